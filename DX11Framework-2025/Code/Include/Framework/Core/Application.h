@@ -8,9 +8,11 @@
 #include"Include/Framework/Core/D3D11System.h"
 #include"Include/Framework/Core/RenderSystem.h"
 #include"Include/Framework/Core/GameLoop.h"
+#include"Include/Framework/Core/FPS.h"
 
 #include<cstdint>
 #include <memory>
+#include <string>
 
 /**	@class	Application
  *	@brief	ゲームシステムの制御
@@ -27,6 +29,10 @@ public:
 		uint32_t screenWidth = 600;		///< 画面横サイズ
 		uint32_t screenHeight = 300;	///< 画面縦サイズ
 		bool isFullScreen = false;		///< フルスクリーンにするのか	[TODO] 使用するようにする
+		std::string physicsRecordPath;	///< 物理ログの出力先（空なら記録しない）
+		std::string inputRecordPath;	///< 入力の記録先（空なら記録しない）
+		std::string inputReplayPath;	///< 再生する入力の記録（空なら実機の入力を使う）
+		uint32_t targetFps = 60;		///< 目標フレームレート（0 なら待たずに計測だけ行う）
 	};
 
 	/** @brief  コンストラクタ
@@ -57,4 +63,5 @@ private:
 	static std::unique_ptr<RenderSystem>   renderSystem;	///< 描画に必要な処理
 
 	static std::unique_ptr<GameLoop>   gameLoop;			///< ゲーム進行の管理
+	static std::unique_ptr<FPS>        fps;				///< フレームレート制御と負荷段階
 };
\ No newline at end of file
@@ -0,0 +1,213 @@
+﻿/** @file   ContentRegistry.h
+ *  @brief  内容ハッシュによるリソース共有（マネージャー・キーをまたいだ重複排除）
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Utils/NonCopyable.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// ContentKey
+//-----------------------------------------------------------------------------
+/** @struct ContentKey
+ *  @brief 内容のハッシュとバイト数の組（バイト数も比べて衝突の可能性を下げる）
+ */
+struct ContentKey
+{
+	uint64_t hash = 0;	///< FNV-1a 64bit
+	uint64_t size = 0;	///< ハッシュしたバイト数
+
+	bool operator==(const ContentKey& _other) const = default;
+};
+
+/** @struct ContentKeyHasher
+ *  @brief unordered_map 用のハッシュ関数
+ */
+struct ContentKeyHasher
+{
+	size_t operator()(const ContentKey& _key) const
+	{
+		return static_cast<size_t>(_key.hash ^ (_key.size * 0x9E3779B97F4A7C15ull));
+	}
+};
+
+//-----------------------------------------------------------------------------
+// ContentHasher
+//-----------------------------------------------------------------------------
+/** @class ContentHasher
+ *  @brief リソースの内容を逐次ハッシュして ContentKey を作る
+ */
+class ContentHasher
+{
+public:
+	/** @brief バイト列を追加する
+	 *  @param _data データ
+	 *  @param _size バイト数
+	 */
+	void Append(const void* _data, size_t _size);
+
+	/** @brief 値をそのままのバイト列として追加する
+	 *  @param _value 追加する値（パディングを含まない型を渡すこと）
+	 */
+	template<typename T>
+	void AppendValue(const T& _value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "AppendValue はトリビアルコピー可能な型のみ");
+		this->Append(&_value, sizeof(T));
+	}
+
+	/** @brief 配列を要素数ごと追加する（要素数も含めるので区切りが曖昧にならない）
+	 *  @param _values 追加する配列
+	 */
+	template<typename T>
+	void AppendVector(const std::vector<T>& _values)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "AppendVector はトリビアルコピー可能な型のみ");
+		this->AppendValue(static_cast<uint64_t>(_values.size()));
+		this->Append(_values.data(), _values.size() * sizeof(T));
+	}
+
+	/** @brief 文字列を長さごと追加する
+	 *  @param _text 追加する文字列
+	 */
+	void AppendString(const std::string& _text);
+
+	/** @brief ここまでの内容のキーを取得
+	 *  @return ContentKey
+	 */
+	ContentKey GetKey() const { return { this->hash, this->size }; }
+
+	/** @brief バイト列のキーを一度に求める
+	 *  @param _data データ
+	 *  @param _size バイト数
+	 *  @return ContentKey
+	 */
+	static ContentKey HashBytes(const void* _data, size_t _size);
+
+private:
+	uint64_t hash = 14695981039346656037ull;	///< FNV-1a オフセット基底
+	uint64_t size = 0;							///< 追加したバイト数
+};
+
+//-----------------------------------------------------------------------------
+// ContentRegistry
+//-----------------------------------------------------------------------------
+/** @class ContentRegistry
+ *  @brief 内容が同じリソースを 1 つの共有インスタンスに解決する型ごとの登録簿
+ *  @details
+ *      - 各マネージャーはキーごとに shared_ptr を持ち、ここは weak_ptr だけを持つ
+ *        （最後の所有者が手放した時点で解放され、登録簿が寿命を延ばすことはない）
+ *      - テクスチャ・メッシュ・クリップを、キーや読み込み元のマネージャーが違っても共有する
+ *      - 生成処理はロックの外で行うので、バックグラウンド読み込みからも呼べる
+ */
+class ContentRegistry : private NonCopyable
+{
+public:
+	/** @struct Stats
+	 *  @brief 型ごとの共有状況
+	 */
+	struct Stats
+	{
+		size_t liveCount = 0;	///< 現在共有されているリソース数
+		size_t hitCount = 0;	///< 既存のリソースに解決できた回数
+		size_t missCount = 0;	///< 新しく生成した回数
+	};
+
+	/** @brief 内容キーに対応するリソースを取得し、無ければ生成して登録する
+	 *  @param _key 内容キー
+	 *  @param _create 生成処理（std::shared_ptr<T> か std::unique_ptr<T> を返す。失敗時 nullptr）
+	 *  @return 共有リソース（生成に失敗した場合 nullptr）
+	 */
+	template<typename T, typename Factory>
+	static std::shared_ptr<T> Acquire(const ContentKey& _key, Factory&& _create)
+	{
+		auto& table = ContentRegistry::tables<T>;
+
+		{
+			std::lock_guard<std::mutex> lock(table.mutex);
+			auto it = table.entries.find(_key);
+			if (it != table.entries.end())
+			{
+				if (auto shared = it->second.lock())
+				{
+					++table.hitCount;
+					return shared;
+				}
+			}
+		}
+
+		std::shared_ptr<T> created = _create();
+		if (!created) { return nullptr; }
+
+		std::lock_guard<std::mutex> lock(table.mutex);
+
+		// 生成中に別スレッドが同じ内容を登録していたらそちらを使う
+		auto& slot = table.entries[_key];
+		if (auto shared = slot.lock())
+		{
+			++table.hitCount;
+			return shared;
+		}
+		slot = created;
+		++table.missCount;
+
+		// 期限切れが溜まったら掃除する（登録数が前回掃除時の 2 倍を超えたとき）
+		if (table.entries.size() > table.purgeThreshold)
+		{
+			std::erase_if(table.entries, [](const auto& _entry) { return _entry.second.expired(); });
+			table.purgeThreshold = std::max<size_t>(MinPurgeThreshold, table.entries.size() * 2);
+		}
+		return created;
+	}
+
+	/** @brief 型ごとの共有状況を取得
+	 *  @return Stats
+	 */
+	template<typename T>
+	static Stats GetStats()
+	{
+		auto& table = ContentRegistry::tables<T>;
+		std::lock_guard<std::mutex> lock(table.mutex);
+
+		Stats stats{};
+		stats.hitCount = table.hitCount;
+		stats.missCount = table.missCount;
+		for (const auto& [key, weak] : table.entries)
+		{
+			if (!weak.expired()) { ++stats.liveCount; }
+		}
+		return stats;
+	}
+
+private:
+	static constexpr size_t MinPurgeThreshold = 64;	///< 掃除を始める登録数の下限
+
+	/** @struct Table
+	 *  @brief 型ごとの登録表
+	 */
+	template<typename T>
+	struct Table
+	{
+		std::mutex mutex;																///< 登録表の保護
+		std::unordered_map<ContentKey, std::weak_ptr<T>, ContentKeyHasher> entries;	///< 内容キー -> リソース
+		size_t purgeThreshold = MinPurgeThreshold;										///< 次に掃除する登録数
+		size_t hitCount = 0;															///< 共有できた回数
+		size_t missCount = 0;															///< 生成した回数
+	};
+
+	template<typename T>
+	inline static Table<T> tables{};	///< 型ごとの登録表
+};
@@ -4,20 +4,61 @@
  */
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Enums / Structs
+//-----------------------------------------------------------------------------
+
+/// @brief フレームの負荷段階（上がるほど省ける処理を省く）
+enum class FrameLoadLevel : uint8_t
+{
+    Normal = 0,     ///< 予算内。全て行う
+    ShedOptional,   ///< 予算超過が続いている。アニメーションの間引き・デバッグ描画を省き、固定ステップの追いつきを広げる
+    Overloaded      ///< 省いても超過している。固定ステップの追いつきを絞り、時間を捨てる
+};
+
+/** @struct FrameTimeStats
+ *  @brief 直近フレームの処理時間の統計（ミリ秒）
+ */
+struct FrameTimeStats
+{
+    double p50Ms = 0.0;         ///< 中央値
+    double p95Ms = 0.0;         ///< 95 パーセンタイル
+    double p99Ms = 0.0;         ///< 99 パーセンタイル
+    double averageMs = 0.0;     ///< 平均
+    double maxMs = 0.0;         ///< 最大
+    size_t sampleCount = 0;     ///< 集計したフレーム数
+};
+
+//-----------------------------------------------------------------------------
+// FPS class
+//-----------------------------------------------------------------------------
 
  /** @class  FPS
-  *  @brief  フレームレート制御クラス（sleep_until方式）
+  *  @brief  フレームレート制御クラス（粗い sleep ＋ 末尾のスピン待ち）
   *  @details
   *          - 絶対時刻方式のため累積誤差が発生しにくい
   *          - 重いフレームで遅れた場合は補正して追いつく
   *          - Tick() 内で自動的にδ時間（ΔTime）を計測する
+  *          - sleep の寝過ごし量を毎回測り、その分だけ手前で起きて残りをスピンで待つ
+  *          - 待ち時間を除いた処理時間で負荷段階を決める（続けて超過したら上げ、十分余裕が続いたら下げる）
   */
 class FPS
 {
 public:
+    static constexpr size_t StatsWindow = 240;              ///< 統計に使う直近フレーム数
+    static constexpr uint32_t RaiseLoadFrames = 30;         ///< 負荷段階を上げるまでの連続超過フレーム数
+    static constexpr uint32_t LowerLoadFrames = 120;        ///< 負荷段階を下げるまでの連続余裕フレーム数
+    static constexpr double OverBudgetRatio = 0.9;          ///< 処理時間がフレーム間隔のこの割合を超えたら超過
+    static constexpr double UnderBudgetRatio = 0.7;         ///< 処理時間がフレーム間隔のこの割合を下回ったら余裕
+
     /** @brief コンストラクタ
-     *  @param _targetFps 目標フレームレート
+     *  @param _targetFps 目標フレームレート（0 なら待たずに計測だけ行う）
      */
     explicit FPS(uint64_t _targetFps);
 
@@ -36,9 +77,60 @@ public:
     /// @brief  FPS値を返す
     float GetFPS()const;
 
+    /// @brief 直近フレームのフレーム時間（待ち込み）の統計
+    [[nodiscard]] FrameTimeStats GetFrameTimeStats() const;
+
+    /// @brief 直近フレームの処理時間（待ちを除く）の統計
+    [[nodiscard]] FrameTimeStats GetWorkTimeStats() const;
+
+    /// @brief 現在の負荷段階
+    [[nodiscard]] FrameLoadLevel GetLoadLevel() const { return this->loadLevel; }
+
+    /// @brief 省ける処理を省くべきか（アニメーションの間引き・デバッグ描画）
+    [[nodiscard]] bool ShouldShedOptionalWork() const { return this->loadLevel != FrameLoadLevel::Normal; }
+
+    /** @brief 負荷段階を固定する（入力の再生で記録時と同じ段階を使う。以後は計測から変えない）
+     *  @param _level 負荷段階
+     */
+    void ForceLoadLevel(FrameLoadLevel _level);
+
+    /// @brief sleep の寝過ごし量の推定値（マイクロ秒）
+    [[nodiscard]] uint64_t OversleepEstimateMicrosec() const;
+
+private:
+    /** @brief 指定時刻まで待つ（粗い sleep の後にスピン）
+     *  @param _target 起きる時刻
+     */
+    void WaitUntil(std::chrono::steady_clock::time_point _target);
+
+    /** @brief フレームの計測値を記録し、負荷段階を更新する
+     *  @param _frame フレーム時間（待ち込み）
+     *  @param _work 処理時間（待ちを除く）
+     */
+    void Record(std::chrono::steady_clock::duration _frame, std::chrono::steady_clock::duration _work);
+
+    /** @brief 記録した値から統計を作る
+     *  @param _samples 記録（ミリ秒）
+     *  @return 統計
+     */
+    FrameTimeStats BuildStats(const std::array<float, StatsWindow>& _samples) const;
+
 private:
-    const std::chrono::steady_clock::duration frameInterval; ///< 1フレームの理想間隔
+    const std::chrono::steady_clock::duration frameInterval; ///< 1フレームの理想間隔（0 なら待たない）
     std::chrono::steady_clock::time_point     nextTime;      ///< 次フレームの理想時刻
     std::chrono::steady_clock::time_point     lastTime;      ///< 前フレーム計測時刻
     uint64_t                                  deltaMicrosec; ///< 実フレーム間隔(μs)
-};
\ No newline at end of file
+
+    std::chrono::steady_clock::duration       oversleepEstimate; ///< sleep の寝過ごし量の推定値
+
+    std::array<float, StatsWindow>            frameSamples;  ///< フレーム時間の記録（ms、リング）
+    std::array<float, StatsWindow>            workSamples;   ///< 処理時間の記録（ms、リング）
+    size_t                                    sampleIndex;   ///< 次に書き込む位置
+    size_t                                    sampleCount;   ///< 記録済みの数
+    mutable std::vector<float>                scratch;       ///< 統計用の作業領域
+
+    FrameLoadLevel                            loadLevel;          ///< 負荷段階
+    uint32_t                                  overBudgetFrames;   ///< 連続超過フレーム数
+    uint32_t                                  underBudgetFrames;  ///< 連続余裕フレーム数
+    bool                                      isLoadLevelForced;  ///< ForceLoadLevel で固定しているか
+};
@@ -0,0 +1,102 @@
+﻿/** @file   FakeInputDevice.h
+ *  @brief  ハードウェアを使わない入力デバイス（テスト・ベンチマーク用）
+ *  @date   2026/10/18
+ */
+#pragma once
+
+ //-----------------------------------------------------------------------------
+ // Includes
+ //-----------------------------------------------------------------------------
+#include "Include/Framework/Core/IInputDevice.h"
+
+#include <bitset>
+
+//-----------------------------------------------------------------------------
+// FakeInputDevice class
+//-----------------------------------------------------------------------------
+
+/** @class  FakeInputDevice
+ *  @brief  コードから押下状態を設定できる入力デバイス
+ *  @details
+ *          - SetPressed で設定した状態は次の Update で反映される（実機のデバイスと同じく 1 フレームに 1 回更新する）
+ *          - 入力コードは DirectInputDevice と同じ 0..CodeCount-1 を想定する（範囲外は押されていない扱い）
+ *          - ウィンドウや DirectInput を必要としないので、ヘッドレスのテストやベンチマークで使える
+ */
+class FakeInputDevice : public IInputDevice
+{
+public:
+	static constexpr int CodeCount = 512;		///< 扱える入力コードの数
+
+	/// @brief コンストラクタ
+	FakeInputDevice();
+
+	/// @brief デストラクタ
+	~FakeInputDevice() override;
+
+	/// @brief 解放処理（全て離した状態に戻す）
+	void Dispose() override;
+
+	/// @brief 入力状態の更新（設定された状態を反映する）
+	void Update() override;
+
+	/** @brief 押下状態の取得
+	 *  @param _code 入力コード
+	 *  @return 押されていれば true
+	 */
+	bool IsPressed(int _code) const override;
+
+	/** @brief トリガー状態の取得
+	 *  @param _code 入力コード
+	 *  @return このフレームで押されたなら true
+	 */
+	bool IsTriggered(int _code) const override;
+
+	/** @brief リリース状態の取得
+	 *  @param _code 入力コード
+	 *  @return このフレームで離されたなら true
+	 */
+	bool IsReleased(int _code) const override;
+
+	/// @brief マウスX座標の取得
+	int GetMouseX() const override { return this->mouseX; }
+
+	/// @brief マウスY座標の取得
+	int GetMouseY() const override { return this->mouseY; }
+
+	/** @brief マウスの移動量（Δ）を取得
+	 *  @param _dx X方向の変化量
+	 *  @param _dy Y方向の変化量
+	 */
+	void GetMouseDelta(int& _dx, int& _dy) const override;
+
+	/** @brief 押下状態を設定する（次の Update で反映）
+	 *  @param _code 入力コード
+	 *  @param _pressed 押されているか
+	 */
+	void SetPressed(int _code, bool _pressed);
+
+	/** @brief マウスの状態を設定する（次の Update で反映）
+	 *  @param _x X座標（-1 でマウス無し扱い）
+	 *  @param _y Y座標
+	 *  @param _dx X方向の変化量
+	 *  @param _dy Y方向の変化量
+	 */
+	void SetMouse(int _x, int _y, int _dx = 0, int _dy = 0);
+
+	/// @brief 全て離した状態を設定する（次の Update で反映）
+	void ReleaseAll();
+
+private:
+	std::bitset<CodeCount> pending;		///< 次の Update で反映する押下状態
+	std::bitset<CodeCount> current;		///< 現在の押下状態
+	std::bitset<CodeCount> previous;	///< 前フレームの押下状態
+
+	int pendingMouseX = -1;		///< 次の Update で反映するマウスX座標
+	int pendingMouseY = -1;		///< 次の Update で反映するマウスY座標
+	int pendingMouseDX = 0;		///< 次の Update で反映するX方向の変化量
+	int pendingMouseDY = 0;		///< 次の Update で反映するY方向の変化量
+	int mouseX = -1;			///< マウスX座標
+	int mouseY = -1;			///< マウスY座標
+	int mouseDX = 0;			///< X方向の変化量
+	int mouseDY = 0;			///< Y方向の変化量
+};
@@ -3,10 +3,13 @@
  */
 #pragma once
 #include <memory>
+#include <string>
 
 #include"Include/Framework/Utils/NonCopyable.h"
+#include"Include/Framework/Utils/AllocationCounter.h"
 
 #include"Include/Framework/Core/InputSystem.h"
+#include"Include/Framework/Core/InputReplayDevice.h"
 #include"Include/Framework/Core/TimeScaleSystem.h"
 #include"Include/Framework/Core/PhysicsSystem.h"
 #include"Include/Framework/Core/EngineServices.h"
@@ -55,8 +58,26 @@ public:
 	/// @brief	ゲームループを抜ける
 	void RequestExit() { this->isRunning = false; }
 
+	/**	@brief	物理ログの出力先を設定する（Initialize の前に呼ぶ。シーンを読み込む前から記録する）
+	 *	@param	const std::string& _path	出力先（空なら記録しない）
+	 */
+	void SetPhysicsRecordPath(const std::string& _path) { this->physicsRecordPath = _path; }
+
+	/**	@brief	入力の記録先を設定する（Initialize の前に呼ぶ）
+	 *	@param	const std::string& _path	記録先（空なら記録しない）
+	 */
+	void SetInputRecordPath(const std::string& _path) { this->inputRecordPath = _path; }
+
+	/**	@brief	再生する入力の記録を設定する（Initialize の前に呼ぶ。実機の入力は使わず、最後まで再生したら終了する）
+	 *	@param	const std::string& _path	再生する記録（空なら再生しない）
+	 */
+	void SetInputReplayPath(const std::string& _path) { this->inputReplayPath = _path; }
+
 private:
 	bool isRunning;			///< ゲームが進行中かどうか
+	std::string physicsRecordPath;	///< 物理ログの出力先（空なら記録しない）
+	std::string inputRecordPath;	///< 入力の記録先（空なら記録しない）
+	std::string inputReplayPath;	///< 再生する入力の記録（空なら再生しない）
 
 	// @enum  ゲームの状態
 	enum class GameState {
@@ -71,9 +92,12 @@ private:
 	std::unique_ptr<TimeScaleSystem> timeScaleSystem;		///< 時間スケールの管理
 	std::unique_ptr<SceneManager> sceneManager;				///< シーン管理
 	std::unique_ptr<InputSystem> inputSystem;				///< 入力の管理
+	InputReplayDevice* inputReplay = nullptr;				///< 入力の再生（再生中のみ。所有は inputSystem）
 	std::unique_ptr<GameObjectManager> gameObjectManager;	///< ゲームオブジェクトの管理
 	std::unique_ptr<Framework::Physics::PhysicsSystem> physicsSystem;			///< 物理システムの管理
 
+	Framework::Memory::FrameAllocationMonitor allocationMonitor;	///< フレームごとのヒープ確保回数の監視
+
 	EngineServices services;									///< リソース関連の参照
 	std::unique_ptr<SpriteManager> spriteManager;				///< 画像データの管理
 	std::unique_ptr<ShaderManager> shaderManager;				///< シェーダーの管理
@@ -19,4 +19,7 @@ public:
 
 	/// @brief 固定ステップ幅（秒）
 	virtual float FixedDelta() const = 0;
+
+	/// @brief 最後の固定ステップから次の固定ステップまでの進み具合（0～1）
+	virtual float FixedAlpha() const = 0;
 };
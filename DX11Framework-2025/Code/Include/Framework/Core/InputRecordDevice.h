@@ -0,0 +1,149 @@
+﻿/** @file   InputRecordDevice.h
+ *  @brief  実機の入力をフレームごとにファイルへ記録する入力デバイス
+ *  @date   2026/10/18
+ */
+#pragma once
+
+ //-----------------------------------------------------------------------------
+ // Includes
+ //-----------------------------------------------------------------------------
+#include "Include/Framework/Core/IInputDevice.h"
+#include "Include/Framework/Core/TimeSystem.h"
+#include "Include/Framework/Core/FPS.h"
+
+#include <bitset>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Input record format
+//-----------------------------------------------------------------------------
+inline constexpr uint32_t InputRecordMagic = 0x43455249;		///< "IREC"
+inline constexpr uint32_t InputRecordVersion = 1;				///< 記録のバージョン
+inline constexpr char InputRecordExtension[] = ".irec";			///< 保存ファイルの拡張子
+inline constexpr int InputRecordCodeCount = 512;				///< 記録する入力コードの数（0..511。キーボードとマウスボタン）
+
+/** @struct InputRecordHeader
+ *  @brief 記録のヘッダ
+ */
+struct InputRecordHeader
+{
+	uint32_t magic = InputRecordMagic;			///< 識別子
+	uint32_t version = InputRecordVersion;		///< バージョン
+	uint32_t codeCount = InputRecordCodeCount;	///< 記録した入力コードの数
+	float fixedDelta = 0.0f;					///< 記録時の固定ステップ幅（再生時に違えば警告する）
+};
+
+static_assert(sizeof(InputRecordHeader) == 16);
+
+/** @struct InputFrameRecord
+ *  @brief 1 フレーム分の記録の先頭（この後に可変長の内容が続く）
+ */
+struct InputFrameRecord
+{
+	/// @brief 後に続く内容（flags のビット）
+	enum Flags : uint8_t
+	{
+		MousePosition = 1 << 0,		///< int32 x, y が続く（前フレームから変わったときだけ）
+		MouseDelta = 1 << 1,		///< int32 dx, dy が続く（0 でないときだけ）
+	};
+
+	float rawDelta = 0.0f;			///< このフレームの rawDeltaTime（TimeSystem::TickRawDelta の結果）
+	uint8_t loadLevel = 0;			///< このフレームの負荷段階（FrameLoadLevel。追いつき上限とアニメーションの間引きが決まる）
+	uint8_t flags = 0;				///< Flags の組み合わせ
+	uint16_t changedCount = 0;		///< 押下状態が変わった入力コードの数（uint16 のコードが続く）
+};
+
+static_assert(sizeof(InputFrameRecord) == 8);
+
+//-----------------------------------------------------------------------------
+// InputRecordDevice class
+//-----------------------------------------------------------------------------
+
+/** @class  InputRecordDevice
+ *  @brief  他のデバイスの入力をそのまま使いつつ、フレームごとの状態を書き出す
+ *  @details
+ *          - 問い合わせは包んだデバイスにそのまま渡すので、記録中も普段通りに遊べる
+ *          - 記録するのは押下状態が変わった入力コードとマウスの変化、TimeSystem の経過時間、FPS の負荷段階
+ *            （何も操作していないフレームは 8 バイト）
+ *          - Update は TimeSystem::TickRawDelta の後に呼ぶこと（GameLoop::Update の順番通り）
+ *          - InputReplayDevice で再生すると、同じ入力と経過時間でゲームを進められる
+ *
+ *  記録のレイアウト（リトルエンディアン）
+ *      InputRecordHeader
+ *      (InputFrameRecord, [マウス座標], [マウス移動量], 入力コード × changedCount) × フレーム数（ファイルの終わりまで）
+ */
+class InputRecordDevice : public IInputDevice
+{
+public:
+	/** @brief コンストラクタ
+	 *  @param _source 実際に入力を取るデバイス（所有権を受け取る）
+	 *  @param _timeSystem 経過時間を記録する TimeSystem
+	 *  @param _fps 負荷段階を記録する FPS
+	 */
+	InputRecordDevice(std::unique_ptr<IInputDevice> _source, const TimeSystem& _timeSystem, const FPS& _fps);
+
+	/// @brief デストラクタ（記録中なら閉じる）
+	~InputRecordDevice() override;
+
+	/** @brief 記録を開始する（ヘッダを書き出す）
+	 *  @param _path 出力先
+	 *  @return 開けなければ false
+	 */
+	bool Begin(const std::string& _path);
+
+	/// @brief 記録を終えてファイルを閉じる
+	void End();
+
+	/// @brief 記録中か
+	[[nodiscard]] bool IsRecording() const { return this->file.is_open(); }
+
+	/// @brief 記録したフレーム数
+	[[nodiscard]] uint64_t GetFrameCount() const { return this->frameCount; }
+
+	/// @brief 解放処理（記録を閉じ、包んだデバイスも解放する）
+	void Dispose() override;
+
+	/// @brief 入力状態の更新（包んだデバイスを更新し、1 フレーム分を書き出す）
+	void Update() override;
+
+	/// @brief 押下状態の取得
+	bool IsPressed(int _code) const override { return this->source->IsPressed(_code); }
+
+	/// @brief トリガー状態の取得
+	bool IsTriggered(int _code) const override { return this->source->IsTriggered(_code); }
+
+	/// @brief リリース状態の取得
+	bool IsReleased(int _code) const override { return this->source->IsReleased(_code); }
+
+	/// @brief マウスX座標の取得
+	int GetMouseX() const override { return this->source->GetMouseX(); }
+
+	/// @brief マウスY座標の取得
+	int GetMouseY() const override { return this->source->GetMouseY(); }
+
+	/// @brief マウスの移動量（Δ）を取得
+	void GetMouseDelta(int& _dx, int& _dy) const override { this->source->GetMouseDelta(_dx, _dy); }
+
+	/// @brief 振動の制御
+	void SetVibration(const MotorForce& _force) override { this->source->SetVibration(_force); }
+
+private:
+	/// @brief 1 フレーム分を書き出す
+	void WriteFrame();
+
+private:
+	std::unique_ptr<IInputDevice> source;		///< 実際に入力を取るデバイス
+	const TimeSystem& timeSystem;				///< 経過時間の取得元
+	const FPS& fps;								///< 負荷段階の取得元
+
+	std::ofstream file;							///< 出力先
+	std::bitset<InputRecordCodeCount> pressed;	///< 前フレームまでに書き出した押下状態
+	int mouseX;									///< 前フレームまでに書き出したマウスX座標
+	int mouseY;									///< 前フレームまでに書き出したマウスY座標
+	std::vector<uint8_t> frameBuffer;			///< 1 フレーム分の書き出し用（使い回す）
+	uint64_t frameCount;						///< 記録したフレーム数
+};
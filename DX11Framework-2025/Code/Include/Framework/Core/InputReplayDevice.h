@@ -0,0 +1,91 @@
+﻿/** @file   InputReplayDevice.h
+ *  @brief  InputRecordDevice の記録を再生する入力デバイス
+ *  @date   2026/10/18
+ */
+#pragma once
+
+ //-----------------------------------------------------------------------------
+ // Includes
+ //-----------------------------------------------------------------------------
+#include "Include/Framework/Core/FakeInputDevice.h"
+#include "Include/Framework/Core/InputRecordDevice.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+static_assert(FakeInputDevice::CodeCount >= InputRecordCodeCount, "記録した入力コードを全て再生できません。");
+
+//-----------------------------------------------------------------------------
+// InputReplayDevice class
+//-----------------------------------------------------------------------------
+
+/** @class  InputReplayDevice
+ *  @brief  記録した入力を 1 フレームずつ再生する
+ *  @details
+ *          - 記録は Open でまとめて読み込み、最後まで壊れていないか確かめてから再生する
+ *          - GameLoop は Update の前に PeekNextTiming で記録時の経過時間と負荷段階を取り、TimeSystem と FPS に渡す
+ *            （フレームレートや負荷に関係なく、記録時と同じ固定ステップ数・アニメーションの間引きでゲームが進む）
+ *          - 実機のデバイスを使わないので、ウィンドウのフォーカスや DirectInput に左右されない
+ *          - 最後まで再生したら IsFinished が true になり、以後は全て離した状態になる
+ */
+class InputReplayDevice : public FakeInputDevice
+{
+public:
+	/** @struct FrameTiming
+	 *  @brief 記録時の 1 フレームの時間
+	 */
+	struct FrameTiming
+	{
+		float rawDelta = 0.0f;			///< rawDeltaTime（秒）
+		FrameLoadLevel loadLevel = FrameLoadLevel::Normal;	///< 負荷段階
+	};
+
+	/// @brief コンストラクタ
+	InputReplayDevice();
+
+	/// @brief デストラクタ
+	~InputReplayDevice() override;
+
+	/** @brief 記録を読み込む
+	 *  @param _path 読み込むファイル
+	 *  @param _fixedDelta 再生側の固定ステップ幅（記録時と違えば警告する）
+	 *  @return 読み込めれば true（途中で切れている場合は読めたフレームまで再生する）
+	 */
+	bool Open(const std::string& _path, float _fixedDelta);
+
+	/** @brief 次の Update で再生するフレームの時間を取得する
+	 *  @param _outTiming 取得先
+	 *  @return 再生するフレームが残っていなければ false
+	 */
+	[[nodiscard]] bool PeekNextTiming(FrameTiming& _outTiming) const;
+
+	/// @brief 最後まで再生したか
+	[[nodiscard]] bool IsFinished() const { return this->frameIndex >= this->frameCount; }
+
+	/// @brief 再生したフレーム数
+	[[nodiscard]] uint64_t GetPlayedFrameCount() const { return this->frameIndex; }
+
+	/// @brief 記録のフレーム数
+	[[nodiscard]] uint64_t GetFrameCount() const { return this->frameCount; }
+
+	/// @brief 再生結果（フレーム数と実時間）をログに出す
+	void Report() const;
+
+	/// @brief 解放処理
+	void Dispose() override;
+
+	/// @brief 入力状態の更新（1 フレーム分を反映する）
+	void Update() override;
+
+private:
+	std::vector<uint8_t> data;			///< 記録（ヘッダを除く）
+	size_t readOffset;					///< 次のフレームの位置
+	uint64_t frameIndex;				///< 次に再生するフレーム
+	uint64_t frameCount;				///< 記録のフレーム数（壊れていない範囲）
+	int mouseX;							///< 再生中のマウスX座標
+	int mouseY;							///< 再生中のマウスY座標
+
+	std::chrono::steady_clock::time_point startTime;	///< 最初のフレームを再生した時刻
+};
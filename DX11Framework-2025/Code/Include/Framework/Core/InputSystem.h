@@ -5,11 +5,65 @@
 #include"Include/Framework/Utils/NonCopyable.h"
 #include"Include/Framework/Core/IInputDevice.h"
 
+#include<cstdint>
 #include<string>
+#include<string_view>
 #include<memory>
 #include<unordered_map>
 #include<vector>
 
+/// @brief	アクションの番号（登録順に 0 から振られる）
+using InputActionId = uint32_t;
+
+/// @brief	未登録のアクション
+inline constexpr InputActionId InvalidInputActionId = UINT32_MAX;
+
+/** @class	InputActionName
+ *	@brief	アクション名とそのハッシュ
+ *	@details
+ *  - 文字列リテラルからはコンパイル時にハッシュを求める（IsActionPressed("Jump") の呼び出しで文字列を作らない）
+ *  - 実行時に組み立てた名前は明示的に InputActionName(name) と書く
+ */
+class InputActionName
+{
+public:
+	/**	@brief	文字列リテラルから作る（コンパイル時に評価する）
+	 *	@param	const char (&_name)[N]	アクション名
+	 */
+	template<size_t N>
+	consteval InputActionName(const char (&_name)[N]) : name(_name, N - 1), hash(Hash(std::string_view(_name, N - 1))) {}
+
+	/**	@brief	実行時の文字列から作る
+	 *	@param	std::string_view _name	アクション名（呼び出しの間だけ参照する）
+	 */
+	explicit InputActionName(std::string_view _name) : name(_name), hash(Hash(_name)) {}
+
+	/**	@brief	名前のハッシュ（FNV-1a 32bit）を求める
+	 *	@param	std::string_view _name	アクション名
+	 *	@return	uint32_t
+	 */
+	static constexpr uint32_t Hash(std::string_view _name)
+	{
+		uint32_t value = 2166136261u;
+		for (char c : _name)
+		{
+			value ^= static_cast<uint8_t>(c);
+			value *= 16777619u;
+		}
+		return value;
+	}
+
+	/// @brief	アクション名
+	[[nodiscard]] constexpr std::string_view Name() const { return this->name; }
+
+	/// @brief	ハッシュ
+	[[nodiscard]] constexpr uint32_t GetHash() const { return this->hash; }
+
+private:
+	std::string_view name;	///< アクション名
+	uint32_t hash;			///< 名前のハッシュ
+};
+
 /** @class	InputSystem
  *	@brief	入力管理を行う
  *	@details
@@ -24,12 +78,25 @@ public:
 	/// @brief	リソースの解放処理
 	void Dispose();
 
-	/**@struct	KeyBinding
-	 *	@brief	キーバインドを定義する構造体
+	/**@struct	ActionSnapshot
+	 *	@brief	フレームごとのアクションの状態（Update で 1 回だけ求める。1 アクション 1 ビット）
 	 */
-	struct KeyBinding {
-		int keyCode;             ///< キー、ボタンID
-		std::string actionName;  ///< キーアクション名
+	struct ActionSnapshot
+	{
+		std::vector<uint64_t> pressed;		///< 押されている
+		std::vector<uint64_t> triggered;	///< このフレームで押された
+		std::vector<uint64_t> released;		///< このフレームで離された
+
+		/**	@brief	ビットを調べる
+		 *	@param	const std::vector<uint64_t>& _bits	調べる配列
+		 *	@param	InputActionId _id					アクション番号
+		 *	@return	bool
+		 */
+		static bool Test(const std::vector<uint64_t>& _bits, InputActionId _id)
+		{
+			const size_t word = _id / 64;
+			return word < _bits.size() && ((_bits[word] >> (_id % 64)) & 1) != 0;
+		}
 	};
 	
 	/**	@brief	デバイスの登録
@@ -37,32 +104,68 @@ public:
 	 */
 	void RegisterDevice(std::unique_ptr<IInputDevice> _device);
 
-	/**	@brief	キーバインドの登録
-	 *	@param	const std::string& _action アクション名
+	/**	@brief	アクションの登録（キーは RegisterKeyBinding で割り当てる）
+	 *	@param	InputActionName _action	アクション名
+	 *	@return	InputActionId	アクション番号（登録済みなら既存の番号。ハッシュが衝突したら InvalidInputActionId）
+	 */
+	InputActionId RegisterAction(InputActionName _action);
+
+	/**	@brief	キーバインドの登録（1 つのアクションに複数のキーを割り当てられる）
+	 *	@param	InputActionName _action アクション名
 	 *	@param	int _keyCode	キーボタンの入力コード
+	 *	@return	InputActionId	アクション番号（毎フレームの問い合わせにはこちらを使う）
+	 */
+	InputActionId RegisterKeyBinding(InputActionName _action, int _keyCode);
+
+	/**	@brief	アクション番号を取得する
+	 *	@param	InputActionName _action	アクション名
+	 *	@return	InputActionId	未登録なら InvalidInputActionId
 	 */
-	void RegisterKeyBinding(const std::string& _action, int _keyCode);
+	[[nodiscard]] InputActionId GetActionId(InputActionName _action) const;
 
-	/// @brief	入力デバイスの更新
+	/// @brief	入力デバイスの更新（全アクションの状態をここで 1 回だけ求める）
 	void Update();
 
 	/**	@brief	アクションに対応したキー、ボタンが押された状態か取得する
-	 *	@param	const std::string& _action	キーアクション名（例: "Jump"）
+	 *	@param	InputActionId _action	アクション番号
 	 *  @return bool いずれかのデバイスで押されていれば true
 	 */
-	bool IsActionPressed(const std::string& _action) const;
+	bool IsActionPressed(InputActionId _action) const { return ActionSnapshot::Test(this->snapshot.pressed, _action); }
 
 	/**	@brief	アクションに対応したキー、ボタンがトリガー状態か取得する
-	 *	@param	const std::string& _action	キーアクション
+	 *	@param	InputActionId _action	アクション番号
 	 * @return bool 前フレームから押された瞬間であれば true
 	 */
-	bool IsActionTriggered(const std::string& _action) const;
+	bool IsActionTriggered(InputActionId _action) const { return ActionSnapshot::Test(this->snapshot.triggered, _action); }
 
 	/**	@brief	アクションに対応したキー、ボタンがリリース状態か取得する
-	 *	@param	const std::string& _action	キーアクション
+	 *	@param	InputActionId _action	アクション番号
 	 * @return bool 前フレームから離された瞬間であれば true
 	 */
-	bool isActionReleased(const std::string& _action) const;
+	bool isActionReleased(InputActionId _action) const { return ActionSnapshot::Test(this->snapshot.released, _action); }
+
+	/**	@brief	アクションに対応したキー、ボタンが押された状態か取得する
+	 *	@param	InputActionName _action	キーアクション名（例: "Jump"）
+	 *  @return bool いずれかのデバイスで押されていれば true
+	 */
+	bool IsActionPressed(InputActionName _action) const { return this->IsActionPressed(this->GetActionId(_action)); }
+
+	/**	@brief	アクションに対応したキー、ボタンがトリガー状態か取得する
+	 *	@param	InputActionName _action	キーアクション
+	 * @return bool 前フレームから押された瞬間であれば true
+	 */
+	bool IsActionTriggered(InputActionName _action) const { return this->IsActionTriggered(this->GetActionId(_action)); }
+
+	/**	@brief	アクションに対応したキー、ボタンがリリース状態か取得する
+	 *	@param	InputActionName _action	キーアクション
+	 * @return bool 前フレームから離された瞬間であれば true
+	 */
+	bool isActionReleased(InputActionName _action) const { return this->isActionReleased(this->GetActionId(_action)); }
+
+	/**	@brief	このフレームのアクションの状態を取得する
+	 *	@return	const ActionSnapshot&
+	 */
+	[[nodiscard]] const ActionSnapshot& GetActionSnapshot() const { return this->snapshot; }
 
 	/** @brief マウスの現在座標を取得
 	 *  @param int& _x X座標
@@ -79,6 +182,24 @@ public:
 	bool GetMouseDelta(int& _dx, int& _dy) const;
 
 private:
-	std::vector<std::unique_ptr<IInputDevice>> devices;	///< 入力デバイスのリスト
-	std::unordered_map<std::string, int> keyMap;		///< アクションに対応したキーマップ
+	/**@struct	ActionEntry
+	 *	@brief	登録されたアクション 1 つ分
+	 */
+	struct ActionEntry
+	{
+		std::string name;			///< アクション名（ハッシュ衝突の確認用）
+		std::vector<int> keyCodes;	///< 割り当てられたキー、ボタン
+	};
+
+	/**	@brief	アクションに割り当てたキーのどれかが押されているか
+	 *	@param	const ActionEntry& _action	アクション
+	 *	@return	bool	いずれかのデバイスで押されていれば true
+	 */
+	bool IsAnyKeyPressed(const ActionEntry& _action) const;
+
+private:
+	std::vector<std::unique_ptr<IInputDevice>> devices;			///< 入力デバイスのリスト
+	std::vector<ActionEntry> actions;							///< アクション（添字がアクション番号）
+	std::unordered_map<uint32_t, InputActionId> actionIds;		///< 名前のハッシュからアクション番号を引く
+	ActionSnapshot snapshot;									///< このフレームのアクションの状態
 };
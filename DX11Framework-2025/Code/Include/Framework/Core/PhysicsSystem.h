@@ -6,12 +6,22 @@
 
 #include <memory>	
 #include <array>
-#include <unordered_set>
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <unordered_map>
 #include <mutex>
+#include <vector>
 
 #include "Include/Framework/Physics/PhysicsLayers.h"
 #include "Include/Framework/Physics/PhysicsContactListener.h"
+#include "Include/Framework/Physics/ContactPairTable.h"
+#if !defined(FRAMEWORK_PHYSICS_HEADLESS)
+#include "Include/Framework/Physics/PhysicsQuery.h"
+#endif
+#include "Include/Framework/Physics/PhysicsTelemetry.h"
+#include "Include/Framework/Physics/PhysicsRecorder.h"
 
 #include <Jolt/Jolt.h>
 #include <Jolt/Core/JobSystemThreadPool.h>
@@ -40,34 +50,22 @@ namespace Framework::Physics
 		Max
 	};
 
-	/// @brief コライダー識別キー
-	struct ColliderKey
-	{
-		JPH::BodyID bodyID;
-		int colliderID;
-
-		bool operator==(const ColliderKey& other) const noexcept
-		{
-			return bodyID == other.bodyID && colliderID == other.colliderID;
-		}
-	};
-
-	/// @brief コライダー識別キーのハッシュ関数
-	struct ColliderKeyHash
+	/** @struct BodyRecord
+	 *  @brief Body ごとの関連情報（BodyID::GetIndex() で直接引く）
+	 *  @details Body 生成時に登録し、接触イベントの配送ではハッシュ表も Body ロックも使わずに済ませる
+	 */
+	struct BodyRecord
 	{
-		std::size_t operator()(const ColliderKey& _key) const noexcept
-		{
-			// BodyID と SubShapeID の値を混ぜる
-			// BodyID は GetIndex と GetSequenceNumber の組み合わせで安定させる
-			std::size_t h1 = std::hash<JPH::uint32>()(_key.bodyID.GetIndex()) ^ (std::hash<JPH::uint32>()(_key.bodyID.GetSequenceNumber()) << 1);
-			std::size_t h2 = std::hash<int>()(_key.colliderID);
-
-			return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6) + (h1 >> 2));
-		}
+		JPH::BodyID bodyID;							///< 登録中の BodyID（無効値なら空き）
+		Rigidbody3D* rigidbody = nullptr;			///< 所有する Rigidbody3D（接触リスナーの一覧を持つ）
+		Collider3DComponent* collider = nullptr;	///< 対応するコライダー
+		bool isSensor = false;						///< センサー（トリガー）か
 	};
 
 	/** @class  PhysicsSystem
 	 *  @brief  JoltPhysics の初期化・更新・破棄を行うシステム
+	 *  @details FRAMEWORK_PHYSICS_HEADLESS を定義すると PhysicsQuery とコンポーネントへの接触配送を外し、
+	 *           DirectX を使わず Jolt だけでビルドできる（PhysicsReplayMain.cpp のヘッドレス再生用）
 	 */
 	class PhysicsSystem
 	{
@@ -79,9 +77,10 @@ namespace Framework::Physics
 		~PhysicsSystem();
 
 		/** @brief 初期化処理
+		 *  @param _config 容量設定
 		 *  @return 初期化に成功したら true
 		 */
-		bool Initialize();
+		bool Initialize(const PhysicsConfig& _config = {});
 
 		/** @brief 物理シミュレーションを進める
 		 *  @param _deltaTime 経過時間
@@ -109,6 +108,48 @@ namespace Framework::Physics
 		 */
 		[[nodiscard]] const JPH::NarrowPhaseQuery& GetNarrowPhaseQuery() const;
 
+		/** @brief ロックを取らない NarrowPhaseQuery を取得
+		 *  @details 物理更新中でなく、Body の追加・移動も行われていない間だけ使うこと（並列クエリ用）
+		 *  @return NarrowPhaseQuery の参照
+		 */
+		[[nodiscard]] const JPH::NarrowPhaseQuery& GetNarrowPhaseQueryNoLock() const;
+
+		/** @brief ロックを取らない剛体ロック用インターフェースを取得
+		 *  @return 剛体ロックインターフェースの参照
+		 */
+		[[nodiscard]] const JPH::BodyLockInterface& GetBodyLockInterfaceNoLock() const;
+
+		/** @brief 物理更新に使うジョブシステムを取得（他システムの並列処理にも使う）
+		 *  @return ジョブシステム（未初期化なら nullptr）
+		 */
+		[[nodiscard]] JPH::JobSystem* GetJobSystem() const { return this->jobSystem.get(); }
+
+		/** @brief 範囲をジョブに分けて並列に処理し、全て終わるまで待つ
+		 *  @details 呼び出しスレッドもジョブを実行する。ジョブの中から呼ばないこと
+		 *  @param _name ジョブ名（プロファイラ表示用）
+		 *  @param _count 要素数
+		 *  @param _minPerJob 1 ジョブに詰める最小要素数
+		 *  @param _function 範囲 [begin, end) を処理する関数
+		 */
+		void ParallelFor(const char* _name, size_t _count, size_t _minPerJob, const std::function<void(size_t, size_t)>& _function);
+
+#if !defined(FRAMEWORK_PHYSICS_HEADLESS)
+		/** @brief 空間クエリ（レイ・オーバーラップ・ShapeCast の一括実行と遅延実行）を取得
+		 *  @return PhysicsQuery の参照
+		 */
+		[[nodiscard]] PhysicsQuery& GetQuery() { return this->query; }
+#endif
+
+		/** @brief 初期化時の容量設定を取得
+		 *  @return PhysicsConfig の参照
+		 */
+		[[nodiscard]] const PhysicsConfig& GetConfig() const { return this->config; }
+
+		/** @brief 直近ステップの使用量と処理時間を取得
+		 *  @return PhysicsStats の参照
+		 */
+		[[nodiscard]] const PhysicsStats& GetStats() const { return this->telemetry.GetStats(); }
+
 		/** @brief ShapeCast 用 BroadPhaseLayerFilter を取得
 		 *  @param _layer 自身の ObjectLayer
 		 *  @return BroadPhaseLayerFilter への参照
@@ -122,10 +163,11 @@ namespace Framework::Physics
 		[[nodiscard]] const JPH::ObjectLayerFilter& GetObjectLayerFilter(JPH::ObjectLayer _layer) const;
 
 		/** @brief 接触した剛体ペアを追加
+		 *  @details Jolt のワーカースレッドから呼ばれる。ロックは取らずスレッドごとのバッファに追記する
 		 *  @param _bodyA       ぶつかった剛体A
 		 *  @param _bodyB       ぶつかった剛体B
 		 */
-		void AddContactPair(ColliderKey _bodyA, ColliderKey _bodyB);
+		void AddContactPair(JPH::BodyID _bodyA, JPH::BodyID _bodyB);
 
 		/// @brief 接触イベントを処理する
 		void ProcessContactEvents();
@@ -135,7 +177,7 @@ namespace Framework::Physics
 		 *  @param _bodyA  剛体Aの BodyID
 		 *  @param _bodyB  剛体Bの BodyID
 		 */
-		void HandleContact(ContactType _type, ColliderKey _bodyA, ColliderKey _bodyB);
+		void HandleContact(ContactType _type, JPH::BodyID _bodyA, JPH::BodyID _bodyB);
 
 		/** @brief BodyID がセンサーボディかどうか調べる
 		 *  @param _id 調べる BodyID
@@ -154,16 +196,116 @@ namespace Framework::Physics
 		 */
 		[[nodiscard]] bool IsBodyValid(JPH::BodyID _body);
 
-		/** @brief BodyID と Rigidbody3D の関連付けを登録する
-		 *  @param _bodyID  登録する BodyID
-		 *  @param _rigidbody 関連付ける Rigidbody3D
+		/** @brief Body の関連情報を登録する（Body 生成時に呼ぶ）
+		 *  @param _bodyID    登録する BodyID
+		 *  @param _rigidbody 所有する Rigidbody3D
+		 *  @param _collider  対応するコライダー（ColliderID も登録する）
+		 *  @param _isSensor  センサーボディか
+		 */
+		void RegisterBody(JPH::BodyID _bodyID, Rigidbody3D* _rigidbody, Collider3DComponent* _collider, bool _isSensor);
+
+		/** @brief Body をワールドに追加する
+		 *  @details 一括追加中（BeginBodyBatch ～ EndBodyBatch）は EndBodyBatch までまとめて保留する
+		 *  @param _bodyID 追加する BodyID
+		 *  @param _activation 追加時に起こすか
+		 */
+		void AddBody(JPH::BodyID _bodyID, JPH::EActivation _activation);
+
+		/** @brief Body をワールドから取り除く（一括追加で保留中なら保留を取り消す）
+		 *  @param _bodyID 取り除く BodyID
+		 */
+		void RemoveBody(JPH::BodyID _bodyID);
+
+		/** @brief Body の一括追加を開始する（シーン読み込みの前に呼ぶ。入れ子にできる）
+		 *  @details 保留中の Body はクエリにも接触にも現れないので、物理更新をまたがないこと
+		 */
+		void BeginBodyBatch();
+
+		/** @brief 保留した Body を AddBodiesPrepare / AddBodiesFinalize でまとめて追加し、BroadPhase を最適化する
+		 *  @details 入れ子の場合は最も外側の呼び出しで追加する
+		 */
+		void EndBodyBatch();
+
+		/// @brief BroadPhase の木を作り直す（大量の Body を追加した後に呼ぶ。物理更新中は呼ばないこと）
+		void OptimizeBroadPhase();
+
+		//-----------------------------------------------------------------------------
+		// Body の操作（記録中はログにも残すので、BodyInterface を直接呼ばずにこちらを通す）
+		//-----------------------------------------------------------------------------
+
+		/** @brief Body を生成する（ワールドへの追加は AddBody で行う）
+		 *  @param _settings 生成設定
+		 *  @return 生成した Body（上限に達したら nullptr）
 		 */
-		void RegisterRigidbody3D(JPH::BodyID _bodyID, Rigidbody3D* _rigidbody);
+		JPH::Body* CreateBody(const JPH::BodyCreationSettings& _settings);
 
-		/** @brief BodyID と Rigidbody3D の関連付けを解除する
+		/** @brief Body を破棄する（先に RemoveBody しておくこと）
+		 *  @param _bodyID 破棄する BodyID
+		 */
+		void DestroyBody(JPH::BodyID _bodyID);
+
+		/** @brief Kinematic Body を次のステップで目標姿勢に届くよう動かす
+		 *  @param _bodyID 対象の BodyID
+		 *  @param _position 目標位置（COM）
+		 *  @param _rotation 目標回転
+		 *  @param _deltaTime ステップ幅
+		 */
+		void MoveKinematic(JPH::BodyID _bodyID, JPH::RVec3Arg _position, JPH::QuatArg _rotation, float _deltaTime);
+
+		/** @brief MotionType を変更する
+		 *  @param _bodyID 対象の BodyID
+		 *  @param _motionType 動作モード
+		 *  @param _activation 変更後に起こすか
+		 */
+		void SetMotionType(JPH::BodyID _bodyID, JPH::EMotionType _motionType, JPH::EActivation _activation);
+
+		/** @brief MotionQuality を変更する
+		 *  @param _bodyID 対象の BodyID
+		 *  @param _motionQuality 衝突判定の精度
+		 */
+		void SetMotionQuality(JPH::BodyID _bodyID, JPH::EMotionQuality _motionQuality);
+
+		/** @brief ObjectLayer を変更する
+		 *  @param _bodyID 対象の BodyID
+		 *  @param _layer 設定するレイヤー
+		 */
+		void SetObjectLayer(JPH::BodyID _bodyID, JPH::ObjectLayer _layer);
+
+		//-----------------------------------------------------------------------------
+		// 記録と再生
+		//-----------------------------------------------------------------------------
+
+		/** @brief Body の操作と固定ステップの記録を開始する
+		 *  @details 既にある Body はその時点の姿勢・速度で生成し直したものとして書き出す
+		 *           （ハッシュまで一致させたい場合は、シーンを読み込む前に開始すること）
+		 *  @param _path 出力先
+		 *  @return 開始できたら true
+		 */
+		bool StartRecording(const std::string& _path);
+
+		/// @brief 記録を終了してファイルを閉じる
+		void StopRecording();
+
+		/// @brief 記録中か
+		[[nodiscard]] bool IsRecording() const { return this->recorder.IsRecording(); }
+
+		/** @brief 全 Body の姿勢・速度と今ステップの接触ペアから状態ハッシュを求める
+		 *  @details Step の直後（ProcessContactEvents の前）に呼ぶ。記録時と再生時の比較に使う
+		 *  @return 状態ハッシュ
+		 */
+		[[nodiscard]] uint64_t ComputeStateHash() const;
+
+		/** @brief Body の関連情報を解除する（Body 破棄前に呼ぶ）
+		 *  @details Body の破棄通知を兼ね、この Body を含む接触ペアを次の ProcessContactEvents で取り除く
 		 *  @param _bodyID 解除する BodyID
 		 */
-		void UnregisterRigidbody3D(JPH::BodyID _bodyID);
+		void UnregisterBody(JPH::BodyID _bodyID);
+
+		/** @brief BodyID から関連情報を取得する
+		 *  @param _bodyID 取得する BodyID
+		 *  @return 登録されていなければ nullptr（破棄済み BodyID の再利用も世代番号で弾く）
+		 */
+		[[nodiscard]] const BodyRecord* FindBodyRecord(JPH::BodyID _bodyID) const;
 
 		/** @brief BodyID から Rigidbody3D を取得する
 		 *  @param _bodyID 取得する BodyID
@@ -177,17 +319,6 @@ namespace Framework::Physics
 		 */
 		int AssignColliderID(Collider3DComponent* _collider);
 
-		/** @brief BodyID と Collider3DComponent の関連付けを登録する
-		 *  @param _bodyID  登録する BodyID
-		 *  @param _collider 関連付けるコライダー
-		 */
-		void RegisterCollider3D(JPH::BodyID _bodyID, Collider3DComponent* _collider);
-
-		/** @brief BodyID と Collider3DComponent の関連付けを解除する
-		 *  @param _bodyID 解除する BodyID
-		 */
-		void UnregisterCollider3D(JPH::BodyID _bodyID);
-
 		/** @brief ColliderID から Collider3DComponent を取得する
 		 *  @param _colliderID 取得する ColliderID
 		 *  @return 対応する Collider3DComponent（存在しない場合は nullptr）
@@ -211,11 +342,33 @@ namespace Framework::Physics
 		/// @brief ShapeCast 用のフィルタ群を初期化する
 		void InitializeShapeCastFilters();
 
+		/** @brief 起きている Body が BroadPhase で重なっている Body ペア数を数える（Step 後に呼ぶ）
+		 *  @return Body ペア数（Jolt はこの数だけ Body ペアキャッシュを使う）
+		 */
+		uint32_t CountBodyPairs();
+
+		/// @brief スレッドごとの接触ペア追記バッファ
+		struct ContactBuffer
+		{
+			std::vector<ContactPairKey> pairs;	///< 追記された接触ペア（重複あり）
+		};
+
+		/** @brief 呼び出しスレッド用の接触バッファを取得（初回だけ登録でロックを取る）
+		 *  @return 接触バッファ
+		 */
+		ContactBuffer& GetThreadContactBuffer();
+
+		/// @brief スレッドごとのバッファを接触ペア表へまとめる（Step 後に呼ぶ）
+		void MergeContactBuffers();
+
 	private:
 		// 基本リソース
-		std::unique_ptr<JPH::TempAllocatorImpl>		tempAllocator;	///< 一時アロケータ
+		std::unique_ptr<TrackingTempAllocator>		tempAllocator;	///< 一時アロケータ（最大使用量を記録する）
 		std::unique_ptr<JPH::JobSystemThreadPool>	jobSystem;		///< ジョブシステム
 		std::unique_ptr<JPH::PhysicsSystem>			physics;		///< 物理システム
+		PhysicsConfig								config;			///< 容量設定
+		PhysicsTelemetry							telemetry;		///< 使用量・処理時間の計測
+		PhysicsRecorder								recorder;		///< Body の操作と固定ステップの記録
 
 		// レイヤー / 衝突フィルタ共通
 		BPLayerInterfaceImpl					bpLayerInterface;			///< BroadPhaseLayer インターフェース
@@ -227,16 +380,27 @@ namespace Framework::Physics
 		std::array<std::unique_ptr<JPH::ObjectLayerFilter>, Framework::Physics::PhysicsLayer::NUM_LAYERS>		shapeCastObjectFilters;	///< ShapeCast 用 ObjectLayerFilter
 
 		// 衝突検知
-		std::unordered_map<ColliderKey, std::unordered_set<ColliderKey, ColliderKeyHash>, ColliderKeyHash>	currContact;		///< 今フレームの接触情報
-		std::unordered_map<ColliderKey, std::unordered_set<ColliderKey, ColliderKeyHash>, ColliderKeyHash>	prevContact;		///< 前フレームの接触情報
-		PhysicsContactListener												contactListener;	///< コンタクトリスナー
-
-		// 追加: 衝突テーブル用ミューテックス
-		std::mutex contactMutex;
-
-		std::unordered_map < JPH::BodyID, Framework::Physics::Rigidbody3D* > bodyMap;				///< BodyIDに対するRigidbody3Dマップ
+		ContactPairTable							contactTable;		///< 前フレームと今フレームの接触ペア
+#if !defined(FRAMEWORK_PHYSICS_HEADLESS)
+		PhysicsQuery								query;				///< 空間クエリ
+#endif
+		PhysicsContactListener						contactListener;	///< コンタクトリスナー
+		std::vector<std::unique_ptr<ContactBuffer>>	contactBuffers;		///< スレッドごとの追記バッファ
+		std::mutex									contactBufferMutex;	///< contactBuffers への登録用（スレッドごとに初回のみ）
+		uint64_t									instanceID;			///< スレッドローカルのバッファ参照を識別する ID
+
+		static inline std::atomic<uint64_t> nextInstanceID{ 1 };	///< 次に割り当てるインスタンス ID
+
+		// Body の一括追加
+		int											bodyBatchDepth = 0;		///< BeginBodyBatch の入れ子の深さ
+		std::vector<JPH::BodyID>					batchedActiveBodies;	///< 起こして追加する保留中の Body
+		std::vector<JPH::BodyID>					batchedSleepingBodies;	///< 眠らせたまま追加する保留中の Body
+
+		std::vector<JPH::BodyID>					pairCountBodies;		///< CountBodyPairs 用の起きている Body の写し（並べ替えられる）
+		uint32_t									bodyPairCountdown = 0;	///< 次に Body ペア数を数えるまでのステップ数
+
+		std::vector<BodyRecord> bodyRecords;																///< BodyID::GetIndex() ごとの関連情報
 		std::unordered_map < int, Framework::Physics::Collider3DComponent* > colliderIDMap;		///< ColliderIDに対するCollider3DComponentマップ
-		std::unordered_map < JPH::BodyID, Framework::Physics::Collider3DComponent* > bodyColliderMap;	///< BodyIDに対するCollider3DComponentマップ
 		int nextColliderID = 1;																		///< 次に割り当てるColliderID
 	};
 } // namespace Framework::Physics
@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // Enums / Structs
@@ -38,6 +39,12 @@ enum class TimeScaleEventId : uint8_t
 	Max
 };
 
+/// @brief インターン済みのグループ名（TimeScaleSystem::RegisterGroup で払い出す）
+using TimeScaleGroupId = uint16_t;
+
+/// @brief 同時に実行できる TimeScale イベントの上限
+inline constexpr size_t MaxActiveTimeScaleEvents = 16;
+
 /// @brief 同一イベント再成立時の扱い
 enum class TimeScaleStackPolicy : uint8_t
 {
@@ -69,6 +76,9 @@ struct TimeScaleEventDef
  *          - Group は TimeScaleSystem が倍率表を保持（TimeScaleGroup コンポーネント廃止）
  *          - イベントは ID でリクエストし、定義から対象グループ倍率を書き換える
  *          - 継続時間は rawDelta で管理し、時間切れで確実復帰する
+ *          - グループは登録時に整数 ID へインターンし、倍率は ID 引きの配列で持つ
+ *          - 実行中イベントは優先度順の固定長配列で持ち、変化したグループだけ再計算する
+ *            （コンボ中に毎秒何度も来るヒットストップでも確保もハッシュ計算も起きない）
  */
 class TimeScaleSystem : private NonCopyable
 {
@@ -122,6 +132,27 @@ public:
 	 */
 	[[nodiscard]] float GetGroupScale(const std::string& _groupName) const;
 
+	/** @brief グループ名を整数 ID にインターンする（登録済みなら同じ ID を返す）
+	 *  @param _groupName グループ名
+	 *  @return グループ ID
+	 */
+	TimeScaleGroupId RegisterGroup(const std::string& _groupName);
+
+	/** @brief グループ倍率（最終適用値）を ID で取得する（文字列のハッシュを取らない）
+	 *  @param _groupId RegisterGroup で得た ID
+	 *  @return 最終適用倍率
+	 */
+	[[nodiscard]] float GetGroupScale(TimeScaleGroupId _groupId) const;
+
+	/// @brief 登録済みグループ数（ID は 0 ～ 数-1）
+	[[nodiscard]] size_t GetGroupCount() const { return this->groupNames.size(); }
+
+	/** @brief 倍率の版数を取得する
+	 *  @details Global / Layer / Group の倍率やイベントで適用値が変わるたびに進む（キャッシュの鮮度確認用）
+	 *  @return 版数
+	 */
+	[[nodiscard]] uint32_t GetRevision() const { return this->revision; }
+
 	/** @brief TimeScale イベントをリクエストする（IDのみ）
 	 *  @param _eventId イベントID
 	 */
@@ -133,34 +164,32 @@ public:
 	void SetEventDef(const TimeScaleEventDef& _def);
 
 private:
-	struct EventKey
+	/** @struct ActiveEvent
+	 *  @brief 実行中イベント（ID+Group で一意）
+	 */
+	struct ActiveEvent
 	{
-		TimeScaleEventId id;
-		std::string groupName;
-
-		bool operator==(const EventKey& _rhs) const
-		{
-			return (id == _rhs.id) && (groupName == _rhs.groupName);
-		}
+		TimeScaleEventId id = TimeScaleEventId::JustDodge;	///< イベントID
+		TimeScaleGroupId groupId = 0;						///< 適用対象グループ
+		float scale = 1.0f;									///< 適用倍率
+		int priority = 0;									///< 優先度
+		float remainingRawSec = 0.0f;						///< 残り時間（raw秒）
 	};
 
-	struct EventKeyHash
-	{
-		size_t operator()(const EventKey& _key) const
-		{
-			const size_t h1 = std::hash<uint8_t>()(static_cast<uint8_t>(_key.id));
-			const size_t h2 = std::hash<std::string>()(_key.groupName);
-			return (h1 * 1315423911u) ^ h2;
-		}
-	};
+	/** @brief 実行中イベントを優先度順の位置へ入れる（同じ優先度なら後から来た方を前に置く）
+	 *  @param _event 追加するイベント
+	 */
+	void InsertActiveEvent(const ActiveEvent& _event);
 
-	struct ActiveEvent
-	{
-		TimeScaleEventDef def;			///< 定義（コピー保持）
-		float remainingRawSec = 0.0f;	///< 残り時間（raw秒）
-	};
-	void ApplyEventToGroup(const TimeScaleEventDef& _def);
-	void RebuildAppliedGroupScales();
+	/** @brief 実行中イベントを取り除く（並び順は保つ）
+	 *  @param _index 取り除く位置
+	 */
+	void RemoveActiveEvent(size_t _index);
+
+	/** @brief 1 グループだけ適用倍率を計算し直す
+	 *  @param _groupId 対象グループ
+	 */
+	void RecomputeGroup(TimeScaleGroupId _groupId);
 
 	[[nodiscard]] const TimeScaleEventDef* FindEventDef(TimeScaleEventId _eventId) const;
 
@@ -168,9 +197,14 @@ private:
 	float globalScale;															///< 全体に適用される時間スケール
 	std::array<float, static_cast<size_t>(TimeScaleLayer::Max)> layerScales;	///< レイヤーごとの時間スケール
 
-	std::unordered_map<std::string, float> groupBaseScales;		///< グループ倍率（基準値）
-	std::unordered_map<std::string, float> groupAppliedScales;	///< グループ倍率（最終適用値）
+	std::unordered_map<std::string, TimeScaleGroupId> groupIds;	///< グループ名 → ID（登録時だけ引く）
+	std::vector<std::string> groupNames;						///< ID → グループ名
+	std::vector<float> groupBaseScales;							///< ID ごとの倍率（基準値）
+	std::vector<float> groupScaleById;							///< ID ごとの倍率（最終適用値）
+	uint32_t revision;											///< 倍率の版数
 
-	std::array<TimeScaleEventDef, static_cast<size_t>(TimeScaleEventId::Max)> eventDefs;	///< ID→定義
-	std::unordered_map<EventKey, ActiveEvent, EventKeyHash> activeEvents;					///< 実行中イベント（ID+Groupで一意）
+	std::array<TimeScaleEventDef, static_cast<size_t>(TimeScaleEventId::Max)> eventDefs;		///< ID→定義
+	std::array<TimeScaleGroupId, static_cast<size_t>(TimeScaleEventId::Max)> eventGroupIds;	///< ID→定義の対象グループ
+	std::array<ActiveEvent, MaxActiveTimeScaleEvents> activeEvents;							///< 実行中イベント（優先度の高い順）
+	size_t activeEventCount;																///< 実行中イベント数
 };
\ No newline at end of file
@@ -15,10 +15,15 @@
   *          - scaledDeltaTime（TimeScale適用）を生成
   *          - 固定ステップ方式の accumulator で FixedUpdate を制御
   *          - PhysicsSystem は fixedDeltaTime で TimeScale 非適用
+  *          - 1 フレームで追いつく固定ステップ数に上限を設け、超えた分は捨てて数える
   */
 class TimeSystem : public ITimeProvider
 {
 public:
+	static constexpr uint32_t DefaultMaxCatchUpSteps = 5;	///< 追いつく固定ステップ数の既定の上限
+	static constexpr uint32_t ShedMaxCatchUpSteps = 8;		///< 省ける処理を省いている間の上限（時間を捨てずに追いつく）
+	static constexpr uint32_t OverloadMaxCatchUpSteps = 2;	///< 省いても超過している間の上限（スパイラルを断つ）
+
 	/** @brief コンストラクタ
 	 *  @param uint32_t _fixedFps 固定ステップ用FPS値
 	 */
@@ -27,12 +32,29 @@ public:
 	/// @brief 毎フレームの rawDeltaTime を計算する
 	void TickRawDelta();
 
+	/** @brief 実時間の代わりに与えた経過時間でフレームを進める
+	 *  @details 入力の再生で記録時と同じ経過時間を使う（固定ステップ数が記録時と一致する）
+	 *  @param float _rawDeltaSec 経過時間（秒）
+	 */
+	void TickRawDelta(float _rawDeltaSec);
+
 	/// @brief rawDeltaTime（秒）を返す
 	[[nodiscard]] float RawDelta() const override;
 
 	/// @brief 固定ステップ幅（秒）を返す
 	[[nodiscard]] float FixedDelta() const override;
 
+	/** @brief 固定ステップ間の補間係数を返す
+	 *  @details 固定ステップを消費し終えた後の残り accumulator を固定ステップ幅で割ったもの
+	 */
+	[[nodiscard]] float FixedAlpha() const override;
+
+	/** @brief 固定ステップ用FPSを変更する
+	 *  @details 物理負荷の高いシーンでは 30 に落としても、補間により見た目は描画レートで動く
+	 *  @param uint32_t _fixedFps 固定ステップ用FPS値
+	 */
+	void SetFixedFps(uint32_t _fixedFps);
+
 	/// @brief FixedUpdate を実行すべきか判定する
 	bool ShouldRunFixedStep() const;
 
@@ -42,10 +64,30 @@ public:
 	/// @brief 累積時間をリセット
 	void Reset();
 
+	/** @brief 1 フレームで追いつく固定ステップ数の上限を設定する
+	 *  @details 超えた分の時間は捨てる（シミュレーションが実時間より遅れる）
+	 *  @param uint32_t _steps 上限（1 以上）
+	 */
+	void SetMaxCatchUpSteps(uint32_t _steps);
+
+	/// @brief 1 フレームで追いつく固定ステップ数の上限
+	[[nodiscard]] uint32_t MaxCatchUpSteps() const { return this->maxCatchUpSteps; }
+
+	/// @brief 上限を超えて捨てた固定ステップ数の累計
+	[[nodiscard]] uint64_t DroppedStepCount() const { return this->droppedStepCount; }
+
+private:
+	/** @brief rawDeltaTime を設定し、固定ステップ用に累積する
+	 *  @param float _rawDeltaSec 経過時間（秒）
+	 */
+	void AdvanceRawDelta(float _rawDeltaSec);
+
 private:
 	std::chrono::steady_clock::time_point lastTime;		///< 前フレーム時刻
 	float rawDeltaSec;									///< TimeScale非適用Δ時間
 	float fixedDeltaSec;								///< 固定ステップΔ時間
 
 	float accumulator;									///< 固定ステップ累積
+	uint32_t maxCatchUpSteps;							///< 1 フレームで追いつく固定ステップ数の上限
+	uint64_t droppedStepCount;							///< 捨てた固定ステップ数の累計
 };
\ No newline at end of file
@@ -136,4 +136,7 @@ private:
 	const Graphics::Import::SkeletonCache* skeletonCache = nullptr; ///< スケルトンキャッシュ
 	Graphics::Import::Pose currentPose{};							///< 現在のポーズ（global/skin/cpuBoneMatrices）
 	bool isSkeletonCached = false;									///< スケルトンキャッシュ設定済みか
+
+	float skippedDeltaTime = 0.0f;									///< 負荷で間引いた分の経過時間
+	bool skipNextUpdate = false;									///< 次の更新を間引くか（負荷が高い間だけ交互に立つ）
 };
\ No newline at end of file
@@ -51,6 +51,12 @@ public:
      */
     const DX::Matrix4x4& GetProjectionMatrix() const;
 
+    /** @brief 距離 1 の位置で 1 単位が画面上で何ピクセルになるかを取得
+     *  @return 画面高さ / (2 * tan(fovY / 2))
+     *  @details LOD 選択などで、オブジェクト空間の誤差をピクセルに換算するのに使う
+     */
+    float GetProjectionScale() const;
+
     /** @brief 透視投影の設定
      *  @param float _fovY   視野角（ラジアン）
      *  @param float _aspect アスペクト比
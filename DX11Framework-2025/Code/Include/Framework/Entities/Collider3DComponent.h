@@ -10,12 +10,16 @@
 #include <Include/Framework/Utils/CommonTypes.h>
 #include "Include/Framework/Entities/Component.h"
 #include "Include/Framework/Entities/Transform.h"
+#include "Include/Framework/Physics/ColliderCooker.h"
 
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/Collision/Shape/Shape.h>
 #include <Jolt/Physics/Collision/ShapeCast.h>
 #include <Jolt/Physics/Body/BodyFilter.h>
 
+#include <memory>
+#include <string>
+
 namespace Framework::Physics
 {
 	//-----------------------------------------------------------------------------
@@ -145,6 +149,13 @@ namespace Framework::Physics
 		 */
 		void SetCapsule(float _radius, float _halfHeight);
 
+		/** @brief メッシュ形状の元にするモデルを設定する（SetShape(ColliderShapeType::Mesh) と併用）
+		 *  @param _modelKey ModelManager の登録名（未登録なら登録する）
+		 *  @param _options 変換設定（メッシュ・凸包・サブセットごとの凸包）
+		 *  @details 変換結果は .ccol に保存され、同じモデル・設定のコライダー間で共有される
+		 */
+		void SetMeshModel(const std::string& _modelKey, const ColliderCooker::CookOptions& _options = {});
+
 		/** @brief 形状の中心オフセットを設定する
 		 *  @param _offset オフセット値
 		 */
@@ -201,6 +212,11 @@ namespace Framework::Physics
 
 		JPH::Ref<JPH::ShapeSettings>	shapeSettings;	///< BuildShapeで作る設定キャッシュ
 
+		// メッシュ形状
+		std::string									meshModelKey;	///< 元にするモデルの登録名
+		ColliderCooker::CookOptions					meshOptions;	///< 変換設定
+		std::shared_ptr<const ColliderCooker::CookedCollider>	cookedMesh;	///< 変換済み形状（共有を保つために保持する）
+
 		// 設定値（BuildShape 用）
 		DX::Vector3 boxHalfExtent;		///< ボックス形状の半分の大きさ
 		float		sphereRadius;		///< 球形状の半径
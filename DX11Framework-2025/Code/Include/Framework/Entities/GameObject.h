@@ -8,10 +8,13 @@
 #include"Include/Framework/Entities/TimeScaleComponent.h"
 
 #include"Include/Framework/Event/GameObjectEvent.h"
+#include"Include/Framework/Utils/FrameArena.h"
 
+#include<cstdint>
 #include<string>
 #include<vector>
 #include<memory>
+#include<span>
 
  /** @namespace GameTags
   *  @brief     ゲームオブジェクトの識別に使用するタグやレイヤーを定義する名前空間
@@ -149,6 +152,7 @@ public:
 
 		T* rawPtr = component.get();
 		this->components.emplace_back(std::move(component));
+		++this->componentVersion;
 
 		// コンポーネントの追加通知
 		GameObjectEventContext eventContext = 
@@ -162,6 +166,19 @@ public:
 		return rawPtr;
 	}
 
+	/** @brief  生成済みのコンポーネントを通知なしで追加する
+	 *  @param	std::unique_ptr<Component> _component	追加するコンポーネント（このオブジェクトを所有者として生成したもの）
+	 *  @return	Component*	追加したコンポーネント
+	 *  @details	GameObjectManager::InstantiateBulk 用。フェーズへの登録は呼び出し側がまとめて行う
+	 */
+	Component* AttachComponentSilently(std::unique_ptr<Component> _component)
+	{
+		Component* rawPtr = _component.get();
+		this->components.emplace_back(std::move(_component));
+		++this->componentVersion;
+		return rawPtr;
+	}
+
 	template<typename T>
 	/** @brief  コンポーネントの取得
 	 *	@return	T*	見つからなければnullptrを返す	
@@ -186,26 +203,47 @@ public:
 	 */
 	template<typename T>
 	std::vector<T*> GetComponentsInChildren()
+	{
+		std::vector<T*> foundComponents{};
+		this->CollectComponentsInChildren<T>(foundComponents);
+		return foundComponents;
+	}
+
+	/** @brief  コンポーネントの全取得（子オブジェクトも含む。フレームの一時メモリに置くのでヒープ確保しない）
+	 *  @return	std::span<T*>	見つかったコンポーネントのリスト（GameLoop::Update の終わりまで有効。保存しないこと）
+	 */
+	template<typename T>
+	std::span<T*> GetComponentsInChildrenThisFrame()
+	{
+		Framework::Memory::FrameVector<T*> foundComponents{};
+		this->CollectComponentsInChildren<T>(foundComponents);
+
+		// 領域は FrameArena が持つので、配列を捨てても中身はフレームの終わりまで残る
+		return { foundComponents.data(), foundComponents.size() };
+	}
+
+	/** @brief  コンポーネントを子オブジェクトも含めて集める
+	 *  @param	Container& _out	追加先
+	 */
+	template<typename T, typename Container>
+	void CollectComponentsInChildren(Container& _out)
 	{
 		static_assert(std::is_base_of<Component, T>::value, "クラス T はComponentから派生する必要があります。");
-			
+
 		// 自身のコンポーネントをチェックする
-		std::vector<T*> foundComponents{};
 		for (auto& comp : this->components)
 		{
 			if (auto casted = dynamic_cast<T*>(comp.get()))
 			{
-				foundComponents.push_back(casted);
+				_out.push_back(casted);
 			}
 		}
 
-		// 子オブジェクトを再帰的にチェックする
+		// 子オブジェクトを再帰的にチェックする（途中の配列は作らない）
 		for (auto& child : this->children)
 		{
-			auto childComponents = child->GetComponentsInChildren<T>();
-			foundComponents.insert(foundComponents.end(), childComponents.begin(), childComponents.end());
+			child->CollectComponentsInChildren<T>(_out);
 		}
-		return foundComponents;
 	}
 
 	/** @brief  コンポーネントの削除
@@ -234,6 +272,7 @@ public:
 
 				// 実際の配列からも削除する
 				this->components.erase(it);
+				++this->componentVersion;
 				return;
 			}
 		}
@@ -288,6 +327,11 @@ public:
 	 */
 	[[nodiscard]] const std::vector<std::unique_ptr<Component>>& GetComponents() const { return this->components; }
 
+	/**	@brief	コンポーネント構成の版数を取得（追加・削除のたびに進む。キャッシュの鮮度確認用）
+	 *	@return	uint32_t
+	 */
+	[[nodiscard]] uint32_t GetComponentVersion() const { return this->componentVersion; }
+
 public:
 		Transform* transform;	///< 位置、回転、スケール情報
 private:
@@ -304,4 +348,5 @@ private:
 
 	std::vector<GameObject*> children;						///< 子オブジェクトのリスト
 	std::vector<std::unique_ptr<Component>>	components;		///< コンポーネントのリスト
+	uint32_t componentVersion = 0;							///< コンポーネント構成の版数
 };
\ No newline at end of file
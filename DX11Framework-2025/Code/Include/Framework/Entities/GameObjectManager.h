@@ -10,12 +10,17 @@
 #include"Include/Framework/Entities/PhaseInterfaces.h"
 #include"Include/Framework/Entities/Rigidbody3D.h"
 #include"Include/Framework/Entities/Transform.h"
+#include"Include/Framework/Entities/TimeScaleTable.h"
+#include"Include/Framework/Physics/KinematicCharacterSystem.h"
 
 #include<memory>
 #include<list>
 #include<unordered_map>
 #include<string>
 #include <deque>
+#include <functional>
+#include <span>
+#include <string_view>
 
 /**	@class	GameObjectManager
  *	@brief	ゲームオブジェクトの生成、更新、取得などを管理する
@@ -26,6 +31,19 @@
 class GameObjectManager :private NonCopyable, public IGameObjectObserver
 {
 public:
+	static constexpr uint32_t NoParent = UINT32_MAX;	///< BulkObjectDesc::parentIndex の「親なし」
+
+	/**	@struct	BulkObjectDesc
+	 *	@brief	InstantiateBulk で生成するオブジェクト 1 つ分
+	 */
+	struct BulkObjectDesc
+	{
+		std::string_view name;					///< オブジェクトの名前
+		GameTags::Tag tag = GameTags::Tag::None;///< オブジェクトのタグ
+		bool isActive = true;					///< オブジェクトの有効状態
+		uint32_t parentIndex = NoParent;		///< 親の添字（親は子より前に並べる）
+	};
+
 	/**	@brief コンストラクタ
 	 *	@param const EngineServices* _services
 	 */
@@ -63,6 +81,11 @@ public:
 	 */	
 	void EndPhysics(float _deltaTime);
 
+	/** @brief 固定ステップ間の補間を Rigidbody の Transform に反映する
+	 *  @param _alpha 固定ステップ間の補間係数（0～1）
+	 */
+	void InterpolatePhysics(float _alpha);
+
 	/// @brief 一括描画
 	void RenderAll();
 
@@ -74,17 +97,33 @@ public:
 	 */
 	GameObject* Instantiate(const std::string& _name, const GameTags::Tag& _tag = GameTags::Tag::None, const bool _isActive = true);
 
+	/**	@brief	ゲームオブジェクトをまとめて生成する
+	 *	@param	std::span<const BulkObjectDesc> _descs						生成するオブジェクト
+	 *	@param	const std::function<bool(size_t, GameObject&)>& _setup		コンポーネントを付ける処理（AttachComponentSilently を使う。false で中断）
+	 *	@param	std::vector<GameObject*>& _outObjects						生成したオブジェクト（_descs と同じ並び）
+	 *	@return bool														全て生成できれば true（失敗時は 1 つも登録しない）
+	 *	@details
+	 *	-	生成中はイベントを通知せず、最後に 1 回でフェーズ・検索表・時間スケール表に登録する
+	 *	-	Transform と TimeScaleComponent は Instantiate と同じく先に付けておく
+	 */
+	bool InstantiateBulk(std::span<const BulkObjectDesc> _descs, const std::function<bool(size_t, GameObject&)>& _setup, std::vector<GameObject*>& _outObjects);
+
+	/**	@brief	管理中のゲームオブジェクトを取得する（読み取り専用）
+	 *	@return const std::list<std::unique_ptr<GameObject>>&	生成順のリスト
+	 */
+	[[nodiscard]] const std::list<std::unique_ptr<GameObject>>& GetGameObjects() const { return this->gameObjects; }
+
 	/**	@brief	ゲームオブジェクトを名前検索で取得する
 	 *	@param	const std::string& _name	オブジェクトの名前
 	 *	@return GameObject*					ゲームオブジェクト
 	 */
 	[[nodiscard]] GameObject* GetFindObjectByName(const std::string& _name);
 
-	/**	@brief	ゲームオブジェクトをタグ検索で取得する
+	/**	@brief	ゲームオブジェクトをタグ検索で取得する（コピーせずに管理中のリストを見せる）
 	 *	@param	const GameTags::Tag& _tag = GameTags::Tag::None	オブジェクトのタグ名
-	 *	@return std::vector<GameObject*>						当てはまるゲームオブジェクトのリスト
+	 *	@return std::span<GameObject* const>					当てはまるゲームオブジェクトのリスト（生成・破棄があるまで有効）
 	 */
-	[[nodiscard]] std::vector<GameObject*> GetFindObjectsWithTag(const GameTags::Tag& _tag);
+	[[nodiscard]] std::span<GameObject* const> GetFindObjectsWithTag(const GameTags::Tag& _tag) const;
 
 	/**	@brief 登録されたゲームオブジェクトを一括削除する
 	 *	@details
@@ -127,12 +166,15 @@ public:
 	}
 
 private:
-	void RegisterComponentToPhases(Component* _component);
+	void RegisterComponentToPhases(Component* _component, bool _checkDuplicate = true);
 	void UnregisterComponentFromPhases(Component* _component);
 
 private:
 	const EngineServices* services;		///< リソース関連の参照
 
+	// 時間スケール（オブジェクトより後に破棄されるよう先に宣言する）
+	TimeScaleTable timeScaleTable;		///< オブジェクトごとの最終時間スケール表
+
 	// オブジェクト関連
 	std::list<std::unique_ptr<GameObject>> gameObjects;		///< 生成されたゲームオブジェクト
 	std::deque<GameObject*> destroyQueue;					///< 遅延破棄対象キュー
@@ -151,4 +193,7 @@ private:
 	std::unordered_map<std::string, GameObject*> nameMap;				///< 名前検索用マップ
 	std::unordered_map<GameTags::Tag, std::vector<GameObject*>> tagMap;	///< タグ検索用マップ
 
+	// 物理
+	std::unique_ptr<Framework::Physics::KinematicCharacterSystem> kinematicCharacterSystem;	///< Rigidbody3D の押し戻しの一括解決
+
 };
\ No newline at end of file
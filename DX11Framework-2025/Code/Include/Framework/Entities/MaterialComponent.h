@@ -49,6 +49,16 @@ public:
 	 */
 	Material* GetMaterial()const;
 
+	/**	@brief	個別設定の画像情報の取得
+	 *	@return	TextureResource*	画像情報（未設定なら nullptr）
+	 */
+	TextureResource* GetTexture()const;
+
+	/**	@brief	パラメータ情報の取得
+	 *	@return	const MaterialParams&	パラメータ情報
+	 */
+	const MaterialParams& GetParams()const;
+
 	/** @brief マテリアルを適用する
 	 *  @param ID3D11DeviceContext* _context
 	 *  @param RenderSystem* _renderSystem
@@ -20,12 +20,18 @@
 #include <Jolt/Physics/Body/MotionType.h>
 #include <Jolt/Physics/Body/BodyCreationSettings.h>
 
+#include <cstdint>
 #include <memory>
+#include <vector>
+
+class BaseColliderDispatcher3D;
 
 namespace Framework::Physics
 {
 	class PhysicsSystem;
 	enum class ContactType;
+	struct KinematicCharacterQuery;
+	struct KinematicBodyQuery;
 
 	/** @class Rigidbody3D
 	 *  @brief Jolt Physics ベースの 3D リジッドボディコンポーネント
@@ -48,11 +54,25 @@ namespace Framework::Physics
 		/// @brief 破棄
 		void Dispose() override;
 
-        /** @brief 物理シミュレーションステップ
+        /** @brief 物理シミュレーションステップ（単体で押し戻しまで行う）
+         *  @details 通常は KinematicCharacterSystem がまとめて処理する
          *  @param _deltaTime 経過時間
 		 */
         void StepPhysics(float _deltaTime);
 
+		/** @brief 自前移動を行い、押し戻し用のクエリを作る
+		 *  @param _deltaTime 経過時間（TimeScale 未適用）
+		 *  @param _outQuery 出力先クエリ
+		 *  @param _outBodies Body ごとのクエリの追加先
+		 *  @return このステップで更新しない（TimeScale で間引かれた）場合 false
+		 */
+		bool BuildKinematicQuery(float _deltaTime, KinematicCharacterQuery& _outQuery, std::vector<KinematicBodyQuery>& _outBodies);
+
+		/** @brief 押し戻し結果を論理姿勢・速度・接地フラグに反映し、visual に同期する
+		 *  @param _query 解決済みのクエリ
+		 */
+		void ApplyKinematicResult(const KinematicCharacterQuery& _query);
+
 		/** @brief 自前移動（TimeScale 適用済み）
 		 *  @param _deltaTime 経過時間
 		 */
@@ -61,6 +81,23 @@ namespace Framework::Physics
 		/// @brief staged → visual の同期
 		void SyncToVisual() const;
 
+		/** @brief 直前 2 回の固定ステップ結果を補間して visual に反映する
+		 *  @details 論理姿勢・Jolt の Body には触れない（描画用の Transform だけを動かす）
+		 *  @param _alpha 固定ステップ間の補間係数（0～1）
+		 */
+		void InterpolateVisual(float _alpha) const;
+
+		/// @brief 補間の始点と終点を現在の論理姿勢に揃える（ワープ直後などに呼ぶ）
+		void ResetInterpolation();
+
+		/** @brief 補間の有効/無効設定
+		 *  @param _use false なら固定ステップの結果をそのまま表示する
+		 */
+		void SetUseInterpolation(bool _use) { this->useInterpolation = _use; }
+
+		/// @brief 補間が有効か
+		bool IsUsingInterpolation() const { return this->useInterpolation; }
+
 		/** @brief visual → Jolt（Kinematic Body）へ同期
 		 *  @param _deltaTime 経過時間
 		 */
@@ -69,14 +106,6 @@ namespace Framework::Physics
 		/// @brief Jolt → visual/staged へ姿勢を反映
 		void SyncJoltToVisual();
 
-		/// @brief 貫通解決
-		void ResolvePenetration();
-
-		/** @brief CastShape による押し戻し解決
-		 *  @param _deltaTime 経過時間
-		 */
-		void ResolveCastShape(float _deltaTime);
-
 		/// @brief 論理位置取得
 		DX::Vector3 GetLogicalPosition() const;
 
@@ -151,14 +180,13 @@ namespace Framework::Physics
 		bool GetBodyTransform(DX::Vector3& _outPos, DX::Quaternion& _outRot) const;
 
 		/** @brief 接触イベントのディスパッチ
+		 *  @details 事前に集めた接触リスナー（BaseColliderDispatcher3D）にだけ配送する
 		 *  @param _type イベント種別
 		 *  @param _selfCollider 自分側のコライダー
 		 *  @param _otherColl 相手側のコライダー
 		 */
 		void DispatchContactEvent(const ContactType& _type, Collider3DComponent* _selfCollider, Collider3DComponent* _otherColl);
 
-		static constexpr int SolveIterations = 3;   ///< 貫通解決の反復回数
-
 	private:
 		struct BodyEntry
 		{
@@ -184,8 +212,15 @@ namespace Framework::Physics
 		/// @brief Body を破棄
 		void DestroyBody();
 
-		/// @brief 接地判定（RayCast）
-		void CheckGrounded();
+		/** @brief 接地判定の Ray を飛ばす高さを計算
+		 *  @param _rot 論理回転
+		 *  @param _outOffset ピボットから最も低いコライダー底面までの高さ
+		 *  @return コライダーが無ければ false
+		 */
+		bool ComputeGroundProbeOffset(const DX::Quaternion& _rot, float& _outOffset) const;
+
+		/// @brief 接触リスナー一覧を必要なら作り直す
+		void RefreshContactListeners();
 
 		/// @brief 複数ColliderのcenterOffsetを回転適用して平均COMオフセットを計算
 		DX::Vector3 ComputeColliderOffset(const Collider3DComponent* _collider, const DX::Quaternion& _rot) const;
@@ -200,6 +235,10 @@ namespace Framework::Physics
 		std::unique_ptr<StagedTransform> staged;        ///< 論理姿勢（更新中の位置）
 		std::unique_ptr<StagedTransform> stagedPrev;    ///< 前フレームの論理姿勢
 
+		StagedTransform interpolationFrom;              ///< 1 つ前の固定ステップ結果（補間の始点）
+		StagedTransform interpolationTo;                ///< 最新の固定ステップ結果（補間の終点）
+		bool useInterpolation;                          ///< 固定ステップ間の補間を行うか
+
 		Transform* visualTransform;                     ///< Transform（見た目用）
 		PhysicsSystem& physicsSystem;                   ///< Jolt 物理システム
 		std::vector<Collider3DComponent*> colliders;    ///< 自身の階層下に存在するコライダー形状
@@ -209,5 +248,9 @@ namespace Framework::Physics
 		bool useGravity;                            ///< 重力使用フラグ
 
 		bool isGrounded;                            ///< 接地フラグ
+
+		std::vector<BaseColliderDispatcher3D*> contactListeners;	///< 接触イベントを受け取るコンポーネント
+		uint32_t contactListenerVersion;							///< 一覧を作ったときのコンポーネント構成の版数
+		bool hasContactListeners;									///< 一覧を作成済みか
 	};
 } // namespace Framework::Physics
@@ -5,6 +5,7 @@
 #pragma once
 #include "Include/Framework/Entities/Component.h"
 #include "Include/Framework/Core/TimeScaleSystem.h"
+#include "Include/Framework/Entities/TimeScaleTable.h"
 
 #include<string>
 
@@ -13,6 +14,7 @@ struct ScaleGroupInfo;
  /** @class TimeScaleComponent
   *  @brief オブジェクトごとの時間スケールを保持・管理するコンポーネント
   *  @details - Componentを継承し、各オブジェクトの個別時間係数を管理する
+  *           - GameObjectManager の TimeScaleTable に載っている間は最終倍率を表から引く
   */
 class TimeScaleComponent : public Component
 {
@@ -41,6 +43,7 @@ public:
 	/// @brief 蓄積された時間スケールを取得する
 	[[nodiscard]] float GetAccumulatedScale() const;
 
+	/// @brief 最終倍率（親の累積 × グループ × レイヤー × グローバル）を取得する
 	[[nodiscard]] float GetFinalScale() const;
 
 	/**@brief デルタタイムに時間スケールを適用する
@@ -49,10 +52,24 @@ public:
 	 */
 	[[nodiscard]] float ApplyTimeScale(float _baseDelta) const;
 
+	/**@brief 固定ステップ 1 回分の経過時間を求める
+	 * @details 遅いグループは固定ステップを間引いて素の経過時間で進め、止まっているグループは更新しない
+	 * @param _fixedDelta 固定ステップの経過時間（TimeScale 未適用）
+	 * @param _outDelta TimeScale 適用済みの経過時間
+	 * @return このステップで更新するなら true
+	 */
+	[[nodiscard]] bool TryGetFixedStepDelta(float _fixedDelta, float& _outDelta) const;
+
+	/**@brief 固定ステップ間の補間係数をグループの進み具合に合わせる
+	 * @param _alpha 固定ステップ間の補間係数（0～1）
+	 * @return このオブジェクト用の補間係数
+	 */
+	[[nodiscard]] float GetFixedStepAlpha(float _alpha) const;
+
 	/**@brief 時間スケールレイヤーを設定する
 	 * @param _layer 
 	 */
-	void SetTimeScaleLayer(TimeScaleLayer _layer) { this->timeScaleLayer = _layer; }
+	void SetTimeScaleLayer(TimeScaleLayer _layer) { this->timeScaleLayer = _layer; this->MarkTableDirty(); }
 
 	/**@brief 時間スケールレイヤーを取得する
 	 * @return レイヤー情報
@@ -62,7 +79,7 @@ public:
 	/**@brief グループ名を設定する
 	 * @param _groupName グループ名
 	 */
-	void SetGroupName(const std::string& _groupName) { this->groupName = _groupName; }
+	void SetGroupName(const std::string& _groupName);
 
 	/**@brief グループ名を取得する
 	 * @return グループ名
@@ -70,20 +87,35 @@ public:
 	[[nodiscard]] const std::string& GetGroupName() const { return this->groupName; }
 
 	/// @brief グループ名を設定する
-	void SetignoreGroup(bool _ignore) { this->ignoreGroup = _ignore; }
-	void SetIgnoreLayer(bool _ignore) { this->ignoreLayer = _ignore; }
-	void SetIgnoreGlobal(bool _ignore) { this->ignoreGlobal = _ignore; }
+	void SetignoreGroup(bool _ignore) { this->ignoreGroup = _ignore; this->MarkTableDirty(); }
+	void SetIgnoreLayer(bool _ignore) { this->ignoreLayer = _ignore; this->MarkTableDirty(); }
+	void SetIgnoreGlobal(bool _ignore) { this->ignoreGlobal = _ignore; this->MarkTableDirty(); }
 
 	/// @brief グループの時間スケールを無視するかどうかを取得する
 	[[nodiscard]] bool IsIgnoreGroup() const { return this->ignoreGroup; }
 	[[nodiscard]] bool IsIgnoreLayer() const { return this->ignoreLayer; }
 	[[nodiscard]] bool IsIgnoreGlobal() const { return this->ignoreGlobal; }
+private:
+	friend class TimeScaleTable;
+
+	/// @brief グループ × レイヤー × グローバルの倍率を求める（親の累積は含まない）
+	[[nodiscard]] float ComputeSystemScale() const;
+
+	/// @brief レイヤー × グローバルの倍率を求める
+	[[nodiscard]] float ComputeLayerGlobalScale() const;
+
+	/// @brief 倍率表に載っていれば再計算を要求する
+	void MarkTableDirty() { if (this->table) { this->table->MarkScaleDirty(); } }
+
 private:
 	TimeScaleSystem& timeScaleSystem;	///< 時間スケール管理システムの参照
+	TimeScaleTable* table;				///< 載っている倍率表（無ければ nullptr）
+	uint32_t tableIndex;				///< 倍率表での添字
 
 	float timeScale;					///< オブジェクト固有の時間倍率
 	TimeScaleLayer timeScaleLayer;		///< オブジェクトの時間スケールレイヤー
 	std::string groupName;              ///< 所属するグループ名
+	TimeScaleGroupId groupId;			///< 所属するグループの ID
 
 	bool ignoreGroup;					///< グループの時間スケールを無視するかどうか
 	bool ignoreLayer;					///< レイヤーの時間スケールを無視するかどうか
@@ -0,0 +1,113 @@
+﻿/** @file   TimeScaleTable.h
+ *  @brief  オブジェクトごとの最終時間スケールを親から順にまとめて求める表
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class TimeScaleComponent;
+class TimeScaleSystem;
+
+/** @class TimeScaleTable
+ *  @brief TimeScaleComponent の最終倍率（親の累積 × グループ × レイヤー × グローバル）を密な配列に持つ
+ *  @details
+ *      - 親が子より前に並ぶ順で 1 パス計算するので、親チェーンを毎回辿らない
+ *      - 計算し直すのは、倍率・グループ・無視フラグが変わったとき、親子関係が変わったとき、
+ *        TimeScaleSystem 側の倍率（イベントを含む）が変わったときだけ
+ *      - 変更は次に倍率を読んだときに反映されるので、フレームの途中で変えても結果は従来と同じ
+ *      - 固定ステップはグループごとの蓄積で間引く。倍率 0.25 のグループは 4 ステップに 1 回だけ
+ *        素の経過時間で更新し、倍率 0 のグループは一切更新しない（1 以上は毎ステップ）
+ *      - 倍率が変わっても補間係数は後ろに戻らない（遅くなったときは表示中の係数から数え、止まっている間は 1）
+ */
+class TimeScaleTable
+{
+public:
+	static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();	///< 表に無いことを表す添字
+
+	/** @brief コンストラクタ
+	 *  @param _system 時間スケール管理システム
+	 */
+	explicit TimeScaleTable(TimeScaleSystem& _system);
+
+	/** @brief コンポーネントを表に加える
+	 *  @param _component 追加するコンポーネント
+	 */
+	void Add(TimeScaleComponent* _component);
+
+	/** @brief コンポーネントを表から外す
+	 *  @param _component 外すコンポーネント
+	 */
+	void Remove(TimeScaleComponent* _component);
+
+	/// @brief 全て外す
+	void Clear();
+
+	/// @brief 親子関係が変わったことを通知する（並び順から作り直す）
+	void MarkStructureDirty() { this->structureDirty = true; }
+
+	/// @brief 倍率が変わったことを通知する（値だけ計算し直す）
+	void MarkScaleDirty() { this->scaleDirty = true; }
+
+	/// @brief 必要なら並び順と倍率を計算し直す（フレームの頭で呼ぶ）
+	void Refresh();
+
+	/** @brief 最終倍率を取得する
+	 *  @param _component 表に加えたコンポーネント
+	 *  @return 最終倍率
+	 */
+	[[nodiscard]] float GetScale(const TimeScaleComponent* _component);
+
+	/// @brief 固定ステップを 1 回進め、グループごとに今回更新するかを決める（固定ステップの頭で呼ぶ）
+	void AdvanceFixedStep();
+
+	/** @brief 今回の固定ステップでの経過時間を取得する
+	 *  @param _component 表に加えたコンポーネント
+	 *  @param _fixedDelta 固定ステップの経過時間（TimeScale 未適用）
+	 *  @param _outDelta TimeScale 適用済みの経過時間
+	 *  @return このステップで更新するなら true
+	 */
+	[[nodiscard]] bool GetFixedStepDelta(const TimeScaleComponent* _component, float _fixedDelta, float& _outDelta);
+
+	/** @brief グループの進み具合に合わせた補間係数を取得する
+	 *  @param _component 表に加えたコンポーネント
+	 *  @param _alpha 固定ステップ間の補間係数（0～1）
+	 *  @return 直前 2 回の更新の間での補間係数
+	 */
+	[[nodiscard]] float GetFixedStepAlpha(const TimeScaleComponent* _component, float _alpha);
+
+	/// @brief 表に載っているコンポーネント数
+	[[nodiscard]] size_t Size() const { return this->components.size(); }
+
+private:
+	/// @brief 親が先に来るように並べ直し、添字と親の添字を振り直す
+	void RebuildOrder();
+
+	/// @brief 並び順に沿って累積倍率と最終倍率を計算する
+	void Recompute();
+
+private:
+	TimeScaleSystem& system;						///< 時間スケール管理システム
+
+	std::vector<TimeScaleComponent*> components;	///< 親が先に来る順のコンポーネント
+	std::vector<uint32_t> parentIndices;			///< 親のコンポーネントの添字（無ければ InvalidIndex）
+	std::vector<float> accumulatedScales;			///< 親からの累積倍率（自分の倍率込み）
+	std::vector<float> finalScales;					///< 最終倍率
+	std::vector<float> residualScales;				///< グループ倍率を除いた倍率（固定ステップ用）
+
+	std::vector<float> groupRates;					///< グループごとの倍率（固定ステップの頭で取得）
+	std::vector<float> groupAccumulators;			///< グループごとの前回更新からの進み（ステップ単位）
+	std::vector<float> groupStepScales;				///< 更新するときの経過時間の倍率
+	std::vector<uint8_t> groupDue;					///< 今回の固定ステップで更新するか
+	float lastAlpha;								///< 最後に補間に使った固定ステップ間の補間係数
+
+	uint32_t systemRevision;						///< 計算に使った TimeScaleSystem の版数
+	bool structureDirty;							///< 並び順を作り直す必要があるか
+	bool scaleDirty;								///< 倍率を計算し直す必要があるか
+};
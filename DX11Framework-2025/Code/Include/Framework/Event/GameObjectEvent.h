@@ -18,7 +18,8 @@ enum class GameObjectEvent {
 	ComponentEnabled,
 	ComponentDisabled,
 	ComponentAdded,
-	ComponentRemoved
+	ComponentRemoved,
+	ParentChanged
 };
 
  /** @struct GameObjectEventContext
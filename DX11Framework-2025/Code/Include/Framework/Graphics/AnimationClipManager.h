@@ -36,6 +36,19 @@ public:
 	 */
 	Graphics::Import::AnimationClip* Register(const std::string& _key) override;
 
+	/** @brief クリップを読み込む（登録表を書き換えないのでワーカースレッドから呼べる）
+	 *  @param _key リソースキー
+	 *  @return 読み込んだクリップ（内容が同じものは共有される）。失敗時 nullptr
+	 */
+	std::shared_ptr<Graphics::Import::AnimationClip> Preload(const std::string& _key);
+
+	/** @brief 読み込んだクリップを登録する（メインスレッドで呼ぶ）
+	 *  @param _key リソースキー
+	 *  @param _clip Preload の結果
+	 *  @return 登録したクリップ（既に登録済みなら既存のもの、失敗時 nullptr）
+	 */
+	Graphics::Import::AnimationClip* Commit(const std::string& _key, std::shared_ptr<Graphics::Import::AnimationClip> _clip);
+
 	/** @brief リソースの登録を解除する
 	 *  @param _key リソースキー
 	 */
@@ -67,10 +80,18 @@ public:
 	 */
 	void BuildEventTable(Graphics::Import::AnimationClip& _clip, const std::vector<Graphics::Import::ClipEvent>& _defs);
 
+private:
+	/** @brief クリップを読み込む（内容が同じものは共有する）
+	 *  @param _key リソースキー
+	 *  @param _importer 使うインポーター（スレッドごとに別のものを渡す）
+	 *  @return 読み込んだクリップ。失敗時 nullptr
+	 */
+	std::shared_ptr<Graphics::Import::AnimationClip> Load(const std::string& _key, Graphics::Import::AnimationImporter& _importer);
+
 private:
 	Graphics::Import::AnimationImporter importer;
 
-	std::unordered_map<std::string, std::unique_ptr<Graphics::Import::AnimationClip>> clipMap;	///< クリップ本体
+	std::unordered_map<std::string, std::shared_ptr<Graphics::Import::AnimationClip>> clipMap;	///< クリップ本体（内容が同じものはキー間で共有）
 	std::unordered_map<std::string, std::string> clipInfoMap;									///< key -> filename
 	std::unordered_map<std::string, std::vector<Graphics::Import::ClipEvent>> eventDefMap;		///< key -> events
 
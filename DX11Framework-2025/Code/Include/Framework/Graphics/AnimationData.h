@@ -131,7 +131,7 @@ namespace Graphics::Import
 	struct AnimationClip
 	{
 		std::string name{};							///< クリップ名（デバッグ用）
-		std::string keyName{};						///< クリップキー名
+		std::string keyName{};						///< 最初に登録したクリップキー名（同じ内容のクリップはキー間で共有されるので、同一判定はポインタで行う）
 
 		double durationTicks = 0.0;					///< Bake時に「全キー最大時刻」で確定
 		double ticksPerSecond = 0.0;				///< 0にならないようインポータで補正
@@ -279,6 +279,8 @@ private:
 	bool isPaused = false;													///< 停止中フラグ
 
 	Graphics::Animation::CrossFadeData<StateId> crossFadeData{};			///< クロスフェード中の状態情報
+	Graphics::Animation::LocalPose crossFadeFromPose{};						///< クロスフェードの遷移前ポーズ（毎フレーム使い回す）
+	Graphics::Animation::LocalPose crossFadeToPose{};						///< クロスフェードの遷移後ポーズ（毎フレーム使い回す）
 
 	//-----------------------------------------------------------------------------
 	// キー探索の高速化用キャッシュ
@@ -554,8 +556,9 @@ void Animator<StateId>::Update(float _deltaTime)
 	this->crossFadeData.fromTime += _deltaTime * fromDef->playbackSpeed;
 	this->crossFadeData.toTime += _deltaTime * toDef->playbackSpeed;
 
-	Graphics::Animation::LocalPose fromPose{};
-	Graphics::Animation::LocalPose toPose{};
+	// 作業用のポーズはメンバーを使い回す（ノード数が変わらない限り確保しない）
+	Graphics::Animation::LocalPose& fromPose = this->crossFadeFromPose;
+	Graphics::Animation::LocalPose& toPose = this->crossFadeToPose;
 	float fromNrm = 0.0f;
 	float toNrm = 0.0f;
 	bool fromFin = false;
@@ -34,6 +34,12 @@ public:
      */
     Material* Get(const std::string& _key) override;
 
+    /** @brief マテリアルの登録名を探す（保存時に参照を名前へ戻す用。線形探索）
+     *  @param _material マテリアル
+     *  @return 登録名、無ければnullptr（デフォルトマテリアルも nullptr）
+     */
+    const std::string* FindKey(const Material* _material) const;
+
     /** @brief デフォルトマテリアルを取得
      *  @return  Material* 
      */
@@ -4,6 +4,7 @@
 #pragma once
 #include "Include/Framework/Graphics/VertexBuffer.h"
 #include "Include/Framework/Graphics/IndexBuffer.h"
+#include "Include/Framework/Graphics/ConstantBuffer.h"
 #include "Include/Framework/Graphics/Material.h"
 #include "Include/Framework/Graphics/VertexTypes.h"
 
@@ -23,9 +24,20 @@ namespace Graphics
 		int materialIndex = -1;
 	};
 
+	/** @struct MeshLod
+	 *  @brief 簡略化した LOD の描画範囲（VB/IB は基本メッシュと共有）
+	 */
+	struct MeshLod
+	{
+		std::vector<MeshSubset> subsets;	///< 共有 IB 内の描画範囲
+		float error = 0.0f;					///< 簡略化誤差（オブジェクト空間の距離）
+	};
+
 	class Mesh
 	{
 	public:
+		static constexpr float DefaultMaxScreenError = 1.0f;	///< LOD 選択で許容する画面上の誤差（ピクセル）
+
 		~Mesh() = default;
 
 		void Bind(ID3D11DeviceContext& _context) const;
@@ -37,6 +49,64 @@ namespace Graphics
 		void SetIndexBuffer(std::unique_ptr<IndexBuffer> _ib) { this->indexBuffer = std::move(_ib); }
 		void SetSubsets(std::vector<MeshSubset>&& _subsets) { this->subsets = std::move(_subsets); }
 
+		//-----------------------------------------------------------------------------
+		// Vertex format
+		//-----------------------------------------------------------------------------
+
+		/**@brief 頂点形式を設定する
+		 * @param _format 頂点形式
+		 * @param _dequantBuffer 位置復元用の定数バッファ（Full の場合は nullptr）
+		 */
+		void SetVertexFormat(VertexFormat _format, std::unique_ptr<ConstantBuffer<VertexDequantBuffer>> _dequantBuffer)
+		{
+			this->vertexFormat = _format;
+			this->dequantBuffer = std::move(_dequantBuffer);
+		}
+
+		/**@brief 頂点形式を取得
+		 * @return 頂点形式
+		 */
+		VertexFormat GetVertexFormat() const { return this->vertexFormat; }
+
+		//-----------------------------------------------------------------------------
+		// LOD
+		//-----------------------------------------------------------------------------
+
+		/**@brief LOD を追加する（基本メッシュが LOD0 で、追加順に粗くなる前提）
+		 * @param _subsets 共有 IB 内の描画範囲
+		 * @param _error 簡略化誤差（オブジェクト空間の距離）
+		 */
+		void AddLod(std::vector<MeshSubset>&& _subsets, float _error) { this->lods.push_back({ std::move(_subsets), _error }); }
+
+		/**@brief LOD 数を取得（基本メッシュを含む）
+		 * @return LOD 数
+		 */
+		size_t GetLodCount() const { return 1 + this->lods.size(); }
+
+		/**@brief 指定 LOD の描画範囲を取得
+		 * @param _lod LOD 番号（範囲外は最も粗い LOD）
+		 * @return 描画範囲
+		 */
+		const std::vector<MeshSubset>& GetSubsets(size_t _lod) const;
+
+		/**@brief 画面上の誤差が許容値に収まる最も粗い LOD を選ぶ
+		 * @param _distance カメラからの距離（ビュー空間の奥行き）
+		 * @param _projectionScale 距離 1 での 1 単位あたりのピクセル数（画面高さ / (2 * tan(fovY / 2))）
+		 * @param _worldScale オブジェクトのワールドスケール（最大軸）
+		 * @param _maxScreenError 許容する画面上の誤差（ピクセル）
+		 * @return LOD 番号
+		 */
+		size_t SelectLod(float _distance, float _projectionScale, float _worldScale = 1.0f, float _maxScreenError = DefaultMaxScreenError) const;
+
+		/**@brief ワールド/ビュー行列から距離とスケールを求めて LOD を選ぶ
+		 * @param _world ワールド行列
+		 * @param _view ビュー行列
+		 * @param _projectionScale 距離 1 での 1 単位あたりのピクセル数（Camera3D::GetProjectionScale）
+		 * @param _maxScreenError 許容する画面上の誤差（ピクセル）
+		 * @return LOD 番号
+		 */
+		size_t SelectLod(const DX::Matrix4x4& _world, const DX::Matrix4x4& _view, float _projectionScale, float _maxScreenError = DefaultMaxScreenError) const;
+
 		//-----------------------------------------------------------------------------
 		// Debug / CPU cache (for diagnostics)
 		//-----------------------------------------------------------------------------
@@ -55,6 +125,10 @@ namespace Graphics
 		std::unique_ptr<VertexBuffer> vertexBuffer;
 		std::unique_ptr<IndexBuffer> indexBuffer;
 		std::vector<MeshSubset> subsets;
+		std::vector<MeshLod> lods;	///< LOD1 以降（粗くなる順）
+
+		VertexFormat vertexFormat = VertexFormat::Full;							///< 頂点形式
+		std::unique_ptr<ConstantBuffer<VertexDequantBuffer>> dequantBuffer;	///< 圧縮頂点の位置復元用（b8）
 
 		// デバッグ用：読み込み時に保持しておく CPU頂点
 		std::vector<ModelVertexGPU> cpuVertices;
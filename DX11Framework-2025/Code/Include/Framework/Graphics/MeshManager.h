@@ -43,6 +43,12 @@ public:
      */
     Graphics::Mesh* Get(const std::string& _key) override;
 
+    /** @brief メッシュの登録名を探す（保存時に参照を名前へ戻す用。線形探索）
+     *  @param _mesh メッシュ
+     *  @return 登録名（内容を共有する別名があればどれか 1 つ）、無ければnullptr
+     */
+    const std::string* FindKey(const Graphics::Mesh* _mesh) const;
+
     /** @brief デフォルトメッシュを取得
      *  @return デフォルトメッシュ（nullptrの可能性あり）
      */
@@ -63,8 +69,15 @@ public:
      */
     std::unique_ptr<Graphics::Mesh> CreateFromModelData(const Graphics::Import::ModelData& _modelData);
 
+    /** @brief モデルデータからメッシュを生成して登録する（頂点・インデックスが同じメッシュは共有する）
+     *  @param _key 登録名
+     *  @param _modelData 読み込んだモデルデータ
+     *  @return 登録されたメッシュ、生成に失敗した場合はnullptr
+     */
+    Graphics::Mesh* RegisterFromModelData(const std::string& _key, const Graphics::Import::ModelData& _modelData);
+
 private:
-    std::unordered_map<std::string, std::unique_ptr<Graphics::Mesh>> meshTable; ///< 名前で管理するメッシュ辞書
+    std::unordered_map<std::string, std::shared_ptr<Graphics::Mesh>> meshTable; ///< 名前で管理するメッシュ辞書（内容が同じものはキー間で共有）
     std::unique_ptr<Graphics::Mesh> defaultMesh;                                ///< デフォルトメッシュ
 
 	ShaderManager& shaderManager;   ///< シェーダーマネージャー
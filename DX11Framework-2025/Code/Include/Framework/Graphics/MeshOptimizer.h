@@ -0,0 +1,92 @@
+﻿/** @file   MeshOptimizer.h
+ *  @brief  インポート時のメッシュ最適化（頂点溶接・頂点キャッシュ/フェッチ最適化）
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Graphics/ModelData.h"
+
+#include <cstddef>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Namespace : Graphics::Import::MeshOptimizer
+//-----------------------------------------------------------------------------
+/** @namespace Graphics::Import::MeshOptimizer
+ *  @brief BuildMeshBuffers で得た頂点/インデックス配列を GPU 向けに並べ替える処理群
+ *  @details
+ *      - WeldVertices        : 属性が完全一致する頂点を 1 つにまとめる
+ *      - OptimizeVertexCache : Forsyth 法で三角形順を頂点キャッシュ向きに並べ替える
+ *      - OptimizeVertexFetch : 初出順に頂点を並べ替えて VB の読み出しを連続にする
+ */
+namespace Graphics::Import::MeshOptimizer
+{
+	inline constexpr unsigned int ForsythCacheSize = 32;	///< Forsyth 法のスコア計算に使うキャッシュ長
+	inline constexpr unsigned int AcmrCacheSize = 16;		///< ACMR 計測に使う FIFO キャッシュ長
+	inline constexpr size_t MaxIndex16VertexCount = 0xFFFF;	///< 16bit インデックスで参照できる頂点数の上限
+
+	/** @struct Stats
+	 *  @brief 最適化前後の計測値（セルフテスト用）
+	 */
+	struct Stats
+	{
+		size_t sourceVertexCount = 0;	///< 最適化前の頂点数
+		size_t vertexCount = 0;			///< 最適化後の頂点数
+		size_t indexCount = 0;			///< インデックス数（三角形数 * 3）
+		float acmrBefore = 0.0f;		///< 最適化前の ACMR（三角形あたりのキャッシュミス数）
+		float acmrAfter = 0.0f;			///< 最適化後の ACMR
+	};
+
+	/** @brief 属性（位置・法線・色・UV・ボーン）が完全一致する頂点を溶接する
+	 *  @param _vertices 入出力頂点配列（重複が取り除かれる）
+	 *  @param _indices 入出力インデックス配列（溶接後の番号に置き換えられる）
+	 *  @return 旧頂点番号 -> 新頂点番号 の対応表
+	 */
+	std::vector<unsigned int> WeldVertices(std::vector<Vertex>& _vertices, std::vector<unsigned int>& _indices);
+
+	/** @brief Forsyth 法で三角形の並びを頂点キャッシュのヒット率が高くなる順に並べ替える
+	 *  @param _indices 入出力インデックス配列（三角形リスト）
+	 *  @param _vertexCount 頂点数
+	 */
+	void OptimizeVertexCache(std::vector<unsigned int>& _indices, size_t _vertexCount);
+
+	/** @brief インデックスから参照される順に頂点を並べ替える（参照されない頂点は取り除く）
+	 *  @param _vertices 入出力頂点配列
+	 *  @param _indices 入出力インデックス配列
+	 *  @return 旧頂点番号 -> 新頂点番号 の対応表（取り除いた頂点は UINT_MAX）
+	 */
+	std::vector<unsigned int> OptimizeVertexFetch(std::vector<Vertex>& _vertices, std::vector<unsigned int>& _indices);
+
+	/** @brief FIFO キャッシュを模擬して ACMR（三角形あたりのキャッシュミス数）を求める
+	 *  @param _indices インデックス配列（三角形リスト）
+	 *  @param _vertexCount 頂点数
+	 *  @param _cacheSize キャッシュ長
+	 *  @return ACMR（三角形が無い場合は 0）
+	 */
+	float ComputeACMR(const std::vector<unsigned int>& _indices, size_t _vertexCount, unsigned int _cacheSize = AcmrCacheSize);
+
+	/** @brief 溶接・キャッシュ最適化・フェッチ最適化をまとめて適用する
+	 *  @param _vertices 入出力頂点配列
+	 *  @param _indices 入出力インデックス配列
+	 *  @param _outStats 計測値の出力先（nullptr 可）
+	 *  @return 旧頂点番号 -> 新頂点番号 の対応表（取り除いた頂点は UINT_MAX）
+	 */
+	std::vector<unsigned int> Optimize(std::vector<Vertex>& _vertices, std::vector<unsigned int>& _indices, Stats* _outStats = nullptr);
+
+	/** @brief 三角形順をシャッフルした溶接前の格子で、溶接・ACMR・バッファサイズ・形状の保存を検証する
+	 *  @return 全ての確認を満たせば true
+	 */
+	bool RunSelfTest();
+
+	/** @brief コマンドライン引数を解釈してセルフテストを実行する
+	 *  @details --mesh-optimizer-selftest
+	 *  @param _argc 引数の数
+	 *  @param _argv 引数
+	 *  @param _outExitCode 終了コード
+	 *  @return セルフテスト用の引数だった場合 true（アプリケーションは起動しない）
+	 */
+	bool RunCommandLine(int _argc, char** _argv, int& _outExitCode);
+} // namespace Graphics::Import::MeshOptimizer
@@ -0,0 +1,51 @@
+﻿/** @file   MeshSimplifier.h
+ *  @brief  インポート時の LOD 生成（Quadric Error Metrics による簡略化）
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Graphics/ModelData.h"
+
+#include <cstddef>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Namespace : Graphics::Import::MeshSimplifier
+//-----------------------------------------------------------------------------
+/** @namespace Graphics::Import::MeshSimplifier
+ *  @brief 頂点配列を共有したままインデックスだけを間引く LOD 生成処理群
+ *  @details
+ *      - エッジを既存頂点へ畳み込む（half-edge collapse）ため、UV・ボーンウェイトは元頂点の値がそのまま残る
+ *      - UV シーム上の頂点（同一位置に別属性の頂点がある）と境界頂点は動かさない
+ *      - 支配ボーンが異なる頂点同士は畳み込まない（関節付近の形状を保つ）
+ */
+namespace Graphics::Import::MeshSimplifier
+{
+	inline constexpr size_t MaxLodLevels = 3;												///< 基本メッシュ以外に作る LOD 数の上限
+	inline constexpr float LodTriangleRatios[MaxLodLevels] = { 0.5f, 0.25f, 0.125f };		///< 各 LOD の目標三角形比率（基本メッシュ比）
+	inline constexpr float MinLodReduction = 0.85f;										///< 前段の三角形数からこの比率までも減らせなければ打ち切る
+	inline constexpr size_t MinLodTriangleCount = 16;										///< これ未満の三角形数のメッシュは LOD を作らない
+
+	/** @brief インデックスを目標数まで簡略化する
+	 *  @param _vertices 頂点配列（変更しない）
+	 *  @param _indices 元のインデックス配列（三角形リスト）
+	 *  @param _targetIndexCount 目標インデックス数
+	 *  @param _outError 発生した最大誤差（オブジェクト空間の距離、nullptr 可）
+	 *  @return 簡略化後のインデックス配列（_vertices を参照する）
+	 */
+	std::vector<unsigned int> Simplify(
+		const std::vector<Vertex>& _vertices,
+		const std::vector<unsigned int>& _indices,
+		size_t _targetIndexCount,
+		float* _outError = nullptr);
+
+	/** @brief LodTriangleRatios に従って LOD 列を作る
+	 *  @param _vertices 頂点配列
+	 *  @param _indices 基本メッシュのインデックス配列
+	 *  @return LOD 列（粗くなる順。作れない場合は空）
+	 */
+	std::vector<LodLevel> BuildLodChain(const std::vector<Vertex>& _vertices, const std::vector<unsigned int>& _indices);
+} // namespace Graphics::Import::MeshSimplifier
@@ -7,6 +7,7 @@
  // Includes
  //-----------------------------------------------------------------------------
 #include "Include/Framework/Graphics/TextureResource.h"
+#include "Include/Framework/Graphics/VertexTypes.h"
 #include "Include/Framework/Utils/TreeNode.h"
 #include "Include/Framework/Shaders/ShaderCommon.h"
 #include "Include/Tests/SkinningDebug.h"
@@ -58,6 +59,7 @@ namespace Graphics::Import
     {
         std::string meshName = "";      ///< メッシュ名
         int materialIndex = -1;         ///< マテリアルインデックス
+        unsigned int meshIndex = 0;     ///< 元のメッシュ番号（vertices / indices / lods の添字。null メッシュは飛ばすのでサブセット番号とは一致しない）
         unsigned int vertexBase = 0;    ///< 頂点バッファのベース
         unsigned int vertexNum = 0;     ///< 頂点数
         unsigned int indexBase = 0;     ///< インデックスバッファのベース
@@ -65,6 +67,15 @@ namespace Graphics::Import
         std::string materialName = "";  ///< マテリアル名
     };
 
+    /** @struct LodLevel
+     *  @brief 簡略化した LOD（頂点は基本メッシュと共有し、インデックスのみ持つ）
+     */
+    struct LodLevel
+    {
+        std::vector<unsigned int> indices{};    ///< 基本メッシュの頂点を参照するインデックス
+        float error = 0.0f;                     ///< 簡略化誤差（オブジェクト空間の距離）
+    };
+
     /** @struct Material
      *  @brief マテリアル（マテリアル色・テクスチャ名）
      */
@@ -136,8 +147,10 @@ namespace Graphics::Import
         std::vector<std::vector<Vertex>> vertices{};                        ///< 頂点配列
         std::vector<std::vector<unsigned int>> indices{};                   ///< インデックス配列
         std::vector<Subset> subsets{};                                      ///< サブセット配列
+        std::vector<std::vector<LodLevel>> lods{};                          ///< LOD 配列 [meshIndex][lod - 1]
         std::vector<Material> materials{};                                  ///< マテリアル配列
-        std::vector<std::unique_ptr<TextureResource>> diffuseTextures{};    ///< テクスチャ配列
+        std::vector<std::shared_ptr<TextureResource>> diffuseTextures{};    ///< テクスチャ配列（内容が同じものはモデル間で共有）
+        VertexFormat vertexFormat = VertexFormat::Full;                     ///< GPU 頂点の格納形式
 
         std::unordered_map<std::string, Bone> boneDictionary{};             ///< ボーン辞書（スキニング用）
 		Utils::TreeNode<BoneNode> nodeTree{};                               ///< ノードツリー（骨格構造用）
@@ -40,6 +40,36 @@ namespace Graphics::Import
 		 */
 		bool Load(const std::string& _filename, const std::string& _textureDir, ModelData& _outModel, SkeletonCache& _outSkeletonCache);
 
+		/** @brief 読み込み時のメッシュ最適化（溶接・キャッシュ/フェッチ最適化）を切り替える
+		 *  @param _enable true で有効
+		 */
+		void SetMeshOptimizeEnabled(bool _enable) { this->enableMeshOptimize = _enable; }
+
+		/** @brief 読み込み時のメッシュ最適化が有効か
+		 *  @return 有効なら true
+		 */
+		bool IsMeshOptimizeEnabled() const { return this->enableMeshOptimize; }
+
+		/** @brief 読み込み時の LOD 生成を切り替える
+		 *  @param _enable true で有効
+		 */
+		void SetLodGenerationEnabled(bool _enable) { this->enableLodGeneration = _enable; }
+
+		/** @brief 読み込み時の LOD 生成が有効か
+		 *  @return 有効なら true
+		 */
+		bool IsLodGenerationEnabled() const { return this->enableLodGeneration; }
+
+		/** @brief GPU 頂点の格納形式を設定する（MeshManager::CreateFromModelData で使われる）
+		 *  @param _format 頂点形式
+		 */
+		void SetVertexFormat(VertexFormat _format) { this->vertexFormat = _format; }
+
+		/** @brief GPU 頂点の格納形式を取得
+		 *  @return 頂点形式
+		 */
+		VertexFormat GetVertexFormat() const { return this->vertexFormat; }
+
 	private:
 		/** @brief Assimp シーンから Material / DiffuseTexture を構築する
 		 *  @param _scene Assimp シーン
@@ -67,6 +97,17 @@ namespace Graphics::Import
 		 */
 		void BuildBonesAndSkinWeights(const aiScene* _scene, ModelData& _modelData) const;
 
+		/** @brief メッシュごとに頂点の溶接・三角形順/頂点順の最適化を行う
+		 *  @details ボーンウェイト確定後に呼ぶ（Bone::weights の頂点番号も付け替える）
+		 *  @param _modelData 入出力モデルデータ
+		 */
+		void OptimizeMeshBuffers(ModelData& _modelData) const;
+
+		/** @brief メッシュごとに簡略化した LOD 列を構築する
+		 *  @param _modelData 入出力モデルデータ（lods を更新）
+		 */
+		void BuildLods(ModelData& _modelData) const;
+
 		/** @brief Assimp シーンからノードツリーを構築して ModelData に格納する
 		 *  @param _scene Assimp シーン
 		 *  @param _modelData 出力先モデルデータ
@@ -83,5 +124,8 @@ namespace Graphics::Import
 
 	private:
 		std::unique_ptr<TextureLoader> textureLoader;	///< テクスチャ読み込み
+		bool enableMeshOptimize = true;					///< 読み込み時にメッシュ最適化を行うか
+		bool enableLodGeneration = true;				///< 読み込み時に LOD を生成するか
+		VertexFormat vertexFormat = VertexFormat::CompactQuantized;	///< GPU 頂点の格納形式
 	};
 } // namespace Graphics::Import
\ No newline at end of file
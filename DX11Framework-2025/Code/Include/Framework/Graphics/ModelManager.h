@@ -20,6 +20,16 @@
 class ModelManager : public IResourceManager<Graphics::ModelEntry>
 {
 public:
+    /** @struct PreloadedModel
+     *  @brief GPU に送る前の読み込み結果（Preload で作り、メインスレッドで Commit する）
+     */
+    struct PreloadedModel
+    {
+        std::string key;                                                ///< 登録名
+        std::unique_ptr<Graphics::Import::ModelData> modelData;         ///< 読み込んだモデル（失敗時 nullptr）
+        std::unique_ptr<Graphics::Import::SkeletonCache> skeletonCache; ///< スケルトンキャッシュ
+    };
+
     ModelManager();
     ~ModelManager() override;
 
@@ -29,6 +39,18 @@ public:
      */
     Graphics::ModelEntry* Register(const std::string& _key) override;
 
+    /** @brief モデルファイルを読み込む（登録表を書き換えないのでワーカースレッドから呼べる）
+     *  @param _key 登録名
+     *  @return 読み込み結果（失敗時は modelData が nullptr）
+     */
+    PreloadedModel Preload(const std::string& _key) const;
+
+    /** @brief 読み込み結果からメッシュ・マテリアルを作って登録する（メインスレッドで呼ぶ）
+     *  @param _model Preload の結果
+     *  @return 登録したモデル（既に登録済みなら既存のもの、失敗時 nullptr）
+     */
+    Graphics::ModelEntry* Commit(PreloadedModel _model);
+
     /** @brief 外部生成済みモデルデータを登録
      *  @param _key 登録名
      *  @param _model 登録対象
@@ -54,6 +76,15 @@ public:
     /// @brief 全モデルを削除
     void Clear();
 
+private:
+    /** @brief モデルファイルを読み込む
+     *  @param _key 登録名
+     *  @param _importer 使うインポーター（スレッドごとに別のものを渡す）
+     *  @param _outModel 出力先
+     *  @return 成功時 true
+     */
+    bool Import(const std::string& _key, Graphics::Import::ModelImporter& _importer, PreloadedModel& _outModel) const;
+
 private:
     std::unordered_map<std::string, std::unique_ptr<Graphics::ModelEntry>> modelTable;    ///< 名前で管理するモデル辞書
     std::unordered_map<std::string, Graphics::ModelInfo> modelInfoTable;                  ///< モデル情報辞書
@@ -36,6 +36,12 @@ public:
 	 *	@return	const TextureResource*	リソースのポインタ、見つからなかった場合は nullptr
 	 */
 	TextureResource* Get(const std::string& _key) override;
+
+	/**	@brief	画像の登録名を探す（保存時に参照を名前へ戻す用。線形探索）
+	 *	@param	const TextureResource* _texture	画像
+	 *	@return	const std::string*	登録名、無ければ nullptr
+	 */
+	const std::string* FindKey(const TextureResource* _texture) const;
 	
 	/**	@brief	デフォルトのリソースを取得する
 	 *	@return	const T*	リソースのポインタ、見つからなかった場合は nullptr
@@ -49,7 +55,7 @@ private:
 
 	std::unique_ptr<TextureLoader>	textureLorder;	///< テクスチャの読み込み
 
-	std::unordered_map<std::string, std::unique_ptr<TextureResource>> spriteMap;		///< スプライトのマップ
+	std::unordered_map<std::string, std::shared_ptr<TextureResource>> spriteMap;		///< スプライトのマップ（同じ画像はモデルのテクスチャとも共有）
 	std::unordered_map<std::string, std::string> spritePathMap;							///< スプライトに対応する画像パスのマップ
 
 	TextureResource* defaultSprite;					///< 未設定の場合に選ばれるスプライト
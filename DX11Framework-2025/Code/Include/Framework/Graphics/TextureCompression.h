@@ -0,0 +1,77 @@
+﻿/** @file   TextureCompression.h
+ *  @brief  CPU でのブロック圧縮（BC1 / BC3 / BC5 / BC7）エンコーダ・デコーダ
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <cstdint>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Namespace : Graphics::TextureCompression
+//-----------------------------------------------------------------------------
+/** @namespace Graphics::TextureCompression
+ *  @brief 4x4 テクセル単位のブロック圧縮（D3D / DXGI を使わないのでヘッドレスで動く）
+ *  @details
+ *      - BC1 : RGB 565 端点 + 2bit インデックス（8 バイト / ブロック）
+ *      - BC3 : BC4 形式のアルファ + BC1 形式のカラー（16 バイト / ブロック）
+ *      - BC5 : BC4 形式の R / G 2 チャンネル（法線マップ用、16 バイト / ブロック）
+ *      - BC7 : モード 6（RGBA 7777 + P ビット端点、4bit インデックス）のみを出力する
+ *  入力ブロックは RGBA8 の 4x4 を行優先で並べた 64 バイト
+ */
+namespace Graphics::TextureCompression
+{
+	inline constexpr uint32_t BlockDimension = 4;	///< ブロックの一辺のテクセル数
+
+	/** @enum  BlockFormat
+	 *  @brief ブロック圧縮形式
+	 */
+	enum class BlockFormat
+	{
+		BC1,
+		BC3,
+		BC5,
+		BC7,
+	};
+
+	/** @brief 1 ブロックのバイト数を取得
+	 *  @param _format 圧縮形式
+	 *  @return バイト数（8 または 16）
+	 */
+	uint32_t GetBlockBytes(BlockFormat _format);
+
+	/** @brief 4x4 ブロックを圧縮する
+	 *  @param _format 圧縮形式
+	 *  @param _rgba 入力テクセル（RGBA8 x 16）
+	 *  @param _outBlock 出力先（GetBlockBytes バイト）
+	 */
+	void EncodeBlock(BlockFormat _format, const uint8_t _rgba[64], uint8_t* _outBlock);
+
+	/** @brief 4x4 ブロックを展開する（検証用、BC7 はモード 6 のみ対応）
+	 *  @param _format 圧縮形式
+	 *  @param _block 入力ブロック
+	 *  @param _outRgba 出力テクセル（RGBA8 x 16）
+	 */
+	void DecodeBlock(BlockFormat _format, const uint8_t* _block, uint8_t _outRgba[64]);
+
+	/** @brief 画像全体を圧縮する（端のブロックは境界のテクセルを複製して埋める）
+	 *  @param _format 圧縮形式
+	 *  @param _rgba 入力画像（RGBA8、行ピッチは _width * 4）
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @param _outBlocks 出力ブロック列（行ピッチは ceil(_width / 4) * GetBlockBytes）
+	 */
+	void CompressImage(BlockFormat _format, const uint8_t* _rgba, uint32_t _width, uint32_t _height, std::vector<uint8_t>& _outBlocks);
+
+	/** @brief 圧縮済みの画像を RGBA8 に展開する（検証用）
+	 *  @param _format 圧縮形式
+	 *  @param _blocks 入力ブロック列
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @param _outRgba 出力画像（RGBA8、行ピッチは _width * 4）
+	 */
+	void DecompressImage(BlockFormat _format, const uint8_t* _blocks, uint32_t _width, uint32_t _height, std::vector<uint8_t>& _outRgba);
+} // namespace Graphics::TextureCompression
@@ -0,0 +1,236 @@
+﻿/** @file   TextureCooker.h
+ *  @brief  テクスチャのオフライン変換（ミップ生成・ブロック圧縮・.ctex 形式の読み書き）
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Graphics/TextureCompression.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Namespace : Graphics::TextureCooker
+//-----------------------------------------------------------------------------
+/** @namespace Graphics::TextureCooker
+ *  @brief 画像を GPU へそのまま転送できる形（全ミップ・ブロック圧縮済み）に変換する処理群
+ *  @details
+ *      - D3D11 に依存しないので、main の --cook-textures からヘッドレスで実行できる
+ *      - 出力は DDS に倣った独自コンテナ（.ctex）で、TextureLoader が直接アップロードする
+ *
+ *  .ctex のレイアウト（リトルエンディアン）
+ *      CookedHeader
+ *      CookedMipEntry * mipCount
+ *      ミップ 0 から順にデータ（各 CookedMipEntry::byteSize バイト）
+ */
+namespace Graphics::TextureCooker
+{
+	inline constexpr uint32_t CookedMagic = 0x58455443;			///< "CTEX"
+	inline constexpr uint32_t CookedVersion = 1;				///< コンテナのバージョン
+	inline constexpr char CookedExtension[] = ".ctex";			///< 変換後の拡張子
+	inline constexpr uint32_t CookedFlagSrgb = 1u << 0;			///< ミップを sRGB として線形空間で縮小した
+	inline constexpr uint32_t CookedFlagNormalMap = 1u << 1;	///< 法線マップ（BC5）
+	inline constexpr uint32_t MaxCookedDimension = 16384;		///< 幅・高さの上限（D3D11 の Texture2D の上限）
+	inline constexpr float KaiserAlpha = 4.0f;					///< Kaiser 窓の形状パラメータ
+	inline constexpr float KaiserRadius = 1.5f;					///< Kaiser フィルタの半径（縮小後のテクセル単位）
+
+	/** @enum  CookedFormat
+	 *  @brief 変換後のピクセル形式（ファイルに保存する値なので並びを変えないこと）
+	 */
+	enum class CookedFormat : uint32_t
+	{
+		RGBA8 = 0,	///< 非圧縮（ブロック圧縮できないサイズの場合）
+		BC1 = 1,	///< 不透明カラー（1/8）
+		BC3 = 2,	///< 半透明カラー（1/4）
+		BC5 = 3,	///< 法線マップ（1/4）
+		BC7 = 4,	///< 高品質カラー（1/4）
+	};
+
+	/** @enum  MipFilter
+	 *  @brief ミップ生成の縮小フィルタ
+	 */
+	enum class MipFilter
+	{
+		Box,	///< 2x2 平均
+		Kaiser,	///< Kaiser 窓付き sinc（遠景のモアレ・ぼけを抑える）
+	};
+
+	/** @struct CookOptions
+	 *  @brief 変換設定
+	 */
+	struct CookOptions
+	{
+		CookedFormat format = CookedFormat::BC7;	///< 出力形式
+		bool selectFormatByAlpha = true;			///< 完全に不透明なら BC1 を選ぶ（format が BC3 / BC7 のとき）
+		MipFilter mipFilter = MipFilter::Kaiser;	///< ミップ生成フィルタ
+		bool generateMips = true;					///< 1x1 までミップを生成するか
+		bool srgb = true;							///< カラーを sRGB とみなして線形空間で縮小するか
+	};
+
+	/** @struct CookedHeader
+	 *  @brief .ctex のヘッダ
+	 */
+	struct CookedHeader
+	{
+		uint32_t magic = CookedMagic;		///< 識別子
+		uint32_t version = CookedVersion;	///< バージョン
+		uint32_t format = 0;				///< CookedFormat
+		uint32_t flags = 0;					///< CookedFlag*
+		uint32_t width = 0;					///< ミップ 0 の幅
+		uint32_t height = 0;				///< ミップ 0 の高さ
+		uint32_t mipCount = 0;				///< ミップ数
+		uint32_t reserved = 0;				///< 予約
+	};
+
+	/** @struct CookedMipEntry
+	 *  @brief .ctex のミップ情報
+	 */
+	struct CookedMipEntry
+	{
+		uint32_t width = 0;		///< 幅
+		uint32_t height = 0;	///< 高さ
+		uint32_t rowPitch = 0;	///< 1 行（BC はブロック 1 行）のバイト数
+		uint32_t byteSize = 0;	///< データのバイト数
+	};
+
+	static_assert(sizeof(CookedHeader) == 32);
+	static_assert(sizeof(CookedMipEntry) == 16);
+
+	/** @struct CookedMip
+	 *  @brief 変換済みミップ 1 枚
+	 */
+	struct CookedMip
+	{
+		uint32_t width = 0;			///< 幅
+		uint32_t height = 0;		///< 高さ
+		uint32_t rowPitch = 0;		///< 1 行（BC はブロック 1 行）のバイト数
+		std::vector<uint8_t> data;	///< ピクセル / ブロックデータ
+	};
+
+	/** @struct CookedTexture
+	 *  @brief 変換済みテクスチャ
+	 */
+	struct CookedTexture
+	{
+		CookedFormat format = CookedFormat::RGBA8;	///< ピクセル形式
+		uint32_t flags = 0;							///< CookedFlag*
+		uint32_t width = 0;							///< ミップ 0 の幅
+		uint32_t height = 0;						///< ミップ 0 の高さ
+		std::vector<CookedMip> mips;				///< ミップ列（0 が最大）
+
+		/** @brief 全ミップのデータサイズ
+		 *  @return バイト数
+		 */
+		size_t GetByteSize() const;
+	};
+
+	/** @struct Image
+	 *  @brief RGBA8 画像
+	 */
+	struct Image
+	{
+		uint32_t width = 0;			///< 幅
+		uint32_t height = 0;		///< 高さ
+		std::vector<uint8_t> rgba;	///< ピクセル（行ピッチは width * 4）
+	};
+
+	/** @brief ミップ列を生成する（先頭は入力のコピー）
+	 *  @param _rgba 入力画像（RGBA8）
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @param _filter 縮小フィルタ
+	 *  @param _srgb RGB を sRGB とみなして線形空間で縮小するか
+	 *  @return 1x1 までのミップ列
+	 */
+	std::vector<Image> GenerateMipChain(const uint8_t* _rgba, uint32_t _width, uint32_t _height, MipFilter _filter, bool _srgb);
+
+	/** @brief RGBA8 画像を変換する
+	 *  @param _rgba 入力画像（RGBA8）
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @param _options 変換設定
+	 *  @param _outTexture 出力先
+	 *  @return 成功時 true
+	 */
+	bool Cook(const uint8_t* _rgba, uint32_t _width, uint32_t _height, const CookOptions& _options, CookedTexture& _outTexture);
+
+	/** @brief 1x1 までのミップ数
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @return ミップ数
+	 */
+	uint32_t ComputeFullMipCount(uint32_t _width, uint32_t _height);
+
+	/** @brief 変換済みテクスチャをバイト列にする
+	 *  @param _texture 変換済みテクスチャ
+	 *  @param _outBytes 出力先
+	 */
+	void Serialize(const CookedTexture& _texture, std::vector<uint8_t>& _outBytes);
+
+	/** @brief バイト列から変換済みテクスチャを復元する
+	 *  @details 各ミップの寸法が max(1, width >> i) x max(1, height >> i) と一致し、
+	 *           データが残りのバイト数に収まることを確認してからコピーする
+	 *  @param _data 入力データ
+	 *  @param _size 入力サイズ
+	 *  @param _outTexture 出力先
+	 *  @return 形式が正しければ true
+	 */
+	bool Deserialize(const uint8_t* _data, size_t _size, CookedTexture& _outTexture);
+
+	/** @brief データが .ctex 形式かどうか（先頭の識別子だけを見る）
+	 *  @param _data 入力データ
+	 *  @param _size 入力サイズ
+	 *  @return .ctex なら true
+	 */
+	bool IsCookedData(const uint8_t* _data, size_t _size);
+
+	/** @brief 元画像のパスから .ctex のパスを作る（拡張子を置き換える）
+	 *  @param _sourcePath 元画像のパス
+	 *  @return .ctex のパス
+	 */
+	std::string GetCookedPath(const std::string& _sourcePath);
+
+	/** @brief .ctex が元画像より新しいか
+	 *  @param _sourcePath 元画像のパス
+	 *  @param _cookedPath .ctex のパス
+	 *  @return .ctex があり、元画像が無いか元画像以降に更新されていれば true
+	 */
+	bool IsCookedUpToDate(const std::string& _sourcePath, const std::string& _cookedPath);
+
+	/** @brief 画像ファイルを変換して保存する
+	 *  @param _sourcePath 元画像のパス（stb_image が読める形式）
+	 *  @param _cookedPath 保存先
+	 *  @param _options 変換設定
+	 *  @return 成功時 true
+	 */
+	bool CookFile(const std::string& _sourcePath, const std::string& _cookedPath, const CookOptions& _options);
+
+	/** @brief ディレクトリ以下の画像をまとめて変換する（元画像の隣に .ctex を置く）
+	 *  @param _directory 対象ディレクトリ
+	 *  @param _options 変換設定
+	 *  @return 全て成功した場合 true
+	 */
+	bool CookDirectory(const std::string& _directory, const CookOptions& _options);
+
+	/** @brief 合成画像で全形式を変換・展開し、PSNR とサイズを検証する
+	 *  @details 壊れた .ctex の拒否と、元画像より古い .ctex の判定も確認する
+	 *  @return 全形式が閾値を満たせば true
+	 */
+	bool RunSelfTest();
+
+	/** @brief コマンドライン引数を解釈して変換を実行する
+	 *  @details
+	 *      --cook-textures <dir> [rgba8|bc1|bc3|bc5|bc7] [box|kaiser]
+	 *      --cook-textures-selftest
+	 *  @param _argc 引数の数
+	 *  @param _argv 引数
+	 *  @param _outExitCode 終了コード
+	 *  @return 変換用の引数だった場合 true（アプリケーションは起動しない）
+	 */
+	bool RunCommandLine(int _argc, char** _argv, int& _outExitCode);
+} // namespace Graphics::TextureCooker
@@ -30,4 +30,17 @@ public:
         const DX::Color& _color,
         int _width = 1,
         int _height = 1);
+
+    /** @brief 単色テクスチャを取得する（同じ色・サイズのものは共有する）
+     *  @param _device   D3D11デバイス
+     *  @param _color    単色 (RGBA, 0〜255)
+     *  @param _width    幅
+     *  @param _height   高さ
+     *  @return 共有テクスチャ（呼び出し側が保持している間だけ有効）
+     */
+    static std::shared_ptr<TextureResource> AcquireSolidColorTexture(
+        ID3D11Device* _device,
+        const DX::Color& _color,
+        int _width = 1,
+        int _height = 1);
 };
\ No newline at end of file
@@ -7,12 +7,13 @@
 #include <memory>
 
 #include "Include/Framework/Graphics/TextureResource.h"
+#include "Include/Framework/Graphics/TextureCooker.h"
 
  /**@class TextureLoader
   * @brief ファイルまたはメモリデータからGPU上にテクスチャを作成する
   * @details
   *     - 本クラスは テクスチャの読み込み専用
-  *     - 管理・キャッシュは行わない
+  *     - 管理は行わない（AcquireShared のみ ContentRegistry で内容が同じものを共有する）
   *     - SpriteManagerやModelImporterが利用する前提
   */
 class TextureLoader
@@ -22,11 +23,20 @@ public:
 
     /**
      * @brief 画像ファイルを読み込んでテクスチャを生成する
+     * @details 同じ場所に変換済みの .ctex があれば、デコードせずにそちらを転送する
      * @param[in] _path ファイルパス
      * @return 生成されたTextureResourceのunique_ptr失敗時はnullptr
      */
     std::unique_ptr<TextureResource> FromFile(const std::string& _path) const;
 
+    /**
+     * @brief 画像ファイルを読み込み、内容が同じテクスチャがあれば共有する
+     * @details ファイルの中身でハッシュを取るので、パスや読み込み元のマネージャーが違っても同じ SRV になる
+     * @param[in] _path ファイルパス
+     * @return 共有テクスチャ。失敗時はnullptr
+     */
+    std::shared_ptr<TextureResource> AcquireShared(const std::string& _path) const;
+
     /**
      * @brief メモリ上の画像データからテクスチャを生成する
      * @param[in] _data 画像データのポインタ
@@ -35,5 +45,12 @@ public:
      */
     std::unique_ptr<TextureResource> FromMemory(const unsigned char* _data, int _len) const;
 
+    /**
+     * @brief 変換済みテクスチャ（ブロック圧縮・全ミップ）をそのまま転送する
+     * @param[in] _cooked 変換済みテクスチャ
+     * @return 生成されたTextureResourceのunique_ptr。失敗時はnullptr
+     */
+    std::unique_ptr<TextureResource> FromCooked(const Graphics::TextureCooker::CookedTexture& _cooked) const;
+
     std::unique_ptr<TextureResource> FromRawRGBA(const unsigned char* data, unsigned int width, unsigned int height);
 };
\ No newline at end of file
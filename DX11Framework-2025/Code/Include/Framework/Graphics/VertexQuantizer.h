@@ -0,0 +1,71 @@
+﻿/** @file   VertexQuantizer.h
+ *  @brief  GPU 頂点の圧縮（八面体法線・half UV・8bit スキニング・16bit 位置）
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Graphics/VertexTypes.h"
+
+#include <cstdint>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Namespace : Graphics::VertexQuantizer
+//-----------------------------------------------------------------------------
+/** @namespace Graphics::VertexQuantizer
+ *  @brief ModelVertexGPU を VertexFormat に応じた圧縮頂点へ変換する処理群
+ *  @details
+ *      - 法線 : 八面体エンコードして R16G16_SNORM
+ *      - UV   : R16G16_FLOAT
+ *      - ボーン : インデックスは R8G8B8A8_UINT、ウェイトは合計 255 を保った R8G8B8A8_UNORM
+ *      - 位置 : CompactQuantized のみ AABB で正規化して R16G16B16A16_SNORM
+ */
+namespace Graphics::VertexQuantizer
+{
+	inline constexpr UINT MaxCompactBoneIndex = 0xFF;	///< 8bit ボーンインデックスで参照できる上限
+
+	/** @brief 形式ごとの頂点ストライドを取得
+	 *  @param _format 頂点形式
+	 *  @param _skinned スキニング情報を含めるか
+	 *  @return 1 頂点のバイト数
+	 */
+	UINT GetVertexStride(VertexFormat _format, bool _skinned);
+
+	/** @brief 単位法線を八面体エンコードする
+	 *  @param _normal 法線（正規化済みでなくてもよい）
+	 *  @param _outEncoded 出力（SNORM16 x2）
+	 */
+	void EncodeOctNormal(const DirectX::XMFLOAT3& _normal, int16_t _outEncoded[2]);
+
+	/** @brief 八面体エンコードされた法線を復元する（検証用、HLSL の DecodeOctNormal と同じ計算）
+	 *  @param _encoded エンコード済み法線
+	 *  @return 正規化済み法線
+	 */
+	DirectX::XMFLOAT3 DecodeOctNormal(const int16_t _encoded[2]);
+
+	/** @brief ボーンウェイトを合計が 255 になるよう 8bit に量子化する
+	 *  @param _weights 入力ウェイト（4 本）
+	 *  @param _outWeights 出力ウェイト（UNORM8 x4）
+	 */
+	void QuantizeBoneWeights(const float _weights[4], uint8_t _outWeights[4]);
+
+	/** @brief 位置の量子化に使う復元パラメータを求める
+	 *  @param _vertices 頂点配列
+	 *  @return AABB 中心と最大半径
+	 */
+	VertexDequantBuffer ComputePositionDequant(const std::vector<ModelVertexGPU>& _vertices);
+
+	/** @brief 頂点配列を指定形式のバイト列に変換する
+	 *  @param _vertices 入力頂点配列
+	 *  @param _format 頂点形式（Full の場合はそのままコピー）
+	 *  @param _skinned スキニング情報を含めるか
+	 *  @param _dequant 位置の復元パラメータ（CompactQuantized のみ使用）
+	 *  @param _outBytes 出力バイト列（GetVertexStride * 頂点数）
+	 *  @return ボーンインデックスが 8bit に収まらない場合 false
+	 */
+	bool Encode(const std::vector<ModelVertexGPU>& _vertices, VertexFormat _format, bool _skinned,
+		const VertexDequantBuffer& _dequant, std::vector<uint8_t>& _outBytes);
+} // namespace Graphics::VertexQuantizer
@@ -24,4 +24,68 @@ namespace Graphics
         UINT  boneIndex[4] = { 0,0,0,0 };
         float boneWeight[4] = { 0,0,0,0 };
     };
+
+    /** @enum  VertexFormat
+     *  @brief GPU 頂点の格納形式
+     */
+    enum class VertexFormat
+    {
+        Full,               ///< ModelVertexGPU（64 バイト）
+        Compact,            ///< 位置は float3、法線/UV/スキニング情報を圧縮
+        CompactQuantized,   ///< Compact に加えて位置も 16bit に量子化
+    };
+
+    /** @brief 圧縮形式の静的メッシュ頂点（20 バイト）
+     */
+    struct ModelVertexCompactGPU
+    {
+        DirectX::XMFLOAT3 position;             ///< 位置
+        int16_t  normal[2] = { 0, 0 };          ///< 八面体エンコード法線（R16G16_SNORM）
+        uint16_t texcoord[2] = { 0, 0 };        ///< UV（R16G16_FLOAT）
+    };
+
+    /** @brief 圧縮形式のスキニングメッシュ頂点（28 バイト）
+     */
+    struct SkinnedVertexCompactGPU
+    {
+        DirectX::XMFLOAT3 position;             ///< 位置
+        int16_t  normal[2] = { 0, 0 };          ///< 八面体エンコード法線（R16G16_SNORM）
+        uint16_t texcoord[2] = { 0, 0 };        ///< UV（R16G16_FLOAT）
+        uint8_t  boneIndex[4] = { 0,0,0,0 };    ///< ボーンインデックス（R8G8B8A8_UINT）
+        uint8_t  boneWeight[4] = { 0,0,0,0 };   ///< ボーンウェイト（R8G8B8A8_UNORM）
+    };
+
+    /** @brief 位置量子化形式の静的メッシュ頂点（16 バイト）
+     */
+    struct ModelVertexQuantizedGPU
+    {
+        int16_t  position[4] = { 0,0,0,0 };     ///< 量子化位置（R16G16B16A16_SNORM、w は未使用）
+        int16_t  normal[2] = { 0, 0 };          ///< 八面体エンコード法線（R16G16_SNORM）
+        uint16_t texcoord[2] = { 0, 0 };        ///< UV（R16G16_FLOAT）
+    };
+
+    /** @brief 位置量子化形式のスキニングメッシュ頂点（24 バイト）
+     */
+    struct SkinnedVertexQuantizedGPU
+    {
+        int16_t  position[4] = { 0,0,0,0 };     ///< 量子化位置（R16G16B16A16_SNORM、w は未使用）
+        int16_t  normal[2] = { 0, 0 };          ///< 八面体エンコード法線（R16G16_SNORM）
+        uint16_t texcoord[2] = { 0, 0 };        ///< UV（R16G16_FLOAT）
+        uint8_t  boneIndex[4] = { 0,0,0,0 };    ///< ボーンインデックス（R8G8B8A8_UINT）
+        uint8_t  boneWeight[4] = { 0,0,0,0 };   ///< ボーンウェイト（R8G8B8A8_UNORM）
+    };
+
+    static_assert(sizeof(ModelVertexCompactGPU) == 20);
+    static_assert(sizeof(SkinnedVertexCompactGPU) == 28);
+    static_assert(sizeof(ModelVertexQuantizedGPU) == 16);
+    static_assert(sizeof(SkinnedVertexQuantizedGPU) == 24);
+
+    /** @brief 量子化位置の復元パラメータ（VS の b8 に渡す）
+     *  @details 復元位置 = 量子化位置 * scale + offset（スケールは全軸共通なので法線は影響を受けない）
+     */
+    struct VertexDequantBuffer
+    {
+        DX::Vector3 positionOffset = DX::Vector3::Zero; ///< AABB の中心
+        float positionScale = 1.0f;                     ///< AABB の最大半径
+    };
 } // namespace Graphics
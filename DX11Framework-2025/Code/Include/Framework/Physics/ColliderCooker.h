@@ -0,0 +1,153 @@
+﻿/** @file   ColliderCooker.h
+ *  @brief  モデルデータからメッシュ・凸包コライダーを作り、Jolt のバイナリ形式で保存・復元する
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Core/ContentRegistry.h"
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Graphics::Import { struct ModelData; }
+
+//-----------------------------------------------------------------------------
+// Namespace : Framework::Physics::ColliderCooker
+//-----------------------------------------------------------------------------
+/** @namespace Framework::Physics::ColliderCooker
+ *  @brief 読み込んだモデルのサブセットから、箱の寄せ集めより少なく正確なコライダーを作る処理群
+ *  @details
+ *      - Mesh                : 三角形メッシュ（静的な地形向け。MeshShape 同士は衝突しない）
+ *      - ConvexHull          : 全サブセットをまとめた凸包 1 つ
+ *      - ConvexDecomposition : サブセットごとの凸包を StaticCompoundShape にまとめたもの（動く物体向け）
+ *      - 結果は元の形状と設定から求めた内容キーで共有し、ディスクにも .ccol として保存する
+ *        （キーがファイル名に入るので、モデルや設定が変われば自動的に作り直される）
+ *      - main の --cook-colliders-selftest で、保存→復元の往復をヘッドレスで確認できる
+ *
+ *  .ccol のレイアウト（リトルエンディアン）
+ *      CookedHeader
+ *      Shape::SaveWithChildren の出力
+ */
+namespace Framework::Physics::ColliderCooker
+{
+	inline constexpr uint32_t CookedMagic = 0x4C4F4343;							///< "CCOL"
+	inline constexpr uint32_t CookedVersion = 1;								///< コンテナのバージョン
+	inline constexpr char CookedExtension[] = ".ccol";							///< 保存ファイルの拡張子
+	inline constexpr char DefaultCacheDirectory[] = "Assets/Cache/Colliders";	///< 既定の保存先
+
+	/** @enum  ShapeKind
+	 *  @brief 作る形状の種類（ファイルに保存する値なので並びを変えないこと）
+	 */
+	enum class ShapeKind : uint32_t
+	{
+		Mesh = 0,					///< 三角形メッシュ
+		ConvexHull = 1,				///< 凸包 1 つ
+		ConvexDecomposition = 2,	///< サブセットごとの凸包の複合形状
+	};
+
+	/** @struct CookOptions
+	 *  @brief 変換設定
+	 */
+	struct CookOptions
+	{
+		ShapeKind kind = ShapeKind::Mesh;	///< 作る形状
+		std::vector<uint32_t> subsets;		///< 使うサブセット（空なら全て）
+		float simplifyRatio = 1.0f;			///< Mesh で残す三角形の割合（1 なら簡略化しない）
+		float maxConvexRadius = 0.05f;		///< 凸包の角の丸め半径
+		float hullTolerance = 1.0e-3f;		///< 凸包から外れて良い距離（大きいほど頂点が減る）
+	};
+
+	/** @struct CookedHeader
+	 *  @brief .ccol のヘッダ
+	 */
+	struct CookedHeader
+	{
+		uint32_t magic = CookedMagic;		///< 識別子
+		uint32_t version = CookedVersion;	///< バージョン
+		uint32_t kind = 0;					///< ShapeKind
+		uint32_t reserved = 0;				///< 予約
+		uint64_t sourceHash = 0;			///< 元の形状と設定の内容キー
+		uint64_t sourceSize = 0;			///< 内容キーのバイト数
+	};
+
+	static_assert(sizeof(CookedHeader) == 32);
+
+	/** @struct CookedCollider
+	 *  @brief 変換済みコライダー（同じ内容のものはコライダー間で共有する）
+	 */
+	struct CookedCollider
+	{
+		JPH::ShapeRefC shape;					///< 形状（スケール未適用）
+		ShapeKind kind = ShapeKind::Mesh;		///< 種類
+	};
+
+	/** @brief 元の形状と設定から内容キーを求める
+	 *  @param _model モデルデータ
+	 *  @param _options 変換設定
+	 *  @return 内容キー
+	 */
+	ContentKey ComputeSourceKey(const Graphics::Import::ModelData& _model, const CookOptions& _options);
+
+	/** @brief 形状を作る
+	 *  @param _model モデルデータ
+	 *  @param _options 変換設定
+	 *  @return 形状（失敗時 nullptr）
+	 */
+	JPH::ShapeRefC Cook(const Graphics::Import::ModelData& _model, const CookOptions& _options);
+
+	/** @brief 形状を .ccol に保存する
+	 *  @param _path 保存先
+	 *  @param _shape 形状
+	 *  @param _kind 種類
+	 *  @param _sourceKey 元の内容キー
+	 *  @return 成功時 true
+	 */
+	bool Save(const std::string& _path, const JPH::Shape& _shape, ShapeKind _kind, const ContentKey& _sourceKey);
+
+	/** @brief .ccol から形状を復元する
+	 *  @param _path 読み込むファイル
+	 *  @param _sourceKey 期待する内容キー（一致しなければ失敗）
+	 *  @param _outKind 種類
+	 *  @return 形状（失敗時 nullptr）
+	 */
+	JPH::ShapeRefC Load(const std::string& _path, const ContentKey& _sourceKey, ShapeKind& _outKind);
+
+	/** @brief 保存先のパスを作る
+	 *  @param _name モデル名（ファイル名の先頭に使う）
+	 *  @param _sourceKey 元の内容キー
+	 *  @return パス
+	 */
+	std::string GetCachePath(const std::string& _name, const ContentKey& _sourceKey);
+
+	/** @brief 共有中のもの → .ccol → 新規変換の順に探してコライダーを取得する
+	 *  @details 新規に変換した場合は .ccol に保存する。Jolt の型登録（PhysicsSystem::Initialize）後に呼ぶこと
+	 *  @param _name モデル名
+	 *  @param _model モデルデータ
+	 *  @param _options 変換設定
+	 *  @return コライダー（失敗時 nullptr）
+	 */
+	std::shared_ptr<const CookedCollider> Acquire(const std::string& _name, const Graphics::Import::ModelData& _model, const CookOptions& _options);
+
+	/** @brief 合成モデルで全種類を変換・保存・復元し、復元した形状が元と一致するか検証する
+	 *  @details 種類・境界・体積・レイの当たり方を比べ、内容キー違い・途切れたファイルが読まれないことも確認する
+	 *  @return 全て一致すれば true
+	 */
+	bool RunSelfTest();
+
+	/** @brief コマンドライン引数を解釈してセルフテストを実行する
+	 *  @details --cook-colliders-selftest
+	 *  @param _argc 引数の数
+	 *  @param _argv 引数
+	 *  @param _outExitCode 終了コード
+	 *  @return セルフテスト用の引数だった場合 true（アプリケーションは起動しない）
+	 */
+	bool RunCommandLine(int _argc, char** _argv, int& _outExitCode);
+} // namespace Framework::Physics::ColliderCooker
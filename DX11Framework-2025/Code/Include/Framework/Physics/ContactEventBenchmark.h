@@ -0,0 +1,77 @@
+﻿/** @file   ContactEventBenchmark.h
+ *  @brief  接触イベント処理（Enter/Stay/Exit の判定）の計測
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+
+//-----------------------------------------------------------------------------
+// Namespace : Framework::Physics::ContactEventBenchmark
+//-----------------------------------------------------------------------------
+/** @namespace Framework::Physics::ContactEventBenchmark
+ *  @brief 持続する大量の接触に対して、旧方式（入れ子のハッシュ表）と ContactPairTable を比べる
+ *  @details
+ *      - Jolt の初期化もウィンドウも不要なので、main の --bench-contacts からヘッドレスで実行できる
+ *      - 両方式のイベント数を突き合わせ、一致しなければ失敗扱いにする
+ */
+namespace Framework::Physics::ContactEventBenchmark
+{
+	inline constexpr size_t DefaultContactCount = 10000;	///< 既定の持続接触数
+	inline constexpr int DefaultStepCount = 600;			///< 既定の計測ステップ数（60Hz で 10 秒）
+	inline constexpr float DefaultChurnRate = 0.01f;		///< 毎ステップ入れ替わる接触の割合
+
+	/** @struct Settings
+	 *  @brief 計測条件
+	 */
+	struct Settings
+	{
+		size_t contactCount = DefaultContactCount;	///< 持続接触数
+		int stepCount = DefaultStepCount;			///< 計測ステップ数
+		float churnRate = DefaultChurnRate;			///< 毎ステップ離れて別のペアに置き換わる割合
+		int threadBuffers = 4;						///< 接触を追記するスレッドバッファ数（ワーカー数を想定）
+	};
+
+	/** @struct Result
+	 *  @brief 1 方式分の計測結果
+	 */
+	struct Result
+	{
+		double microsecondsPerStep = 0.0;	///< 1 ステップあたりの平均処理時間
+		uint64_t enteredCount = 0;			///< Enter の総数
+		uint64_t stayedCount = 0;			///< Stay の総数
+		uint64_t exitedCount = 0;			///< Exit の総数
+	};
+
+	/** @brief 旧方式（入れ子のハッシュ表・有効性の問い合わせ・表のコピー）を計測する
+	 *  @param _settings 計測条件
+	 *  @return 計測結果
+	 */
+	Result RunHashTable(const Settings& _settings);
+
+	/** @brief ContactPairTable（昇順配列の線形マージ）を計測する
+	 *  @param _settings 計測条件
+	 *  @return 計測結果
+	 */
+	Result RunSortedPairs(const Settings& _settings);
+
+	/** @brief 両方式を計測して結果を出力する
+	 *  @param _settings 計測条件
+	 *  @return イベント数が一致すれば true
+	 */
+	bool Run(const Settings& _settings);
+
+	/** @brief コマンドライン引数を解釈して計測を実行する
+	 *  @details
+	 *      --bench-contacts [contactCount] [stepCount] [churnRate]
+	 *  @param _argc 引数の数
+	 *  @param _argv 引数
+	 *  @param _outExitCode 終了コード
+	 *  @return 計測用の引数だった場合 true（アプリケーションは起動しない）
+	 */
+	bool RunCommandLine(int _argc, char** _argv, int& _outExitCode);
+} // namespace Framework::Physics::ContactEventBenchmark
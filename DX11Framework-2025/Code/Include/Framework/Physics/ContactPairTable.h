@@ -0,0 +1,127 @@
+﻿/** @file   ContactPairTable.h
+ *  @brief  接触ペアを昇順の平たい配列で保持し、前ステップとの差分から Enter/Stay/Exit を求める
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Body/BodyID.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Framework::Physics
+{
+	/// @brief 接触ペアキー（2 つの BodyID を昇順に並べて 64bit に詰めたもの）
+	using ContactPairKey = uint64_t;
+
+	/** @brief 接触ペアキーを作る
+	 *  @param _bodyA 剛体A
+	 *  @param _bodyB 剛体B
+	 *  @return 順序に依らない接触ペアキー
+	 */
+	inline ContactPairKey MakeContactPairKey(JPH::BodyID _bodyA, JPH::BodyID _bodyB)
+	{
+		JPH::uint32 a = _bodyA.GetIndexAndSequenceNumber();
+		JPH::uint32 b = _bodyB.GetIndexAndSequenceNumber();
+		if (a > b) { std::swap(a, b); }
+		return (static_cast<ContactPairKey>(a) << 32) | b;
+	}
+
+	/// @brief 接触ペアキーから BodyID が小さい側を取り出す
+	inline JPH::BodyID GetContactPairBodyA(ContactPairKey _key) { return JPH::BodyID(static_cast<JPH::uint32>(_key >> 32)); }
+
+	/// @brief 接触ペアキーから BodyID が大きい側を取り出す
+	inline JPH::BodyID GetContactPairBodyB(ContactPairKey _key) { return JPH::BodyID(static_cast<JPH::uint32>(_key & 0xFFFFFFFFull)); }
+
+	/// @brief 前ステップからの接触状態の変化
+	enum class ContactTransition
+	{
+		Entered,	///< 今ステップから接触した
+		Stayed,		///< 前ステップから接触し続けている
+		Exited,		///< 今ステップで離れた
+	};
+
+	/** @class ContactPairTable
+	 *  @brief 前ステップと今ステップの接触ペアを昇順の配列で持つ
+	 *  @details
+	 *      - 両方が昇順なので、1 回の線形マージで Enter/Stay/Exit が決まる（ハッシュ参照なし）
+	 *      - 差分を取った後は配列を入れ替えるだけで、今ステップの内容をコピーしない
+	 *      - 破棄された Body は RemoveBody で通知してもらい、差分の前にまとめて取り除く
+	 *        （ペアごとに Body の有効性を問い合わせない）
+	 */
+	class ContactPairTable
+	{
+	public:
+		/** @brief 今ステップの接触ペアを追加する（重複・順不同で良い）
+		 *  @param _pairs 追加するペア
+		 */
+		void Append(const std::vector<ContactPairKey>& _pairs);
+
+		/// @brief 今ステップの接触ペアを昇順に並べて重複を取り除く（追加し終えたら呼ぶ）
+		void Finalize();
+
+		/** @brief 破棄された Body を通知する（次の Diff で関係するペアを取り除く）
+		 *  @param _bodyID 破棄された BodyID
+		 */
+		void RemoveBody(JPH::BodyID _bodyID);
+
+		/** @brief 前ステップとの差分を通知し、今ステップを前ステップとして保持する
+		 *  @details 通知中に RemoveBody が呼ばれても良い（次の Diff で反映する）
+		 *  @param _callback void(ContactTransition, ContactPairKey)
+		 */
+		template<typename Callback>
+		void Diff(Callback&& _callback)
+		{
+			this->ApplyRemovals();
+
+			const auto& curr = this->currPairs;
+			const auto& prev = this->prevPairs;
+			size_t i = 0;
+			size_t j = 0;
+
+			while (i < curr.size() || j < prev.size())
+			{
+				if (j == prev.size() || (i < curr.size() && curr[i] < prev[j]))
+				{
+					_callback(ContactTransition::Entered, curr[i++]);
+				}
+				else if (i == curr.size() || prev[j] < curr[i])
+				{
+					_callback(ContactTransition::Exited, prev[j++]);
+				}
+				else
+				{
+					_callback(ContactTransition::Stayed, curr[i]);
+					++i;
+					++j;
+				}
+			}
+
+			this->prevPairs.swap(this->currPairs);
+			this->currPairs.clear();
+		}
+
+		/// @brief 全ての接触情報を破棄する
+		void Clear();
+
+		/// @brief 今ステップの接触ペア（Finalize 後は昇順）
+		const std::vector<ContactPairKey>& GetCurrentPairs() const { return this->currPairs; }
+
+		/// @brief 前ステップの接触ペア（昇順）
+		const std::vector<ContactPairKey>& GetPreviousPairs() const { return this->prevPairs; }
+
+	private:
+		/// @brief 破棄通知のあった Body を含むペアを取り除く
+		void ApplyRemovals();
+
+	private:
+		std::vector<ContactPairKey> currPairs;		///< 今ステップの接触ペア
+		std::vector<ContactPairKey> prevPairs;		///< 前ステップの接触ペア（昇順・重複なし）
+		std::vector<JPH::uint32> removedBodies;		///< 破棄通知のあった BodyID
+	};
+} // namespace Framework::Physics
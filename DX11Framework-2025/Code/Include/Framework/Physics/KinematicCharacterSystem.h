@@ -0,0 +1,115 @@
+﻿/** @file   KinematicCharacterSystem.h
+ *  @brief  Rigidbody3D の押し戻し・接地判定をまとめて並列に解決するシステム
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/PhysicsQuery.h"
+#include "Include/Framework/Utils/CommonTypes.h"
+#include "Include/Framework/Utils/NonCopyable.h"
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Body/BodyID.h>
+#include <Jolt/Physics/Collision/ObjectLayer.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace JPH { class Shape; }
+
+namespace Framework::Physics
+{
+	class PhysicsSystem;
+	class Rigidbody3D;
+
+	/** @struct KinematicBodyQuery
+	 *  @brief 押し戻しに使う Body 1 つ分の入力（収集時に形状・オフセットを確定させる）
+	 */
+	struct KinematicBodyQuery
+	{
+		JPH::BodyID id{};					///< 対象 Body
+		const JPH::Shape* shape = nullptr;	///< 収集時点の Body 形状
+		DX::Vector3 offset{};				///< 回転適用済みの COM オフセット
+	};
+
+	/** @struct KinematicCharacterQuery
+	 *  @brief Rigidbody3D 1 つ分のクエリ入出力
+	 */
+	struct KinematicCharacterQuery
+	{
+		Rigidbody3D* rigidbody = nullptr;		///< 書き戻し先
+		JPH::ObjectLayer objectLayer = 0;		///< コリジョンレイヤ
+		DX::Quaternion rotation{};				///< 論理回転
+		DX::Vector3 prevPosition{};				///< 前ステップの論理位置（CastShape の始点）
+		float castDeltaTime = 0.0f;				///< CastShape の移動量に使う経過時間
+		float groundProbeOffset = 0.0f;			///< ピボットから足元までの高さ（負値）
+		bool hasGroundProbe = false;			///< 接地判定を行えるか
+		bool resolveContacts = false;			///< 押し戻しを行うか（false なら移動のみで接地フラグも維持）
+		uint32_t firstBody = 0;					///< Body クエリ配列の開始位置
+		uint32_t bodyCount = 0;					///< 押し戻しに使う Body 数（トリガーは含まない）
+
+		DX::Vector3 position{};					///< 論理位置（入出力）
+		DX::Vector3 velocity{};					///< 線形速度（入出力）
+		bool isGrounded = false;				///< 接地フラグ（入出力）
+		bool needsGroundProbe = false;			///< 接地判定の Ray が必要か（解決後に ResolveGroundProbes でまとめて飛ばす）
+	};
+
+	/** @class KinematicCharacterSystem
+	 *  @brief 全 Rigidbody3D の貫通解決・CastShape・接地判定を 1 回のバッチで行う
+	 *  @details
+	 *      - 収集 : 各 Rigidbody3D が自前移動を行い、形状とオフセットを平たい配列に書き出す（逐次）
+	 *      - 解決 : Jolt のジョブシステムで並列に実行する。Body の移動は後段の SyncVisualToJolt まで
+	 *               行われないので、ロック無しの NarrowPhaseQuery を読み取り専用のスナップショットとして使う
+	 *      - 接地 : 押し戻し後の足元 Ray は PhysicsQuery::CastRays で 1 回のバッチにまとめて飛ばす
+	 *      - 反映 : 結果を一括で Rigidbody3D と Transform に書き戻す（逐次）
+	 *      - クエリ同士は互いの結果を参照しないので、逐次に解いた場合と同じ結果になる
+	 */
+	class KinematicCharacterSystem : private NonCopyable
+	{
+	public:
+		static constexpr int SolveIterations = 3;			///< 貫通解決の反復回数
+		static constexpr size_t MinCharactersPerJob = 4;	///< 1 ジョブに詰める最小キャラクター数
+
+		/** @brief コンストラクタ
+		 *  @param _physicsSystem 物理システム
+		 */
+		explicit KinematicCharacterSystem(PhysicsSystem& _physicsSystem);
+
+		/** @brief 全 Rigidbody3D の自前移動と押し戻しを行う
+		 *  @param _rigidbodies 対象（nullptr は無視）
+		 *  @param _deltaTime 固定ステップの経過時間
+		 */
+		void Step(const std::vector<Rigidbody3D*>& _rigidbodies, float _deltaTime);
+
+		/** @brief 1 キャラクター分のクエリを解決する
+		 *  @details 物理更新中でないこと（Body が動かないこと）を呼び出し側が保証する
+		 *  @param _physicsSystem 物理システム
+		 *  @param _query 入出力
+		 *  @param _bodies Body クエリ配列（_query.firstBody から _query.bodyCount 個を使う）
+		 */
+		static void SolveCharacter(PhysicsSystem& _physicsSystem, KinematicCharacterQuery& _query, const KinematicBodyQuery* _bodies);
+
+		/** @brief SolveCharacter で接地判定が必要になったクエリの足元 Ray をまとめて飛ばし、接地フラグを確定させる
+		 *  @details Ray とその結果はこのステップ限りなので、FrameArena に置く（ヒープ確保しない）
+		 *  @param _physicsSystem 物理システム
+		 *  @param _queries クエリ配列
+		 *  @param _count クエリ数
+		 */
+		static void ResolveGroundProbes(PhysicsSystem& _physicsSystem, KinematicCharacterQuery* _queries, size_t _count);
+
+	private:
+		/** @brief 範囲内のクエリを解決する（ジョブから呼ばれる）
+		 *  @param _begin 開始位置
+		 *  @param _end 終了位置
+		 */
+		void SolveRange(size_t _begin, size_t _end);
+
+	private:
+		PhysicsSystem& physicsSystem;						///< 物理システム
+		std::vector<KinematicCharacterQuery> queries;		///< キャラクターごとのクエリ（毎ステップ再利用）
+		std::vector<KinematicBodyQuery> bodyQueries;		///< 全キャラクターの Body クエリ（毎ステップ再利用）
+	};
+} // namespace Framework::Physics
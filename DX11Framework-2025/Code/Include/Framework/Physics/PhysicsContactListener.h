@@ -3,6 +3,9 @@
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/Collision/ContactListener.h>
 
+#include <atomic>
+#include <cstdint>
+
 namespace Framework::Physics
 {
 	class PhysicsSystem;
@@ -42,7 +45,20 @@ namespace Framework::Physics
          */
         void OnContactRemoved(const JPH::SubShapeIDPair& _subshapePair) override;
 
+		/** @brief 直近の更新で必要になった接触拘束の数を取り出してリセットする
+		 *  @details コールバックは Jolt が上限を確認する前に呼ばれるので、上限で捨てられた分も数に入る
+		 *  @return 接触拘束の数（maxContactConstraints と比べる値）
+		 */
+		uint32_t TakeConstraintCount() { return this->constraintCount.exchange(0, std::memory_order_relaxed); }
+
+    private:
+		/** @brief 接触拘束が作られるマニフォールドなら数える
+		 *  @details Jolt と同じ条件（センサーでなく、どちらかが質量を持つ動的 Body）で判定する
+		 */
+		void CountConstraint(const JPH::Body& _bodyA, const JPH::Body& _bodyB, const JPH::ContactSettings& _settings);
+
     private:
 		PhysicsSystem& physicsSystem;   ///< 物理システム
+		std::atomic<uint32_t> constraintCount{ 0 };	///< 更新中に作られた接触拘束の数（ワーカースレッドから加算）
     };
 }
\ No newline at end of file
@@ -0,0 +1,262 @@
+﻿/** @file   PhysicsQuery.h
+ *  @brief  レイ・オーバーラップ・ShapeCast をまとめて並列に実行する空間クエリ
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Utils/CommonTypes.h"
+#include "Include/Framework/Utils/NonCopyable.h"
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Body/BodyID.h>
+#include <Jolt/Physics/Collision/ObjectLayer.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace JPH { class Shape; }
+
+namespace Framework::Physics
+{
+	class PhysicsSystem;
+	class Collider3DComponent;
+
+	/// @brief レイヤーで絞り込まない（全ての Body を対象にする）
+	inline constexpr JPH::ObjectLayer QueryAllLayers = JPH::cObjectLayerInvalid;
+
+	//-----------------------------------------------------------------------------
+	// Query / Result
+	//-----------------------------------------------------------------------------
+
+	/** @struct RayQuery
+	 *  @brief レイキャスト 1 本分の入力
+	 */
+	struct RayQuery
+	{
+		DX::Vector3 origin{};						///< 始点
+		DX::Vector3 direction{};					///< 向きと長さ（始点 + direction が終点）
+		JPH::ObjectLayer layer = QueryAllLayers;	///< このレイヤーの Body として当たる相手だけを対象にする
+		JPH::BodyID ignoreBody{};					///< 無視する Body（自分自身など）
+	};
+
+	/** @struct RayHit
+	 *  @brief レイキャスト 1 本分の結果
+	 */
+	struct RayHit
+	{
+		bool hasHit = false;						///< 当たったか
+		float fraction = 1.0f;						///< 当たった位置（direction に対する割合）
+		DX::Vector3 point{};						///< 当たった位置
+		DX::Vector3 normal{};						///< 当たった面の法線
+		JPH::BodyID bodyID{};						///< 当たった Body
+		Collider3DComponent* collider = nullptr;	///< 当たったコライダー（未登録なら nullptr）
+	};
+
+	/** @struct OverlapQuery
+	 *  @brief オーバーラップ（形状と重なっている Body の列挙）1 回分の入力
+	 */
+	struct OverlapQuery
+	{
+		const JPH::Shape* shape = nullptr;			///< 判定に使う形状（呼び出し側が寿命を保証する）
+		DX::Vector3 position{};						///< 形状の中心位置
+		DX::Quaternion rotation{};					///< 形状の回転
+		JPH::ObjectLayer layer = QueryAllLayers;	///< このレイヤーの Body として当たる相手だけを対象にする
+		JPH::BodyID ignoreBody{};					///< 無視する Body
+		uint32_t maxHits = 16;						///< 返す Body の最大数（めり込みが深い順）
+	};
+
+	/** @struct OverlapHit
+	 *  @brief 重なっている Body 1 つ分
+	 */
+	struct OverlapHit
+	{
+		JPH::BodyID bodyID{};						///< 重なっている Body
+		Collider3DComponent* collider = nullptr;	///< 対応するコライダー（未登録なら nullptr）
+		float penetrationDepth = 0.0f;				///< めり込み量（Body 内の最大値）
+	};
+
+	/** @struct OverlapRange
+	 *  @brief 平たいヒット配列のうち、クエリ 1 回分の範囲
+	 */
+	struct OverlapRange
+	{
+		uint32_t first = 0;		///< 開始位置
+		uint32_t count = 0;		///< 個数
+	};
+
+	/** @struct ShapeCastQuery
+	 *  @brief ShapeCast 1 回分の入力
+	 */
+	struct ShapeCastQuery
+	{
+		const JPH::Shape* shape = nullptr;			///< 動かす形状（呼び出し側が寿命を保証する）
+		DX::Vector3 position{};						///< 開始位置（形状の中心）
+		DX::Quaternion rotation{};					///< 形状の回転
+		DX::Vector3 direction{};					///< 移動量
+		JPH::ObjectLayer layer = QueryAllLayers;	///< このレイヤーの Body として当たる相手だけを対象にする
+		JPH::BodyID ignoreBody{};					///< 無視する Body
+	};
+
+	/** @struct ShapeCastHit
+	 *  @brief ShapeCast 1 回分の結果（最も手前のヒット）
+	 */
+	struct ShapeCastHit
+	{
+		bool hasHit = false;						///< 当たったか
+		float fraction = 1.0f;						///< 当たった位置（direction に対する割合）
+		DX::Vector3 point{};						///< 相手側の接触点
+		DX::Vector3 normal{};						///< 相手から自分へ向かう法線
+		JPH::BodyID bodyID{};						///< 当たった Body
+		Collider3DComponent* collider = nullptr;	///< 当たったコライダー（未登録なら nullptr）
+	};
+
+	/** @struct QueryHandle
+	 *  @brief 遅延クエリの結果を引くためのハンドル
+	 */
+	struct QueryHandle
+	{
+		uint32_t index = 0;			///< 予約順の位置
+		uint32_t generation = 0;	///< 解決される世代（0 は無効）
+
+		/// @brief 予約に成功したハンドルか
+		bool IsValid() const { return this->generation != 0; }
+	};
+
+	//-----------------------------------------------------------------------------
+	// PhysicsQuery class
+	//-----------------------------------------------------------------------------
+
+	/** @class PhysicsQuery
+	 *  @brief 空間クエリを配列で受け取り、Jolt のジョブシステムで並列に実行する
+	 *  @details
+	 *      - 即時実行 : CastRays / CollideShapes / CastShapes。ロック無しの NarrowPhaseQuery を使うので、
+	 *                   物理更新中や Body の追加・移動と同時に呼ばないこと（メインスレッドの Update から呼ぶ想定）
+	 *      - 遅延実行 : Schedule* で予約しておくと、PhysicsSystem::Step の更新直後にまとめて解決される。
+	 *                   結果は次に予約分が解決されるまで Get* で引ける
+	 *      - コレクタはスレッドごとに使い回し、オーバーラップの結果は平たい配列と範囲で返す
+	 *      - 予約・取得はメインスレッドからのみ行う
+	 */
+	class PhysicsQuery : private NonCopyable
+	{
+	public:
+		static constexpr size_t MinQueriesPerJob = 16;	///< 1 ジョブに詰める最小クエリ数
+
+		/** @brief コンストラクタ
+		 *  @param _physicsSystem 物理システム
+		 */
+		explicit PhysicsQuery(PhysicsSystem& _physicsSystem);
+
+		//-----------------------------------------------------------
+		// 即時実行
+		//-----------------------------------------------------------
+
+		/** @brief レイキャストをまとめて実行する
+		 *  @param _queries 入力
+		 *  @param _outHits 結果（入力と同じ順・同じ数）
+		 */
+		void CastRays(const std::vector<RayQuery>& _queries, std::vector<RayHit>& _outHits);
+
+		/** @brief レイキャストをまとめて実行する（書き込み先は呼び出し側が用意する。FrameArena の配列など）
+		 *  @param _queries 入力
+		 *  @param _outHits 結果（入力と同じ数を用意しておくこと）
+		 */
+		void CastRays(std::span<const RayQuery> _queries, std::span<RayHit> _outHits);
+
+		/** @brief オーバーラップをまとめて実行する
+		 *  @param _queries 入力
+		 *  @param _outRanges クエリごとの範囲（入力と同じ順・同じ数）
+		 *  @param _outHits 全クエリのヒットを詰めた配列
+		 */
+		void CollideShapes(const std::vector<OverlapQuery>& _queries, std::vector<OverlapRange>& _outRanges, std::vector<OverlapHit>& _outHits);
+
+		/** @brief ShapeCast をまとめて実行する
+		 *  @param _queries 入力
+		 *  @param _outHits 結果（入力と同じ順・同じ数）
+		 */
+		void CastShapes(const std::vector<ShapeCastQuery>& _queries, std::vector<ShapeCastHit>& _outHits);
+
+		//-----------------------------------------------------------
+		// 遅延実行
+		//-----------------------------------------------------------
+
+		/** @brief レイキャストを予約する
+		 *  @param _query 入力
+		 *  @return 結果を引くハンドル
+		 */
+		QueryHandle ScheduleRay(const RayQuery& _query);
+
+		/** @brief オーバーラップを予約する
+		 *  @param _query 入力
+		 *  @return 結果を引くハンドル
+		 */
+		QueryHandle ScheduleOverlap(const OverlapQuery& _query);
+
+		/** @brief ShapeCast を予約する
+		 *  @param _query 入力
+		 *  @return 結果を引くハンドル
+		 */
+		QueryHandle ScheduleShapeCast(const ShapeCastQuery& _query);
+
+		/// @brief 予約されたクエリをまとめて解決する（PhysicsSystem::Step から呼ばれる）
+		void ResolveDeferred();
+
+		/** @brief 解決済みのレイキャスト結果を取得する
+		 *  @param _handle ScheduleRay のハンドル
+		 *  @return 結果（未解決・解決済みの世代が古い場合は nullptr）
+		 */
+		[[nodiscard]] const RayHit* GetRayHit(QueryHandle _handle) const;
+
+		/** @brief 解決済みのオーバーラップ結果を取得する
+		 *  @param _handle ScheduleOverlap のハンドル
+		 *  @param _outHits 重なっている Body の先頭
+		 *  @param _outCount 個数
+		 *  @return 解決済みなら true
+		 */
+		bool GetOverlapHits(QueryHandle _handle, const OverlapHit*& _outHits, uint32_t& _outCount) const;
+
+		/** @brief 解決済みの ShapeCast 結果を取得する
+		 *  @param _handle ScheduleShapeCast のハンドル
+		 *  @return 結果（未解決・解決済みの世代が古い場合は nullptr）
+		 */
+		[[nodiscard]] const ShapeCastHit* GetShapeCastHit(QueryHandle _handle) const;
+
+		/// @brief 予約と結果を全て破棄する
+		void Clear();
+
+	private:
+		/** @brief 予約用のハンドルを作る
+		 *  @param _index 予約順の位置
+		 *  @return ハンドル
+		 */
+		QueryHandle MakeHandle(size_t _index) const;
+
+		/** @brief ハンドルが最新の解決結果を指しているか
+		 *  @param _handle ハンドル
+		 *  @param _count 結果の数
+		 *  @return 引けるなら true
+		 */
+		bool IsResolved(QueryHandle _handle, size_t _count) const;
+
+	private:
+		PhysicsSystem& physicsSystem;					///< 物理システム
+
+		std::vector<RayQuery> pendingRays;				///< 予約中のレイキャスト
+		std::vector<OverlapQuery> pendingOverlaps;		///< 予約中のオーバーラップ
+		std::vector<ShapeCastQuery> pendingCasts;		///< 予約中の ShapeCast
+
+		std::vector<RayHit> rayResults;					///< 解決済みのレイキャスト結果
+		std::vector<OverlapRange> overlapRanges;		///< 解決済みのオーバーラップ範囲
+		std::vector<OverlapHit> overlapResults;			///< 解決済みのオーバーラップ結果
+		std::vector<ShapeCastHit> castResults;			///< 解決済みの ShapeCast 結果
+
+		std::vector<uint32_t> overlapOffsets;			///< オーバーラップ用の作業領域（クエリごとの書き込み位置）
+		std::vector<OverlapHit> overlapScratch;			///< オーバーラップ用の作業領域（詰める前のヒット）
+
+		uint32_t pendingGeneration = 1;					///< 予約中のクエリが解決される世代
+		uint32_t resolvedGeneration = 0;				///< 最後に解決した世代
+	};
+} // namespace Framework::Physics
@@ -0,0 +1,151 @@
+﻿/** @file   PhysicsRecorder.h
+ *  @brief  物理ワールドへの操作とステップごとの状態ハッシュをバイナリログに記録する
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/PhysicsTelemetry.h"
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/StreamWrapper.h>
+#include <Jolt/Physics/Body/BodyCreationSettings.h>
+#include <Jolt/Physics/Body/BodyID.h>
+#include <Jolt/Physics/EActivation.h>
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace Framework::Physics
+{
+	inline constexpr uint32_t RecordMagic = 0x43455250;		///< "PREC"
+	inline constexpr uint32_t RecordVersion = 1;			///< ログのバージョン
+	inline constexpr char RecordExtension[] = ".prec";		///< 保存ファイルの拡張子
+
+	/** @enum  RecordType
+	 *  @brief ログ 1 件の種類（ファイルに保存する値なので並びを変えないこと）
+	 */
+	enum class RecordType : uint8_t
+	{
+		End = 0,				///< ログの終わり
+		CreateBody = 1,			///< BodyID, BodyCreationSettings::SaveWithChildren
+		AddBody = 2,			///< BodyID, EActivation
+		AddBodies = 3,			///< EActivation, 個数, BodyID...（AddBodiesPrepare / Finalize）
+		RemoveBody = 4,			///< BodyID
+		DestroyBody = 5,		///< BodyID
+		MoveKinematic = 6,		///< BodyID, 位置, 回転, 経過時間
+		SetMotionType = 7,		///< BodyID, EMotionType, EActivation
+		SetMotionQuality = 8,	///< BodyID, EMotionQuality
+		SetObjectLayer = 9,		///< BodyID, ObjectLayer
+		OptimizeBroadPhase = 10,///< なし
+		Step = 11,				///< 経過時間, ステップ後の状態ハッシュ
+	};
+
+	/** @struct RecordHeader
+	 *  @brief ログのヘッダ（再生側は同じ容量で PhysicsSystem を作る）
+	 */
+	struct RecordHeader
+	{
+		uint32_t magic = RecordMagic;			///< 識別子
+		uint32_t version = RecordVersion;		///< バージョン
+		uint32_t maxBodies = 0;					///< PhysicsConfig::maxBodies
+		uint32_t maxBodyPairs = 0;				///< PhysicsConfig::maxBodyPairs
+		uint32_t maxContactConstraints = 0;		///< PhysicsConfig::maxContactConstraints
+		uint32_t tempAllocatorSize = 0;			///< PhysicsConfig::tempAllocatorSize
+		uint32_t workerThreads = 0;				///< PhysicsConfig::workerThreads
+		uint32_t reserved = 0;					///< 予約
+	};
+
+	static_assert(sizeof(RecordHeader) == 32);
+
+	/** @class PhysicsRecorder
+	 *  @brief PhysicsSystem を通った Body の操作と固定ステップをそのまま書き出す
+	 *  @details
+	 *      - 記録するのは Jolt に渡した値そのもの（入力やゲームロジックの結果は MoveKinematic 等に現れる）
+	 *      - Body は元の BodyID ごと記録し、再生側は CreateBodyWithID で同じ ID に作る
+	 *      - 形状やマテリアルは ID で共有されるので、同じ形状の Body が多くてもログは膨らまない
+	 *
+	 *  ログのレイアウト（リトルエンディアン）
+	 *      RecordHeader
+	 *      (RecordType, 内容) の繰り返し
+	 *      RecordType::End
+	 */
+	class PhysicsRecorder
+	{
+	public:
+		PhysicsRecorder();
+		~PhysicsRecorder();
+
+		/** @brief 記録を開始する（ヘッダを書き出す）
+		 *  @param _path 出力先
+		 *  @param _config PhysicsSystem の容量設定
+		 *  @return 開けなければ false
+		 */
+		bool Begin(const std::string& _path, const PhysicsConfig& _config);
+
+		/// @brief 終端を書き出してファイルを閉じる
+		void End();
+
+		/// @brief 記録中か
+		[[nodiscard]] bool IsRecording() const { return this->stream != nullptr; }
+
+		/// @brief 記録したステップ数
+		[[nodiscard]] uint64_t GetStepCount() const { return this->stepCount; }
+
+		//-----------------------------------------------------------------------------
+		// 以下、BodyInterface の同名関数を呼んだ直後に同じ引数で呼ぶ（記録中でなければ何もしない）
+		//-----------------------------------------------------------------------------
+
+		/// @brief Body の生成（作成時点の設定を丸ごと書き出す）
+		void CreateBody(JPH::BodyID _bodyID, const JPH::BodyCreationSettings& _settings);
+
+		/// @brief Body 1 つの追加
+		void AddBody(JPH::BodyID _bodyID, JPH::EActivation _activation);
+
+		/// @brief Body の一括追加
+		void AddBodies(const JPH::BodyID* _bodyIDs, int _count, JPH::EActivation _activation);
+
+		/// @brief Body をワールドから取り除く
+		void RemoveBody(JPH::BodyID _bodyID);
+
+		/// @brief Body の破棄
+		void DestroyBody(JPH::BodyID _bodyID);
+
+		/// @brief Kinematic Body の移動
+		void MoveKinematic(JPH::BodyID _bodyID, JPH::RVec3Arg _position, JPH::QuatArg _rotation, float _deltaTime);
+
+		/// @brief MotionType の変更
+		void SetMotionType(JPH::BodyID _bodyID, JPH::EMotionType _motionType, JPH::EActivation _activation);
+
+		/// @brief MotionQuality の変更
+		void SetMotionQuality(JPH::BodyID _bodyID, JPH::EMotionQuality _motionQuality);
+
+		/// @brief ObjectLayer の変更
+		void SetObjectLayer(JPH::BodyID _bodyID, JPH::ObjectLayer _layer);
+
+		/// @brief BroadPhase の作り直し
+		void OptimizeBroadPhase();
+
+		/** @brief 固定ステップを記録する
+		 *  @param _deltaTime ステップ幅
+		 *  @param _stateHash ステップ後の状態ハッシュ（PhysicsSystem::ComputeStateHash）
+		 */
+		void Step(float _deltaTime, uint64_t _stateHash);
+
+	private:
+		/// @brief 種類と BodyID を書き出す
+		void WriteBodyRecord(RecordType _type, JPH::BodyID _bodyID);
+
+	private:
+		std::ofstream file;										///< 出力先
+		std::unique_ptr<JPH::StreamOutWrapper> stream;			///< Jolt のシリアライズ用ラッパー（記録中のみ）
+		JPH::BodyCreationSettings::ShapeToIDMap shapeMap;		///< 書き出し済みの形状
+		JPH::BodyCreationSettings::MaterialToIDMap materialMap;	///< 書き出し済みのマテリアル
+		JPH::BodyCreationSettings::GroupFilterToIDMap groupFilterMap;	///< 書き出し済みのグループフィルタ
+		uint64_t stepCount;										///< 記録したステップ数
+	};
+} // namespace Framework::Physics
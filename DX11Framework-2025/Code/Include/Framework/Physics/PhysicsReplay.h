@@ -0,0 +1,68 @@
+﻿/** @file   PhysicsReplay.h
+ *  @brief  PhysicsRecorder のログをヘッドレスで再生し、状態ハッシュの照合とステップごとの計測を行う
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <cstdint>
+#include <string>
+
+//-----------------------------------------------------------------------------
+// Namespace : Framework::Physics::PhysicsReplay
+//-----------------------------------------------------------------------------
+/** @namespace Framework::Physics::PhysicsReplay
+ *  @brief 記録した物理ログを PhysicsSystem::Step + ProcessContactEvents で再実行する
+ *  @details
+ *      - ウィンドウも D3D も作らずに main の --replay-physics から実行できる
+ *      - FRAMEWORK_PHYSICS_HEADLESS でビルドすれば DirectX 無しの単体実行ファイルにもなる（PhysicsReplayMain.cpp）
+ *      - ステップごとに記録時の状態ハッシュと照合し、1 つでも食い違えば失敗扱いにする
+ *      - 処理時間はステップごとに測り、平均が予算を超えても失敗扱いにできる（性能の退行検出用）
+ */
+namespace Framework::Physics::PhysicsReplay
+{
+	/** @struct Settings
+	 *  @brief 再生条件
+	 */
+	struct Settings
+	{
+		std::string logPath;					///< 再生するログ
+		std::string timingCsvPath;				///< ステップごとの計測結果の出力先（空なら出力しない）
+		uint32_t workerThreads = 0;				///< ワーカースレッド数（0 なら記録時と同じ）
+		double maxAverageMilliseconds = 0.0;	///< 1 ステップの平均処理時間の上限（0 なら判定しない）
+	};
+
+	/** @struct Result
+	 *  @brief 再生結果
+	 */
+	struct Result
+	{
+		bool loaded = false;				///< ログを最後まで読めたか
+		uint64_t stepCount = 0;				///< 再生したステップ数
+		uint64_t mismatchCount = 0;			///< 状態ハッシュが食い違ったステップ数
+		int64_t firstMismatchStep = -1;		///< 最初に食い違ったステップ（無ければ -1）
+		double averageMilliseconds = 0.0;	///< 1 ステップの平均処理時間
+		double p95Milliseconds = 0.0;		///< 1 ステップの処理時間の 95 パーセンタイル
+		double maxMilliseconds = 0.0;		///< 1 ステップの最大処理時間
+		uint64_t slowestStep = 0;			///< 最も遅かったステップ
+	};
+
+	/** @brief ログを再生する
+	 *  @param _settings 再生条件
+	 *  @return 再生結果
+	 */
+	Result Run(const Settings& _settings);
+
+	/** @brief コマンドライン引数を解釈して再生を実行する
+	 *  @details
+	 *      --replay-physics <log> [timingCsv] [maxAverageMs] [workerThreads]
+	 *      （timingCsv に - を渡すと出力しない）
+	 *  @param _argc 引数の数
+	 *  @param _argv 引数
+	 *  @param _outExitCode 終了コード（ハッシュ不一致・予算超過・読み込み失敗なら 1）
+	 *  @return 再生用の引数だった場合 true（アプリケーションは起動しない）
+	 */
+	bool RunCommandLine(int _argc, char** _argv, int& _outExitCode);
+} // namespace Framework::Physics::PhysicsReplay
@@ -0,0 +1,147 @@
+﻿/** @file   PhysicsTelemetry.h
+ *  @brief  物理システムの容量設定と、使用量・処理時間の計測
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/TempAllocator.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace Framework::Physics
+{
+	/** @struct PhysicsConfig
+	 *  @brief 物理システムの容量設定（PhysicsSystem::Initialize に渡す）
+	 *  @details 上限を超えると Jolt は接触を黙って捨てる（一時アロケータは abort する）ので、
+	 *           シーンの規模に合わせて余裕を持たせること
+	 */
+	struct PhysicsConfig
+	{
+		uint32_t maxBodies = 2048;						///< 最大 Body 数
+		uint32_t maxBodyPairs = 8192;					///< BroadPhase で重なった Body ペアの最大数
+		uint32_t maxContactConstraints = 4096;			///< 接触拘束の最大数
+		uint32_t tempAllocatorSize = 10 * 1024 * 1024;	///< 物理更新で使う一時領域のバイト数
+		uint32_t workerThreads = 1;						///< ジョブシステムのワーカースレッド数
+		uint32_t bodyPairSampleInterval = 60;			///< Body ペア数を数える間隔（ステップ数。数えるたびに BroadPhase をもう一度引く。0 なら数えない）
+		float warningRatio = 0.8f;						///< 使用率がこれを超えたら警告する
+	};
+
+	/** @struct PhysicsStats
+	 *  @brief 直近ステップの使用量と処理時間
+	 */
+	struct PhysicsStats
+	{
+		uint64_t stepCount = 0;				///< これまでのステップ数
+
+		uint32_t bodyCount = 0;				///< 登録中の Body 数
+		uint32_t activeBodyCount = 0;		///< 起きている動的 Body 数
+		uint32_t maxBodies = 0;				///< 最大 Body 数
+
+		uint32_t contactPairCount = 0;		///< 接触している Body ペア数（センサー含む、イベント用）
+		uint32_t bodyPairCount = 0;			///< BroadPhase で重なった Body ペア数（Jolt の Body ペアキャッシュの使用量。bodyPairSampleInterval ごとの値）
+		uint32_t maxBodyPairs = 0;			///< Body ペアの上限
+		uint32_t contactConstraintCount = 0;///< 必要だった接触拘束の数（上限で捨てた分も含む。センサー・質量のない組み合わせは含まない）
+		uint32_t maxContactConstraints = 0;	///< 接触拘束の上限
+
+		size_t tempAllocatorStepPeak = 0;	///< 直近ステップの一時領域の最大使用量
+		size_t tempAllocatorPeak = 0;		///< 初期化以降の一時領域の最大使用量
+		size_t tempAllocatorSize = 0;		///< 一時領域のサイズ
+
+		uint32_t updateErrors = 0;			///< 直近ステップの JPH::EPhysicsUpdateError（ビットの組み合わせ）
+		uint64_t overflowStepCount = 0;		///< 接触を捨てたステップ数
+
+		double updateMilliseconds = 0.0;	///< Jolt の更新（BroadPhase・NarrowPhase・ソルバー）
+		double contactMilliseconds = 0.0;	///< 接触ペアの集約
+		double queryMilliseconds = 0.0;		///< 遅延クエリの解決
+		double bodyPairMilliseconds = 0.0;	///< Body ペア数の計測（数えなかったステップは 0）
+		double stepMilliseconds = 0.0;		///< Step 全体（Body ペア数の計測も含む）
+	};
+
+	/** @class TrackingTempAllocator
+	 *  @brief 使用量の最大値を記録する一時アロケータ
+	 *  @details Jolt は一時アロケータを同時に 1 スレッドからしか使わないので、記録にロックは要らない
+	 */
+	class TrackingTempAllocator final : public JPH::TempAllocator
+	{
+	public:
+		JPH_OVERRIDE_NEW_DELETE
+
+		/** @brief コンストラクタ
+		 *  @param _size 確保するバイト数
+		 */
+		explicit TrackingTempAllocator(uint32_t _size) : impl(_size) {}
+
+		void* Allocate(JPH::uint _size) override
+		{
+			void* address = this->impl.Allocate(_size);
+			this->stepPeak = std::max(this->stepPeak, this->impl.GetUsage());
+			return address;
+		}
+
+		void Free(void* _address, JPH::uint _size) override
+		{
+			this->impl.Free(_address, _size);
+		}
+
+		/// @brief 直近の計測区間の最大使用量を取り出して区間をリセットする
+		size_t TakeStepPeak()
+		{
+			const size_t peak = this->stepPeak;
+			this->stepPeak = this->impl.GetUsage();
+			return peak;
+		}
+
+		/// @brief 確保済みのバイト数
+		size_t GetSize() const { return this->impl.GetSize(); }
+
+	private:
+		JPH::TempAllocatorImpl impl;	///< 実際の確保を行うアロケータ
+		size_t stepPeak = 0;			///< 計測区間の最大使用量
+	};
+
+	/** @class PhysicsTelemetry
+	 *  @brief ステップごとの計測値をまとめ、上限に近づいたら警告を出す
+	 *  @details
+	 *      - 使用率が PhysicsConfig::warningRatio を超えた時に 1 回だけ警告し、下回ったら再び警告できるようにする
+	 *      - Jolt が接触を捨てたステップ（EPhysicsUpdateError）は、毎ステップ報告する
+	 */
+	class PhysicsTelemetry
+	{
+	public:
+		/** @brief 容量設定を反映して計測値をリセットする
+		 *  @param _config 容量設定
+		 */
+		void Reset(const PhysicsConfig& _config);
+
+		/** @brief 1 ステップ分の計測値を記録して上限を確認する
+		 *  @param _stats 直近ステップの計測値（累計値は内部で更新する）
+		 */
+		void Record(const PhysicsStats& _stats);
+
+		/// @brief 直近ステップの計測値
+		const PhysicsStats& GetStats() const { return this->stats; }
+
+	private:
+		/** @brief 使用率を確認して警告する
+		 *  @param _label 対象名
+		 *  @param _used 使用量
+		 *  @param _capacity 上限
+		 *  @param _warned 警告済みフラグ（入出力）
+		 */
+		void CheckUsage(const char* _label, size_t _used, size_t _capacity, bool& _warned) const;
+
+	private:
+		PhysicsStats stats;					///< 直近ステップの計測値
+		float warningRatio = 0.8f;			///< 警告する使用率
+		bool bodyWarned = false;			///< Body 数の警告済みフラグ
+		bool bodyPairWarned = false;		///< Body ペア数の警告済みフラグ
+		bool constraintWarned = false;		///< 接触拘束数の警告済みフラグ
+		bool tempWarned = false;			///< 一時領域の警告済みフラグ
+	};
+} // namespace Framework::Physics
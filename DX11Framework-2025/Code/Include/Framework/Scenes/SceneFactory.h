@@ -7,6 +7,7 @@
 #include"Include/Framework/Entities/GameObjectManager.h"
 #include"Include/Framework/Scenes/SceneType.h"
 #include"Include/Framework/Scenes/BaseScene.h"
+#include"Include/Framework/Scenes/SceneManifest.h"
 
 #include <memory>
 #include <functional>
@@ -29,8 +30,9 @@ public:
 	/**	@brief	指定のSceneTypeに対応する生成関数を登録する
 	 *	@param	SceneType	_type		生成するシーンの種類
 	 *	@param	Creator		_creator	生成するシーンの種類
+	 *	@param	SceneManifest	_manifest	遷移前に読み込んでおくリソース（空なら読み込まない）
 	 */
-	void Register(SceneType _type, Creator _creator);
+	void Register(SceneType _type, Creator _creator, SceneManifest _manifest = {});
 
 	/**	@brief　指定されたSceneTypeに対応するシーンを生成して返す
 	 *	@param	SceneType					_type	生成するシーンの種類
@@ -38,6 +40,13 @@ public:
 	 */
 	std::unique_ptr<BaseScene> Create(SceneType _type) const;
 
+	/**	@brief	指定されたSceneTypeのリソース一覧を返す
+	 *	@param	SceneType				_type	シーンの種類
+	 *	@return	const SceneManifest*			リソース一覧（未登録なら nullptr）
+	 */
+	const SceneManifest* GetManifest(SceneType _type) const;
+
 private:
-	std::unordered_map<SceneType, Creator> registry;	///< SceneTypeとその生成関数の対応表
+	std::unordered_map<SceneType, Creator> registry;		///< SceneTypeとその生成関数の対応表
+	std::unordered_map<SceneType, SceneManifest> manifests;	///< SceneTypeとそのリソース一覧の対応表
 };
@@ -0,0 +1,19 @@
+﻿/**	@file	SceneManifest.h
+*	@date	2026/10/18
+*/
+#pragma once
+#include <string>
+#include <vector>
+
+/**	@struct	SceneManifest
+ *	@brief	シーンが使うリソースの一覧（遷移前にバックグラウンドで読み込む）
+ *	@details	一覧に無いリソースは従来どおり SetupObjects の Register で読み込まれる
+ */
+struct SceneManifest
+{
+	std::vector<std::string> models;			///< ModelManager に登録するモデル名
+	std::vector<std::string> animationClips;	///< AnimationClipManager に登録するクリップ名
+
+	/// @brief	読み込むものが無いか
+	bool IsEmpty() const { return this->models.empty() && this->animationClips.empty(); }
+};
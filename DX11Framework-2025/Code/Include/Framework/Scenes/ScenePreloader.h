@@ -0,0 +1,72 @@
+﻿/**	@file	ScenePreloader.h
+*	@date	2026/10/18
+*/
+#pragma once
+#include"Include/Framework/Utils/NonCopyable.h"
+#include"Include/Framework/Scenes/SceneManifest.h"
+#include"Include/Framework/Graphics/ModelManager.h"
+#include"Include/Framework/Graphics/AnimationClipManager.h"
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**	@class		ScenePreloader
+ *	@brief		次のシーンのリソースをワーカースレッドで読み込み、メインスレッドで一度に登録する
+ *	@details
+ *		- ファイル読み込み・解析・テクスチャ作成はワーカー、メッシュの GPU 転送と登録表への追加は Commit（メインスレッド）で行う
+ *		- 読み込み中も現在のシーンは動かしてよい（登録表は Commit まで書き換えない）
+ *		- このクラスはコピー、代入を禁止している
+ */
+class ScenePreloader :private NonCopyable
+{
+public:
+	/// @brief	コンストラクタ
+	ScenePreloader();
+	/// @brief	デストラクタ（読み込み中なら終わるまで待つ）
+	~ScenePreloader();
+
+	/**	@brief	読み込みを開始する（メインスレッドで呼ぶ）
+	 *	@param	const SceneManifest&	_manifest	読み込むリソースの一覧
+	 */
+	void Start(const SceneManifest& _manifest);
+
+	/**	@brief	読み込みの進み具合
+	 *	@return	float	0.0 ～ 1.0（読み込むものが無ければ 1.0）
+	 */
+	float GetProgress() const;
+
+	/**	@brief	全て読み込み終えたか
+	 *	@return	bool	終えていれば true
+	 */
+	bool IsReady() const;
+
+	/**	@brief	読み込んだリソースを登録する（メインスレッドで呼ぶ。読み込み中なら終わるまで待つ）
+	 */
+	void Commit();
+
+private:
+	static constexpr size_t MaxWorkerCount = 4;		///< 読み込みに使うスレッドの上限
+
+	/// @brief	ワーカーの処理（残っている項目を順に取り出して読み込む）
+	void WorkerMain();
+
+	/// @brief	ワーカーの終了を待つ
+	void Wait();
+
+private:
+	std::vector<std::string> modelKeys;											///< 読み込むモデル名
+	std::vector<std::string> clipKeys;											///< 読み込むクリップ名
+	std::vector<ModelManager::PreloadedModel> models;							///< 読み込んだモデル（modelKeys と同じ並び）
+	std::vector<std::shared_ptr<Graphics::Import::AnimationClip>> clips;		///< 読み込んだクリップ（clipKeys と同じ並び）
+
+	std::vector<std::future<void>> workers;		///< ワーカー
+	std::atomic<size_t> nextIndex{ 0 };			///< 次に取り出す項目（モデル→クリップの順の通し番号）
+	std::atomic<size_t> completedCount{ 0 };	///< 読み込み終えた項目数
+	size_t totalCount = 0;						///< 項目数
+
+	ModelManager* modelManager = nullptr;					///< 読み込み先
+	AnimationClipManager* animationClipManager = nullptr;	///< 読み込み先
+};
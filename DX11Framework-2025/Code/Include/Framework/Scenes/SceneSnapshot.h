@@ -0,0 +1,220 @@
+﻿/**	@file	SceneSnapshot.h
+*	@date	2026/10/18
+*/
+#pragma once
+#include"Include/Framework/Entities/GameObjectManager.h"
+#include"Include/Framework/Scenes/SceneManifest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// SnapshotWriter / SnapshotReader
+//-----------------------------------------------------------------------------
+
+/**	@class	SnapshotWriter
+ *	@brief	コンポーネント 1 つ分のデータを書き出す（文字列は文字列表の番号で書く）
+ */
+class SnapshotWriter
+{
+public:
+	/**	@brief	コンストラクタ
+	 *	@param	std::vector<uint8_t>&							_payload	書き出し先
+	 *	@param	std::unordered_map<std::string, uint32_t>&		_stringIndices	文字列表の逆引き
+	 *	@param	std::vector<std::string>&						_strings	文字列表
+	 */
+	SnapshotWriter(std::vector<uint8_t>& _payload, std::unordered_map<std::string, uint32_t>& _stringIndices, std::vector<std::string>& _strings)
+		: payload(_payload), stringIndices(_stringIndices), strings(_strings) {}
+
+	/**	@brief	値をそのまま書き出す
+	 *	@param	const T&	_value	値（memcpy できる型）
+	 */
+	template<typename T>
+	void Write(const T& _value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "memcpy できない型は書き出せません。");
+		const size_t offset = this->payload.size();
+		this->payload.resize(offset + sizeof(T));
+		std::memcpy(this->payload.data() + offset, &_value, sizeof(T));
+	}
+
+	/**	@brief	文字列を書き出す（同じ文字列は 1 回だけ保存される）
+	 *	@param	const std::string&	_text	文字列
+	 */
+	void WriteString(const std::string& _text);
+
+private:
+	std::vector<uint8_t>& payload;								///< 書き出し先
+	std::unordered_map<std::string, uint32_t>& stringIndices;	///< 文字列表の逆引き
+	std::vector<std::string>& strings;							///< 文字列表
+};
+
+/**	@class	SnapshotReader
+ *	@brief	コンポーネント 1 つ分のデータを読み込む（範囲外を読もうとすると失敗する）
+ */
+class SnapshotReader
+{
+public:
+	/**	@brief	コンストラクタ
+	 *	@param	const uint8_t*					_begin		先頭
+	 *	@param	const uint8_t*					_end		終端
+	 *	@param	const std::vector<std::string>&	_strings	文字列表
+	 */
+	SnapshotReader(const uint8_t* _begin, const uint8_t* _end, const std::vector<std::string>& _strings)
+		: cursor(_begin), end(_end), strings(_strings) {}
+
+	/**	@brief	値をそのまま読み込む
+	 *	@param	T&		_outValue	読み込み先（memcpy できる型）
+	 *	@return	bool	読めれば true
+	 */
+	template<typename T>
+	bool Read(T& _outValue)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "memcpy できない型は読み込めません。");
+		if (static_cast<size_t>(this->end - this->cursor) < sizeof(T)) { return false; }
+		std::memcpy(&_outValue, this->cursor, sizeof(T));
+		this->cursor += sizeof(T);
+		return true;
+	}
+
+	/**	@brief	文字列を読み込む
+	 *	@param	std::string&	_outText	読み込み先
+	 *	@return	bool			読めれば true
+	 */
+	bool ReadString(std::string& _outText);
+
+private:
+	const uint8_t* cursor;						///< 読み込み位置
+	const uint8_t* end;							///< 終端
+	const std::vector<std::string>& strings;	///< 文字列表
+};
+
+//-----------------------------------------------------------------------------
+// SceneSnapshot
+//-----------------------------------------------------------------------------
+
+/**	@class	SceneSnapshot
+ *	@brief	ゲームオブジェクトの構成をバイナリに保存し、まとめて復元する
+ *	@details
+ *		- 保存するのはオブジェクト（名前・タグ・有効状態・親子関係）、コンポーネントのデータ、参照するリソース名
+ *		- 復元は GameObjectManager::InstantiateBulk で行い、オブジェクトごとのイベント通知を出さない
+ *		- コンポーネントは RegisterComponent で登録した型だけ保存される（未登録の型は飛ばして警告する）
+ *		- 登録名はファイルに残るので、型を追加するときは既存の名前を変えないこと
+ *		- メッシュ・マテリアル・テクスチャはポインタではなく各マネージャーの登録名で残す
+ *		- main の --scene-snapshot-selftest で、保存→復元の往復をヘッドレスで確認できる
+ *
+ *	ファイルのレイアウト（リトルエンディアン）
+ *		FileHeader
+ *		文字列表    : (uint32 長さ, 文字列) × stringCount
+ *		マニフェスト : uint32 文字列番号 × (modelCount + clipCount)
+ *		ObjectRecord × objectCount（親は子より前）
+ *		ComponentRecord × componentCount（オブジェクト順）
+ *		データ      : payloadBytes バイト
+ */
+class SceneSnapshot
+{
+public:
+	static constexpr uint32_t Magic = 0x4E534344;			///< "DCSN"
+	static constexpr uint32_t Version = 1;					///< ファイルのバージョン
+	static constexpr char Extension[] = ".scene";			///< 保存ファイルの拡張子
+
+	/**	@struct	ComponentCodec
+	 *	@brief	コンポーネント 1 種類の保存・復元方法（RegisterComponent で作る）
+	 */
+	struct ComponentCodec
+	{
+		std::string typeName;											///< ファイルに残す型名
+		std::function<Component*(GameObject&)> attach;					///< 通知なしで付ける
+		std::function<void(const Component&, SnapshotWriter&)> save;	///< データの書き出し
+		std::function<bool(Component&, SnapshotReader&)> load;			///< データの読み込み
+	};
+
+	/**	@brief	コンポーネントの型を登録する（保存・復元できるようにする）
+	 *	@param	const std::string&									_typeName	ファイルに残す型名
+	 *	@param	std::function<void(const T&, SnapshotWriter&)>		_save		データの書き出し（無ければ付けるだけ）
+	 *	@param	std::function<bool(T&, SnapshotReader&)>			_load		データの読み込み（無ければ付けるだけ）
+	 */
+	template<typename T>
+	static void RegisterComponent(const std::string& _typeName,
+		std::function<void(const T&, SnapshotWriter&)> _save = nullptr,
+		std::function<bool(T&, SnapshotReader&)> _load = nullptr)
+	{
+		static_assert(std::is_base_of_v<Component, T>, "クラス T はComponentから派生する必要があります。");
+
+		ComponentCodec codec{};
+		codec.typeName = _typeName;
+		codec.attach = [](GameObject& _owner) -> Component*
+			{
+				// Instantiate で必ず付くものは付け直さずに既存のものを使う
+				if constexpr (std::is_same_v<T, Transform>) { return _owner.GetTransform(); }
+				else if constexpr (std::is_same_v<T, TimeScaleComponent>) { return _owner.TimeScale(); }
+				else { return _owner.AttachComponentSilently(std::make_unique<T>(&_owner)); }
+			};
+		if (_save)
+		{
+			codec.save = [save = std::move(_save)](const Component& _component, SnapshotWriter& _writer)
+				{
+					save(static_cast<const T&>(_component), _writer);
+				};
+		}
+		if (_load)
+		{
+			codec.load = [load = std::move(_load)](Component& _component, SnapshotReader& _reader)
+				{
+					return load(static_cast<T&>(_component), _reader);
+				};
+		}
+		AddCodec(std::type_index(typeid(T)), std::move(codec));
+	}
+
+	/**	@brief	管理中のゲームオブジェクトを保存する
+	 *	@param	const std::string&		_path		保存先
+	 *	@param	const GameObjectManager&	_manager	保存するオブジェクトの管理
+	 *	@param	const SceneManifest&	_resources	読み込み時に先に登録しておくリソース
+	 *	@return	bool					保存できれば true
+	 */
+	static bool Save(const std::string& _path, const GameObjectManager& _manager, const SceneManifest& _resources = {});
+
+	/**	@brief	保存したゲームオブジェクトを復元する（シーンの SetupObjects から呼ぶ）
+	 *	@param	const std::string&	_path		読み込むファイル
+	 *	@param	GameObjectManager&	_manager	生成先
+	 *	@return	bool				復元できれば true（失敗時は 1 つも生成しない）
+	 */
+	static bool Load(const std::string& _path, GameObjectManager& _manager);
+
+	/**	@brief	保存したリソース一覧だけを読み込む（ScenePreloader に渡す用）
+	 *	@param	const std::string&	_path			読み込むファイル
+	 *	@param	SceneManifest&		_outResources	読み込み先
+	 *	@return	bool				読めれば true
+	 */
+	static bool ReadManifest(const std::string& _path, SceneManifest& _outResources);
+
+	/**	@brief	テスト用のオブジェクトを保存・復元し、オブジェクト・親子関係・コンポーネントのデータが元と一致するか検証する
+	 *	@details	途中で切れたファイルを読まないこと、リソース一覧が戻ることも確認する
+	 *	@return	bool	全て一致すれば true
+	 */
+	static bool RunSelfTest();
+
+	/**	@brief	コマンドライン引数を解釈してセルフテストを実行する
+	 *	@details	--scene-snapshot-selftest
+	 *	@param	int		_argc			引数の数
+	 *	@param	char**	_argv			引数
+	 *	@param	int&	_outExitCode	終了コード
+	 *	@return	bool	セルフテスト用の引数だった場合 true（アプリケーションは起動しない）
+	 */
+	static bool RunCommandLine(int _argc, char** _argv, int& _outExitCode);
+
+private:
+	/**	@brief	型の保存・復元方法を登録する（同じ型を登録し直すと置き換わる）
+	 *	@param	std::type_index		_type	型
+	 *	@param	ComponentCodec		_codec	保存・復元方法
+	 */
+	static void AddCodec(std::type_index _type, ComponentCodec _codec);
+};
@@ -6,6 +6,7 @@
 #include"Include/Framework/Core/IResourceManager.h"
 #include"Include/Framework/Shaders/ShaderBase.h"
 #include"Include/Framework/Shaders/ShaderCommon.h"
+#include"Include/Framework/Graphics/VertexTypes.h"
 
 #include<unordered_map>
 #include<memory>
@@ -72,6 +73,13 @@ public:
 	 */
 	ShaderProgram* GetShaderProgram(const std::string& _programName);
 
+	/**	@brief 頂点形式に合ったモデル描画用シェーダープログラムの取得
+	 *	@param Graphics::VertexFormat _format	メッシュの頂点形式
+	 *	@param bool _skinned					スキニング描画か
+	 *	@return ShaderProgram*	シェーダープログラムの参照
+	 */
+	ShaderProgram* GetModelShaderProgram(Graphics::VertexFormat _format, bool _skinned);
+
 	/**	@brief シェーダー情報を事前登録する
 	 *	@param	const std::string& _key	リソースのキー
 	 *	@param	const ShaderInfo& _info	シェーダー情報
@@ -0,0 +1,76 @@
+﻿/** @file   AllocationCounter.h
+ *  @brief  ヒープ確保回数の計測（フレームごとの確保回数を監視する）
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <cstdint>
+
+//-----------------------------------------------------------------------------
+// Namespace : Framework::Memory
+//-----------------------------------------------------------------------------
+namespace Framework::Memory
+{
+	namespace Config
+	{
+#if defined(FRAMEWORK_DISABLE_ALLOCATION_COUNTER)
+		inline constexpr bool BuildEnableAllocationCounter = false;
+#else
+		inline constexpr bool BuildEnableAllocationCounter = true;
+#endif
+
+		inline constexpr uint32_t SteadyStateWarmupFrames = 120;	///< 定常状態とみなすまでのフレーム数（起動・シーン遷移の後）
+	}
+
+	/** @brief プロセス開始からのヒープ確保回数（operator new の呼び出し回数）
+	 *  @return 回数（FRAMEWORK_DISABLE_ALLOCATION_COUNTER なら常に 0）
+	 */
+	[[nodiscard]] uint64_t GetHeapAllocationCount();
+
+	//-----------------------------------------------------------------------------
+	// FrameAllocationMonitor class
+	//-----------------------------------------------------------------------------
+	/** @class FrameAllocationMonitor
+	 *  @brief フレームごとのヒープ確保回数を数え、定常状態で確保したフレームを報告する
+	 *  @details
+	 *      - 目標は定常状態で 0 回。最大値を更新したときだけログを出す
+	 *      - 起動直後とシーン遷移の後は SteadyStateWarmupFrames だけ数えない
+	 */
+	class FrameAllocationMonitor
+	{
+	public:
+		/// @brief コンストラクタ
+		FrameAllocationMonitor();
+
+		/** @brief フレームを終える
+		 *  @param _isSteady 定常状態として数えてよいか（シーン遷移中などは false）
+		 */
+		void EndFrame(bool _isSteady);
+
+		/// @brief 直前のフレームの確保回数
+		[[nodiscard]] uint64_t LastFrameCount() const { return this->lastFrameCount; }
+
+		/// @brief 定常状態として数えたフレーム数
+		[[nodiscard]] uint64_t SteadyFrameCount() const { return this->steadyFrames; }
+
+		/// @brief 定常状態で確保があったフレーム数
+		[[nodiscard]] uint64_t SteadyFramesWithAllocations() const { return this->steadyFramesWithAllocations; }
+
+		/// @brief 定常状態での 1 フレームあたりの最大確保回数
+		[[nodiscard]] uint64_t SteadyPeakCount() const { return this->steadyPeakCount; }
+
+		/// @brief 集計をログに出す
+		void Report() const;
+
+	private:
+		uint64_t lastTotal;						///< 前のフレームの終わりの累計
+		uint64_t lastFrameCount;				///< 直前のフレームの確保回数
+		uint32_t warmupRemaining;				///< 定常状態とみなすまでの残りフレーム数
+		uint64_t steadyFrames;					///< 定常状態として数えたフレーム数
+		uint64_t steadyFramesWithAllocations;	///< 定常状態で確保があったフレーム数
+		uint64_t steadyPeakCount;				///< 定常状態での最大確保回数
+	};
+} // namespace Framework::Memory
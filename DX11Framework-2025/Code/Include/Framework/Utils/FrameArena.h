@@ -0,0 +1,167 @@
+﻿/** @file   FrameArena.h
+ *  @brief  フレーム単位で使い捨てる一時メモリ（線形アロケータ）
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Namespace : Framework::Memory
+//-----------------------------------------------------------------------------
+namespace Framework::Memory
+{
+	namespace Config
+	{
+		inline constexpr size_t DefaultFrameArenaBytes = 256 * 1024;	///< スレッドごとの初期容量
+	}
+
+	//-----------------------------------------------------------------------------
+	// FrameArena class
+	//-----------------------------------------------------------------------------
+	/** @class FrameArena
+	 *  @brief 先頭から詰めて確保し、フレームの終わりにまとめて捨てる一時メモリ
+	 *  @details
+	 *      - スレッドごとに 1 つ持つ（ForThisThread）。確保は持ち主のスレッドだけが行うのでロックしない
+	 *      - GameLoop::Update の終わりに EndFrame が呼ばれ、各スレッドの領域は次に触れたときに空になる
+	 *      - 容量が足りなければ追加の塊を確保し、次のリセットで 1 つの塊にまとめ直す（以後は確保しない）
+	 *      - 中身はフレームをまたいで持たないこと（メンバーに保存しない）
+	 */
+	class FrameArena
+	{
+	public:
+		/** @brief コンストラクタ
+		 *  @param _initialBytes 初期容量
+		 */
+		explicit FrameArena(size_t _initialBytes = Config::DefaultFrameArenaBytes);
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		/** @brief 領域を確保する
+		 *  @param _bytes バイト数
+		 *  @param _alignment アラインメント（2 の冪）
+		 *  @return 確保した領域（失敗しない）
+		 */
+		[[nodiscard]] void* Allocate(size_t _bytes, size_t _alignment);
+
+		/** @brief 領域を返す（何もしない。中身はリセットまで残るので、FrameVector を捨てた後も span で参照できる）
+		 *  @param _pointer 確保した領域
+		 *  @param _bytes バイト数
+		 */
+		void Deallocate(void* _pointer, size_t _bytes) { (void)_pointer; (void)_bytes; }
+
+		/// @brief 全て捨てる（溢れていたら 1 つの塊にまとめ直す）
+		void Reset();
+
+		/// @brief 使用中のバイト数
+		[[nodiscard]] size_t UsedBytes() const;
+
+		/// @brief 確保済みの容量
+		[[nodiscard]] size_t CapacityBytes() const;
+
+		/// @brief これまでで最も多く使ったバイト数
+		[[nodiscard]] size_t PeakBytes() const { return this->peakBytes; }
+
+		/** @brief このスレッドの領域を取得する（フレームが進んでいれば空にしてから返す）
+		 *  @return このスレッドの FrameArena
+		 */
+		[[nodiscard]] static FrameArena& ForThisThread();
+
+		/// @brief フレームを終える（GameLoop::Update の終わりに呼ぶ）
+		static void EndFrame();
+
+	private:
+		/** @struct Block
+		 *  @brief 確保済みの塊 1 つ
+		 */
+		struct Block
+		{
+			std::unique_ptr<std::byte[]> memory;	///< 領域
+			size_t size = 0;						///< バイト数
+		};
+
+		/** @brief 塊を追加する
+		 *  @param _bytes 最低限必要なバイト数
+		 */
+		void AddBlock(size_t _bytes);
+
+	private:
+		std::vector<Block> blocks;			///< 塊（通常は 1 つ。溢れたフレームだけ増える）
+		size_t offset;						///< 最後の塊の使用位置
+		size_t retiredUsedBytes;			///< 最後の塊より前の塊で使ったバイト数
+		size_t retiredCapacityBytes;		///< 最後の塊より前の塊の容量
+		size_t peakBytes;					///< これまでで最も多く使ったバイト数
+		uint64_t frameEpoch;				///< 最後にリセットしたフレーム
+	};
+
+	//-----------------------------------------------------------------------------
+	// FrameAllocator class
+	//-----------------------------------------------------------------------------
+	/** @class FrameAllocator
+	 *  @brief FrameArena から確保する STL 互換のアロケータ
+	 */
+	template<typename T>
+	class FrameAllocator
+	{
+	public:
+		using value_type = T;
+
+		/// @brief このスレッドの FrameArena を使う
+		FrameAllocator() : arena(&FrameArena::ForThisThread()) {}
+
+		/** @brief 指定した FrameArena を使う
+		 *  @param _arena 確保元
+		 */
+		explicit FrameAllocator(FrameArena& _arena) noexcept : arena(&_arena) {}
+
+		template<typename U>
+		FrameAllocator(const FrameAllocator<U>& _other) noexcept : arena(_other.arena) {}
+
+		[[nodiscard]] T* allocate(size_t _count)
+		{
+			return static_cast<T*>(this->arena->Allocate(_count * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* _pointer, size_t _count) noexcept
+		{
+			this->arena->Deallocate(_pointer, _count * sizeof(T));
+		}
+
+		template<typename U>
+		bool operator==(const FrameAllocator<U>& _other) const noexcept { return this->arena == _other.arena; }
+
+	private:
+		template<typename U> friend class FrameAllocator;
+
+		FrameArena* arena;		///< 確保元
+	};
+
+	/// @brief フレーム内だけ使う可変長配列
+	template<typename T>
+	using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+	/** @brief フレーム内だけ有効な配列を確保する（要素は値初期化する。デストラクタは呼ばない）
+	 *  @param _count 要素数
+	 *  @return 確保した配列
+	 */
+	template<typename T>
+	[[nodiscard]] std::span<T> AllocateFrameArray(size_t _count)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "破棄処理の要る型はフレーム配列に置けません。");
+
+		if (_count == 0) { return {}; }
+
+		T* data = static_cast<T*>(FrameArena::ForThisThread().Allocate(_count * sizeof(T), alignof(T)));
+		std::uninitialized_value_construct_n(data, _count);
+		return { data, _count };
+	}
+} // namespace Framework::Memory
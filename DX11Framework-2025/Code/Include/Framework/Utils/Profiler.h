@@ -0,0 +1,164 @@
+﻿/** @file   Profiler.h
+ *  @brief  スコープ単位の CPU プロファイラ（Chrome トレース形式で出力）
+ *  @date   2026/10/18
+ */
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Namespace : Framework::Profiler
+//-----------------------------------------------------------------------------
+/** @namespace Framework::Profiler
+ *  @brief 入れ子のゾーン（RAII）で CPU 時間を測り、chrome://tracing / Perfetto で開ける JSON に出力する
+ *  @details
+ *      - 記録はスレッドごとのリングバッファに書く（書き込みは自スレッドだけなのでロックしない）
+ *      - 記録していない間のゾーンは原子変数を 1 回読むだけ。FRAMEWORK_DISABLE_PROFILER を定義すると丸ごと消える
+ *      - ウィンドウに依存しないので、--replay-physics などのヘッドレス実行からもトレースを取れる
+ *      - 出力は EndCapture の後、ワーカーのジョブが終わっている時点で行う
+ */
+namespace Framework::Profiler
+{
+	namespace Config
+	{
+#if defined(FRAMEWORK_DISABLE_PROFILER)
+		inline constexpr bool BuildEnableProfiler = false;
+#else
+		inline constexpr bool BuildEnableProfiler = true;
+#endif
+
+		inline constexpr size_t ThreadRingCapacity = 1 << 16;	///< スレッドごとに保持するゾーン数（溢れたら古い方から上書き）
+	}
+
+	using Clock = std::chrono::steady_clock;
+
+	/// @brief 記録を開始する（以前の記録は捨てる）
+	void BeginCapture();
+
+	/// @brief 記録を止める
+	void EndCapture();
+
+	/// @brief 記録中か
+	[[nodiscard]] bool IsCapturing();
+
+	/** @brief 記録したゾーンを Chrome トレース形式の JSON で出力する
+	 *  @param _path 出力先
+	 *  @return 書き込めたら true
+	 */
+	bool WriteChromeTrace(const std::string& _path);
+
+	/** @brief 今のスレッドに名前を付ける（トレースの表示名）
+	 *  @param _name スレッド名（文字列リテラルなど、寿命の長いもの）
+	 */
+	void SetThreadName(const char* _name);
+
+	/** @brief ゾーンを 1 つ記録する（通常は ScopedZone を使う。記録中でなければ何もしない）
+	 *  @param _name ゾーン名（文字列リテラルなど、寿命の長いもの）
+	 *  @param _begin 開始時刻
+	 *  @param _end 終了時刻
+	 *  @param _count まとめた回数（0 なら通常のゾーン）
+	 */
+	void RecordZone(const char* _name, Clock::time_point _begin, Clock::time_point _end, uint32_t _count = 0);
+
+	//-----------------------------------------------------------------------------
+	// ScopedZone class
+	//-----------------------------------------------------------------------------
+	/** @class ScopedZone
+	 *  @brief 生存期間を 1 ゾーンとして記録する
+	 */
+	class ScopedZone
+	{
+	public:
+		/** @brief コンストラクタ
+		 *  @param _name ゾーン名（文字列リテラルなど、寿命の長いもの）
+		 */
+		explicit ScopedZone(const char* _name)
+		{
+			if constexpr (Config::BuildEnableProfiler)
+			{
+				if (IsCapturing())
+				{
+					this->name = _name;
+					this->begin = Clock::now();
+				}
+			}
+		}
+
+		/// @brief デストラクタ
+		~ScopedZone()
+		{
+			if constexpr (Config::BuildEnableProfiler)
+			{
+				if (this->name)
+				{
+					RecordZone(this->name, this->begin, Clock::now());
+				}
+			}
+		}
+
+		ScopedZone(const ScopedZone&) = delete;
+		ScopedZone& operator=(const ScopedZone&) = delete;
+
+	private:
+		const char* name = nullptr;		///< ゾーン名（記録しないときは nullptr）
+		Clock::time_point begin{};		///< 開始時刻
+	};
+
+	//-----------------------------------------------------------------------------
+	// TypeAggregateZone class
+	//-----------------------------------------------------------------------------
+	/** @class TypeAggregateZone
+	 *  @brief ループの中身を型ごとに合計し、ループの終わりに型ごとのゾーンとして記録する
+	 *  @details
+	 *      - 要素ごとにゾーンを作ると数千件になるので、型ごとの合計時間と回数だけを残す
+	 *      - 型ごとのゾーンはループの開始時刻から順に並べて記録する（実際の実行順ではない）
+	 */
+	class TypeAggregateZone
+	{
+	public:
+		/** @brief コンストラクタ
+		 *  @param _name ループ全体のゾーン名
+		 */
+		explicit TypeAggregateZone(const char* _name);
+
+		/// @brief デストラクタ（型ごとのゾーンとループ全体のゾーンを記録する）
+		~TypeAggregateZone();
+
+		TypeAggregateZone(const TypeAggregateZone&) = delete;
+		TypeAggregateZone& operator=(const TypeAggregateZone&) = delete;
+
+		/// @brief 記録するか（記録しないときは要素ごとの計測を飛ばす）
+		[[nodiscard]] bool IsActive() const { return this->name != nullptr; }
+
+		/** @brief 要素 1 つ分の時間を型ごとに足す
+		 *  @param _type 要素の型
+		 *  @param _begin 開始時刻
+		 *  @param _end 終了時刻
+		 */
+		void Add(const std::type_info& _type, Clock::time_point _begin, Clock::time_point _end);
+
+	private:
+		/** @struct Entry
+		 *  @brief 型 1 つ分の合計
+		 */
+		struct Entry
+		{
+			std::type_index type;		///< 型
+			const char* typeName;		///< 型名
+			Clock::duration total;		///< 合計時間
+			uint32_t count;				///< 回数
+		};
+
+		const char* name = nullptr;		///< ループ全体のゾーン名（記録しないときは nullptr）
+		Clock::time_point begin{};		///< 開始時刻
+		std::vector<Entry> entries;		///< 型ごとの合計（型の数は少ないので線形探索）
+	};
+} // namespace Framework::Profiler
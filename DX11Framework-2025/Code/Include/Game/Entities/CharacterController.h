@@ -106,6 +106,13 @@ private:
 	InputSystem& inputSystem;					///< 入力処理を管理している
 	TimeScaleSystem& timeScaleSystem;			///< タイムスケール処理を管理している
 
+	InputActionId moveForwardAction = InvalidInputActionId;		///< 前移動
+	InputActionId moveBackwardAction = InvalidInputActionId;	///< 後移動
+	InputActionId moveLeftAction = InvalidInputActionId;		///< 左移動
+	InputActionId moveRightAction = InvalidInputActionId;		///< 右移動
+	InputActionId punchAction = InvalidInputActionId;			///< 攻撃
+	InputActionId dodgeAction = InvalidInputActionId;			///< 回避
+
 	AnimationComponent* animationComponent = nullptr;	///< アニメーション
 	AttackComponent* attackComponent = nullptr;			///< 攻撃処理
 	MoveComponent* moveComponent = nullptr;				///< 移動処理
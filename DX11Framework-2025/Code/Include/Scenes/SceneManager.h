@@ -6,6 +6,7 @@
 #include"Include/Framework/Scenes/SceneFactory.h"
 #include"Include/Framework/Scenes/SceneType.h"
 #include"Include/Framework/Scenes/BaseScene.h"
+#include"Include/Framework/Scenes/ScenePreloader.h"
 
 #include <memory>
 #include <functional>
@@ -45,11 +46,26 @@ public:
 	 */
 	void SetTransitionCallback(std::function<void(SceneType)> _callback);
 
+	/**	@brief	遷移先のリソース読み込みの進み具合を受け取るコールバック設定を行う
+	 *	@param	std::function<void(SceneType, float)> _callback	遷移先と進み具合（0.0 ～ 1.0）を受け取るコールバック
+	 */
+	void SetTransitionProgressCallback(std::function<void(SceneType, float)> _callback);
+
 	/**	@brief	遷移開始処理を行うためのラッパー関数
 	 *	@param	SceneType _nextSceneType	次のシーンタイプ
 	 */
 	void NotifyTransitionReady(SceneType _nextSceneType);
 
+	/**	@brief	シーンが遷移を終えて動いているか
+	 *	@return	bool	遷移中・初期化前なら false
+	 */
+	bool IsSceneReady() const { return !this->isTransitioning && this->isSceneInitialized; }
+
+	/**	@brief	遷移時に読み込みの完了を待つかを設定する
+	 *	@param	bool _isBlocking	true なら旧シーンを動かさずにその場で読み込みを待つ（入力の再生など、フレーム数を実時間に左右させたくない場合）
+	 */
+	void SetBlockingTransition(bool _isBlocking) { this->isBlockingTransition = _isBlocking; }
+
 private:
 	/**	@brief	遷移開始処理を行う
 	 *	@param	SceneType _nextSceneType	次のシーンタイプ
@@ -59,6 +75,9 @@ private:
 	/// @brief Factoryを使ってシーン生成・切り替えを行う
 	void CompleteTransition();
 
+	/// @brief 読み込みの進み具合を通知する（変わったときだけ）
+	void ReportTransitionProgress();
+
 	/// @brief 終了処理
 	void Dispose();
 private:
@@ -69,7 +88,12 @@ private:
 
 	std::function<void(SceneType _nextSceneType)> onTransitionBegin;  ///< 遷移開始通知イベント
 	std::function<void(SceneType _nextSceneType)> onTransitionEnd;    ///< 遷移完了通知イベント
+	std::function<void(SceneType _nextSceneType, float _progress)> onTransitionProgress;	///< 読み込み進捗通知イベント
+
+	ScenePreloader preloader;			///< 遷移先のリソースの先読み
+	float reportedProgress = -1.0f;		///< 最後に通知した進み具合
 	
 	bool isTransitioning = false;		///< 遷移フラグ
 	bool isSceneInitialized = false;	///< 初期化チェック
+	bool isBlockingTransition = false;	///< 遷移時に読み込みの完了を待つか
 };
\ No newline at end of file
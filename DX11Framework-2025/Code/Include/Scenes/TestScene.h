@@ -3,6 +3,10 @@
 */
 #pragma once
 #include"Include/Framework/Scenes/BaseScene.h"
+#include"Include/Framework/Graphics/TextureResource.h"
+
+#include<memory>
+#include<vector>
 
 /**	@class	TestScene
  *	@brief	テスト用シーン
@@ -26,5 +30,5 @@ public:
 	//-----------------------------------------------------------------------------
 	void SpawnManyBoxes(const int _countX = 50, const int _countZ = 50, const float _spacing = 3.0f);
 private:
-
+	std::vector<std::shared_ptr<TextureResource>> groupTextures;	///< グループ色のテクスチャ（同じ色のボックスで共有）
 };
\ No newline at end of file
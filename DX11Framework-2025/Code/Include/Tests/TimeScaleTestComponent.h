@@ -8,6 +8,8 @@
 #include "Include/Framework/Core/InputSystem.h"
 #include "Include/Framework/Core/TimeScaleSystem.h"
 
+#include <array>
+
  /** @class TimeScaleTestComponent
   *  @brief 時間スケールの挙動を検証するテスト用コンポーネント
   *  @details - Componentを継承し、UpdateフェーズでTimeScale関連の動作確認を行う
@@ -38,4 +40,7 @@ public:
 private:
 	InputSystem& inputSystem;			///< 入力システムの参照
 	TimeScaleSystem& timeScaleSystem;	///< 時間スケールシステムの参照
+
+	InputActionId slowGlobalAction = InvalidInputActionId;								///< グローバルのスロー
+	std::array<InputActionId, 3> slowObjectActions{ InvalidInputActionId, InvalidInputActionId, InvalidInputActionId };	///< オブジェクトごとのスロー
 };
\ No newline at end of file
@@ -72,6 +72,13 @@ cbuffer BoneBuffer : register(b7)
     float4x4 boneMatrices[128]; ///< ボーン変換行列配列（最大128本）
 }
 
+// 圧縮頂点の位置復元用定数バッファ（復元位置 = pos * positionScale + positionOffset）
+cbuffer VertexDequantBuffer : register(b8)
+{
+    float3 positionOffset;  // AABB の中心
+    float positionScale;    // AABB の最大半径
+}
+
 //-----------------------------------------------------------------------------
 // 通常モデル描画用構造体
 //-----------------------------------------------------------------------------
@@ -110,6 +117,40 @@ struct VS_IN_SKINNED_MODEL
     float4 boneWeight : BONEWEIGHT; // ボーンウェイト
 };
 
+// ----------------------------------------------------------------------------
+// 圧縮頂点描画用構造体（法線は八面体エンコード、UV は half、ウェイトは UNORM8）
+// ----------------------------------------------------------------------------
+struct VS_IN_MODEL_COMPACT
+{
+    float3 pos : POSITION;          // 頂点位置（量子化時は [-1, 1]）
+    float2 normal : NORMAL;         // 八面体エンコード法線
+    float2 tex : TEXCOORD0;         // テクスチャ座標
+};
+
+struct VS_IN_SKINNED_MODEL_COMPACT
+{
+    float3 pos : POSITION;          // 頂点位置（量子化時は [-1, 1]）
+    float2 normal : NORMAL;         // 八面体エンコード法線
+    float2 tex : TEXCOORD0;         // テクスチャ座標
+    uint4 boneIndex : BONEINDEX;    // ボーンインデックス
+    float4 boneWeight : BONEWEIGHT; // ボーンウェイト
+};
+
+// 八面体エンコードされた法線を復元する
+float3 DecodeOctNormal(float2 _encoded)
+{
+    float3 n = float3(_encoded.x, _encoded.y, 1.0f - abs(_encoded.x) - abs(_encoded.y));
+    float t = saturate(-n.z);
+    n.xy += (n.xy >= 0.0f) ? -t : t;
+    return normalize(n);
+}
+
+// 圧縮頂点の位置を復元する
+float3 DecodePosition(float3 _pos)
+{
+    return _pos * positionScale + positionOffset;
+}
+
 //-----------------------------------------------------------------------------
 // スプライト描画用構造体
 //-----------------------------------------------------------------------------
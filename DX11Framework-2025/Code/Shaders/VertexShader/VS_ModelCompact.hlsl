@@ -0,0 +1,29 @@
+//-----------------------------------------------------------------------------
+// VS_ModelCompact.hlsl
+// 頂点シェーダー：圧縮頂点（ModelCompact / ModelQuantized）用の VS_Model
+//-----------------------------------------------------------------------------
+#include "../Common.hlsli"
+
+//------------------------------------------------------
+// メイン
+//------------------------------------------------------
+VS_OUT_MODEL main(VS_IN_MODEL_COMPACT input)
+{
+    VS_OUT_MODEL output;
+
+    // ワールド・ビュー・プロジェクション
+    float4 worldPos = mul(float4(DecodePosition(input.pos), 1.0f), world);
+    float4 viewPos = mul(worldPos, view);
+    output.pos = mul(viewPos, projection);
+
+    // ワールド空間での法線（正規化して補間させる）
+    output.normal = normalize(mul(DecodeOctNormal(input.normal), (float3x3) world));
+
+    // ワールド座標
+    output.worldPos = worldPos.xyz;
+
+    // テクスチャ座標
+    output.tex = input.tex;
+
+    return output;
+}
\ No newline at end of file
@@ -20,6 +20,7 @@ std::unique_ptr<WindowSystem>   Application::windowSystem;
 std::unique_ptr<D3D11System>    Application::d3d11System;
 std::unique_ptr<RenderSystem>   Application::renderSystem;
 std::unique_ptr<GameLoop>       Application::gameLoop;
+std::unique_ptr<FPS>            Application::fps;
 
 //-----------------------------------------------------------------------------
 // RenderSystem Class
@@ -67,8 +68,15 @@ bool Application::Initialize()
     if (!Application::renderSystem->Initialize()) { return false; }
     SystemLocator::Register<RenderSystem>(Application::renderSystem.get());
 
+    // フレームレート制御（負荷段階をシステムやコンポーネントから参照する）
+    Application::fps = std::make_unique<FPS>(Application::appConfig.targetFps);
+    SystemLocator::Register<FPS>(Application::fps.get());
+
     // ゲーム進行
     Application::gameLoop = std::make_unique<GameLoop>();
+    Application::gameLoop->SetPhysicsRecordPath(Application::appConfig.physicsRecordPath);
+    Application::gameLoop->SetInputRecordPath(Application::appConfig.inputRecordPath);
+    Application::gameLoop->SetInputReplayPath(Application::appConfig.inputReplayPath);
 
     // 初期化成功
     return true;
@@ -90,6 +98,9 @@ void Application::MainLoop()
     MSG msg{};
     Application::gameLoop->Initialize();
 
+    // 初期化（シーン読み込み）にかかった時間を最初のフレームに含めない
+    Application::fps->ResetTime();
+
     while (msg.message != WM_QUIT && Application::gameLoop->IsRunning())
     {
 
@@ -117,6 +128,9 @@ void Application::MainLoop()
         Application::renderSystem->BeginRender();
         Application::gameLoop->Draw();
         Application::renderSystem->EndRender();
+
+        // 次フレームまで待つ（フレーム時間の計測と負荷段階の更新も行う）
+        Application::fps->Tick();
     }
 }
 
@@ -128,6 +142,9 @@ void Application::ShutDown()
 {
     Application::gameLoop.reset();
 
+    SystemLocator::Unregister<FPS>();
+    Application::fps.reset();
+
     Application::renderSystem.reset();
     SystemLocator::Unregister<RenderSystem>();
 
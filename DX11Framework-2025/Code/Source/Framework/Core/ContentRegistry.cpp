@@ -0,0 +1,41 @@
+﻿/** @file   ContentRegistry.cpp
+ *  @brief  内容ハッシュの計算
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Core/ContentRegistry.h"
+
+//-----------------------------------------------------------------------------
+// ContentHasher class
+//-----------------------------------------------------------------------------
+
+void ContentHasher::Append(const void* _data, size_t _size)
+{
+	constexpr uint64_t FnvPrime = 1099511628211ull;
+
+	const auto* bytes = static_cast<const uint8_t*>(_data);
+	uint64_t h = this->hash;
+	for (size_t i = 0; i < _size; ++i)
+	{
+		h ^= bytes[i];
+		h *= FnvPrime;
+	}
+	this->hash = h;
+	this->size += _size;
+}
+
+void ContentHasher::AppendString(const std::string& _text)
+{
+	this->AppendValue(static_cast<uint64_t>(_text.size()));
+	this->Append(_text.data(), _text.size());
+}
+
+ContentKey ContentHasher::HashBytes(const void* _data, size_t _size)
+{
+	ContentHasher hasher;
+	hasher.Append(_data, _size);
+	return hasher.GetKey();
+}
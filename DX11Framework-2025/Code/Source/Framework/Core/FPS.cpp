@@ -7,41 +7,83 @@
  // Includes
  //-----------------------------------------------------------------------------
 #include "Include/Framework/Core/FPS.h"
+
+#include <algorithm>
+#include <iostream>
 #include <thread>
 
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr auto MinSpinMargin = std::chrono::microseconds(500);     ///< スピンで待つ最小の幅
+    constexpr auto MaxSpinMargin = std::chrono::microseconds(4000);    ///< スピンで待つ最大の幅
+    constexpr auto InitialOversleep = std::chrono::microseconds(1000); ///< 寝過ごし量の初期推定（timeBeginPeriod(1) 前提）
+
+    /** @brief steady_clock の間隔をミリ秒に直す
+     *  @param _duration 間隔
+     *  @return ミリ秒
+     */
+    static float ToMilliseconds(Clock::duration _duration)
+    {
+        return std::chrono::duration<float, std::milli>(_duration).count();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // FPS Class
 //-----------------------------------------------------------------------------
 
 /** @brief コンストラクタ
- *  @param _targetFps 目標フレームレート
+ *  @param _targetFps 目標フレームレート（0 なら待たずに計測だけ行う）
  */
 FPS::FPS(uint64_t _targetFps)
-    : frameInterval(std::chrono::microseconds(1'000'000 / _targetFps)),
-    nextTime(std::chrono::steady_clock::now() + this->frameInterval),
-    lastTime(std::chrono::steady_clock::now()),      // 初期化
-    deltaMicrosec(0)
-{}
+    : frameInterval((_targetFps > 0) ? Clock::duration(std::chrono::microseconds(1'000'000 / _targetFps)) : Clock::duration::zero()),
+    nextTime(Clock::now() + this->frameInterval),
+    lastTime(Clock::now()),      // 初期化
+    deltaMicrosec(0),
+    oversleepEstimate(InitialOversleep),
+    frameSamples{},
+    workSamples{},
+    sampleIndex(0),
+    sampleCount(0),
+    scratch(),
+    loadLevel(FrameLoadLevel::Normal),
+    overBudgetFrames(0),
+    underBudgetFrames(0),
+    isLoadLevelForced(false)
+{
+    this->scratch.reserve(StatsWindow);
+}
 
 /// @brief 次フレームまで待機し、ΔTime を更新する
 void FPS::Tick()
 {
-    auto now = std::chrono::steady_clock::now();
+    auto now = Clock::now();
+
+    // 前フレームの Tick から今までが、このフレームの処理時間
+    const auto work = now - this->lastTime;
 
     // まだ次フレーム時刻前なら待機
-    if (now < this->nextTime)
+    if (this->frameInterval > Clock::duration::zero() && now < this->nextTime)
     {
-        std::this_thread::sleep_until(this->nextTime);
+        this->WaitUntil(this->nextTime);
     }
 
     // 待機後の実時間
-    now = std::chrono::steady_clock::now();
+    now = Clock::now();
 
     // ΔTime（前フレームからの経過時間）を更新
+    const auto frame = now - this->lastTime;
     this->deltaMicrosec =
-        std::chrono::duration_cast<std::chrono::microseconds>(now - this->lastTime).count();
+        std::chrono::duration_cast<std::chrono::microseconds>(frame).count();
     this->lastTime = now;
 
+    this->Record(frame, work);
+
     // 遅れていた場合は補正（遅延累積を防ぐ）
     if (now > this->nextTime + this->frameInterval)
     {
@@ -67,11 +109,157 @@ uint64_t FPS::DeltaMicrosec() const
 /// @brief 次フレームの理想時刻を現在時刻から再設定
 void FPS::ResetTime()
 {
-    this->nextTime = std::chrono::steady_clock::now() + this->frameInterval;
+    this->lastTime = Clock::now();
+    this->nextTime = this->lastTime + this->frameInterval;
 }
 
 /// @brief  FPS値を返す
 float FPS::GetFPS() const
 {
     return 1.0f / DeltaSec();
-}
\ No newline at end of file
+}
+
+/// @brief 直近フレームのフレーム時間（待ち込み）の統計
+FrameTimeStats FPS::GetFrameTimeStats() const
+{
+    return this->BuildStats(this->frameSamples);
+}
+
+/// @brief 直近フレームの処理時間（待ちを除く）の統計
+FrameTimeStats FPS::GetWorkTimeStats() const
+{
+    return this->BuildStats(this->workSamples);
+}
+
+/// @brief sleep の寝過ごし量の推定値（マイクロ秒）
+uint64_t FPS::OversleepEstimateMicrosec() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(this->oversleepEstimate).count();
+}
+
+/** @brief 負荷段階を固定する
+ *  @param _level 負荷段階
+ */
+void FPS::ForceLoadLevel(FrameLoadLevel _level)
+{
+    this->loadLevel = _level;
+    this->isLoadLevelForced = true;
+    this->overBudgetFrames = 0;
+    this->underBudgetFrames = 0;
+}
+
+/** @brief 指定時刻まで待つ
+ *  @param _target 起きる時刻
+ */
+void FPS::WaitUntil(Clock::time_point _target)
+{
+    // 寝過ごしの推定値の 2 倍だけ手前で起きる（残りはスピンで詰める）
+    const auto spinMargin = std::clamp<Clock::duration>(this->oversleepEstimate * 2, MinSpinMargin, MaxSpinMargin);
+
+    auto now = Clock::now();
+    if (_target - now > spinMargin)
+    {
+        const auto wakeTime = _target - spinMargin;
+        std::this_thread::sleep_until(wakeTime);
+
+        // 寝過ごした量で推定値を更新する（増えるときは即座に、減るときはゆっくり追従する）
+        now = Clock::now();
+        const auto oversleep = std::max(now - wakeTime, Clock::duration::zero());
+        if (oversleep > this->oversleepEstimate)
+        {
+            this->oversleepEstimate = oversleep;
+        }
+        else
+        {
+            this->oversleepEstimate -= (this->oversleepEstimate - oversleep) / 16;
+        }
+    }
+
+    // 残りはスピンで待つ（他スレッドには譲る）
+    while (Clock::now() < _target)
+    {
+        std::this_thread::yield();
+    }
+}
+
+/** @brief フレームの計測値を記録し、負荷段階を更新する
+ *  @param _frame フレーム時間（待ち込み）
+ *  @param _work 処理時間（待ちを除く）
+ */
+void FPS::Record(Clock::duration _frame, Clock::duration _work)
+{
+    this->frameSamples[this->sampleIndex] = ToMilliseconds(_frame);
+    this->workSamples[this->sampleIndex] = ToMilliseconds(_work);
+    this->sampleIndex = (this->sampleIndex + 1) % StatsWindow;
+    this->sampleCount = std::min(this->sampleCount + 1, StatsWindow);
+
+    // 目標が無ければ予算も無い（固定している間も変えない）
+    if (this->frameInterval <= Clock::duration::zero() || this->isLoadLevelForced) { return; }
+
+    //-----------------------------------------------------------
+    // 負荷段階（ヒステリシス付き）
+    //-----------------------------------------------------------
+    const double ratio = std::chrono::duration<double>(_work).count() / std::chrono::duration<double>(this->frameInterval).count();
+    if (ratio > OverBudgetRatio)
+    {
+        this->underBudgetFrames = 0;
+        if (++this->overBudgetFrames >= RaiseLoadFrames && this->loadLevel != FrameLoadLevel::Overloaded)
+        {
+            this->loadLevel = static_cast<FrameLoadLevel>(static_cast<uint8_t>(this->loadLevel) + 1);
+            this->overBudgetFrames = 0;
+            std::cout << "[FPS] 負荷段階を上げました : " << static_cast<int>(this->loadLevel) << std::endl;
+        }
+    }
+    else if (ratio < UnderBudgetRatio)
+    {
+        this->overBudgetFrames = 0;
+        if (++this->underBudgetFrames >= LowerLoadFrames && this->loadLevel != FrameLoadLevel::Normal)
+        {
+            this->loadLevel = static_cast<FrameLoadLevel>(static_cast<uint8_t>(this->loadLevel) - 1);
+            this->underBudgetFrames = 0;
+            std::cout << "[FPS] 負荷段階を下げました : " << static_cast<int>(this->loadLevel) << std::endl;
+        }
+    }
+    else
+    {
+        this->overBudgetFrames = 0;
+        this->underBudgetFrames = 0;
+    }
+}
+
+/** @brief 記録した値から統計を作る
+ *  @param _samples 記録（ミリ秒）
+ *  @return 統計
+ */
+FrameTimeStats FPS::BuildStats(const std::array<float, StatsWindow>& _samples) const
+{
+    FrameTimeStats stats{};
+    stats.sampleCount = this->sampleCount;
+    if (this->sampleCount == 0) { return stats; }
+
+    this->scratch.assign(_samples.begin(), _samples.begin() + this->sampleCount);
+
+    double total = 0.0;
+    for (float ms : this->scratch)
+    {
+        total += ms;
+    }
+    stats.averageMs = total / static_cast<double>(this->sampleCount);
+
+    // 低い方から順に nth_element で切り出す（前の結果より右側だけを見ればよい）
+    const auto percentile = [this](size_t _from, size_t _percent)
+    {
+        const size_t index = std::min(this->scratch.size() - 1, this->scratch.size() * _percent / 100);
+        std::nth_element(this->scratch.begin() + _from, this->scratch.begin() + index, this->scratch.end());
+        return index;
+    };
+    const size_t i50 = percentile(0, 50);
+    stats.p50Ms = this->scratch[i50];
+    const size_t i95 = percentile(i50, 95);
+    stats.p95Ms = this->scratch[i95];
+    const size_t i99 = percentile(i95, 99);
+    stats.p99Ms = this->scratch[i99];
+    stats.maxMs = *std::max_element(this->scratch.begin() + i99, this->scratch.end());
+
+    return stats;
+}
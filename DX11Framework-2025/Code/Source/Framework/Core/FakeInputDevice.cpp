@@ -0,0 +1,127 @@
+﻿/** @file   FakeInputDevice.cpp
+ *  @brief  FakeInputDevice の実装
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Core/FakeInputDevice.h"
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	/** @brief 入力コードが範囲内か
+	 *  @param _code 入力コード
+	 *  @return 範囲内なら true
+	 */
+	static bool IsValidCode(int _code)
+	{
+		return _code >= 0 && _code < FakeInputDevice::CodeCount;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// FakeInputDevice class
+//-----------------------------------------------------------------------------
+
+/// @brief コンストラクタ
+FakeInputDevice::FakeInputDevice() {}
+
+/// @brief デストラクタ
+FakeInputDevice::~FakeInputDevice() {}
+
+/// @brief 解放処理
+void FakeInputDevice::Dispose()
+{
+	this->pending.reset();
+	this->current.reset();
+	this->previous.reset();
+	this->SetMouse(-1, -1);
+	this->mouseX = this->mouseY = -1;
+	this->mouseDX = this->mouseDY = 0;
+}
+
+/// @brief 入力状態の更新
+void FakeInputDevice::Update()
+{
+	this->previous = this->current;
+	this->current = this->pending;
+
+	this->mouseX = this->pendingMouseX;
+	this->mouseY = this->pendingMouseY;
+	this->mouseDX = this->pendingMouseDX;
+	this->mouseDY = this->pendingMouseDY;
+
+	// 移動量は 1 フレーム分だけ
+	this->pendingMouseDX = this->pendingMouseDY = 0;
+}
+
+/** @brief 押下状態の取得
+ *  @param _code 入力コード
+ *  @return 押されていれば true
+ */
+bool FakeInputDevice::IsPressed(int _code) const
+{
+	return IsValidCode(_code) && this->current.test(_code);
+}
+
+/** @brief トリガー状態の取得
+ *  @param _code 入力コード
+ *  @return このフレームで押されたなら true
+ */
+bool FakeInputDevice::IsTriggered(int _code) const
+{
+	return IsValidCode(_code) && this->current.test(_code) && !this->previous.test(_code);
+}
+
+/** @brief リリース状態の取得
+ *  @param _code 入力コード
+ *  @return このフレームで離されたなら true
+ */
+bool FakeInputDevice::IsReleased(int _code) const
+{
+	return IsValidCode(_code) && !this->current.test(_code) && this->previous.test(_code);
+}
+
+/** @brief マウスの移動量（Δ）を取得
+ *  @param _dx X方向の変化量
+ *  @param _dy Y方向の変化量
+ */
+void FakeInputDevice::GetMouseDelta(int& _dx, int& _dy) const
+{
+	_dx = this->mouseDX;
+	_dy = this->mouseDY;
+}
+
+/** @brief 押下状態を設定する
+ *  @param _code 入力コード
+ *  @param _pressed 押されているか
+ */
+void FakeInputDevice::SetPressed(int _code, bool _pressed)
+{
+	if (!IsValidCode(_code)) { return; }
+	this->pending.set(_code, _pressed);
+}
+
+/** @brief マウスの状態を設定する
+ *  @param _x X座標
+ *  @param _y Y座標
+ *  @param _dx X方向の変化量
+ *  @param _dy Y方向の変化量
+ */
+void FakeInputDevice::SetMouse(int _x, int _y, int _dx, int _dy)
+{
+	this->pendingMouseX = _x;
+	this->pendingMouseY = _y;
+	this->pendingMouseDX = _dx;
+	this->pendingMouseDY = _dy;
+}
+
+/// @brief 全て離した状態を設定する
+void FakeInputDevice::ReleaseAll()
+{
+	this->pending.reset();
+}
@@ -9,8 +9,12 @@
 
 #include"Include/Framework/Core/GameLoop.h"
 #include"Include/Framework/Core/SystemLocator.h"
+#include"Include/Framework/Core/FPS.h"
 #include"Include/Framework/Core/DirectInputDevice.h"
+#include"Include/Framework/Core/InputRecordDevice.h"
 #include"Include/Framework/Core/ResourceHub.h"
+#include"Include/Framework/Utils/Profiler.h"
+#include"Include/Framework/Utils/FrameArena.h"
 
 #include "Include/Scenes/TestScene.h"
 #include "Include/Scenes/TitleScene.h"
@@ -76,35 +80,45 @@ void GameLoop::Initialize()
     
 	// 時間管理システムの作成
     // ITimeProviderとして登録することで、時間情報のみを提供可能にする
+    // Rigidbody の見た目は固定ステップ間で補間するので、物理の重い環境では 30 に落としても良い
     this->timeSystem = std::make_unique<TimeSystem>(60);
 	SystemLocator::Register<ITimeProvider>(this->timeSystem.get()); 
 
     // 物理システムの管理
+    // 容量はシーンの最大規模に合わせる（使用率が 8 割を超えるとログに警告が出る）
+    Framework::Physics::PhysicsConfig physicsConfig{};
     this->physicsSystem = std::make_unique<Framework::Physics::PhysicsSystem>();
-    if (!this->physicsSystem->Initialize())
+    if (!this->physicsSystem->Initialize(physicsConfig))
     {
         std::cerr << "[GameLoop]PhysicsSystemの初期化に失敗しました。\n";
         return;
     }
     SystemLocator::Register<Framework::Physics::PhysicsSystem>(this->physicsSystem.get());
 
-    // シーン構成の初期化
+    // --record-physics 指定時は、シーンの Body 生成から記録する（--replay-physics で再生できる）
+    if (!this->physicsRecordPath.empty())
+    {
+        this->physicsSystem->StartRecording(this->physicsRecordPath);
+    }
+
+    // シーン構成の初期化（リソース一覧を渡したシーンは、遷移前にバックグラウンドで読み込む）
+    const SceneManifest playerManifest{ { "Player" }, { "Jump", "HeadHit", "Idle", "Dodge", "Punch" } };
     auto factory = std::make_unique<SceneFactory>();
     factory->Register(SceneType::Test, [](GameObjectManager& manager) {
         return std::make_unique<TestScene>(manager);
         });
     factory->Register(SceneType::Title, [](GameObjectManager& manager) {
         return std::make_unique<TitleScene>(manager);
-        });
+        }, SceneManifest{ { "Player" }, { "Idle" } });
     factory->Register(SceneType::PhysicsTest, [](GameObjectManager& manager) {
         return std::make_unique<PhysicsTest>(manager);
         });
     factory->Register(SceneType::ModelTest, [](GameObjectManager& manager) {
         return std::make_unique<ModelTest>(manager);
-        });
+        }, playerManifest);
     factory->Register(SceneType::Gameplay, [](GameObjectManager& manager) {
         return std::make_unique<GameScene>(manager);
-        });
+        }, playerManifest);
 
     // シーン管理の作成
     this->sceneManager = std::make_unique<SceneManager>(std::move(factory));
@@ -112,18 +126,21 @@ void GameLoop::Initialize()
         std::cout << "[GameLoop] シーン遷移時の演出を行いました。\n";
         raw->NotifyTransitionReady(_next);
         });
+    this->sceneManager->SetTransitionProgressCallback([](SceneType, float _progress) {
+        std::cout << "[GameLoop] 読み込み中 " << static_cast<int>(_progress * 100.0f) << "%\n";
+        });
 
     // シーン管理を登録
     SystemLocator::Register<SceneManager>(this->sceneManager.get());
 
+    // 時間スケールの管理（GameObjectManager が倍率表を作るので先に登録する）
+    this->timeScaleSystem = std::make_unique<TimeScaleSystem>();
+    SystemLocator::Register<TimeScaleSystem>(this->timeScaleSystem.get());
+
     // ゲームオブジェクトの管理
     this->gameObjectManager = std::make_unique<GameObjectManager>(&services);
     SystemLocator::Register<GameObjectManager>(this->gameObjectManager.get());
 
-    // 時間スケールの管理
-    this->timeScaleSystem = std::make_unique<TimeScaleSystem>();
-    SystemLocator::Register<TimeScaleSystem>(this->timeScaleSystem.get());
-
     // 入力管理
     this->inputSystem = std::make_unique<InputSystem>();
     SystemLocator::Register<InputSystem>(this->inputSystem.get());
@@ -133,10 +150,50 @@ void GameLoop::Initialize()
     //--------------------------------------------------------------------------    
 
     // 入力デバイスの登録
-    auto& window = SystemLocator::Get<WindowSystem>();
-    auto directInput = std::make_unique<DirectInputDevice>();
-    if (!directInput->Initialize(window.GetHInstance(), window.GetWindow())) { return; }
-    this->inputSystem->RegisterDevice(std::move(directInput));
+    // --replay-input 指定時は記録だけを入力にする（実機の入力は混ぜない）
+    if (!this->inputReplayPath.empty())
+    {
+        auto replay = std::make_unique<InputReplayDevice>();
+        if (!replay->Open(this->inputReplayPath, this->timeSystem->FixedDelta()))
+        {
+            // 入力が無いまま動き続けないように終了する
+            this->RequestExit();
+            return;
+        }
+        this->inputReplay = replay.get();
+        this->inputSystem->RegisterDevice(std::move(replay));
+
+        // 読み込みの速さで旧シーンの更新回数が変わらないように、遷移はその場で読み込みを待つ（記録時と同じ）
+        this->sceneManager->SetBlockingTransition(true);
+    }
+    else
+    {
+        auto& window = SystemLocator::Get<WindowSystem>();
+        auto directInput = std::make_unique<DirectInputDevice>();
+        if (!directInput->Initialize(window.GetHInstance(), window.GetWindow())) { return; }
+
+        // --record-input 指定時は、実機の入力をそのまま使いながら記録する（--replay-input で再生できる）
+        if (!this->inputRecordPath.empty())
+        {
+            auto recorder = std::make_unique<InputRecordDevice>(std::move(directInput), *this->timeSystem, SystemLocator::Get<FPS>());
+            if (!recorder->Begin(this->inputRecordPath))
+            {
+                // 記録を頼まれているので、記録できないまま遊び続けないように終了する
+                std::cerr << "[GameLoop] 入力を記録できないため終了します : " << this->inputRecordPath << std::endl;
+                this->RequestExit();
+                return;
+            }
+            this->inputSystem->RegisterDevice(std::move(recorder));
+
+            // 遷移中に旧シーンが動くフレーム数は読み込みの速さで変わるので、再生と同じくその場で読み込みを待つ
+            // （待たないと、旧シーンで使った入力を再生時には新シーンが受け取ってしまう）
+            this->sceneManager->SetBlockingTransition(true);
+        }
+        else
+        {
+            this->inputSystem->RegisterDevice(std::move(directInput));
+        }
+    }
 
     // キーバインドの登録
     this->inputSystem->RegisterKeyBinding("SceneChangeTest", static_cast<int>(DirectInputDevice::KeyboardKey::D));
@@ -152,13 +209,42 @@ void GameLoop::Update()
 {
     if (!this->isRunning) { return; }
 
+    using Framework::Profiler::ScopedZone;
+    ScopedZone updateZone("GameLoop::Update");
+
+    // 再生中は記録時の経過時間と負荷段階で進める（実時間や負荷に関係なく、記録時と同じ固定ステップ数になる）
+    InputReplayDevice::FrameTiming replayTiming{};
+    if (this->inputReplay)
+    {
+        if (!this->inputReplay->PeekNextTiming(replayTiming))
+        {
+            this->inputReplay->Report();
+            this->RequestExit();
+            return;
+        }
+        SystemLocator::Get<FPS>().ForceLoadLevel(replayTiming.loadLevel);
+    }
+
+    // 負荷段階に合わせて固定ステップの追いつき上限を決める
+    // （まずアニメーション・デバッグ描画を省いて追いつき、それでも足りなければ時間を捨てる）
+    switch (SystemLocator::Get<FPS>().GetLoadLevel())
+    {
+    case FrameLoadLevel::Normal:       this->timeSystem->SetMaxCatchUpSteps(TimeSystem::DefaultMaxCatchUpSteps);  break;
+    case FrameLoadLevel::ShedOptional: this->timeSystem->SetMaxCatchUpSteps(TimeSystem::ShedMaxCatchUpSteps);     break;
+    case FrameLoadLevel::Overloaded:   this->timeSystem->SetMaxCatchUpSteps(TimeSystem::OverloadMaxCatchUpSteps); break;
+    }
+
     // デルタタイムの計算
-    this->timeSystem->TickRawDelta();
+    if (this->inputReplay) { this->timeSystem->TickRawDelta(replayTiming.rawDelta); }
+    else { this->timeSystem->TickRawDelta(); }
     float delta = this->timeSystem->RawDelta();
     float fixedDelta = this->timeSystem->FixedDelta();
 
     // TimeScaleイベント更新
-    this->timeScaleSystem->Update(delta);
+    {
+        ScopedZone zone("TimeScale");
+        this->timeScaleSystem->Update(delta);
+    }
 
 //#ifdef _DEBUG
 //    // 瞬間FPS
@@ -169,38 +255,79 @@ void GameLoop::Update()
     //-------------------------------------------------------------
     // 可変ステップ更新
     //-------------------------------------------------------------
-    this->inputSystem->Update();
-    this->sceneManager->Update(delta);
+    {
+        ScopedZone zone("Input");
+        this->inputSystem->Update();
+    }
+    {
+        ScopedZone zone("SceneUpdate");
+        this->sceneManager->Update(delta);
+    }
 
     //-------------------------------------------------------------
     // 固定ステップ更新
     //-------------------------------------------------------------
     while (this->timeSystem->ShouldRunFixedStep())
     {
+        ScopedZone stepZone("FixedStep");
+
         // 物理とTransformがそろった状態でゲームロジックのFixedUpdateを実行する
-        this->gameObjectManager->FixedUpdateAll(fixedDelta);
+        {
+            ScopedZone zone("FixedUpdate");
+            this->gameObjectManager->FixedUpdateAll(fixedDelta);
+        }
 
 		// 自前移動処理のため、物理システムの前にTransformを更新する
-		this->gameObjectManager->BeginPhysics(fixedDelta);
+        {
+            ScopedZone zone("BeginPhysics");
+            this->gameObjectManager->BeginPhysics(fixedDelta);
+        }
 
         // 物理シミュレーションを実行する
-        this->physicsSystem->Step(fixedDelta);
+        {
+            ScopedZone zone("PhysicsStep");
+            this->physicsSystem->Step(fixedDelta);
+        }
 
 		// 自前の押し戻し、同期処理を行う
-		this->gameObjectManager->EndPhysics(fixedDelta);
+        {
+            ScopedZone zone("EndPhysics");
+            this->gameObjectManager->EndPhysics(fixedDelta);
+        }
 
         // 接触イベントの処理を行う
-        this->physicsSystem->ProcessContactEvents();
+        {
+            ScopedZone zone("ContactEvents");
+            this->physicsSystem->ProcessContactEvents();
+        }
 
 		// 固定ステップを1回分消費する
         this->timeSystem->ConsumeFixedStep();
     }
 
+	// 余った accumulator の分だけ直前 2 ステップの間を補間して表示する
+    {
+        ScopedZone zone("Interpolate");
+        this->gameObjectManager->InterpolatePhysics(this->timeSystem->FixedAlpha());
+    }
+
 	// 全Transformのワールド行列を更新する
-	this->gameObjectManager->UpdateAllTransforms();
+    {
+        ScopedZone zone("Transforms");
+        this->gameObjectManager->UpdateAllTransforms();
+    }
 
 	// 保留中のオブジェクト破棄を行う
-	this->sceneManager->FlushPendingDestroys();
+    {
+        ScopedZone zone("FlushDestroys");
+        this->sceneManager->FlushPendingDestroys();
+    }
+
+    // フレームの一時メモリを捨てる（各スレッドの領域は次に使うときに空になる）
+    Framework::Memory::FrameArena::EndFrame();
+
+    // 定常状態でヒープ確保があれば報告する（目標は 0 回）
+    this->allocationMonitor.EndFrame(this->sceneManager->IsSceneReady());
 }
 
 /// @brief		描画処理を行う
@@ -208,24 +335,29 @@ void GameLoop::Draw()
 {
     if (!this->isRunning) { return; }
 
+    Framework::Profiler::ScopedZone zone("GameLoop::Draw");
     this->sceneManager->Draw();
 }
 
 /// @brief		終了処理を行う
 void GameLoop::Dispose()
 {
+    // 二度目の呼び出し（デストラクタ）では出さない
+    if (this->sceneManager) { this->allocationMonitor.Report(); }
+
     SystemLocator::Unregister<InputSystem>();
+    this->inputReplay = nullptr;
     this->inputSystem.reset();
 
-    SystemLocator::Unregister<TimeScaleSystem>();
-    this->timeScaleSystem.reset();
-
     SystemLocator::Unregister<SceneManager>();
     this->sceneManager.reset();
 
     SystemLocator::Unregister<GameObjectManager>();
     this->gameObjectManager.reset();
 
+    SystemLocator::Unregister<TimeScaleSystem>();
+    this->timeScaleSystem.reset();
+
     SystemLocator::Unregister<Framework::Physics::PhysicsSystem>();
     this->physicsSystem.reset();
 
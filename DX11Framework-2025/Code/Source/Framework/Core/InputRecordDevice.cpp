@@ -0,0 +1,159 @@
+﻿/** @file   InputRecordDevice.cpp
+ *  @brief  InputRecordDevice の実装
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Core/InputRecordDevice.h"
+
+#include <cstring>
+#include <iostream>
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	/** @brief 値をそのまま末尾に書き足す
+	 *  @param _buffer 書き出し先
+	 *  @param _value 値
+	 */
+	template<typename T>
+	static void Append(std::vector<uint8_t>& _buffer, const T& _value)
+	{
+		const size_t offset = _buffer.size();
+		_buffer.resize(offset + sizeof(T));
+		std::memcpy(_buffer.data() + offset, &_value, sizeof(T));
+	}
+}
+
+//-----------------------------------------------------------------------------
+// InputRecordDevice class
+//-----------------------------------------------------------------------------
+
+/** @brief コンストラクタ
+ *  @param _source 実際に入力を取るデバイス
+ *  @param _timeSystem 経過時間を記録する TimeSystem
+ *  @param _fps 負荷段階を記録する FPS
+ */
+InputRecordDevice::InputRecordDevice(std::unique_ptr<IInputDevice> _source, const TimeSystem& _timeSystem, const FPS& _fps)
+	: source(std::move(_source))
+	, timeSystem(_timeSystem)
+	, fps(_fps)
+	, file()
+	, pressed()
+	, mouseX(-1)
+	, mouseY(-1)
+	, frameBuffer()
+	, frameCount(0)
+{
+	// 全てのキーが同時に変わっても確保し直さない大きさ
+	this->frameBuffer.reserve(sizeof(InputFrameRecord) + sizeof(int32_t) * 4 + sizeof(uint16_t) * InputRecordCodeCount);
+}
+
+/// @brief デストラクタ
+InputRecordDevice::~InputRecordDevice()
+{
+	this->End();
+}
+
+/** @brief 記録を開始する
+ *  @param _path 出力先
+ *  @return 開けなければ false
+ */
+bool InputRecordDevice::Begin(const std::string& _path)
+{
+	this->End();
+
+	this->file.open(_path, std::ios::binary | std::ios::trunc);
+	if (!this->file)
+	{
+		std::cerr << "[InputRecordDevice] 記録を開けません : " << _path << std::endl;
+		return false;
+	}
+
+	InputRecordHeader header{};
+	header.fixedDelta = this->timeSystem.FixedDelta();
+	this->file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	this->pressed.reset();
+	this->mouseX = this->mouseY = -1;
+	this->frameCount = 0;
+
+	std::cout << "[InputRecordDevice] 記録を開始しました : " << _path << std::endl;
+	return true;
+}
+
+/// @brief 記録を終えてファイルを閉じる
+void InputRecordDevice::End()
+{
+	if (!this->file.is_open()) { return; }
+
+	this->file.close();
+	std::cout << "[InputRecordDevice] 記録を終了しました（" << this->frameCount << " フレーム）" << std::endl;
+}
+
+/// @brief 解放処理
+void InputRecordDevice::Dispose()
+{
+	this->End();
+	if (this->source) { this->source->Dispose(); }
+}
+
+/// @brief 入力状態の更新
+void InputRecordDevice::Update()
+{
+	this->source->Update();
+
+	if (this->file.is_open()) { this->WriteFrame(); }
+}
+
+/// @brief 1 フレーム分を書き出す
+void InputRecordDevice::WriteFrame()
+{
+	std::vector<uint8_t>& buffer = this->frameBuffer;
+	buffer.clear();
+	buffer.resize(sizeof(InputFrameRecord));
+
+	InputFrameRecord record{};
+	record.rawDelta = this->timeSystem.RawDelta();
+	record.loadLevel = static_cast<uint8_t>(this->fps.GetLoadLevel());
+
+	// マウスは変わったときだけ書く
+	const int x = this->source->GetMouseX();
+	const int y = this->source->GetMouseY();
+	if (x != this->mouseX || y != this->mouseY)
+	{
+		record.flags |= InputFrameRecord::MousePosition;
+		Append(buffer, static_cast<int32_t>(x));
+		Append(buffer, static_cast<int32_t>(y));
+		this->mouseX = x;
+		this->mouseY = y;
+	}
+
+	int dx = 0, dy = 0;
+	this->source->GetMouseDelta(dx, dy);
+	if (dx != 0 || dy != 0)
+	{
+		record.flags |= InputFrameRecord::MouseDelta;
+		Append(buffer, static_cast<int32_t>(dx));
+		Append(buffer, static_cast<int32_t>(dy));
+	}
+
+	// 押下状態は変わったコードだけ書く（押しっぱなしのフレームは何も増えない）
+	for (int code = 0; code < InputRecordCodeCount; code++)
+	{
+		const bool isPressed = this->source->IsPressed(code);
+		if (isPressed == this->pressed.test(code)) { continue; }
+
+		this->pressed.set(code, isPressed);
+		Append(buffer, static_cast<uint16_t>(code));
+		record.changedCount++;
+	}
+
+	std::memcpy(buffer.data(), &record, sizeof(record));
+	this->file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+	this->frameCount++;
+}
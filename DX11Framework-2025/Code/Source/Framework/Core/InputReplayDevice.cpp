@@ -0,0 +1,223 @@
+﻿/** @file   InputReplayDevice.cpp
+ *  @brief  InputReplayDevice の実装
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Core/InputReplayDevice.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	/** @brief 値をそのまま読み込む
+	 *  @param _data 記録
+	 *  @param _offset 読み込み位置（読めたら進める）
+	 *  @param _outValue 読み込み先
+	 *  @return 範囲内なら true
+	 */
+	template<typename T>
+	static bool Read(const std::vector<uint8_t>& _data, size_t& _offset, T& _outValue)
+	{
+		if (_data.size() - _offset < sizeof(T)) { return false; }
+		std::memcpy(&_outValue, _data.data() + _offset, sizeof(T));
+		_offset += sizeof(T);
+		return true;
+	}
+
+	/** @brief 1 フレーム分の大きさを求める
+	 *  @param _record フレームの先頭
+	 *  @return フレームのバイト数（先頭を含む）
+	 */
+	static size_t FrameBytes(const InputFrameRecord& _record)
+	{
+		size_t bytes = sizeof(InputFrameRecord);
+		if (_record.flags & InputFrameRecord::MousePosition) { bytes += sizeof(int32_t) * 2; }
+		if (_record.flags & InputFrameRecord::MouseDelta) { bytes += sizeof(int32_t) * 2; }
+		bytes += sizeof(uint16_t) * _record.changedCount;
+		return bytes;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// InputReplayDevice class
+//-----------------------------------------------------------------------------
+
+/// @brief コンストラクタ
+InputReplayDevice::InputReplayDevice()
+	: FakeInputDevice()
+	, data()
+	, readOffset(0)
+	, frameIndex(0)
+	, frameCount(0)
+	, mouseX(-1)
+	, mouseY(-1)
+	, startTime()
+{
+}
+
+/// @brief デストラクタ
+InputReplayDevice::~InputReplayDevice() {}
+
+/** @brief 記録を読み込む
+ *  @param _path 読み込むファイル
+ *  @param _fixedDelta 再生側の固定ステップ幅
+ *  @return 読み込めれば true
+ */
+bool InputReplayDevice::Open(const std::string& _path, float _fixedDelta)
+{
+	this->Dispose();
+
+	std::ifstream file(_path, std::ios::binary);
+	if (!file)
+	{
+		std::cerr << "[InputReplayDevice] 記録を開けません : " << _path << std::endl;
+		return false;
+	}
+
+	InputRecordHeader header{};
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+		|| header.magic != InputRecordMagic || header.version != InputRecordVersion
+		|| header.codeCount > static_cast<uint32_t>(FakeInputDevice::CodeCount))
+	{
+		std::cerr << "[InputReplayDevice] 入力の記録ではないか、バージョンが違います : " << _path << std::endl;
+		return false;
+	}
+	if (std::fabs(header.fixedDelta - _fixedDelta) > 1.0e-6f)
+	{
+		std::cerr << "[InputReplayDevice] 記録時と固定ステップ幅が違います（記録 " << header.fixedDelta
+			<< " 秒 / 再生 " << _fixedDelta << " 秒）。結果は一致しません" << std::endl;
+	}
+
+	this->data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+	// 再生中に範囲を確かめなくて済むように、先に最後まで辿る（記録中に落ちた場合は切れたフレームの手前まで使う）
+	size_t offset = 0;
+	InputFrameRecord record{};
+	while (Read(this->data, offset, record))
+	{
+		const size_t rest = FrameBytes(record) - sizeof(InputFrameRecord);
+		if (this->data.size() - offset < rest)
+		{
+			std::cerr << "[InputReplayDevice] 記録が途中で切れています（" << this->frameCount << " フレーム目まで再生します）" << std::endl;
+			break;
+		}
+
+		// 範囲外の値があれば、そこから先は使わない
+		bool isValid = record.loadLevel <= static_cast<uint8_t>(FrameLoadLevel::Overloaded);
+		const size_t codeOffset = offset + rest - sizeof(uint16_t) * record.changedCount;
+		for (uint16_t i = 0; i < record.changedCount && isValid; i++)
+		{
+			uint16_t code = 0;
+			std::memcpy(&code, this->data.data() + codeOffset + sizeof(uint16_t) * i, sizeof(code));
+			isValid = code < header.codeCount;
+		}
+		if (!isValid)
+		{
+			std::cerr << "[InputReplayDevice] 記録が壊れています（" << this->frameCount << " フレーム目まで再生します）" << std::endl;
+			break;
+		}
+
+		offset += rest;
+		this->frameCount++;
+	}
+	this->data.resize(offset);
+
+	std::cout << "[InputReplayDevice] 記録を読み込みました : " << _path << "（" << this->frameCount << " フレーム）" << std::endl;
+	return true;
+}
+
+/** @brief 次の Update で再生するフレームの時間を取得する
+ *  @param _outTiming 取得先
+ *  @return 再生するフレームが残っていなければ false
+ */
+bool InputReplayDevice::PeekNextTiming(FrameTiming& _outTiming) const
+{
+	if (this->IsFinished()) { return false; }
+
+	InputFrameRecord record{};
+	std::memcpy(&record, this->data.data() + this->readOffset, sizeof(record));
+	_outTiming.rawDelta = record.rawDelta;
+	_outTiming.loadLevel = static_cast<FrameLoadLevel>(record.loadLevel);
+	return true;
+}
+
+/// @brief 再生結果をログに出す
+void InputReplayDevice::Report() const
+{
+	const double seconds = (this->frameIndex > 0)
+		? std::chrono::duration<double>(std::chrono::steady_clock::now() - this->startTime).count()
+		: 0.0;
+	const double averageMs = (this->frameIndex > 0) ? seconds * 1000.0 / static_cast<double>(this->frameIndex) : 0.0;
+
+	std::cout << "[InputReplayDevice] frames " << this->frameIndex << " / " << this->frameCount
+		<< ", seconds " << seconds
+		<< ", avg " << averageMs << " ms/frame" << std::endl;
+}
+
+/// @brief 解放処理
+void InputReplayDevice::Dispose()
+{
+	FakeInputDevice::Dispose();
+
+	this->data.clear();
+	this->readOffset = 0;
+	this->frameIndex = 0;
+	this->frameCount = 0;
+	this->mouseX = this->mouseY = -1;
+}
+
+/// @brief 入力状態の更新
+void InputReplayDevice::Update()
+{
+	if (this->IsFinished())
+	{
+		// 再生し終えたら全て離す
+		this->ReleaseAll();
+		this->SetMouse(this->mouseX, this->mouseY);
+		FakeInputDevice::Update();
+		return;
+	}
+
+	if (this->frameIndex == 0) { this->startTime = std::chrono::steady_clock::now(); }
+
+	// 範囲は Open で確かめてある
+	InputFrameRecord record{};
+	Read(this->data, this->readOffset, record);
+
+	int32_t dx = 0, dy = 0;
+	if (record.flags & InputFrameRecord::MousePosition)
+	{
+		int32_t x = 0, y = 0;
+		Read(this->data, this->readOffset, x);
+		Read(this->data, this->readOffset, y);
+		this->mouseX = x;
+		this->mouseY = y;
+	}
+	if (record.flags & InputFrameRecord::MouseDelta)
+	{
+		Read(this->data, this->readOffset, dx);
+		Read(this->data, this->readOffset, dy);
+	}
+	this->SetMouse(this->mouseX, this->mouseY, dx, dy);
+
+	// 変わったコードだけ反転する（前の Update で反映した状態が IsPressed に残っている）
+	for (uint16_t i = 0; i < record.changedCount; i++)
+	{
+		uint16_t code = 0;
+		Read(this->data, this->readOffset, code);
+		this->SetPressed(code, !this->IsPressed(code));
+	}
+
+	this->frameIndex++;
+	FakeInputDevice::Update();
+}
@@ -7,13 +7,15 @@
 //-----------------------------------------------------------------------------
 #include "Include/Framework/Core/InputSystem.h"
 
+#include <algorithm>
+#include <iostream>
 #include <typeinfo>
 
 //-----------------------------------------------------------------------------
 // InputSystem Class
 //-----------------------------------------------------------------------------
 
-InputSystem::InputSystem() :devices(std::vector<std::unique_ptr<IInputDevice>>()), keyMap(std::unordered_map<std::string, int>()) {}
+InputSystem::InputSystem() :devices(std::vector<std::unique_ptr<IInputDevice>>()), actions(), actionIds(), snapshot() {}
 InputSystem::~InputSystem() { this->Dispose(); }
 
 /// @brief	リソースの解放処理
@@ -41,88 +43,114 @@ void InputSystem::RegisterDevice(std::unique_ptr<IInputDevice> _device)
     this->devices.push_back(std::move(_device));
 }
 
-/**	@brief	キーバインドの登録
- *	@param	const std::string& _action アクション名
- *	@param	int _keyCode	キーボタンの入力コード
+/**	@brief	アクションの登録
+ *	@param	InputActionName _action	アクション名
+ *	@return	InputActionId	アクション番号
  */
-void InputSystem::RegisterKeyBinding(const std::string& _action, int _keyCode)
-{
-    // 既に登録済なら無視する
-    if (this->keyMap.contains(_action)) { return; }
-
-    this->keyMap[_action] = _keyCode;
-}
-
-/// @brief	入力デバイスの更新
-void InputSystem::Update()
+InputActionId InputSystem::RegisterAction(InputActionName _action)
 {
-    for (const auto& device : this->devices)
+    // 既に登録済ならその番号を返す
+    auto it = this->actionIds.find(_action.GetHash());
+    if (it != this->actionIds.end())
     {
-        device->Update();
+        if (this->actions[it->second].name != _action.Name())
+        {
+            std::cerr << "[InputSystem] アクション名のハッシュが衝突しました : " << _action.Name()
+                << " / " << this->actions[it->second].name << std::endl;
+            return InvalidInputActionId;
+        }
+        return it->second;
     }
+
+    const InputActionId id = static_cast<InputActionId>(this->actions.size());
+    this->actions.push_back(ActionEntry{ std::string(_action.Name()), {} });
+    this->actionIds.emplace(_action.GetHash(), id);
+
+    // 状態のビット列を広げる（次の Update から反映される）
+    const size_t words = (this->actions.size() + 63) / 64;
+    this->snapshot.pressed.resize(words, 0);
+    this->snapshot.triggered.resize(words, 0);
+    this->snapshot.released.resize(words, 0);
+    return id;
 }
 
-/**	@brief	アクションに対応したキー、ボタンが押された状態か取得する
- *	@param	const std::string& _action	キーアクション名（例: "Jump"）
- *  @return bool いずれかのデバイスで押されていれば true
+/**	@brief	キーバインドの登録
+ *	@param	InputActionName _action アクション名
+ *	@param	int _keyCode	キーボタンの入力コード
+ *	@return	InputActionId	アクション番号
  */
-bool InputSystem::IsActionPressed(const std::string& _action) const
+InputActionId InputSystem::RegisterKeyBinding(InputActionName _action, int _keyCode)
 {
-    // キーマップに対応した入力コードの取得
-    auto it = this->keyMap.find(_action);
-    if (it == this->keyMap.end()) { return false; }   // [TODO] 未定義のアクションの場合Logを出す
-    
-    int code = it->second;
+    const InputActionId id = this->RegisterAction(_action);
+    if (id == InvalidInputActionId) { return id; }
 
-    for (const auto& device :this->devices)
+    // 同じキーの重複登録は無視する（シーンをまたいで何度も登録されるため）
+    auto& keyCodes = this->actions[id].keyCodes;
+    if (std::find(keyCodes.begin(), keyCodes.end(), _keyCode) == keyCodes.end())
     {
-        // 入力があった
-        if (device->IsPressed(code)) { return true; }
+        keyCodes.push_back(_keyCode);
     }
-
-    // 入力が無かった
-    return false;
+    return id;
 }
 
-/**	@brief	アクションに対応したキー、ボタンがトリガー状態か取得する
- *	@param	const std::string& _action	キーアクション
- * @return bool 前フレームから押された瞬間であれば true
+/**	@brief	アクション番号を取得する
+ *	@param	InputActionName _action	アクション名
+ *	@return	InputActionId	未登録なら InvalidInputActionId
  */
-bool InputSystem::IsActionTriggered(const std::string& _action) const
+InputActionId InputSystem::GetActionId(InputActionName _action) const
 {
-    // キーマップに対応した入力コードの取得
-    auto it = this->keyMap.find(_action);
-    if (it == this->keyMap.end()) { return false; }   // [TODO] 未定義のアクションの場合Logを出す
+    auto it = this->actionIds.find(_action.GetHash());
+    if (it == this->actionIds.end()) { return InvalidInputActionId; }   // [TODO] 未定義のアクションの場合Logを出す
 
-    int code = it->second;
+    // ハッシュが同じ別の名前は未登録として扱う
+    if (this->actions[it->second].name != _action.Name()) { return InvalidInputActionId; }
 
+    return it->second;
+}
+
+/// @brief	入力デバイスの更新
+void InputSystem::Update()
+{
     for (const auto& device : this->devices)
     {
-        // 入力があった
-        if (device->IsTriggered(code)) { return true; }
+        device->Update();
     }
 
-    // 入力が無かった
-    return false;
+    // 全アクションの押下状態を 64 個ずつまとめて求め、前フレームとの差でトリガー・リリースを作る
+    for (size_t word = 0; word < this->snapshot.pressed.size(); word++)
+    {
+        uint64_t pressed = 0;
+        const size_t first = word * 64;
+        const size_t last = std::min(first + 64, this->actions.size());
+        for (size_t id = first; id < last; id++)
+        {
+            if (this->IsAnyKeyPressed(this->actions[id])) { pressed |= uint64_t{ 1 } << (id - first); }
+        }
+
+        const uint64_t previous = this->snapshot.pressed[word];
+        this->snapshot.pressed[word] = pressed;
+        this->snapshot.triggered[word] = pressed & ~previous;
+        this->snapshot.released[word] = ~pressed & previous;
+    }
 }
 
-/**	@brief	アクションに対応したキー、ボタンがリリース状態か取得する
- *	@param	const std::string& _action	キーアクション
- * @return bool 前フレームから離された瞬間であれば true
+/**	@brief	アクションに割り当てたキーのどれかが押されているか
+ *	@param	const ActionEntry& _action	アクション
+ *	@return	bool	いずれかのデバイスで押されていれば true
  */
-bool InputSystem::isActionReleased(const std::string& _action) const
+bool InputSystem::IsAnyKeyPressed(const ActionEntry& _action) const
 {
-    // キーマップに対応した入力コードの取得
-    auto it = this->keyMap.find(_action);
-    if (it == this->keyMap.end()) { return false; }   // [TODO] 未定義のアクションの場合Logを出す
-    int code = it->second;
-    for (const auto& device : this->devices)
+    for (int code : _action.keyCodes)
     {
-        // 離された瞬間の入力があった
-        if (device->IsReleased(code)) { return true; }
+        for (const auto& device : this->devices)
+        {
+            // 入力があった
+            if (device->IsPressed(code)) { return true; }
+        }
     }
+
     // 入力が無かった
-	return false;
+    return false;
 }
 
 /** @brief マウスの現在座標を取得
@@ -12,10 +12,18 @@
 
 #include "Include/Framework/Core/PhysicsSystem.h"
 #include "Include/Framework/Physics/PhysicsLayers.h"
+#if !defined(FRAMEWORK_PHYSICS_HEADLESS)
 #include "Include/Framework/Entities/Rigidbody3D.h"
 #include "Include/Framework/Entities/Collider3DComponent.h"
+#endif
+#include "Include/Framework/Utils/Profiler.h"
 
 #include <Jolt/RegisterTypes.h>
+#include <Jolt/Physics/Collision/BroadPhase/BroadPhase.h>
+#include <Jolt/Core/HashCombine.h>
+
+#include <algorithm>
+#include <chrono>
 
 namespace Framework::Physics
 {
@@ -28,17 +36,28 @@ namespace Framework::Physics
 		: tempAllocator(nullptr)
 		, jobSystem(nullptr)
 		, physics(nullptr)
+		, config()
+		, telemetry()
+		, recorder()
 		, bpLayerInterface()
 		, objectVsBroadPhaseFilter()
 		, objectPairFilter()
 		, shapeCastBroadFilters()
 		, shapeCastObjectFilters()
-		, currContact()
-		, prevContact()
+		, contactTable()
+#if !defined(FRAMEWORK_PHYSICS_HEADLESS)
+		, query(*this)
+#endif
 		, contactListener(*this)
-		, bodyMap()
+		, contactBuffers()
+		, instanceID(nextInstanceID.fetch_add(1))
+		, bodyBatchDepth(0)
+		, batchedActiveBodies()
+		, batchedSleepingBodies()
+		, pairCountBodies()
+		, bodyPairCountdown(0)
+		, bodyRecords()
 		, colliderIDMap()
-		, bodyColliderMap()
 		, nextColliderID(1)
 	{}
 
@@ -49,9 +68,10 @@ namespace Framework::Physics
 	}
 
 	/** @brief 初期化処理
+	 *  @param _config 容量設定
 	 *  @return 成功したら true
 	 */
-	bool PhysicsSystem::Initialize()
+	bool PhysicsSystem::Initialize(const PhysicsConfig& _config)
 	{
 		// すでに初期化されていたら何もしない
 		if (this->physics)
@@ -59,6 +79,14 @@ namespace Framework::Physics
 			return true;
 		}
 
+		if (_config.maxBodies == 0 || _config.maxBodyPairs == 0 || _config.maxContactConstraints == 0 || _config.tempAllocatorSize == 0)
+		{
+			std::cerr << "[PhysicsSystem] PhysicsConfig の容量に 0 が含まれています" << std::endl;
+			return false;
+		}
+		this->config = _config;
+		this->telemetry.Reset(_config);
+
 		// メモリ管理
 		JPH::RegisterDefaultAllocator();
 
@@ -71,7 +99,7 @@ namespace Framework::Physics
 		JPH::RegisterTypes();
 
 		// 一時アロケータ
-		this->tempAllocator = std::make_unique<JPH::TempAllocatorImpl>(10 * 1024 * 1024);
+		this->tempAllocator = std::make_unique<TrackingTempAllocator>(_config.tempAllocatorSize);
 
 		// スレッド数を決定（スレッド数は CPU コア数 − 1）
 		//unsigned int hwThreads = std::thread::hardware_concurrency();
@@ -85,7 +113,7 @@ namespace Framework::Physics
 		//{
 		//	numThreads = 0;
 		//}
-		unsigned int numThreads = 1;
+		const unsigned int numThreads = _config.workerThreads;
 
 		const JPH::uint maxJobs = JPH::cMaxPhysicsJobs;
 		const JPH::uint maxBarriers = JPH::cMaxPhysicsBarriers;
@@ -96,10 +124,10 @@ namespace Framework::Physics
 		// PhysicsSystem の生成
 		this->physics = std::make_unique<JPH::PhysicsSystem>();
 
-		const JPH::uint maxBodies = 2048;
+		const JPH::uint maxBodies = _config.maxBodies;
 		const JPH::uint numBodyMutexes = 0;
-		const JPH::uint maxBodyPairs = 1024;
-		const JPH::uint maxContactConstraints = 1024;
+		const JPH::uint maxBodyPairs = _config.maxBodyPairs;
+		const JPH::uint maxContactConstraints = _config.maxContactConstraints;
 
 		// BroadPhaseLayerInterface / 衝突フィルタの登録
 		this->physics->Init(
@@ -115,6 +143,10 @@ namespace Framework::Physics
 		// ShapeCast 用フィルタ群の初期化
 		this->InitializeShapeCastFilters();
 
+		// Body の関連情報は BodyID のインデックスで引くので最大数ぶん確保しておく
+		this->bodyRecords.assign(maxBodies, BodyRecord{});
+		this->pairCountBodies.reserve(maxBodies);
+
 		// コンタクトリスナーの登録
 		this->physics->SetContactListener(&this->contactListener);
 
@@ -131,12 +163,107 @@ namespace Framework::Physics
 			return;
 		}
 
-		this->physics->Update(
+		using Clock = std::chrono::steady_clock;
+		auto toMilliseconds = [](Clock::duration _d) { return std::chrono::duration<double, std::milli>(_d).count(); };
+
+		const auto stepBegin = Clock::now();
+
+		const JPH::EPhysicsUpdateError errors = this->physics->Update(
 			_deltaTime,
 			1,
 			this->tempAllocator.get(),
 			this->jobSystem.get()
 		);
+		const auto updateEnd = Clock::now();
+
+		// ワーカースレッドが追記した接触ペアをまとめる
+		this->MergeContactBuffers();
+		const auto contactEnd = Clock::now();
+
+#if !defined(FRAMEWORK_PHYSICS_HEADLESS)
+		// 更新中に予約された遅延クエリを、更新後の姿勢で解決する
+		this->query.ResolveDeferred();
+#endif
+		const auto stepEnd = Clock::now();
+
+		// 計測済みの区間をそのままプロファイラにも渡す
+		Profiler::RecordZone("Jolt::Update", stepBegin, updateEnd);
+		Profiler::RecordZone("MergeContacts", updateEnd, contactEnd);
+		Profiler::RecordZone("ResolveDeferredQueries", contactEnd, stepEnd);
+
+		// 記録中はステップ後の状態ハッシュも残す（計測時間には含めない）
+		if (this->recorder.IsRecording())
+		{
+			this->recorder.Step(_deltaTime, this->ComputeStateHash());
+		}
+
+		//-----------------------------------------------------------
+		// 計測値の記録（上限に近づいたら警告が出る）
+		//-----------------------------------------------------------
+		PhysicsStats stats = this->telemetry.GetStats();
+
+		// Body ペア数は BroadPhase をもう一度引いて数えるので、間隔を空けて数える（間のステップは前回の値のまま）
+		// 上限を超えたステップは警告に正しい値を出すため必ず数える
+		const bool overflowed = (errors != JPH::EPhysicsUpdateError::None);
+		const auto pairBegin = Clock::now();
+		if (this->config.bodyPairSampleInterval > 0 && (this->bodyPairCountdown-- == 0 || overflowed))
+		{
+			stats.bodyPairCount = this->CountBodyPairs();
+			this->bodyPairCountdown = this->config.bodyPairSampleInterval - 1;
+			Profiler::RecordZone("CountBodyPairs", pairBegin, Clock::now());
+		}
+		const auto pairEnd = Clock::now();
+
+		stats.bodyCount = this->physics->GetNumBodies();
+		stats.activeBodyCount = this->physics->GetNumActiveBodies(JPH::EBodyType::RigidBody);
+		stats.contactPairCount = static_cast<uint32_t>(this->contactTable.GetCurrentPairs().size());
+		stats.contactConstraintCount = this->contactListener.TakeConstraintCount();
+		stats.tempAllocatorStepPeak = this->tempAllocator->TakeStepPeak();
+		stats.updateErrors = static_cast<uint32_t>(errors);
+		stats.updateMilliseconds = toMilliseconds(updateEnd - stepBegin);
+		stats.contactMilliseconds = toMilliseconds(contactEnd - updateEnd);
+		stats.queryMilliseconds = toMilliseconds(stepEnd - contactEnd);
+		stats.bodyPairMilliseconds = toMilliseconds(pairEnd - pairBegin);
+		stats.stepMilliseconds = toMilliseconds(stepEnd - stepBegin) + stats.bodyPairMilliseconds;
+		this->telemetry.Record(stats);
+	}
+
+	/** @brief 範囲をジョブに分けて並列に処理する
+	 *  @param _name ジョブ名
+	 *  @param _count 要素数
+	 *  @param _minPerJob 1 ジョブの最小要素数
+	 *  @param _function 範囲を処理する関数
+	 */
+	void PhysicsSystem::ParallelFor(const char* _name, size_t _count, size_t _minPerJob, const std::function<void(size_t, size_t)>& _function)
+	{
+		if (_count == 0) { return; }
+
+		// スレッドあたり 2 ジョブにして負荷の偏りをならす
+		constexpr size_t JobsPerThread = 2;
+
+		JPH::JobSystem* jobs = this->jobSystem.get();
+		const size_t concurrency = jobs ? static_cast<size_t>(std::max(1, jobs->GetMaxConcurrency())) : 1;
+		const size_t perJob = std::max<size_t>(std::max<size_t>(1, _minPerJob), (_count + concurrency * JobsPerThread - 1) / (concurrency * JobsPerThread));
+
+		if (!jobs || _count <= perJob)
+		{
+			_function(0, _count);
+			return;
+		}
+
+		JPH::JobSystem::Barrier* barrier = jobs->CreateBarrier();
+		for (size_t begin = 0; begin < _count; begin += perJob)
+		{
+			const size_t end = std::min(_count, begin + perJob);
+			barrier->AddJob(jobs->CreateJob(_name, JPH::Color::sCyan, [&_function, _name, begin, end]()
+			{
+				// ワーカースレッド側のジョブもゾーンとして残す
+				Profiler::ScopedZone zone(_name);
+				_function(begin, end);
+			}));
+		}
+		jobs->WaitForJobs(barrier);
+		jobs->DestroyBarrier(barrier);
 	}
 
 	/// @brief 内部リソースの解放処理
@@ -148,6 +275,9 @@ namespace Framework::Physics
 			return;
 		}
 
+		// 記録中なら閉じておく
+		this->recorder.End();
+
 		// PhysicsSystem の解放（内部で Body や Shape が破棄される）
 		this->physics.reset();
 
@@ -155,6 +285,18 @@ namespace Framework::Physics
 		this->jobSystem.reset();
 		this->tempAllocator.reset();
 
+		// 接触情報・Body の関連情報も破棄（BodyID が無効になるため）
+		this->contactTable.Clear();
+#if !defined(FRAMEWORK_PHYSICS_HEADLESS)
+		this->query.Clear();
+#endif
+		this->bodyBatchDepth = 0;
+		this->bodyPairCountdown = 0;
+		this->batchedActiveBodies.clear();
+		this->batchedSleepingBodies.clear();
+		this->bodyRecords.clear();
+		this->colliderIDMap.clear();
+
 		// ShapeCast フィルタも明示的に破棄
 		for (auto& f : this->shapeCastBroadFilters)
 		{
@@ -208,131 +350,137 @@ namespace Framework::Physics
 		return this->physics->GetNarrowPhaseQuery();
 	}
 
-	/** @brief 接触した剛体ペアを追加する
-	 *  @param _bodyA       ぶつかった剛体1
-	 *  @param _bodyB       ぶつかった剛体2
-	 *	@detail 
-	 *		- BodyIDを昇順に揃える
-	 *		- Jolt側で当たった時、当たっている時に呼び出される
+	/** @brief ロックを取らない NarrowPhaseQuery を取得する
+	 *  @return NarrowPhaseQuery への参照
 	 */
-	void PhysicsSystem::AddContactPair(ColliderKey _bodyA, ColliderKey _bodyB)
+	const JPH::NarrowPhaseQuery& PhysicsSystem::GetNarrowPhaseQueryNoLock() const
 	{
-		// BodyID を昇順に揃える
-		if (_bodyA.bodyID > _bodyB.bodyID)
+		if (!this->physics)
 		{
-			std::swap(_bodyA, _bodyB);
+			static JPH::NarrowPhaseQuery dummy;
+			return dummy;
 		}
+		return this->physics->GetNarrowPhaseQueryNoLock();
+	}
 
-		// 追加: 同期
-		std::lock_guard<std::mutex> lock(this->contactMutex);
-		this->currContact[_bodyA].insert(_bodyB);
+	/** @brief ロックを取らない剛体ロック用インターフェースを取得する
+	 *  @return 剛体ロックインターフェースの参照
+	 */
+	const JPH::BodyLockInterface& PhysicsSystem::GetBodyLockInterfaceNoLock() const
+	{
+		if (!this->physics)
+		{
+			// 空の BodyManager を見るので、どの BodyID でもロックに失敗する
+			static JPH::BodyManager dummyManager;
+			static JPH::BodyLockInterfaceNoLock dummy(dummyManager);
+			return dummy;
+		}
+		return this->physics->GetBodyLockInterfaceNoLock();
 	}
 
-	void PhysicsSystem::ProcessContactEvents()
+	/** @brief 接触した剛体ペアを追加する
+	 *  @param _bodyA       ぶつかった剛体1
+	 *  @param _bodyB       ぶつかった剛体2
+	 *	@detail 
+	 *		- BodyIDを昇順に揃えて 64bit キーに詰める
+	 *		- Jolt側で当たった時、当たっている時に呼び出される（ワーカースレッドから並列に呼ばれる）
+	 *		- 呼び出しスレッド専用のバッファに追記するだけなのでロックは取らない
+	 */
+	void PhysicsSystem::AddContactPair(JPH::BodyID _bodyA, JPH::BodyID _bodyB)
 	{
-		// 追加: 同期（全体処理中はテーブルをロック）
-		std::lock_guard<std::mutex> lock(this->contactMutex);
+		this->GetThreadContactBuffer().pairs.push_back(MakeContactPairKey(_bodyA, _bodyB));
+	}
 
-		auto& bodyInterface = this->physics->GetBodyInterface();
+	/** @brief 呼び出しスレッド用の接触バッファを取得する
+	 *  @return 接触バッファ
+	 */
+	PhysicsSystem::ContactBuffer& PhysicsSystem::GetThreadContactBuffer()
+	{
+		// インスタンス ID で照合するので、PhysicsSystem を作り直しても古いバッファは参照しない
+		thread_local uint64_t cachedOwner = 0;
+		thread_local ContactBuffer* cachedBuffer = nullptr;
 
-		// 無効ボディの掃除
-		auto cleanContactTable = [&](auto& table)
+		if (cachedOwner != this->instanceID)
 		{
-			for (auto itA = table.begin(); itA != table.end(); )
-			{
-				if (!IsBodyValid(itA->first.bodyID))
-				{
-					itA = table.erase(itA);
-					continue;
-				}
-
-				for (auto itB = itA->second.begin(); itB != itA->second.end(); )
-				{
-					if (!IsBodyValid(itB->bodyID))
-						itB = itA->second.erase(itB);
-					else
-						++itB;
-				}
-				++itA;
-			}
-		};
+			std::lock_guard<std::mutex> lock(this->contactBufferMutex);
+			this->contactBuffers.push_back(std::make_unique<ContactBuffer>());
+			cachedBuffer = this->contactBuffers.back().get();
+			cachedOwner = this->instanceID;
+		}
+		return *cachedBuffer;
+	}
 
-		cleanContactTable(this->currContact);
-		cleanContactTable(this->prevContact);
+	/// @brief スレッドごとのバッファを接触ペア表へまとめる
+	void PhysicsSystem::MergeContactBuffers()
+	{
+		std::lock_guard<std::mutex> lock(this->contactBufferMutex);
 
-		// Enter & Stay
-		for (auto& [bodyA, currentSet] : this->currContact)
+		for (auto& buffer : this->contactBuffers)
 		{
-			auto& prevSet = this->prevContact[bodyA];
-
-			for (const auto& bodyB : currentSet)
-			{
-				bool isPrev = (prevSet.count(bodyB) > 0);
-
-				if (!isPrev)
-					this->HandleContact(ContactType::Coll_Entered, bodyA, bodyB);
-				else
-					this->HandleContact(ContactType::Coll_Stayed, bodyA, bodyB);
-			}
+			this->contactTable.Append(buffer->pairs);
+			buffer->pairs.clear();
 		}
+		this->contactTable.Finalize();
+	}
 
-		// Exit
-		for (auto& [bodyA, prevSet] : this->prevContact)
+	/** @brief 接触イベントを処理する
+	 *	@detail 
+	 *		- 前ステップと今ステップの接触ペア（どちらも昇順）を 1 回の線形マージで比べる
+	 *		- 破棄された Body のペアは UnregisterBody の通知で取り除かれている
+	 */
+	void PhysicsSystem::ProcessContactEvents()
+	{
+		this->contactTable.Diff([this](ContactTransition _transition, ContactPairKey _key)
 		{
-			auto itCurr = this->currContact.find(bodyA);
-			const auto* currSet = (itCurr != this->currContact.end()) ? &itCurr->second : nullptr;
+			ContactType type = ContactType::Coll_Stayed;
+			if (_transition == ContactTransition::Entered) { type = ContactType::Coll_Entered; }
+			else if (_transition == ContactTransition::Exited) { type = ContactType::Coll_Exited; }
 
-			for (auto& bodyB : prevSet)
-			{
-				bool stillContact = currSet && currSet->count(bodyB) > 0;
-
-				if (!stillContact)
-					this->HandleContact(ContactType::Coll_Exited, bodyA, bodyB);
-			}
-		}
-
-		// 履歴更新
-		this->prevContact = this->currContact;
-		this->currContact.clear();
+			this->HandleContact(type, GetContactPairBodyA(_key), GetContactPairBodyB(_key));
+		});
 	}
 
-	/** @brief BodyID が有効かどうか調べる
-	 *  @param _body 調べる BodyID
-	 *  @return 有効なら true
+	/** @brief 接触イベントを両側の Rigidbody3D に配送する
+	 *  @param _type   接触タイプ
+	 *  @param _bodyA  剛体Aの BodyID
+	 *  @param _bodyB  剛体Bの BodyID
 	 */
-	void PhysicsSystem::HandleContact(ContactType _type, ColliderKey _bodyA, ColliderKey _bodyB)
+	void PhysicsSystem::HandleContact(ContactType _type, JPH::BodyID _bodyA, JPH::BodyID _bodyB)
 	{
-		auto rbA = GetRigidbody3D(_bodyA.bodyID);
-		auto rbB = GetRigidbody3D(_bodyB.bodyID);
-		if (!rbA || !rbB) { return; }
+		const BodyRecord* foundA = this->FindBodyRecord(_bodyA);
+		const BodyRecord* foundB = this->FindBodyRecord(_bodyB);
+		if (!foundA || !foundB) { return; }
 
-		const bool aIsSensor = IsSensorBody(_bodyA.bodyID);
-		const bool bIsSensor = IsSensorBody(_bodyB.bodyID);
+		// 配送中に Body の登録・解除が起きても良いようにコピーしておく
+		const BodyRecord recordA = *foundA;
+		const BodyRecord recordB = *foundB;
+		if (!recordA.rigidbody || !recordB.rigidbody) { return; }
 
 		ContactType typeA = _type;
 		ContactType typeB = _type;
 
-		// いずれかがセンサーなら両側ともトリガーイベントに変換する
-		if (aIsSensor || bIsSensor)
+		// いずれかがセンサーなら両側ともトリガーイベントに変換する（生成時に記録したフラグを使う）
+		if (recordA.isSensor || recordB.isSensor)
 		{
 			ConvertToTrigger(typeA);
 			ConvertToTrigger(typeB);
 		}
 
+#if !defined(FRAMEWORK_PHYSICS_HEADLESS)
 		// 接触イベントを出す
-		rbA->DispatchContactEvent(typeA, GetCollider3D(_bodyA.colliderID), GetCollider3D(_bodyB.colliderID));
-		rbB->DispatchContactEvent(typeB, GetCollider3D(_bodyB.colliderID), GetCollider3D(_bodyA.colliderID));
+		recordA.rigidbody->DispatchContactEvent(typeA, recordA.collider, recordB.collider);
+		recordB.rigidbody->DispatchContactEvent(typeB, recordB.collider, recordA.collider);
+#endif
 	}
 
-	/** @brief BodyID が有効かどうか調べる
-	 *  @param _body 調べる BodyID
-	 *  @return 有効なら true
+	/** @brief BodyID がセンサーボディかどうか調べる
+	 *  @param _id 調べる BodyID
+	 *  @return センサーボディなら true
 	 */
 	bool PhysicsSystem::IsSensorBody(JPH::BodyID _id)
 	{
-		JPH::BodyLockRead lock(this->physics->GetBodyLockInterface(), _id);
-		if (!lock.Succeeded()) { return false; }
-		return lock.GetBody().IsSensor();
+		const BodyRecord* record = this->FindBodyRecord(_id);
+		return record && record->isSensor;
 	}
 
 	void PhysicsSystem::ConvertToTrigger(ContactType& _type)
@@ -342,87 +490,327 @@ namespace Framework::Physics
 		else if (_type == ContactType::Coll_Exited) _type = ContactType::Trigger_Exited;
 	}
 
-	/** @brief BodyID と Rigidbody3D の関連付けを登録する
-	 *  @param _bodyID  登録する BodyID
-	 *  @param _rigidbody 関連付ける Rigidbody3D
+	/** @brief Body の関連情報を登録する
+	 *  @param _bodyID    登録する BodyID
+	 *  @param _rigidbody 所有する Rigidbody3D
+	 *  @param _collider  対応するコライダー
+	 *  @param _isSensor  センサーボディか
 	 */
-	void PhysicsSystem::RegisterRigidbody3D(JPH::BodyID _bodyID, Rigidbody3D* _rigidbody)
+	void PhysicsSystem::RegisterBody(JPH::BodyID _bodyID, Rigidbody3D* _rigidbody, Collider3DComponent* _collider, bool _isSensor)
 	{
-		// 登録
-		this->bodyMap[_bodyID] =/* { _rigidbody, _bodyID.GetSequenceNumber() };*/_rigidbody;
+		if (_bodyID.IsInvalid()) { return; }
+
+		const JPH::uint32 index = _bodyID.GetIndex();
+		if (index >= this->bodyRecords.size())
+		{
+			this->bodyRecords.resize(static_cast<size_t>(index) + 1);
+		}
+
+		BodyRecord& record = this->bodyRecords[index];
+		record.bodyID = _bodyID;
+		record.rigidbody = _rigidbody;
+		record.collider = _collider;
+		record.isSensor = _isSensor;
+
+		if (_collider)
+		{
+			const int id = AssignColliderID(_collider);
+			if (id >= 0)
+			{
+				this->colliderIDMap[id] = _collider;
+			}
+		}
 	}
 
-	/** @brief BodyID と Rigidbody3D の関連付けを解除する
-	 *  @param _bodyID 解除する BodyID
+	/** @brief Body をワールドに追加する（一括追加中は保留する）
+	 *  @param _bodyID 追加する BodyID
+	 *  @param _activation 追加時に起こすか
 	 */
-	void PhysicsSystem::UnregisterRigidbody3D(JPH::BodyID _bodyID)
+	void PhysicsSystem::AddBody(JPH::BodyID _bodyID, JPH::EActivation _activation)
 	{
-		this->bodyMap.erase(_bodyID);
+		if (this->bodyBatchDepth > 0)
+		{
+			auto& batch = (_activation == JPH::EActivation::Activate) ? this->batchedActiveBodies : this->batchedSleepingBodies;
+			batch.push_back(_bodyID);
+			return;
+		}
+
+		this->GetBodyInterface().AddBody(_bodyID, _activation);
+		this->recorder.AddBody(_bodyID, _activation);
 	}
 
-	/** @brief BodyID から Rigidbody3D を取得する
-	 *  @param _bodyID 取得する BodyID
-	 *  @return 対応する Rigidbody3D（存在しない場合は nullptr）
+	/** @brief Body をワールドから取り除く
+	 *  @param _bodyID 取り除く BodyID
 	 */
-	Rigidbody3D* PhysicsSystem::GetRigidbody3D(JPH::BodyID _bodyID)
+	void PhysicsSystem::RemoveBody(JPH::BodyID _bodyID)
 	{
-		auto it = this->bodyMap.find(_bodyID);
-		if (it != this->bodyMap.end())
+		// 追加前の Body を RemoveBody に渡すと Jolt がアサートするので、保留中なら取り消すだけにする
+		for (auto* batch : { &this->batchedActiveBodies, &this->batchedSleepingBodies })
 		{
-			return it->second;
+			auto it = std::find(batch->begin(), batch->end(), _bodyID);
+			if (it != batch->end())
+			{
+				batch->erase(it);
+				return;
+			}
 		}
 
-		// 存在しない
-		return nullptr;
+		this->GetBodyInterface().RemoveBody(_bodyID);
+		this->recorder.RemoveBody(_bodyID);
 	}
 
-	int PhysicsSystem::AssignColliderID(Collider3DComponent* _collider)
+	/// @brief Body の一括追加を開始する
+	void PhysicsSystem::BeginBodyBatch()
 	{
-		if (!_collider) { return -1; }
+		++this->bodyBatchDepth;
+	}
 
-		int id = _collider->GetColliderID();
-		if (id < 0)
+	/// @brief 保留した Body をまとめて追加する
+	void PhysicsSystem::EndBodyBatch()
+	{
+		if (this->bodyBatchDepth == 0) { return; }
+		if (--this->bodyBatchDepth > 0) { return; }
+		if (!this->physics) { return; }
+
+		const size_t count = this->batchedActiveBodies.size() + this->batchedSleepingBodies.size();
+		if (count == 0) { return; }
+
+		// BroadPhase 側でまとめて木を組んでから一度に差し込む（1 つずつ追加すると木の更新が Body 数分走る）
+		auto& bodyInterface = this->GetBodyInterface();
+		auto addBatch = [this, &bodyInterface](std::vector<JPH::BodyID>& _bodies, JPH::EActivation _activation)
 		{
-			id = this->nextColliderID++;
-			_collider->SetColliderID(id);
+			if (_bodies.empty()) { return; }
+
+			const int number = static_cast<int>(_bodies.size());
+			JPH::BodyInterface::AddState state = bodyInterface.AddBodiesPrepare(_bodies.data(), number);
+			bodyInterface.AddBodiesFinalize(_bodies.data(), number, state, _activation);
+			this->recorder.AddBodies(_bodies.data(), number, _activation);
+			_bodies.clear();
+		};
+		addBatch(this->batchedActiveBodies, JPH::EActivation::Activate);
+		addBatch(this->batchedSleepingBodies, JPH::EActivation::DontActivate);
+
+		// 読み込み直後のクエリが遅くならないよう、木を作り直しておく
+		this->OptimizeBroadPhase();
+	}
+
+	/// @brief BroadPhase の木を作り直す
+	void PhysicsSystem::OptimizeBroadPhase()
+	{
+		if (!this->physics) { return; }
+		this->physics->OptimizeBroadPhase();
+		this->recorder.OptimizeBroadPhase();
+	}
+
+	/** @brief Body を生成する
+	 *  @param _settings 生成設定
+	 *  @return 生成した Body
+	 */
+	JPH::Body* PhysicsSystem::CreateBody(const JPH::BodyCreationSettings& _settings)
+	{
+		JPH::Body* body = this->GetBodyInterface().CreateBody(_settings);
+		if (body)
+		{
+			this->recorder.CreateBody(body->GetID(), _settings);
 		}
+		return body;
+	}
 
-		return id;
+	/** @brief Body を破棄する
+	 *  @param _bodyID 破棄する BodyID
+	 */
+	void PhysicsSystem::DestroyBody(JPH::BodyID _bodyID)
+	{
+		this->GetBodyInterface().DestroyBody(_bodyID);
+		this->recorder.DestroyBody(_bodyID);
 	}
 
-	/** @brief BodyID と Collider3DComponent の関連付けを登録する
-	 *  @param _bodyID			登録する BodyID
-	 *  @param _collider		関連付ける Collider3DComponent
+	/** @brief Kinematic Body を動かす
+	 *  @param _bodyID 対象の BodyID
+	 *  @param _position 目標位置
+	 *  @param _rotation 目標回転
+	 *  @param _deltaTime ステップ幅
 	 */
-	void PhysicsSystem::RegisterCollider3D(JPH::BodyID _bodyID, Collider3DComponent* _collider)
+	void PhysicsSystem::MoveKinematic(JPH::BodyID _bodyID, JPH::RVec3Arg _position, JPH::QuatArg _rotation, float _deltaTime)
 	{
-		if (!_collider) { return; }
+		this->GetBodyInterface().MoveKinematic(_bodyID, _position, _rotation, _deltaTime);
+		this->recorder.MoveKinematic(_bodyID, _position, _rotation, _deltaTime);
+	}
 
-		const int id = AssignColliderID(_collider);
-		if (id < 0) { return; }
+	/** @brief MotionType を変更する
+	 *  @param _bodyID 対象の BodyID
+	 *  @param _motionType 動作モード
+	 *  @param _activation 変更後に起こすか
+	 */
+	void PhysicsSystem::SetMotionType(JPH::BodyID _bodyID, JPH::EMotionType _motionType, JPH::EActivation _activation)
+	{
+		this->GetBodyInterface().SetMotionType(_bodyID, _motionType, _activation);
+		this->recorder.SetMotionType(_bodyID, _motionType, _activation);
+	}
+
+	/** @brief MotionQuality を変更する
+	 *  @param _bodyID 対象の BodyID
+	 *  @param _motionQuality 衝突判定の精度
+	 */
+	void PhysicsSystem::SetMotionQuality(JPH::BodyID _bodyID, JPH::EMotionQuality _motionQuality)
+	{
+		this->GetBodyInterface().SetMotionQuality(_bodyID, _motionQuality);
+		this->recorder.SetMotionQuality(_bodyID, _motionQuality);
+	}
+
+	/** @brief ObjectLayer を変更する
+	 *  @param _bodyID 対象の BodyID
+	 *  @param _layer 設定するレイヤー
+	 */
+	void PhysicsSystem::SetObjectLayer(JPH::BodyID _bodyID, JPH::ObjectLayer _layer)
+	{
+		this->GetBodyInterface().SetObjectLayer(_bodyID, _layer);
+		this->recorder.SetObjectLayer(_bodyID, _layer);
+	}
+
+	/** @brief 記録を開始する
+	 *  @param _path 出力先
+	 *  @return 開始できたら true
+	 */
+	bool PhysicsSystem::StartRecording(const std::string& _path)
+	{
+		if (!this->physics) { return false; }
+		if (!this->recorder.Begin(_path, this->config)) { return false; }
 
-		this->colliderIDMap[id] = _collider;
-		this->bodyColliderMap[_bodyID] = _collider;
+		// 既にある Body は BodyID 順に、その時点の設定で生成・追加したものとして書き出す
+		JPH::BodyIDVector bodyIDs;
+		this->physics->GetBodies(bodyIDs);
+		std::sort(bodyIDs.begin(), bodyIDs.end());
+
+		const auto& lockInterface = this->physics->GetBodyLockInterfaceNoLock();
+		for (const JPH::BodyID& id : bodyIDs)
+		{
+			JPH::BodyLockRead lock(lockInterface, id);
+			if (!lock.Succeeded()) { continue; }
+
+			const JPH::Body& body = lock.GetBody();
+			this->recorder.CreateBody(id, body.GetBodyCreationSettings());
+			if (body.IsInBroadPhase())
+			{
+				this->recorder.AddBody(id, body.IsActive() ? JPH::EActivation::Activate : JPH::EActivation::DontActivate);
+			}
+		}
+		return true;
 	}
 
-	/** @brief BodyID と Collider3DComponent の関連付けを解除する
+	/// @brief 記録を終了する
+	void PhysicsSystem::StopRecording()
+	{
+		this->recorder.End();
+	}
+
+	/** @brief 状態ハッシュを求める
+	 *  @return 状態ハッシュ
+	 */
+	uint64_t PhysicsSystem::ComputeStateHash() const
+	{
+		if (!this->physics) { return 0; }
+
+		JPH::BodyIDVector bodyIDs;
+		this->physics->GetBodies(bodyIDs);
+		std::sort(bodyIDs.begin(), bodyIDs.end());
+
+		// 浮動小数点はビット列のまま混ぜる（再生が決定的なら 1 ビットも変わらない）
+		uint64_t hash = JPH::HashBytes(nullptr, 0);
+		auto mix = [&hash](const auto& _value) { hash = JPH::HashBytes(&_value, sizeof(_value), hash); };
+
+		const auto& lockInterface = this->physics->GetBodyLockInterfaceNoLock();
+		for (const JPH::BodyID& id : bodyIDs)
+		{
+			JPH::BodyLockRead lock(lockInterface, id);
+			if (!lock.Succeeded()) { continue; }
+
+			const JPH::Body& body = lock.GetBody();
+			const JPH::RVec3 position = body.GetPosition();
+			const JPH::Quat rotation = body.GetRotation();
+			const JPH::Vec3 linear = body.GetLinearVelocity();
+			const JPH::Vec3 angular = body.GetAngularVelocity();
+			const JPH::Real px = position.GetX(), py = position.GetY(), pz = position.GetZ();
+
+			mix(id.GetIndexAndSequenceNumber());
+			mix(px); mix(py); mix(pz);
+			mix(rotation.GetX()); mix(rotation.GetY()); mix(rotation.GetZ()); mix(rotation.GetW());
+			mix(linear.GetX()); mix(linear.GetY()); mix(linear.GetZ());
+			mix(angular.GetX()); mix(angular.GetY()); mix(angular.GetZ());
+			mix(static_cast<uint8_t>(body.IsActive()));
+		}
+
+		for (const ContactPairKey key : this->contactTable.GetCurrentPairs())
+		{
+			mix(key);
+		}
+		return hash;
+	}
+
+	/** @brief Body の関連情報を解除する
 	 *  @param _bodyID 解除する BodyID
 	 */
-	void PhysicsSystem::UnregisterCollider3D(JPH::BodyID _bodyID)
+	void PhysicsSystem::UnregisterBody(JPH::BodyID _bodyID)
 	{
-		auto it = this->bodyColliderMap.find(_bodyID);
-		if (it == this->bodyColliderMap.end())
+		const BodyRecord* found = this->FindBodyRecord(_bodyID);
+		if (!found) { return; }
+
+		BodyRecord& record = this->bodyRecords[_bodyID.GetIndex()];
+#if !defined(FRAMEWORK_PHYSICS_HEADLESS)
+		if (record.collider)
 		{
-			return;
+			this->colliderIDMap.erase(record.collider->GetColliderID());
 		}
+#endif
+		record = BodyRecord{};
+
+		this->contactTable.RemoveBody(_bodyID);
+	}
+
+	/** @brief BodyID から関連情報を取得する
+	 *  @param _bodyID 取得する BodyID
+	 *  @return 関連情報（登録されていなければ nullptr）
+	 */
+	const BodyRecord* PhysicsSystem::FindBodyRecord(JPH::BodyID _bodyID) const
+	{
+		if (_bodyID.IsInvalid()) { return nullptr; }
+
+		const JPH::uint32 index = _bodyID.GetIndex();
+		if (index >= this->bodyRecords.size()) { return nullptr; }
+
+		// 同じインデックスが再利用されていても世代番号が違えば別の Body
+		const BodyRecord& record = this->bodyRecords[index];
+		return (record.bodyID == _bodyID) ? &record : nullptr;
+	}
+
+	/** @brief BodyID から Rigidbody3D を取得する
+	 *  @param _bodyID 取得する BodyID
+	 *  @return 対応する Rigidbody3D（存在しない場合は nullptr）
+	 */
+	Rigidbody3D* PhysicsSystem::GetRigidbody3D(JPH::BodyID _bodyID)
+	{
+		const BodyRecord* record = this->FindBodyRecord(_bodyID);
+		return record ? record->rigidbody : nullptr;
+	}
 
-		auto* collider = it->second;
-		if (collider)
+	int PhysicsSystem::AssignColliderID(Collider3DComponent* _collider)
+	{
+#if defined(FRAMEWORK_PHYSICS_HEADLESS)
+		// ヘッドレスではコンポーネントが無いので割り当てない
+		(void)_collider;
+		return -1;
+#else
+		if (!_collider) { return -1; }
+
+		int id = _collider->GetColliderID();
+		if (id < 0)
 		{
-			this->colliderIDMap.erase(collider->GetColliderID());
+			id = this->nextColliderID++;
+			_collider->SetColliderID(id);
 		}
 
-		this->bodyColliderMap.erase(it);
+		return id;
+#endif
 	}
 
 	/** @brief ColliderID から Collider3DComponent を取得する
@@ -445,12 +833,8 @@ namespace Framework::Physics
 	 */
 	Collider3DComponent* PhysicsSystem::GetCollider3D(JPH::BodyID _bodyID)
 	{
-		auto it = this->bodyColliderMap.find(_bodyID);
-		if (it != this->bodyColliderMap.end())
-		{
-			return it->second;
-		}
-		return nullptr;
+		const BodyRecord* record = this->FindBodyRecord(_bodyID);
+		return record ? record->collider : nullptr;
 	}
 
 	/// @brief Jolt ログ出力
@@ -498,6 +882,43 @@ namespace Framework::Physics
 		}
 	}
 
+	/** @brief 起きている Body が BroadPhase で重なっている Body ペア数を数える（Step 後に呼ぶ）
+	 *  @details Jolt は Update 中に BroadPhase が返したペアごとに Body ペアキャッシュを 1 つ使うが、
+	 *           その数は外から読めないので、同じ条件で BroadPhase をもう一度引いて数える。
+	 *           更新後の姿勢で引くため、実際に使われた数とはこのステップの移動分だけずれることがある
+	 *  @return Body ペア数
+	 */
+	uint32_t PhysicsSystem::CountBodyPairs()
+	{
+		/// @brief ペアを保持せずに数だけ数えるコレクタ
+		class CountingPairCollector final : public JPH::BodyPairCollector
+		{
+		public:
+			void AddHit(const JPH::BodyPair&) override { ++this->count; }
+			uint32_t count = 0;
+		};
+
+		const JPH::uint activeCount = this->physics->GetNumActiveBodies(JPH::EBodyType::RigidBody);
+		if (activeCount == 0) { return 0; }
+
+		// FindCollidingPairs は渡した配列をレイヤー順に並べ替えるので写しを渡す
+		const JPH::BodyID* active = this->physics->GetActiveBodiesUnsafe(JPH::EBodyType::RigidBody);
+		this->pairCountBodies.assign(active, active + activeCount);
+
+		// Update の外（ジョブが走っていない間）なら BroadPhase の木は差し替わらないので、そのまま引ける
+		const auto& broadPhase = static_cast<const JPH::BroadPhase&>(this->physics->GetBroadPhaseQuery());
+		CountingPairCollector collector;
+		broadPhase.FindCollidingPairs(
+			this->pairCountBodies.data(),
+			static_cast<int>(this->pairCountBodies.size()),
+			this->physics->GetPhysicsSettings().mSpeculativeContactDistance,
+			this->objectVsBroadPhaseFilter,
+			this->objectPairFilter,
+			collector
+		);
+		return collector.count;
+	}
+
 	/** @brief ShapeCast 用 BroadPhaseLayerFilter を取得
 	 *  @param _layer 自身の ObjectLayer
 	 */
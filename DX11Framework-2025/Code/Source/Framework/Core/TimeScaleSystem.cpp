@@ -18,10 +18,15 @@
 TimeScaleSystem::TimeScaleSystem() :
 	globalScale(1.0f),
 	layerScales{},
+	groupIds{},
+	groupNames{},
 	groupBaseScales{},
-	groupAppliedScales{},
+	groupScaleById{},
+	revision(0),
 	eventDefs{},
-	activeEvents{}
+	eventGroupIds{},
+	activeEvents{},
+	activeEventCount(0)
 {
 	for (auto& s : this->layerScales)
 	{
@@ -39,7 +44,7 @@ TimeScaleSystem::TimeScaleSystem() :
 		def.durationRawSec = 0.50f;
 		def.priority = 10;
 		def.stackPolicy = TimeScaleStackPolicy::Extend;
-		this->eventDefs[static_cast<size_t>(TimeScaleEventId::JustDodge)] = def;
+		this->SetEventDef(def);
 	}
 	{
 		TimeScaleEventDef def{};
@@ -49,7 +54,7 @@ TimeScaleSystem::TimeScaleSystem() :
 		def.durationRawSec = 0.06f;
 		def.priority = 100;
 		def.stackPolicy = TimeScaleStackPolicy::Extend;
-		this->eventDefs[static_cast<size_t>(TimeScaleEventId::HitStop)] = def;
+		this->SetEventDef(def);
 	}
 	{
 		TimeScaleEventDef def{};
@@ -59,11 +64,8 @@ TimeScaleSystem::TimeScaleSystem() :
 		def.durationRawSec = 0.50f;
 		def.priority = 100;
 		def.stackPolicy = TimeScaleStackPolicy::Extend;
-		this->eventDefs[static_cast<size_t>(TimeScaleEventId::TestDodge)] = def;
+		this->SetEventDef(def);
 	}
-
-	// 初期の適用値は基準値に一致させる（空なら何もしない）
-	this->RebuildAppliedGroupScales();
 }
 
 /** @brief 毎フレーム更新（イベント残り時間を rawDelta で減算）
@@ -73,27 +75,22 @@ void TimeScaleSystem::Update(float _rawDeltaSec)
 {
 	if (_rawDeltaSec <= 0.0f){ return; }
 
-	bool anyChanged = false;
-	for (auto it = this->activeEvents.begin(); it != this->activeEvents.end();)
+	size_t i = 0;
+	while (i < this->activeEventCount)
 	{
-		ActiveEvent& e = it->second;
+		ActiveEvent& e = this->activeEvents[i];
 		e.remainingRawSec -= _rawDeltaSec;
 
 		if (e.remainingRawSec <= 0.0f)
 		{
-			// イベント時間切れ
-			it = this->activeEvents.erase(it);
-			anyChanged = true;
+			// イベント時間切れ（そのグループだけ倍率を計算し直す）
+			const TimeScaleGroupId groupId = e.groupId;
+			this->RemoveActiveEvent(i);
+			this->RecomputeGroup(groupId);
 			continue;
 		}
 
-		++it;
-	}
-
-	if (anyChanged)
-	{
-		// イベントの適用値が変わったので、グループ倍率を再構築する
-		this->RebuildAppliedGroupScales();
+		++i;
 	}
 }
 
@@ -102,7 +99,10 @@ void TimeScaleSystem::Update(float _rawDeltaSec)
  */
 void TimeScaleSystem::SetGlobalScale(float _scale)
 {
+	if (this->globalScale == _scale) { return; }
+
 	this->globalScale = _scale;
+	++this->revision;
 }
 
 /// @brief グローバル TimeScale を取得する
@@ -118,7 +118,10 @@ float TimeScaleSystem::GlobalScale() const
 void TimeScaleSystem::SetLayerScale(TimeScaleLayer _layer, float _scale)
 {
 	const size_t index = static_cast<size_t>(_layer);
+	if (this->layerScales[index] == _scale) { return; }
+
 	this->layerScales[index] = _scale;
+	++this->revision;
 }
 
 /** @brief レイヤーの TimeScale を取得する
@@ -147,8 +150,9 @@ float TimeScaleSystem::CombinedScale(TimeScaleLayer _layer) const
  */
 void TimeScaleSystem::SetGroupBaseScale(const std::string& _groupName, float _scale)
 {
-	this->groupBaseScales[_groupName] = _scale;
-	this->RebuildAppliedGroupScales();
+	const TimeScaleGroupId groupId = this->RegisterGroup(_groupName);
+	this->groupBaseScales[groupId] = _scale;
+	this->RecomputeGroup(groupId);
 }
 
 /** @brief グループ倍率（最終適用値）を取得する
@@ -157,22 +161,47 @@ void TimeScaleSystem::SetGroupBaseScale(const std::string& _groupName, float _sc
  */
 float TimeScaleSystem::GetGroupScale(const std::string& _groupName) const
 {
-	// まず適用値を探す（イベントで上書きされている場合があるため）
-	auto it = this->groupAppliedScales.find(_groupName);
-	if (it != this->groupAppliedScales.end())
+	auto it = this->groupIds.find(_groupName);
+	if (it != this->groupIds.end())
 	{
-		return it->second;
+		return this->groupScaleById[it->second];
 	}
 
-	// 適用値が見つからない場合は基準値を探す
-	auto itBase = this->groupBaseScales.find(_groupName);
-	if (itBase != this->groupBaseScales.end())
+	// 未登録の場合は 1.0f を返す
+	return 1.0f;
+}
+
+/** @brief グループ名を整数 ID にインターンする
+ *  @param _groupName グループ名
+ *  @return グループ ID
+ */
+TimeScaleGroupId TimeScaleSystem::RegisterGroup(const std::string& _groupName)
+{
+	auto it = this->groupIds.find(_groupName);
+	if (it != this->groupIds.end())
 	{
-		return itBase->second;
+		return it->second;
 	}
 
-	// どちらも見つからない場合は 1.0f を返す
-	return 1.0f;
+	const TimeScaleGroupId id = static_cast<TimeScaleGroupId>(this->groupNames.size());
+	this->groupIds.emplace(_groupName, id);
+	this->groupNames.push_back(_groupName);
+	this->groupBaseScales.push_back(1.0f);
+	this->groupScaleById.push_back(1.0f);
+	return id;
+}
+
+/** @brief グループ倍率（最終適用値）を ID で取得する
+ *  @param _groupId グループ ID
+ *  @return 最終適用倍率（範囲外は 1.0f）
+ */
+float TimeScaleSystem::GetGroupScale(TimeScaleGroupId _groupId) const
+{
+	if (_groupId >= this->groupScaleById.size())
+	{
+		return 1.0f;
+	}
+	return this->groupScaleById[_groupId];
 }
 
 /** @brief TimeScale イベントをリクエストする（IDのみ）
@@ -184,43 +213,59 @@ void TimeScaleSystem::RequestEvent(TimeScaleEventId _eventId)
 	const TimeScaleEventDef* def = this->FindEventDef(_eventId);
 	if (def == nullptr){ return; }
 
-	EventKey key{};
-	key.id = def->id;
-	key.groupName = def->targetGroupName;
+	const TimeScaleGroupId groupId = this->eventGroupIds[static_cast<size_t>(_eventId)];
+
+	ActiveEvent active{};
+	active.id = def->id;
+	active.groupId = groupId;
+	active.scale = def->scale;
+	active.priority = def->priority;
+	active.remainingRawSec = def->durationRawSec;
 
 	//------------------------------------------
 	// すでに同一イベントが存在するか確認する
 	//------------------------------------------
-	auto it = this->activeEvents.find(key);
-	if (it != this->activeEvents.end())
+	for (size_t i = 0; i < this->activeEventCount; i++)
 	{
-		ActiveEvent& active = it->second;
+		const ActiveEvent& existing = this->activeEvents[i];
+		if (existing.id != active.id || existing.groupId != groupId) { continue; }
 
 		if (def->stackPolicy == TimeScaleStackPolicy::Extend)
 		{
 			// すでに同一イベントが存在する場合、残り時間を延長する
 			// （重ね掛けはしない）
-			active.remainingRawSec = std::max(active.remainingRawSec, 0.0f) + def->durationRawSec;
+			active.remainingRawSec = std::max(existing.remainingRawSec, 0.0f) + def->durationRawSec;
 		}
-		else
+
+		// 同じ優先度の中では後から来た方を勝たせるので、入れ直す
+		this->RemoveActiveEvent(i);
+		this->InsertActiveEvent(active);
+		this->RecomputeGroup(groupId);
+		return;
+	}
+
+	//------------------------------------------
+	// 上限に達していたら最も優先度の低いものを押し出す
+	//------------------------------------------
+	if (this->activeEventCount == this->activeEvents.size())
+	{
+		const ActiveEvent& lowest = this->activeEvents[this->activeEventCount - 1];
+		if (lowest.priority > active.priority)
 		{
-			// すでに同一イベントが存在する場合、残り時間を上書きする
-			active.remainingRawSec = def->durationRawSec;
+			std::cerr << "[TimeScaleSystem] 実行中イベントが上限 " << MaxActiveTimeScaleEvents << " 件に達したため破棄しました : " << static_cast<int>(_eventId) << std::endl;
+			return;
 		}
 
-		active.def = *def;
-		this->RebuildAppliedGroupScales();
-		return;
+		const TimeScaleGroupId evictedGroupId = lowest.groupId;
+		this->RemoveActiveEvent(this->activeEventCount - 1);
+		this->RecomputeGroup(evictedGroupId);
 	}
 
 	// 同一イベントが存在しない場合、新規に追加する
-	ActiveEvent active{};
-	active.def = *def;
-	active.remainingRawSec = def->durationRawSec;
-	this->activeEvents.emplace(key, active);
+	this->InsertActiveEvent(active);
 
 	// イベントを適用する
-	this->RebuildAppliedGroupScales();
+	this->RecomputeGroup(groupId);
 }
 
 /** @brief イベント定義を差し替える（必要な場合のみ使用）
@@ -235,6 +280,10 @@ void TimeScaleSystem::SetEventDef(const TimeScaleEventDef& _def)
 	}
 
 	this->eventDefs[index] = _def;
+
+	// 対象グループはここでインターンしておく（リクエストのたびに文字列を引かない）
+	// 空の名前も全コンポーネントの初期グループ "" として登録する
+	this->eventGroupIds[index] = this->RegisterGroup(_def.targetGroupName);
 }
 
 /** @brief イベント定義を取得する
@@ -260,59 +309,56 @@ const TimeScaleEventDef* TimeScaleSystem::FindEventDef(TimeScaleEventId _eventId
 	return &def;
 }
 
-void TimeScaleSystem::ApplyEventToGroup(const TimeScaleEventDef& _def)
+/** @brief 実行中イベントを優先度順の位置へ入れる
+ *  @param _event 追加するイベント
+ */
+void TimeScaleSystem::InsertActiveEvent(const ActiveEvent& _event)
 {
-	// RebuildAppliedGroupScales() で groupAppliedScales は基準値に戻してある前提
-	// ここではイベント値をそのまま上書きするだけ
-	this->groupAppliedScales[_def.targetGroupName] = _def.scale;
+	// 同じ優先度のものより前に置く（同一 group で priority が同じ場合は後勝ち）
+	size_t position = 0;
+	while (position < this->activeEventCount && this->activeEvents[position].priority > _event.priority)
+	{
+		++position;
+	}
+
+	for (size_t i = this->activeEventCount; i > position; i--)
+	{
+		this->activeEvents[i] = this->activeEvents[i - 1];
+	}
+	this->activeEvents[position] = _event;
+	++this->activeEventCount;
 }
 
-void TimeScaleSystem::RebuildAppliedGroupScales()
+/** @brief 実行中イベントを取り除く
+ *  @param _index 取り除く位置
+ */
+void TimeScaleSystem::RemoveActiveEvent(size_t _index)
 {
-	// まず基準値で埋める（登録済みグループのみ）
-	this->groupAppliedScales = this->groupBaseScales;
-
-	// activeEvents を group ごとに「優先度最大」を採用する
-	// 同一 group で priority が同じ場合は現状「後勝ち」
-	std::unordered_map<std::string, const TimeScaleEventDef*> bestByGroup;
-
-	//----------------------------------------------------------	
-	// 実行中の操作して、グループごとの最適なイベントを見つける
-	//----------------------------------------------------------
-	for (const auto& pair : this->activeEvents)
+	for (size_t i = _index + 1; i < this->activeEventCount; i++)
 	{
-		const ActiveEvent& activeEvent = pair.second;
-		const std::string& groupName = activeEvent.def.targetGroupName;
-
-		// この group のこれまでのイベントと比較する
-		auto itBest = bestByGroup.find(groupName);
-		if (itBest == bestByGroup.end())
-		{
-			bestByGroup[groupName] = &activeEvent.def;
-			continue;
-		}
-		
-		// 同一 group で優先度を比較する
-		const TimeScaleEventDef* currentBest = itBest->second;
-		if (activeEvent.def.priority > currentBest->priority)
-		{
-			bestByGroup[groupName] = &activeEvent.def;
-		}
-		else if (activeEvent.def.priority == currentBest->priority)
-		{
-			bestByGroup[groupName] = &activeEvent.def;
-		}
+		this->activeEvents[i - 1] = this->activeEvents[i];
 	}
-	
-	//---------------------------------------------------------
-	// グループごとの優先度最大イベントを適用する
-	//---------------------------------------------------------
-	for (const auto& pair : bestByGroup)
+	--this->activeEventCount;
+}
+
+/** @brief 1 グループだけ適用倍率を計算し直す
+ *  @param _groupId 対象グループ
+ */
+void TimeScaleSystem::RecomputeGroup(TimeScaleGroupId _groupId)
+{
+	// 優先度順に並んでいるので、最初に見つかったイベントがこのグループの勝者
+	float scale = this->groupBaseScales[_groupId];
+	for (size_t i = 0; i < this->activeEventCount; i++)
 	{
-		const TimeScaleEventDef* def = pair.second;
-		if (def != nullptr)
+		if (this->activeEvents[i].groupId == _groupId)
 		{
-			this->ApplyEventToGroup(*def);
+			scale = this->activeEvents[i].scale;
+			break;
 		}
 	}
-}
\ No newline at end of file
+
+	if (this->groupScaleById[_groupId] == scale) { return; }
+
+	this->groupScaleById[_groupId] = scale;
+	++this->revision;
+}
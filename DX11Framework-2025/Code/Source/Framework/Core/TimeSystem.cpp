@@ -8,6 +8,8 @@
 //-----------------------------------------------------------------------------
 #include "Include/Framework/Core/TimeSystem.h"
 
+#include <algorithm>
+
  //-----------------------------------------------------------------------------
  // TimeSystem class
  //-----------------------------------------------------------------------------
@@ -20,6 +22,8 @@ TimeSystem::TimeSystem(uint32_t _fixedFps)
 	, rawDeltaSec(0.0f)
 	, fixedDeltaSec(1.0f / static_cast<float>(_fixedFps))
 	, accumulator(0.0f)
+	, maxCatchUpSteps(DefaultMaxCatchUpSteps)
+	, droppedStepCount(0)
 {
 }
 
@@ -30,7 +34,26 @@ void TimeSystem::TickRawDelta()
 	auto delta = now - this->lastTime;
 	this->lastTime = now;
 
-	this->rawDeltaSec = std::chrono::duration<float>(delta).count();
+	this->AdvanceRawDelta(std::chrono::duration<float>(delta).count());
+}
+
+/** @brief 与えた経過時間でフレームを進める
+ *  @param float _rawDeltaSec 経過時間（秒）
+ */
+void TimeSystem::TickRawDelta(float _rawDeltaSec)
+{
+	// 実時間に戻したときに、与えた分を二重に数えないようにする
+	this->lastTime = std::chrono::steady_clock::now();
+
+	this->AdvanceRawDelta(_rawDeltaSec);
+}
+
+/** @brief rawDeltaTime を設定し、固定ステップ用に累積する
+ *  @param float _rawDeltaSec 経過時間（秒）
+ */
+void TimeSystem::AdvanceRawDelta(float _rawDeltaSec)
+{
+	this->rawDeltaSec = _rawDeltaSec;
 
 	if (this->rawDeltaSec < 0.000001f) 
 	{
@@ -41,10 +64,11 @@ void TimeSystem::TickRawDelta()
 	// Fixed用に累積する
 	this->accumulator += this->rawDeltaSec;
 
-	// 暴走防止（最大5ステップまで）
-	float maxAcc = this->fixedDeltaSec * 5.0f;
+	// 暴走防止（上限を超えた分は捨てて数える）
+	float maxAcc = this->fixedDeltaSec * static_cast<float>(this->maxCatchUpSteps);
 	if (this->accumulator > maxAcc)
 	{
+		this->droppedStepCount += static_cast<uint64_t>((this->accumulator - maxAcc) / this->fixedDeltaSec);
 		this->accumulator = maxAcc;
 	}
 }
@@ -61,6 +85,21 @@ float TimeSystem::FixedDelta() const
 	return this->fixedDeltaSec;
 }
 
+/// @brief 固定ステップ間の補間係数（0～1）
+float TimeSystem::FixedAlpha() const
+{
+	return std::clamp(this->accumulator / this->fixedDeltaSec, 0.0f, 1.0f);
+}
+
+/// @brief 固定ステップ用FPSを変更する
+void TimeSystem::SetFixedFps(uint32_t _fixedFps)
+{
+	if (_fixedFps == 0) { return; }
+
+	this->fixedDeltaSec = 1.0f / static_cast<float>(_fixedFps);
+	this->accumulator = 0.0f;
+}
+
 /// @brief FixedUpdate が必要か判断する
 bool TimeSystem::ShouldRunFixedStep() const
 {
@@ -77,4 +116,10 @@ void TimeSystem::ConsumeFixedStep()
 void TimeSystem::Reset()
 {
 	this->accumulator = 0.0f;
+}
+
+/// @brief 1 フレームで追いつく固定ステップ数の上限を設定する
+void TimeSystem::SetMaxCatchUpSteps(uint32_t _steps)
+{
+	this->maxCatchUpSteps = std::max<uint32_t>(_steps, 1);
 }
\ No newline at end of file
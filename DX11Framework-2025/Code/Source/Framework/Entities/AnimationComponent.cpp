@@ -11,6 +11,7 @@
 
 #include "Include/Framework/Core/D3D11System.h"
 #include "Include/Framework/Core/SystemLocator.h"
+#include "Include/Framework/Core/FPS.h"
 #include "Include/Framework/Utils/CommonTypes.h"
 
 #include "Include/Framework/Graphics/IAnimator.h"
@@ -134,12 +135,25 @@ void AnimationComponent::Update(float _deltaTime)
 	//	OutputDebugStringA(buf);
 	//}
 
+	//-----------------------------------------------------------------------------
+	// 負荷が高い間は 1 フレームおきに更新する（飛ばした分の時間は次の更新でまとめて進める）
+	//-----------------------------------------------------------------------------
+	float deltaTime = _deltaTime + this->skippedDeltaTime;
+	if (SystemLocator::Get<FPS>().ShouldShedOptionalWork() && !this->skipNextUpdate)
+	{
+		this->skipNextUpdate = true;
+		this->skippedDeltaTime = deltaTime;
+		return;
+	}
+	this->skipNextUpdate = false;
+	this->skippedDeltaTime = 0.0f;
+
 	//-----------------------------------------------------------------------------
 	// LocalPose -> Pose（global/skin/cpuBoneMatrices）更新
 	//-----------------------------------------------------------------------------
 	if (this->animator)
 	{
-		this->animator->Update(_deltaTime);
+		this->animator->Update(deltaTime);
 
 		{
 			char buf[256];
@@ -98,6 +98,14 @@ const DX::Matrix4x4& Camera3D::GetProjectionMatrix() const
     return this->projectionMatrix;
 }
 
+/** @brief 距離 1 の位置で 1 単位が画面上で何ピクセルになるかを取得
+ *  @return 画面高さ / (2 * tan(fovY / 2))
+ */
+float Camera3D::GetProjectionScale() const
+{
+    return this->screenSize.y / (2.0f * std::tan(this->fovY * 0.5f));
+}
+
 /** @brief 透視投影パラメータの設定
  *  @param float _fovY   視野角（ラジアン）
  *  @param float _aspect アスペクト比
@@ -8,14 +8,18 @@
  //-----------------------------------------------------------------------------
 #include "Include/Framework/Entities/Collider3DComponent.h"
 #include "Include/Framework/Entities/GameObject.h"
+#include "Include/Framework/Core/ResourceHub.h"
+#include "Include/Framework/Graphics/ModelManager.h"
 
 // Jolt Physics Shape includes
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
 #include <Jolt/Physics/Collision/Shape/SphereShape.h>
 #include <Jolt/Physics/Collision/Shape/CapsuleShape.h>
+#include <Jolt/Physics/Collision/Shape/ScaledShape.h>
 
 #include <algorithm>
 #include <cmath>
+#include <iostream>
 
 namespace Framework::Physics
 {
@@ -36,6 +40,9 @@ namespace Framework::Physics
 		, colliderID(-1)
 		, isTrigger(false)
 		, shapeSettings(nullptr)
+		, meshModelKey()
+		, meshOptions()
+		, cookedMesh(nullptr)
 	{}
 
 	void Collider3DComponent::Initialize()
@@ -52,6 +59,7 @@ namespace Framework::Physics
 	{
 		this->shape = nullptr;
 		this->transform = nullptr;
+		this->cookedMesh = nullptr;
 	}
 
 	void Collider3DComponent::SetShape(ColliderShapeType _shapeType)
@@ -75,6 +83,13 @@ namespace Framework::Physics
 		this->capsuleHalfHeight = _halfHeight;
 	}
 
+	void Collider3DComponent::SetMeshModel(const std::string& _modelKey, const ColliderCooker::CookOptions& _options)
+	{
+		this->meshModelKey = _modelKey;
+		this->meshOptions = _options;
+		this->cookedMesh = nullptr;
+	}
+
 	void Collider3DComponent::SetCenterOffset(const DX::Vector3& _offset)
 	{
 		this->centerOffset = _offset;
@@ -129,8 +144,37 @@ namespace Framework::Physics
 		}
 
 		case ColliderShapeType::Mesh:
+		{
+			// 変換済みの形状を直接使うので ShapeSettings は作らない（CreateShape は何もしない）
 			this->shapeSettings = nullptr;
+			this->shape = nullptr;
+
+			if (!this->cookedMesh)
+			{
+				auto& modelManager = ResourceHub::Get<ModelManager>();
+				Graphics::ModelEntry* entry = modelManager.Get(this->meshModelKey);
+				if (!entry) { entry = modelManager.Register(this->meshModelKey); }
+
+				if (!entry || !entry->GetModelData())
+				{
+					std::cerr << "[Collider3DComponent] メッシュコライダーのモデルが見つかりません : " << this->meshModelKey << std::endl;
+					break;
+				}
+				this->cookedMesh = ColliderCooker::Acquire(this->meshModelKey, *entry->GetModelData(), this->meshOptions);
+			}
+			if (!this->cookedMesh) { break; }
+
+			// 共有している形状は書き換えず、スケールは外側に被せる
+			if ((scale - DX::Vector3::One).LengthSquared() > 1.0e-8f)
+			{
+				this->shape = new JPH::ScaledShape(this->cookedMesh->shape, JPH::Vec3(scale.x, scale.y, scale.z));
+			}
+			else
+			{
+				this->shape = this->cookedMesh->shape;
+			}
 			break;
+		}
 
 		default:
 			this->shapeSettings = nullptr;
@@ -13,6 +13,7 @@
 #include "Include/Framework/Core/D3D11System.h"
 #include "Include/Framework/Core/RenderSystem.h"
 #include "Include/Framework/Core/SystemLocator.h"
+#include "Include/Framework/Core/FPS.h"
 #include "Include/Framework/Core/ResourceHub.h"
 #include "Include/Framework/Shaders/ShaderManager.h"
 
@@ -173,6 +174,9 @@ void ColliderDebugRenderer::Draw()
     if (!this->collider || !this->transform || !this->camera) { return; }
     if (!this->vertexBuffer || this->linePoints.empty()) { return; }
 
+    // 負荷が高い間はデバッグ描画を省く
+    if (SystemLocator::Get<FPS>().ShouldShedOptionalWork()) { return; }
+
     auto& d3d = SystemLocator::Get<D3D11System>();
     auto context = d3d.GetContext();
     auto& render = SystemLocator::Get<RenderSystem>();
@@ -55,6 +55,7 @@ void GameObject::Dispose()
     }
 	this->transform = nullptr;
     this->components.clear();
+    ++this->componentVersion;
     this->children.clear();
     this->name.clear();
 }
@@ -98,6 +99,15 @@ void GameObject::SetParent(GameObject* _parent)
     {
         _parent->AddChildObject(this);
     }
+
+    // 親子関係の変更通知（時間スケール表の並び替え用）
+    GameObjectEventContext eventContext =
+    {
+        this->name,
+        nullptr,
+        GameObjectEvent::ParentChanged
+    };
+    this->NotifyEvent(eventContext);
 }
 
 /** @brief  子オブジェクトの追加
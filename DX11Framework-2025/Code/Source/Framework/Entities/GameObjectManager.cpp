@@ -8,6 +8,9 @@
 #include "Include/Framework/Entities/GameObjectManager.h"
 #include "Include/Framework/Entities/Transform.h"
 #include "Include/Framework/Entities/TimeScaleComponent.h"
+#include "Include/Framework/Core/SystemLocator.h"
+#include "Include/Framework/Core/PhysicsSystem.h"
+#include "Include/Framework/Utils/Profiler.h"
 
 #include <algorithm>
 #include<iostream>
@@ -21,9 +24,11 @@
  */
 GameObjectManager::GameObjectManager(const EngineServices* _services) :
 	gameObjects(), services(_services),
+	timeScaleTable(SystemLocator::Get<TimeScaleSystem>()),
 	pendingInits(), updates(), fixedUpdates(), destroyQueue(),
 	renderes(), rigidbodies(), transforms(), 
-	nameMap(),tagMap()
+	nameMap(),tagMap(),
+	kinematicCharacterSystem(std::make_unique<Framework::Physics::KinematicCharacterSystem>(SystemLocator::Get<Framework::Physics::PhysicsSystem>()))
 {}
 
 /// @brief デストラクタ
@@ -59,6 +64,7 @@ void GameObjectManager::Dispose()
 	this->renderes.clear();
 	this->rigidbodies.clear();
 	this->transforms.clear();
+	this->timeScaleTable.Clear();
 
 	// マップの解放
 	this->nameMap.clear();
@@ -84,6 +90,12 @@ void GameObjectManager::FlushInitialize()
  */
 void GameObjectManager::UpdateAll(float _deltaTime)
 {
+	// 時間スケールの変化をまとめて反映する
+	this->timeScaleTable.Refresh();
+
+	// 記録中だけコンポーネントの型ごとに時間を集計する
+	Framework::Profiler::TypeAggregateZone zone("UpdateAll");
+
 	for (auto& update : this->updates)
 	{
 		if (update)
@@ -93,6 +105,14 @@ void GameObjectManager::UpdateAll(float _deltaTime)
 			auto obj = comp->Owner();
 			float scaledDelta = obj->TimeScale()->ApplyTimeScale(_deltaTime);
 
+			if (zone.IsActive())
+			{
+				const auto begin = Framework::Profiler::Clock::now();
+				update->Update(scaledDelta);
+				zone.Add(typeid(*comp), begin, Framework::Profiler::Clock::now());
+				continue;
+			}
+
 			update->Update(scaledDelta);
 		}
 	}
@@ -103,15 +123,29 @@ void GameObjectManager::UpdateAll(float _deltaTime)
  */
 void GameObjectManager::FixedUpdateAll(float _deltaTime)
 {
+	// 固定ステップの頭でグループごとに今回更新するかを決める（BeginPhysics もこの結果を使う）
+	this->timeScaleTable.AdvanceFixedStep();
+
+	Framework::Profiler::TypeAggregateZone zone("FixedUpdateAll");
+
 	// 固定更新を持つコンポーネントを更新
 	for (auto& fixedUpdate : this->fixedUpdates)
 	{
 		if (fixedUpdate)
 		{
-			// 時間スケールを考慮して更新する
+			// 時間スケールを考慮して更新する（遅い・止まっているグループは間引く）
 			auto comp = dynamic_cast<Component*>(fixedUpdate);
 			auto obj = comp->Owner();
-			float scaledDelta = obj->TimeScale()->ApplyTimeScale(_deltaTime);
+			float scaledDelta = 0.0f;
+			if (!obj->TimeScale()->TryGetFixedStepDelta(_deltaTime, scaledDelta)) { continue; }
+
+			if (zone.IsActive())
+			{
+				const auto begin = Framework::Profiler::Clock::now();
+				fixedUpdate->FixedUpdate(scaledDelta);
+				zone.Add(typeid(*comp), begin, Framework::Profiler::Clock::now());
+				continue;
+			}
 
 			fixedUpdate->FixedUpdate(scaledDelta);
 		}
@@ -132,14 +166,8 @@ void GameObjectManager::UpdateAllTransforms()
 
 void GameObjectManager::BeginPhysics(float _deltaTime)
 {
-	for (auto& rigidbody : this->rigidbodies)
-	{
-		if (rigidbody)
-		{
-			// 自前移動の更新を行う
-			rigidbody->StepPhysics(_deltaTime);
-		}
-	}
+	// 自前移動と押し戻しを全 Rigidbody でまとめて解決する
+	this->kinematicCharacterSystem->Step(this->rigidbodies, _deltaTime);
 
 	// 全 Transform のワールド行列を更新する
 	this->UpdateAllTransforms();
@@ -166,12 +194,36 @@ void GameObjectManager::EndPhysics(float _deltaTime)
 	}
 }
 
+void GameObjectManager::InterpolatePhysics(float _alpha)
+{
+	for (auto& rigidbody : this->rigidbodies)
+	{
+		if (rigidbody)
+		{
+			// 描画レートに合わせて直前 2 ステップの間を補間する（間引かれたグループは進み具合で補間する）
+			rigidbody->InterpolateVisual(rigidbody->Owner()->TimeScale()->GetFixedStepAlpha(_alpha));
+		}
+	}
+}
+
 /// @brief 一括描画
 void GameObjectManager::RenderAll()
 {
+	Framework::Profiler::TypeAggregateZone zone("RenderAll");
+
 	for (auto& render : this->renderes)
 	{
-		if (render){ render->Draw(); }
+		if (!render) { continue; }
+
+		if (zone.IsActive())
+		{
+			const auto begin = Framework::Profiler::Clock::now();
+			render->Draw();
+			zone.Add(typeid(*render), begin, Framework::Profiler::Clock::now());
+			continue;
+		}
+
+		render->Draw();
 	}
 }
 
@@ -204,6 +256,97 @@ GameObject* GameObjectManager::Instantiate(const std::string& _name, const GameT
 	return rawPtr;
 }
 
+/**	@brief	ゲームオブジェクトをまとめて生成する
+ *	@param	std::span<const BulkObjectDesc> _descs						生成するオブジェクト
+ *	@param	const std::function<bool(size_t, GameObject&)>& _setup		コンポーネントを付ける処理
+ *	@param	std::vector<GameObject*>& _outObjects						生成したオブジェクト
+ *	@return bool														全て生成できれば true
+ */
+bool GameObjectManager::InstantiateBulk(std::span<const BulkObjectDesc> _descs, const std::function<bool(size_t, GameObject&)>& _setup, std::vector<GameObject*>& _outObjects)
+{
+	_outObjects.clear();
+	_outObjects.reserve(_descs.size());
+
+	//-----------------------------------------------------------
+	// 生成（まだ管理リストに入れないので、通知は誰にも届かない）
+	//-----------------------------------------------------------
+	std::vector<std::unique_ptr<GameObject>> created;
+	created.reserve(_descs.size());
+
+	bool succeeded = true;
+	bool hasParent = false;
+	size_t componentCount = 0;
+	for (size_t i = 0; i < _descs.size() && succeeded; i++)
+	{
+		const BulkObjectDesc& desc = _descs[i];
+
+		auto newObject = std::make_unique<GameObject>(*this, std::string(desc.name), desc.tag, desc.isActive);
+		GameObject* rawPtr = newObject.get();
+		rawPtr->SetServices(this->services);
+		created.push_back(std::move(newObject));
+
+		// 必須コンポーネントを追加
+		rawPtr->transform = static_cast<Transform*>(rawPtr->AttachComponentSilently(std::make_unique<Transform>(rawPtr)));
+		rawPtr->AttachComponentSilently(std::make_unique<TimeScaleComponent>(rawPtr));
+
+		// 親は先に生成済みであること
+		if (desc.parentIndex != NoParent)
+		{
+			if (desc.parentIndex >= i)
+			{
+				std::cerr << "[GameObjectManager] InstantiateBulk: 親が子より後に並んでいます : " << desc.name << std::endl;
+				succeeded = false;
+				break;
+			}
+			created[desc.parentIndex]->AddChildObject(rawPtr);
+			hasParent = true;
+		}
+
+		succeeded = _setup(i, *rawPtr);
+		componentCount += rawPtr->GetComponents().size();
+	}
+
+	// 失敗したら 1 つも登録せずに捨てる
+	if (!succeeded)
+	{
+		for (auto& object : created) { object->Dispose(); }
+		return false;
+	}
+
+	//-----------------------------------------------------------
+	// 登録（1 回でまとめて行う）
+	//-----------------------------------------------------------
+	this->nameMap.reserve(this->nameMap.size() + created.size());
+	this->transforms.reserve(this->transforms.size() + created.size());
+	this->updates.reserve(this->updates.size() + componentCount);
+	this->renderes.reserve(this->renderes.size() + componentCount);
+
+	for (auto& object : created)
+	{
+		GameObject* rawPtr = object.get();
+		this->nameMap[rawPtr->GetName()] = rawPtr;
+		this->tagMap[rawPtr->GetTag()].push_back(rawPtr);
+
+		for (auto& compUPtr : rawPtr->GetComponents())
+		{
+			Component* comp = compUPtr.get();
+			this->RegisterComponentToPhases(comp, false);
+			this->pendingInits.push_back(comp);
+
+			if (auto timeScale = dynamic_cast<TimeScaleComponent*>(comp))
+			{
+				this->timeScaleTable.Add(timeScale);
+			}
+		}
+
+		_outObjects.push_back(rawPtr);
+		this->gameObjects.push_back(std::move(object));
+	}
+
+	if (hasParent) { this->timeScaleTable.MarkStructureDirty(); }
+	return true;
+}
+
 /** @brief ゲームオブジェクトを名前検索で取得する
  *  @param const std::string& _name オブジェクトの名前
  *  @return GameObject* ゲームオブジェクト なければnullptr
@@ -218,11 +361,15 @@ GameObject* GameObjectManager::GetFindObjectByName(const std::string& _name)
 
 /** @brief ゲームオブジェクトをタグ検索で取得する
  *  @param const GameTags::Tag& _tag = GameTags::Tag::None オブジェクトのタグ名
- *  @return std::vector<GameObject*> 当てはまるゲームオブジェクトのリスト
+ *  @return std::span<GameObject* const> 当てはまるゲームオブジェクトのリスト（生成・破棄があるまで有効）
  */
-std::vector<GameObject*> GameObjectManager::GetFindObjectsWithTag(const GameTags::Tag& _tag)
+std::span<GameObject* const> GameObjectManager::GetFindObjectsWithTag(const GameTags::Tag& _tag) const
 {
-	return this->tagMap[_tag];
+	// 見つからなくてもマップに空の要素を作らない
+	auto it = this->tagMap.find(_tag);
+	if (it == this->tagMap.end()) { return {}; }
+
+	return it->second;
 }
 
 /**	@brief 登録されたゲームオブジェクトを一括削除する
@@ -300,11 +447,28 @@ void GameObjectManager::OnGameObjectEvent(const GameObjectEventContext _ctx)
 
 		// 初期化待ちキューに登録
 		this->pendingInits.push_back(_ctx.component);
+
+		// 時間スケール表に登録
+		if (auto timeScale = dynamic_cast<TimeScaleComponent*>(_ctx.component))
+		{
+			this->timeScaleTable.Add(timeScale);
+		}
 		break;
 
 		// コンポーネント削除
 	case GameObjectEvent::ComponentRemoved:
 		UnregisterComponentFromPhases(_ctx.component);
+
+		// 破棄される前に時間スケール表から外す
+		if (auto timeScale = dynamic_cast<TimeScaleComponent*>(_ctx.component))
+		{
+			this->timeScaleTable.Remove(timeScale);
+		}
+		break;
+
+		// 親子関係の変更
+	case GameObjectEvent::ParentChanged:
+		this->timeScaleTable.MarkStructureDirty();
 		break;
 
 	case GameObjectEvent::Destroyed:
@@ -332,38 +496,45 @@ void GameObjectManager::OnGameObjectEvent(const GameObjectEventContext _ctx)
 // GameObjectManager - Component Phase Registration Helper
 //-----------------------------------------------------------------------------
 
-void GameObjectManager::RegisterComponentToPhases(Component* _component)
+void GameObjectManager::RegisterComponentToPhases(Component* _component, bool _checkDuplicate)
 {
 	if (!_component){ return; }
 
+	// 生成したばかりのコンポーネントは重複し得ないので探さずに積む
+	auto push = [this, _checkDuplicate](auto& _v, auto* _p)
+		{
+			if (_checkDuplicate) { PushUnique(_v, _p); }
+			else { _v.push_back(_p); }
+		};
+
 	// Update フェーズ
 	if (auto u = dynamic_cast<IUpdatable*>(_component))
 	{
-		PushUnique(this->updates, u);
+		push(this->updates, u);
 	}
 
 	// FixedUpdate フェーズ
 	if (auto f = dynamic_cast<IFixedUpdatable*>(_component))
 	{
-		PushUnique(this->fixedUpdates, f);
+		push(this->fixedUpdates, f);
 	}
 
 	// 描画
 	if (auto dUI = dynamic_cast<IDrawable*>(_component))
 	{
-		PushUnique(this->renderes, dUI);
+		push(this->renderes, dUI);
 	}
 
 	// Rigidbody3D
 	if (auto rb3D = dynamic_cast<Framework::Physics::Rigidbody3D*>(_component))
 	{
-		PushUnique(this->rigidbodies, rb3D);
+		push(this->rigidbodies, rb3D);
 	}
 
 	// Transform
 	if (auto tf = dynamic_cast<Transform*>(_component))
 	{
-		PushUnique(this->transforms, tf);
+		push(this->transforms, tf);
 	}
 }
 
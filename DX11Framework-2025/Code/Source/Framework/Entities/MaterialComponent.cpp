@@ -107,6 +107,16 @@ Material* MaterialComponent::GetMaterial() const
     return this->baseMaterial;
 }
 
+TextureResource* MaterialComponent::GetTexture() const
+{
+    return this->overrideTexture;
+}
+
+const MaterialParams& MaterialComponent::GetParams() const
+{
+    return this->param;
+}
+
 /** @brief マテリアルを適用する
  *  @param ID3D11DeviceContext* _context
  *  @param RenderSystem* _renderSystem
@@ -105,8 +105,9 @@ void MeshRenderer::Draw()
 	// マテリアルを適用する
 	this->materialComponent->Apply(ctx, &render);
 
-    // --- Subsetをループ描画（今は単一マテリアルを使い回す） ---
-    for (const auto& subset : mesh->GetSubsets())
+    // --- 画面上の誤差から LOD を選び、Subsetをループ描画（今は単一マテリアルを使い回す） ---
+    const size_t lod = mesh->SelectLod(world, view, this->camera->GetProjectionScale());
+    for (const auto& subset : mesh->GetSubsets(lod))
     {
         ctx->DrawIndexed(subset.indexCount, subset.indexStart, 0);
     }
@@ -15,14 +15,9 @@
 #include "Include/Framework/Core/SystemLocator.h"
 #include "Include/Framework/Core/PhysicsSystem.h"
 
-#include <Jolt/Physics/Collision/NarrowPhaseQuery.h>
-#include <Jolt/Physics/Collision/ShapeCast.h>
-#include <Jolt/Physics/Collision/CastResult.h>
-#include <Jolt/Physics/Collision/Shape/Shape.h>
-#include <Jolt/Physics/Collision/RayCast.h>
+#include "Include/Framework/Physics/KinematicCharacterSystem.h"
 
-#include <Jolt/Physics/Collision/CollideShape.h>
-#include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
 #include <algorithm>
 #include <cmath>
 #include <cfloat>
@@ -32,33 +27,6 @@ namespace Framework::Physics
 {
 	using namespace JPH;
 
-	//-----------------------------------------------------------------------------
-	// 自身のトリガーを無視する ShapeFilter
-	//-----------------------------------------------------------------------------
-	class SelfTriggerShapeFilter final : public JPH::ShapeFilter
-	{
-	public:
-		SelfTriggerShapeFilter(PhysicsSystem& _phys, JPH::BodyID _id)
-			: mPhys(&_phys), mBody(_id) {}
-
-		bool ShouldCollide(const JPH::Shape* /*_shape*/, const JPH::SubShapeID& _subShapeID) const override
-		{
-			(void)_subShapeID;
-			auto* collider = mPhys->GetCollider3D(mBody);
-			return !(collider && collider->IsTrigger());
-		}
-
-	private:
-		PhysicsSystem* mPhys;
-		JPH::BodyID mBody;
-	};
-
-	//-----------------------------------------------------------------------------
-	// 定数
-	//-----------------------------------------------------------------------------
-	static constexpr float parallelEps = 1.0e-4f;	///< 法線と移動方向がほぼ平行かどうかの判定用（今は未使用）
-	static constexpr float skinWidth = 1.0e-3f;		///< 壁から少しだけ離すためのスキン幅
-
 	//-----------------------------------------------------------------------------
 	// Constructor / Destructor
 	//-----------------------------------------------------------------------------
@@ -70,6 +38,9 @@ namespace Framework::Physics
 		, objectLayer(PhysicsLayer::Kinematic)
 		, staged(nullptr)
 		, stagedPrev(nullptr)
+		, interpolationFrom()
+		, interpolationTo()
+		, useInterpolation(true)
 		, visualTransform(nullptr)
 		, physicsSystem(SystemLocator::Get<PhysicsSystem>())
 		, colliders()
@@ -77,6 +48,9 @@ namespace Framework::Physics
 		, gravity(0.0f, -9.8f, 0.0f)
 		, useGravity(false)
 		, isGrounded(false)
+		, contactListeners()
+		, contactListenerVersion(0)
+		, hasContactListeners(false)
 	{
 	}
 
@@ -111,6 +85,7 @@ namespace Framework::Physics
 		}
 
 		*(this->stagedPrev) = *(this->staged);
+		this->ResetInterpolation();
 
 		this->InitializeBody();
 	}
@@ -125,19 +100,88 @@ namespace Framework::Physics
 	//-----------------------------------------------------------------------------
 	void Rigidbody3D::StepPhysics(float _deltaTime)
 	{
-		// 物理更新は時間スケールを適用させ、自前の押し戻し結果を visualTransform に反映させる
-		float scaledDelta = this->Owner()->TimeScale()->ApplyTimeScale(_deltaTime);
+		// 単体でも KinematicCharacterSystem と同じ手順（収集 → 解決 → 反映）で処理する
+		KinematicCharacterQuery query;
+		std::vector<KinematicBodyQuery> bodyQueries;
+
+		if (!this->BuildKinematicQuery(_deltaTime, query, bodyQueries)) { return; }
+		KinematicCharacterSystem::SolveCharacter(this->physicsSystem, query, bodyQueries.data());
+
+		KinematicCharacterSystem::ResolveGroundProbes(this->physicsSystem, &query, 1);
+		this->ApplyKinematicResult(query);
+	}
+
+	//-----------------------------------------------------------------------------
+	// 押し戻し用クエリの作成（自前移動もここで行う）
+	//-----------------------------------------------------------------------------
+	bool Rigidbody3D::BuildKinematicQuery(float _deltaTime, KinematicCharacterQuery& _outQuery, std::vector<KinematicBodyQuery>& _outBodies)
+	{
+		// 物理更新は時間スケールを適用させる（CastShape の移動量には未適用の経過時間を使う）
+		// 遅い・止まっているグループはこのステップを飛ばす（押し戻しも補間の更新も行わない）
+		float scaledDelta = 0.0f;
+		if (!this->Owner()->TimeScale()->TryGetFixedStepDelta(_deltaTime, scaledDelta)) { return false; }
 		this->UpdateLogical(scaledDelta);
 
-		for (size_t i = 0; i < Rigidbody3D::SolveIterations; i++)
+		_outQuery = KinematicCharacterQuery{};
+		_outQuery.rigidbody = this;
+		_outQuery.objectLayer = this->objectLayer;
+		_outQuery.castDeltaTime = _deltaTime;
+		_outQuery.velocity = this->linearVelocity;
+		_outQuery.isGrounded = this->isGrounded;
+		_outQuery.firstBody = static_cast<uint32_t>(_outBodies.size());
+
+		if (!this->staged || !this->stagedPrev) { return true; }
+
+		const DX::Quaternion rot = this->staged->rotation;
+		_outQuery.rotation = rot;
+		_outQuery.position = this->staged->position;
+		_outQuery.prevPosition = this->stagedPrev->position;
+
+		if (!this->hasBody || this->bodies.empty()) { return true; }
+
+		_outQuery.resolveContacts = true;
+		_outQuery.hasGroundProbe = this->ComputeGroundProbeOffset(rot, _outQuery.groundProbeOffset);
+
+		// 形状はここで確定させる（解決中は Body のロックを取らない）
+		const auto& lockInterface = this->physicsSystem.GetBodyLockInterfaceNoLock();
+		for (const auto& body : this->bodies)
 		{
-			// 貫通解決を行う（既に接地している場合完全に押し戻す）
-			// 現状は順番依存で解決される
-			this->ResolvePenetration();
+			if (!body.collider) { continue; }
+
+			// 自分側がトリガーなら押し戻しをしない
+			auto* selfCol = this->physicsSystem.GetCollider3D(body.id);
+			if (selfCol && selfCol->IsTrigger()) { continue; }
+
+			BodyLockRead lock(lockInterface, body.id);
+			if (!lock.Succeeded()) { continue; }
+
+			const Shape* shape = lock.GetBody().GetShape();
+			if (!shape) { continue; }
+
+			KinematicBodyQuery& entry = _outBodies.emplace_back();
+			entry.id = body.id;
+			entry.shape = shape;
+			entry.offset = this->ComputeColliderOffset(body.collider, rot);
 		}
 
-		// 衝突解決（CastShape 押し戻し）
-		this->ResolveCastShape(_deltaTime);
+		_outQuery.bodyCount = static_cast<uint32_t>(_outBodies.size()) - _outQuery.firstBody;
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	// 押し戻し結果の反映
+	//-----------------------------------------------------------------------------
+	void Rigidbody3D::ApplyKinematicResult(const KinematicCharacterQuery& _query)
+	{
+		if (!this->staged) { return; }
+
+		this->staged->position = _query.position;
+		this->linearVelocity = _query.velocity;
+		this->isGrounded = _query.isGrounded;
+
+		// 補間用に直前 2 ステップ分の結果を残す
+		this->interpolationFrom = this->interpolationTo;
+		this->interpolationTo = *(this->staged);
 
 		// visual に反映させる
 		this->SyncToVisual();
@@ -180,6 +224,35 @@ namespace Framework::Physics
 		this->visualTransform->SetWorldScale(this->staged->scale);
 	}
 
+	//-----------------------------------------------------------------------------
+	// 固定ステップ間の補間 → visual
+	//-----------------------------------------------------------------------------
+	void Rigidbody3D::InterpolateVisual(float _alpha) const
+	{
+		if (!this->visualTransform || !this->staged) { return; }
+
+		if (!this->useInterpolation)
+		{
+			this->SyncToVisual();
+			return;
+		}
+
+		const StagedTransform& from = this->interpolationFrom;
+		const StagedTransform& to = this->interpolationTo;
+
+		this->visualTransform->SetWorldPosition(DX::Vector3::Lerp(from.position, to.position, _alpha));
+		this->visualTransform->SetWorldRotation(DX::Quaternion::Slerp(from.rotation, to.rotation, _alpha));
+		this->visualTransform->SetWorldScale(DX::Vector3::Lerp(from.scale, to.scale, _alpha));
+	}
+
+	void Rigidbody3D::ResetInterpolation()
+	{
+		if (!this->staged) { return; }
+
+		this->interpolationFrom = *(this->staged);
+		this->interpolationTo = *(this->staged);
+	}
+
 	//-----------------------------------------------------------------------------
 	// visual → Jolt（Kinematic のみ）
 	//-----------------------------------------------------------------------------
@@ -192,8 +265,6 @@ namespace Framework::Physics
 		const DX::Vector3 pivot = this->staged->position;
 		const DX::Quaternion rot = this->staged->rotation;
 
-		auto& bodyInterface = this->physicsSystem.GetBodyInterface();
-
 		for (const auto& body : this->bodies)
 		{
 			if (!body.collider) { continue; }
@@ -201,7 +272,7 @@ namespace Framework::Physics
 			DX::Vector3 offset = this->ComputeColliderOffset(body.collider, rot);
 			DX::Vector3 comPos = pivot + offset;
 
-			bodyInterface.MoveKinematic(
+			this->physicsSystem.MoveKinematic(
 				body.id,
 				RVec3(comPos.x, comPos.y, comPos.z),
 				Quat(rot.x, rot.y, rot.z, rot.w),
@@ -261,258 +332,18 @@ namespace Framework::Physics
 	}
 
 	//-----------------------------------------------------------------------------
-	// 貫通解決（最も深くめり込んでいるBody1つを押し出す）
-	//   注意: BodyLockRead は shape を取るだけにして、NarrowPhaseQuery はロック外で使う
+	// 接地判定用の足元オフセット（ピボットから最も低いコライダー底面まで）
 	//-----------------------------------------------------------------------------
-	void Rigidbody3D::ResolvePenetration()
+	bool Rigidbody3D::ComputeGroundProbeOffset(const DX::Quaternion& _rot, float& _outOffset) const
 	{
-		if (!this->hasBody || !this->staged) { return; }
-		if (this->bodies.empty()) { return; }
-
-		const DX::Quaternion rot = this->staged->rotation;
-
-		float bestDepth = 0.0f;
-		DX::Vector3 bestDepen = DX::Vector3::Zero;
-		DX::Vector3 bestNormal = DX::Vector3::Zero;
-
-		const auto& npq = this->physicsSystem.GetNarrowPhaseQuery();
-		const auto& broad = this->physicsSystem.GetBroadPhaseLayerFilter(this->objectLayer);
-		const auto& obj = this->physicsSystem.GetObjectLayerFilter(this->objectLayer);
-
-		for (const auto& body : this->bodies)
-		{
-			if (!body.collider) { continue; }
-
-			const Shape* shape = nullptr;
-			{
-				BodyLockRead lock(this->physicsSystem.GetBodyLockInterface(), body.id);
-				if (!lock.Succeeded()) { continue; }
-
-				shape = lock.GetBody().GetShape();
-			}
-
-			if (!shape) { continue; }
-
-			DX::Vector3 offset = this->ComputeColliderOffset(body.collider, rot);
-			DX::Vector3 comPos = this->staged->position + offset;
-
-			RMat44 transform = RMat44::sRotationTranslation(
-				Quat(rot.x, rot.y, rot.z, rot.w),
-				RVec3(comPos.x, comPos.y, comPos.z)
-			);
-
-			CollideShapeSettings settings;
-			settings.mBackFaceMode = EBackFaceMode::IgnoreBackFaces;
-			settings.mMaxSeparationDistance = 0.0f;
-
-			ClosestHitCollisionCollector<CollideShapeCollector> collector;
-			IgnoreSelfBodyFilter bodyFilter(body.id);
-
-			//// 衝突判定を行うかどうかのフィルタ設定
-			//// Triggerになっている場合には衝突判定を行わない
-			SelfTriggerShapeFilter selfFilter(this->physicsSystem, body.id);
-
-			npq.CollideShape(
-				shape,
-				Vec3::sOne(),
-				transform,
-				settings,
-				RVec3::sZero(),
-				collector,
-				broad,
-				obj,
-				bodyFilter,
-				selfFilter
-			);
-			if (!collector.HadHit()) { continue; }
-
-			const auto& hit = collector.mHit;
-			if (hit.mPenetrationDepth <= 0.0f) { continue; }
-
-			// まず自分側がトリガーなら押し戻しをしない
-			{
-				auto* selfCol = this->physicsSystem.GetCollider3D(body.id);
-				if (selfCol && selfCol->IsTrigger()) { continue; }
-			}
-
-			// ヒットした相手がトリガーなら無視する
-			auto other = this->physicsSystem.GetCollider3D(hit.mBodyID2);
-			if (!other || other->IsTrigger()) { continue; }
-
-			Vec3 axis = hit.mPenetrationAxis.Normalized();
-			DX::Vector3 normal(axis.GetX(), axis.GetY(), axis.GetZ());
-
-			DX::Vector3 depen(
-				-axis.GetX() * hit.mPenetrationDepth,
-				-axis.GetY() * hit.mPenetrationDepth,
-				-axis.GetZ() * hit.mPenetrationDepth
-			);
-
-			if (hit.mPenetrationDepth > bestDepth)
-			{
-				bestDepth = hit.mPenetrationDepth;
-				bestDepen = depen;
-				bestNormal = normal;
-			}
-		}
-
-		if (bestDepth <= 0.0f) { return; }
-
-		float vn = this->linearVelocity.x * bestNormal.x + this->linearVelocity.y * bestNormal.y + this->linearVelocity.z * bestNormal.z;
-		if (vn > 0.0f)
-		{
-			this->linearVelocity -= bestNormal * vn;
-		}
-
-		this->staged->position += bestDepen;
-	}
-
-	//-----------------------------------------------------------------------------
-	// CastShape 押し戻し解決（移動方向に対するヒットを使って押し戻す）
-	//-----------------------------------------------------------------------------
-	void Rigidbody3D::ResolveCastShape(float _deltaTime)
-	{
-		if (!this->hasBody || !this->staged || !this->stagedPrev) { return; }
-		if (this->bodies.empty()) { return; }
-
-		this->isGrounded = false;
-
-		DX::Vector3 move = this->linearVelocity * _deltaTime;
-		if (move.LengthSquared() <= 0.0f) { return; }
-
-		float moveLen = move.Length();
-		DX::Vector3 moveDir = move / moveLen;
-
-		DX::Quaternion rot = this->staged->rotation;
-
-		const auto& npq = this->physicsSystem.GetNarrowPhaseQuery();
-		const auto& broad = this->physicsSystem.GetBroadPhaseLayerFilter(this->objectLayer);
-		const auto& obj = this->physicsSystem.GetObjectLayerFilter(this->objectLayer);
-
-		float bestCorrection = 0.0f;
-		DX::Vector3 bestCandidate = this->staged->position;
-		DX::Vector3 bestNormal = DX::Vector3::Zero;
-		bool hasHit = false;
-
-		for (const auto& body : this->bodies)
-		{
-			if (!body.collider) { continue; }
-
-			const Shape* shape = nullptr;
-			{
-				BodyLockRead lock(this->physicsSystem.GetBodyLockInterface(), body.id);
-				if (!lock.Succeeded()) { continue; }
-
-				shape = lock.GetBody().GetShape();
-			}
-
-			if (!shape) { continue; }
-
-			DX::Vector3 offset = this->ComputeColliderOffset(body.collider, rot);
-			DX::Vector3 comStart = this->stagedPrev->position + offset;
-
-			RShapeCast cast(
-				shape,
-				Vec3::sOne(),
-				RMat44::sRotationTranslation(
-					Quat(rot.x, rot.y, rot.z, rot.w),
-					RVec3(comStart.x, comStart.y, comStart.z)
-				),
-				Vec3(move.x, move.y, move.z)
-			);
-
-			ShapeCastSettings settings;
-			settings.mReturnDeepestPoint = false;
-			settings.mBackFaceModeTriangles = EBackFaceMode::IgnoreBackFaces;
-			settings.mBackFaceModeConvex = EBackFaceMode::IgnoreBackFaces;
-
-			ClosestShapeCastCollector col;
-
-			//// 衝突判定を行うかどうかのフィルタ設定
-			//// Triggerになっている場合には衝突判定を行わない
-			SelfTriggerShapeFilter selfFilter(this->physicsSystem, body.id);
-
-			npq.CastShape(
-				cast,
-				settings,
-				RVec3::sZero(),
-				col,
-				broad,
-				obj,
-				IgnoreSelfBodyFilter(body.id),
-				selfFilter
-			);
-			if (!col.hasHit) { continue; }
-
-			// まず自分側がトリガーなら押し戻しをしない
-			{
-				auto* selfCol = this->physicsSystem.GetCollider3D(body.id);
-				if (selfCol && selfCol->IsTrigger()) { continue; }
-			}
-
-			// ヒットした相手がトリガーなら無視する
-			auto other = this->physicsSystem.GetCollider3D(col.hit.mBodyID2);
-			if (!other || other->IsTrigger()) { continue; }
-
-			float f = std::clamp(col.hit.mFraction, 0.0f, 1.0f);
-			float adv = std::max(0.0f, moveLen * f - skinWidth);
-
-			DX::Vector3 newCom = comStart + moveDir * adv;
-
-			DX::Vector3 normal(
-				col.hit.mPenetrationAxis.GetX(),
-				col.hit.mPenetrationAxis.GetY(),
-				col.hit.mPenetrationAxis.GetZ()
-			);
-			normal.Normalize();
-			if (adv > 0.0f)
-			{
-				newCom += normal * skinWidth;
-			}
-
-			DX::Vector3 candidate = newCom - offset;
-			DX::Vector3 correction = this->staged->position - candidate;
-			float correctionLen = correction.LengthSquared();
-			if (correctionLen > bestCorrection)
-			{
-				bestCorrection = correctionLen;
-				bestCandidate = candidate;
-				bestNormal = normal;
-				hasHit = true;
-			}
-		}
-
-		if (!hasHit) { return; }
-
-		this->staged->position = bestCandidate;
-
-		// 法線成分の速度を削減（面に沿わせる）
-		float vn = this->linearVelocity.x * bestNormal.x + this->linearVelocity.y * bestNormal.y + this->linearVelocity.z * bestNormal.z;
-		if (vn > 0.0f)
-		{
-			this->linearVelocity -= bestNormal * vn;
-		}
-
-		this->CheckGrounded();
-	}
-
-	//-----------------------------------------------------------------------------
-	// 接地判定（足元に短いRayを落とすだけなので BodyLock は不要）
-	//-----------------------------------------------------------------------------
-	void Rigidbody3D::CheckGrounded()
-	{
-		this->isGrounded = false;
-
-		if (!this->hasBody || !this->staged) { return; }
-		if (this->colliders.empty()) { return; }
+		if (!this->staged || this->colliders.empty()) { return false; }
 
 		float minBottomOffset = FLT_MAX;
-		const DX::Quaternion rot = this->staged->rotation;
+		const DX::Vector3 scale = this->staged->scale;
 
 		for (auto& col : this->colliders)
 		{
-			DX::Vector3 offset = DX::Vector3::Transform(col->GetCenterOffset(), rot);
-			DX::Vector3 scale = this->staged->scale;
+			DX::Vector3 offset = DX::Vector3::Transform(col->GetCenterOffset(), _rot);
 
 			float bottom = 0.0f;
 
@@ -537,6 +368,15 @@ namespace Framework::Physics
 				bottom = offset.y - ext.y;
 				break;
 			}
+			case ColliderShapeType::Mesh:
+			{
+				// 変換済み形状の境界（スケール適用済み、重心基準）から底面を求める
+				const JPH::ShapeRefC shape = col->GetShape();
+				bottom = shape
+					? offset.y + shape->GetCenterOfMass().GetY() + shape->GetLocalBounds().mMin.GetY()
+					: offset.y;
+				break;
+			}
 			default:
 				bottom = offset.y;
 				break;
@@ -545,19 +385,8 @@ namespace Framework::Physics
 			minBottomOffset = std::min(minBottomOffset, bottom);
 		}
 
-		const float extra = 0.05f;
-		DX::Vector3 pivotPos = this->staged->position;
-
-		RVec3 from(pivotPos.x, pivotPos.y + minBottomOffset, pivotPos.z);
-		RVec3 to(pivotPos.x, pivotPos.y + minBottomOffset - (0.1f + extra), pivotPos.z);
-
-		RRayCast ray(from, to - from);
-		RayCastResult hit;
-
-		if (this->physicsSystem.GetNarrowPhaseQuery().CastRay(ray, hit))
-		{
-			this->isGrounded = true;
-		}
+		_outOffset = minBottomOffset;
+		return true;
 	}
 
 	//-----------------------------------------------------------------------------
@@ -688,41 +517,53 @@ namespace Framework::Physics
 		if (!owner) { return; }
 		if (_selfCollider == nullptr || _otherColl == nullptr){ return; }
 
-		for (auto& component : owner->GetComponents())
-		{
-			auto listener = dynamic_cast<BaseColliderDispatcher3D*>(component.get());
-			if (!listener) { continue; }
+		using Handler = void (BaseColliderDispatcher3D::*)(Collider3DComponent*, Collider3DComponent*);
 
-			switch (_type)
-			{
-			case Framework::Physics::ContactType::Trigger_Entered:
-				listener->OnTriggerEnter(_selfCollider, _otherColl);
-				break;
+		Handler handler = nullptr;
+		switch (_type)
+		{
+		case Framework::Physics::ContactType::Trigger_Entered:	handler = &BaseColliderDispatcher3D::OnTriggerEnter; break;
+		case Framework::Physics::ContactType::Trigger_Stayed:	handler = &BaseColliderDispatcher3D::OnTriggerStay; break;
+		case Framework::Physics::ContactType::Trigger_Exited:	handler = &BaseColliderDispatcher3D::OnTriggerExit; break;
+		case Framework::Physics::ContactType::Coll_Entered:		handler = &BaseColliderDispatcher3D::OnCollisionEnter; break;
+		case Framework::Physics::ContactType::Coll_Stayed:		handler = &BaseColliderDispatcher3D::OnCollisionStay; break;
+		case Framework::Physics::ContactType::Coll_Exited:		handler = &BaseColliderDispatcher3D::OnCollisionExit; break;
+		default: return;
+		}
 
-			case Framework::Physics::ContactType::Trigger_Stayed:
-				listener->OnTriggerStay(_selfCollider, _otherColl);
-				break;
+		this->RefreshContactListeners();
 
-			case Framework::Physics::ContactType::Trigger_Exited:
-				listener->OnTriggerExit(_selfCollider, _otherColl);
-				break;
+		const uint32_t version = this->contactListenerVersion;
+		for (auto* listener : this->contactListeners)
+		{
+			(listener->*handler)(_selfCollider, _otherColl);
 
-			case Framework::Physics::ContactType::Coll_Entered:
-				listener->OnCollisionEnter(_selfCollider, _otherColl);
-				break;
+			// コールバック内でコンポーネントが増減したら一覧が古いので打ち切る
+			if (owner->GetComponentVersion() != version) { break; }
+		}
+	}
 
-			case Framework::Physics::ContactType::Coll_Stayed:
-				listener->OnCollisionStay(_selfCollider, _otherColl);
-				break;
+	//-----------------------------------------------------------------------------
+	// 接触リスナー一覧の更新（コンポーネント構成が変わったときだけ作り直す）
+	//-----------------------------------------------------------------------------
+	void Rigidbody3D::RefreshContactListeners()
+	{
+		auto owner = this->Owner();
+		if (!owner) { return; }
 
-			case Framework::Physics::ContactType::Coll_Exited:
-				listener->OnCollisionExit(_selfCollider, _otherColl);
-				break;
+		const uint32_t version = owner->GetComponentVersion();
+		if (this->hasContactListeners && this->contactListenerVersion == version) { return; }
 
-			default:
-				break;
+		this->contactListeners.clear();
+		for (auto& component : owner->GetComponents())
+		{
+			if (auto listener = dynamic_cast<BaseColliderDispatcher3D*>(component.get()))
+			{
+				this->contactListeners.push_back(listener);
 			}
 		}
+		this->contactListenerVersion = version;
+		this->hasContactListeners = true;
 	}
 
 	//-----------------------------------------------------------------------------
@@ -751,16 +592,15 @@ namespace Framework::Physics
 	{
 		if (!this->hasBody) { return; }
 
-		auto& bodyInterface = this->physicsSystem.GetBodyInterface();
 		for (const auto& body : this->bodies)
 		{
-			bodyInterface.SetMotionType(
+			this->physicsSystem.SetMotionType(
 				body.id,
 				this->motionType,
 				EActivation::Activate
 			);
 
-			bodyInterface.SetMotionQuality(
+			this->physicsSystem.SetMotionQuality(
 				body.id,
 				(this->motionType == EMotionType::Kinematic)
 				? EMotionQuality::LinearCast
@@ -773,10 +613,9 @@ namespace Framework::Physics
 	{
 		if (!this->hasBody) { return; }
 
-		auto& bodyInterface = this->physicsSystem.GetBodyInterface();
 		for (const auto& body : this->bodies)
 		{
-			bodyInterface.SetObjectLayer(body.id, this->objectLayer);
+			this->physicsSystem.SetObjectLayer(body.id, this->objectLayer);
 		}
 	}
 
@@ -805,8 +644,6 @@ namespace Framework::Physics
 		//=======================================================
 		// Body を作成しワールドに追加する（Collider ごとに作成）
 		//=======================================================
-		auto& bodyInterface = this->physicsSystem.GetBodyInterface();
-
 		const DX::Quaternion rot = this->staged->rotation;
 
 		for (auto& coll : this->colliders)
@@ -833,40 +670,36 @@ namespace Framework::Physics
 			settings.mUserData = static_cast<uint64_t>(colliderID);
 			settings.SetShape(coll->GetShape());
 
-			Body* body = bodyInterface.CreateBody(settings);
+			Body* body = this->physicsSystem.CreateBody(settings);
 			if (!body) { continue; }
 
-			bodyInterface.AddBody(body->GetID(), EActivation::Activate);
+			// シーン読み込み中は PhysicsSystem がまとめて追加する
+			this->physicsSystem.AddBody(body->GetID(), EActivation::Activate);
 
 			this->bodies.push_back({ body->GetID(), coll });
 
 			//=======================================================
-			// Rigidbody → system 登録を行う
-			//=======================================================
-			this->physicsSystem.RegisterRigidbody3D(body->GetID(), this);
-
-			//=======================================================
-			// Body と Collider を system に登録する
+			// Rigidbody・Collider・センサーフラグを system に登録する
 			//=======================================================
-			this->physicsSystem.RegisterCollider3D(body->GetID(), coll);
+			this->physicsSystem.RegisterBody(body->GetID(), this, coll, settings.mIsSensor);
 		}
 
 		this->hasBody = !this->bodies.empty();
+
+		// 接触リスナーは Body 生成時に集めておく（以降はコンポーネント構成が変わったときだけ）
+		this->RefreshContactListeners();
 	}
 
 	void Rigidbody3D::DestroyBody()
 	{
 		if (!this->hasBody) { return; }
 
-		auto& bodyInterface = this->physicsSystem.GetBodyInterface();
-
 		for (const auto& body : this->bodies)
 		{
-			this->physicsSystem.UnregisterCollider3D(body.id);
-			this->physicsSystem.UnregisterRigidbody3D(body.id);
+			this->physicsSystem.UnregisterBody(body.id);
 
-			bodyInterface.RemoveBody(body.id);
-			bodyInterface.DestroyBody(body.id);
+			this->physicsSystem.RemoveBody(body.id);
+			this->physicsSystem.DestroyBody(body.id);
 		}
 
 		this->bodies.clear();
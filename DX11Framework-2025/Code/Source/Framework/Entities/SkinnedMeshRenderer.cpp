@@ -91,8 +91,11 @@ void SkinnedMeshRenderer::Initialize()
 		return;
 	}
 
-	ShaderCommon::ShaderProgram* program = current->shaders;
-	program = shaders->GetShaderProgram("SkinnedModel");
+	// メッシュの頂点形式（圧縮の有無）に合わせたスキニング用プログラムを選ぶ
+	const Graphics::Mesh* mesh = this->meshComponent->GetMesh();
+	const Graphics::VertexFormat format = mesh ? mesh->GetVertexFormat() : Graphics::VertexFormat::Full;
+
+	ShaderCommon::ShaderProgram* program = shaders->GetModelShaderProgram(format, true);
 	if (!program)
 	{
 		std::cout << "[SkinnedMeshRenderer] SkinnedModel shader program not found.\n";
@@ -199,7 +202,9 @@ void SkinnedMeshRenderer::Draw()
 	//-------------------------------------------------------------
 	// 1つ目のログ：Draw 直前で subset の indexCount/indexStart を出す
 	//-------------------------------------------------------------
-	const auto& subsets = mesh->GetSubsets();
+	// 画面上の誤差から LOD を選ぶ（誤差はバインドポーズ基準）
+	const size_t lod = mesh->SelectLod(world, view, this->camera->GetProjectionScale());
+	const auto& subsets = mesh->GetSubsets(lod);
 
 	for (size_t i = 0; i < subsets.size(); i++)
 	{
@@ -22,22 +22,33 @@
 TimeScaleComponent::TimeScaleComponent(GameObject* _owner, bool _active)
     : Component(_owner, _active),
     timeScaleSystem(SystemLocator::Get<TimeScaleSystem>()), 
+	table(nullptr),
+	tableIndex(TimeScaleTable::InvalidIndex),
 	timeScale(1.0f),
 	timeScaleLayer(TimeScaleLayer::Default),
+	groupId(0),
 	ignoreGlobal(false),
 	ignoreLayer(false),
 	ignoreGroup(false)
-{}
+{
+	this->groupId = this->timeScaleSystem.RegisterGroup(this->groupName);
+}
 
 /// @brief 初期化処理
 void TimeScaleComponent::Initialize()
 {
 	this->timeScale = 1.0f;
+	this->MarkTableDirty();
 }
 
 /// @brief 終了処理
 void TimeScaleComponent::Dispose()
-{}
+{
+	if (this->table)
+	{
+		this->table->Remove(this);
+	}
+}
 
 /** @brief 時間スケールを設定する
  *  @param _scale 設定するスケール値
@@ -45,6 +56,17 @@ void TimeScaleComponent::Dispose()
 void TimeScaleComponent::SetTimeScale(float _scale)
 {
 	this->timeScale = _scale;
+	this->MarkTableDirty();
+}
+
+/**@brief グループ名を設定する
+ * @param _groupName グループ名
+ */
+void TimeScaleComponent::SetGroupName(const std::string& _groupName)
+{
+	this->groupName = _groupName;
+	this->groupId = this->timeScaleSystem.RegisterGroup(_groupName);
+	this->MarkTableDirty();
 }
 
 /// @brief 時間スケールを取得する
@@ -70,18 +92,37 @@ float TimeScaleComponent::GetAccumulatedScale() const
     return scale;
 }
 
+/// @brief 最終倍率を取得する
 float TimeScaleComponent::GetFinalScale() const
 {
+    // 倍率表に載っていれば親から順にまとめて求めた値を使う
+    if (this->table)
+    {
+        return this->table->GetScale(this);
+    }
+
     // parent x self
-    float scale = GetAccumulatedScale();
+    return this->GetAccumulatedScale() * this->ComputeSystemScale();
+}
+
+/// @brief グループ × レイヤー × グローバルの倍率を求める
+float TimeScaleComponent::ComputeSystemScale() const
+{
+    float scale = this->ComputeLayerGlobalScale();
 
     // group
-    float groupScale = 1.0f;
     if (!this->ignoreGroup)
     {
-        groupScale = this->timeScaleSystem.GetGroupScale(this->groupName);
+        scale *= this->timeScaleSystem.GetGroupScale(this->groupId);
     }
-    scale *= groupScale;
+
+	return scale;
+}
+
+/// @brief レイヤー × グローバルの倍率を求める
+float TimeScaleComponent::ComputeLayerGlobalScale() const
+{
+    float scale = 1.0f;
 
     // layer & global
     if (!this->ignoreLayer && !this->ignoreGlobal)
@@ -114,4 +155,34 @@ float TimeScaleComponent::ApplyTimeScale(float _baseDelta) const
 	float finalScale = this->GetFinalScale();
 
     return _baseDelta * finalScale;
+}
+
+/**@brief 固定ステップ 1 回分の経過時間を求める
+ * @param _fixedDelta 固定ステップの経過時間（TimeScale 未適用）
+ * @param _outDelta TimeScale 適用済みの経過時間
+ * @return このステップで更新するなら true
+ */
+bool TimeScaleComponent::TryGetFixedStepDelta(float _fixedDelta, float& _outDelta) const
+{
+    if (this->table)
+    {
+        return this->table->GetFixedStepDelta(this, _fixedDelta, _outDelta);
+    }
+
+    // 表に載っていなければ従来通り毎ステップ縮めた経過時間で更新する
+    _outDelta = this->ApplyTimeScale(_fixedDelta);
+    return true;
+}
+
+/**@brief 固定ステップ間の補間係数をグループの進み具合に合わせる
+ * @param _alpha 固定ステップ間の補間係数（0～1）
+ * @return このオブジェクト用の補間係数
+ */
+float TimeScaleComponent::GetFixedStepAlpha(float _alpha) const
+{
+    if (this->table)
+    {
+        return this->table->GetFixedStepAlpha(this, _alpha);
+    }
+    return _alpha;
 }
\ No newline at end of file
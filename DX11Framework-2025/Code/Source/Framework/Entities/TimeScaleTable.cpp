@@ -0,0 +1,309 @@
+﻿/** @file   TimeScaleTable.cpp
+ *  @brief  TimeScaleTable の実装
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Entities/TimeScaleTable.h"
+#include "Include/Framework/Entities/TimeScaleComponent.h"
+#include "Include/Framework/Entities/GameObject.h"
+#include "Include/Framework/Core/TimeScaleSystem.h"
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	/** @brief 親チェーンの深さを求める（並び順を作り直すときだけ呼ぶ）
+	 *  @param _object 対象オブジェクト
+	 *  @return ルートなら 0
+	 */
+	static uint32_t ComputeDepth(const GameObject* _object)
+	{
+		uint32_t depth = 0;
+		for (const GameObject* p = _object ? _object->Parent() : nullptr; p; p = p->Parent())
+		{
+			++depth;
+		}
+		return depth;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// TimeScaleTable class
+//-----------------------------------------------------------------------------
+
+/** @brief コンストラクタ
+ *  @param _system 時間スケール管理システム
+ */
+TimeScaleTable::TimeScaleTable(TimeScaleSystem& _system)
+	: system(_system)
+	, components()
+	, parentIndices()
+	, accumulatedScales()
+	, finalScales()
+	, residualScales()
+	, groupRates()
+	, groupAccumulators()
+	, groupStepScales()
+	, groupDue()
+	, lastAlpha(0.0f)
+	, systemRevision(0)
+	, structureDirty(false)
+	, scaleDirty(false)
+{
+}
+
+/** @brief コンポーネントを表に加える
+ *  @param _component 追加するコンポーネント
+ */
+void TimeScaleTable::Add(TimeScaleComponent* _component)
+{
+	if (!_component || _component->table == this) { return; }
+
+	_component->table = this;
+	_component->tableIndex = InvalidIndex;
+	this->components.push_back(_component);
+	this->structureDirty = true;
+}
+
+/** @brief コンポーネントを表から外す
+ *  @param _component 外すコンポーネント
+ */
+void TimeScaleTable::Remove(TimeScaleComponent* _component)
+{
+	if (!_component || _component->table != this) { return; }
+
+	this->components.erase(std::remove(this->components.begin(), this->components.end(), _component), this->components.end());
+	_component->table = nullptr;
+	_component->tableIndex = InvalidIndex;
+	this->structureDirty = true;
+}
+
+/// @brief 全て外す
+void TimeScaleTable::Clear()
+{
+	for (auto* component : this->components)
+	{
+		component->table = nullptr;
+		component->tableIndex = InvalidIndex;
+	}
+	this->components.clear();
+	this->parentIndices.clear();
+	this->accumulatedScales.clear();
+	this->finalScales.clear();
+	this->residualScales.clear();
+	this->groupRates.clear();
+	this->groupAccumulators.clear();
+	this->groupStepScales.clear();
+	this->groupDue.clear();
+	this->lastAlpha = 0.0f;
+	this->structureDirty = false;
+	this->scaleDirty = false;
+}
+
+/// @brief 必要なら並び順と倍率を計算し直す
+void TimeScaleTable::Refresh()
+{
+	if (this->structureDirty)
+	{
+		this->RebuildOrder();
+		this->scaleDirty = true;
+	}
+
+	if (this->scaleDirty || this->systemRevision != this->system.GetRevision())
+	{
+		this->Recompute();
+	}
+}
+
+/** @brief 最終倍率を取得する
+ *  @param _component 表に加えたコンポーネント
+ *  @return 最終倍率
+ */
+float TimeScaleTable::GetScale(const TimeScaleComponent* _component)
+{
+	this->Refresh();
+	return this->finalScales[_component->tableIndex];
+}
+
+/// @brief 親が先に来るように並べ直す
+void TimeScaleTable::RebuildOrder()
+{
+	this->structureDirty = false;
+
+	// 深さ順に並べれば親は必ず子より前に来る
+	std::vector<std::pair<uint32_t, TimeScaleComponent*>> sorted;
+	sorted.reserve(this->components.size());
+	for (auto* component : this->components)
+	{
+		sorted.emplace_back(ComputeDepth(component->Owner()), component);
+	}
+	std::stable_sort(sorted.begin(), sorted.end(),
+		[](const auto& _a, const auto& _b) { return _a.first < _b.first; });
+
+	const size_t count = sorted.size();
+	for (size_t i = 0; i < count; i++)
+	{
+		this->components[i] = sorted[i].second;
+		this->components[i]->tableIndex = static_cast<uint32_t>(i);
+	}
+
+	// 親の添字は全員の添字が決まってから引く
+	this->parentIndices.assign(count, InvalidIndex);
+	for (size_t i = 0; i < count; i++)
+	{
+		GameObject* parent = this->components[i]->Owner()->Parent();
+		TimeScaleComponent* parentScale = parent ? parent->TimeScale() : nullptr;
+		if (parentScale && parentScale->table == this)
+		{
+			this->parentIndices[i] = parentScale->tableIndex;
+		}
+	}
+
+	this->accumulatedScales.assign(count, 1.0f);
+	this->finalScales.assign(count, 1.0f);
+	this->residualScales.assign(count, 1.0f);
+}
+
+/// @brief 並び順に沿って倍率を計算する
+void TimeScaleTable::Recompute()
+{
+	this->scaleDirty = false;
+	this->systemRevision = this->system.GetRevision();
+
+	const size_t count = this->components.size();
+	for (size_t i = 0; i < count; i++)
+	{
+		const TimeScaleComponent* component = this->components[i];
+		const uint32_t parent = this->parentIndices[i];
+
+		const float accumulated = component->timeScale * ((parent != InvalidIndex) ? this->accumulatedScales[parent] : 1.0f);
+		const float residual = accumulated * component->ComputeLayerGlobalScale();
+		this->accumulatedScales[i] = accumulated;
+		this->residualScales[i] = residual;
+		this->finalScales[i] = component->ignoreGroup ? residual : residual * this->system.GetGroupScale(component->groupId);
+	}
+}
+
+/// @brief 固定ステップを 1 回進める
+void TimeScaleTable::AdvanceFixedStep()
+{
+	this->Refresh();
+
+	// グループは後から増えることがあるので、足りない分だけ伸ばす（既存の進みは保つ）
+	const size_t groupCount = this->system.GetGroupCount();
+	if (this->groupRates.size() < groupCount)
+	{
+		this->groupRates.resize(groupCount, 1.0f);
+		this->groupAccumulators.resize(groupCount, 0.0f);
+		this->groupStepScales.resize(groupCount, 1.0f);
+		this->groupDue.resize(groupCount, 1);
+	}
+
+	for (size_t id = 0; id < groupCount; id++)
+	{
+		const float previousRate = this->groupRates[id];
+		const float rate = this->system.GetGroupScale(static_cast<TimeScaleGroupId>(id));
+		this->groupRates[id] = rate;
+
+		if (rate >= 1.0f)
+		{
+			// 等倍以上は毎ステップ更新する（倍速は経過時間を伸ばす）
+			this->groupAccumulators[id] = 0.0f;
+			this->groupStepScales[id] = rate;
+			this->groupDue[id] = 1;
+			continue;
+		}
+
+		if (rate <= 0.0f)
+		{
+			// 止まっている間は最後の更新結果に留める（補間係数 1）
+			// 再開したら最初のステップで更新するので、補間が後ろに戻らない
+			this->groupAccumulators[id] = 1.0f;
+			this->groupStepScales[id] = 1.0f;
+			this->groupDue[id] = 0;
+			continue;
+		}
+
+		// 等倍以上から遅くなったときは、いま表示している補間係数から数え始める（補間が後ろに戻らない）
+		if (previousRate >= 1.0f)
+		{
+			this->groupAccumulators[id] = this->lastAlpha;
+		}
+
+		// 遅いグループは 1 ステップ分たまったときだけ素の経過時間で更新する
+		this->groupAccumulators[id] += rate;
+		this->groupStepScales[id] = 1.0f;
+		this->groupDue[id] = (this->groupAccumulators[id] >= 1.0f) ? 1 : 0;
+		if (this->groupDue[id])
+		{
+			this->groupAccumulators[id] -= 1.0f;
+		}
+	}
+}
+
+/** @brief 今回の固定ステップでの経過時間を取得する
+ *  @param _component 表に加えたコンポーネント
+ *  @param _fixedDelta 固定ステップの経過時間（TimeScale 未適用）
+ *  @param _outDelta TimeScale 適用済みの経過時間
+ *  @return このステップで更新するなら true
+ */
+bool TimeScaleTable::GetFixedStepDelta(const TimeScaleComponent* _component, float _fixedDelta, float& _outDelta)
+{
+	this->Refresh();
+
+	const uint32_t index = _component->tableIndex;
+	const TimeScaleGroupId groupId = _component->groupId;
+
+	if (_component->ignoreGroup)
+	{
+		// グループに従わないものは毎ステップ縮めた経過時間で更新する
+		_outDelta = _fixedDelta * this->finalScales[index];
+	}
+	else
+	{
+		if (groupId < this->groupDue.size() && !this->groupDue[groupId])
+		{
+			_outDelta = 0.0f;
+			return false;
+		}
+
+		const float stepScale = (groupId < this->groupStepScales.size()) ? this->groupStepScales[groupId] : 1.0f;
+		_outDelta = _fixedDelta * stepScale * this->residualScales[index];
+	}
+
+	// 倍率 0（ポーズなど）は更新そのものを飛ばす
+	return _outDelta > 0.0f;
+}
+
+/** @brief グループの進み具合に合わせた補間係数を取得する
+ *  @param _component 表に加えたコンポーネント
+ *  @param _alpha 固定ステップ間の補間係数（0～1）
+ *  @return 直前 2 回の更新の間での補間係数
+ */
+float TimeScaleTable::GetFixedStepAlpha(const TimeScaleComponent* _component, float _alpha)
+{
+	this->Refresh();
+
+	// 遅くなった瞬間のグループの進みの起点に使う
+	this->lastAlpha = _alpha;
+
+	const TimeScaleGroupId groupId = _component->groupId;
+
+	// 止まっているものは最後の結果に留める
+	if (this->residualScales[_component->tableIndex] <= 0.0f) { return 1.0f; }
+
+	if (_component->ignoreGroup || groupId >= this->groupRates.size()) { return _alpha; }
+
+	const float rate = this->groupRates[groupId];
+	if (rate >= 1.0f) { return _alpha; }
+	if (rate <= 0.0f) { return 1.0f; }
+
+	// 前回の更新からの進み（ステップ単位）がそのまま補間係数になる
+	return std::clamp(this->groupAccumulators[groupId] + _alpha * rate, 0.0f, 1.0f);
+}
@@ -7,9 +7,46 @@
  // Includes
  //-----------------------------------------------------------------------------
 #include "Include/Framework/Graphics/AnimationClipManager.h"
+#include "Include/Framework/Core/ContentRegistry.h"
 
 #include <iostream>
 #include <algorithm>
+#include <fstream>
+#include <iterator>
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	/** @brief クリップの内容キーを作る（ファイルの中身とイベント定義）
+	 *  @param _filename アニメーションファイルパス
+	 *  @param _events イベント定義（無ければ nullptr）
+	 *  @param _outKey 出力先
+	 *  @return ファイルを読めた場合 true
+	 */
+	static bool MakeClipKey(const std::string& _filename, const std::vector<Graphics::Import::ClipEvent>* _events, ContentKey& _outKey)
+	{
+		std::ifstream ifs(_filename, std::ios::binary);
+		if (!ifs) { return false; }
+		const std::vector<char> bytes((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+		ContentHasher hasher;
+		hasher.AppendVector(bytes);
+
+		// イベントテーブルはクリップが持つので、定義が違えば別のクリップにする
+		const uint64_t eventCount = _events ? _events->size() : 0;
+		hasher.AppendValue(eventCount);
+		for (uint64_t i = 0; i < eventCount; ++i)
+		{
+			hasher.AppendValue((*_events)[i].normalizedTime);
+			hasher.AppendValue(static_cast<int32_t>((*_events)[i].eventId));
+		}
+
+		_outKey = hasher.GetKey();
+		return true;
+	}
+}
 
 //-----------------------------------------------------------------------------
 // AnimationClipManager class
@@ -63,6 +100,50 @@ Graphics::Import::AnimationClip* AnimationClipManager::Register(const std::strin
 		}
 	}
 
+	return this->Commit(_key, this->Load(_key, this->importer));
+}
+
+/** @brief クリップを読み込む
+ *  @param _key リソースキー
+ *  @return 読み込んだクリップ。失敗時 nullptr
+ */
+std::shared_ptr<Graphics::Import::AnimationClip> AnimationClipManager::Preload(const std::string& _key)
+{
+	// インポーターはスレッドをまたいで使えないので、呼び出しごとに作る
+	Graphics::Import::AnimationImporter localImporter;
+	return this->Load(_key, localImporter);
+}
+
+/** @brief 読み込んだクリップを登録する
+ *  @param _key リソースキー
+ *  @param _clip Preload の結果
+ *  @return 登録したクリップ。失敗時 nullptr
+ */
+Graphics::Import::AnimationClip* AnimationClipManager::Commit(const std::string& _key, std::shared_ptr<Graphics::Import::AnimationClip> _clip)
+{
+	// 読み込みの間に登録されていたらそちらを使う
+	if (auto* existing = this->Get(_key)) { return existing; }
+	if (!_clip) { return nullptr; }
+
+	Graphics::Import::AnimationClip* clipRaw = _clip.get();
+	this->clipMap.emplace(_key, std::move(_clip));
+
+	if (this->defaultClip == nullptr)
+	{
+		// デフォルトが無ければ最初に登録できたものをデフォルトにする
+		this->defaultClip = clipRaw;
+	}
+
+	return clipRaw;
+}
+
+/** @brief クリップを読み込む（内容が同じものは共有する）
+ *  @param _key リソースキー
+ *  @param _importer 使うインポーター
+ *  @return 読み込んだクリップ。失敗時 nullptr
+ */
+std::shared_ptr<Graphics::Import::AnimationClip> AnimationClipManager::Load(const std::string& _key, Graphics::Import::AnimationImporter& _importer)
+{
 	// ファイルパス情報が無いなら登録できない
 	auto infoIt = this->clipInfoMap.find(_key);
 	if (infoIt == this->clipInfoMap.end())
@@ -73,37 +154,45 @@ Graphics::Import::AnimationClip* AnimationClipManager::Register(const std::strin
 
 	const std::string& filename = infoIt->second;
 
-	// 読み込み
-	auto clip = std::make_unique<Graphics::Import::AnimationClip>();
+	auto defIt = this->eventDefMap.find(_key);
+	const std::vector<Graphics::Import::ClipEvent>* eventDefs = (defIt != this->eventDefMap.end()) ? &defIt->second : nullptr;
 
-	// メンバ importer を使う（ローカル生成はしない）
-	if (!this->importer.LoadSingleClip(filename, *clip))
+	ContentKey contentKey{};
+	if (!::MakeClipKey(filename, eventDefs, contentKey))
 	{
-		std::cerr << "[Error] AnimationClipManager::Register: Import failed: " << _key
+		std::cerr << "[Error] AnimationClipManager::Register: File not found: " << _key
 			<< " (" << filename << ")" << std::endl;
 		return nullptr;
 	}
-	clip->keyName = _key;
 
-	// ロード直後にイベントテーブルを適用（定義があれば）
-	{
-		auto defIt = this->eventDefMap.find(_key);
-		if (defIt != this->eventDefMap.end())
+	// 同じファイル内容・同じイベント定義のクリップは、別のキーで読み込み済みならそれを共有する
+	auto clip = ContentRegistry::Acquire<Graphics::Import::AnimationClip>(contentKey, [&]()
+		-> std::unique_ptr<Graphics::Import::AnimationClip>
 		{
-			this->BuildEventTable(*clip, defIt->second);
-		}
-	}
+			auto created = std::make_unique<Graphics::Import::AnimationClip>();
 
-	Graphics::Import::AnimationClip* clipRaw = clip.get();
-	this->clipMap.emplace(_key, std::move(clip));
+			// 渡されたインポーターを使う（メインスレッドではメンバの importer）
+			if (!_importer.LoadSingleClip(filename, *created))
+			{
+				return nullptr;
+			}
+			created->keyName = _key;
 
-	if (this->defaultClip == nullptr)
+			// ロード直後にイベントテーブルを適用（定義があれば）
+			if (eventDefs)
+			{
+				this->BuildEventTable(*created, *eventDefs);
+			}
+			return created;
+		});
+	if (!clip)
 	{
-		// デフォルトが無ければ最初に登録できたものをデフォルトにする
-		this->defaultClip = clipRaw;
+		std::cerr << "[Error] AnimationClipManager::Register: Import failed: " << _key
+			<< " (" << filename << ")" << std::endl;
+		return nullptr;
 	}
 
-	return clipRaw;
+	return clip;
 }
 
 /** @brief リソースの登録を解除する
@@ -117,13 +206,19 @@ void AnimationClipManager::Unregister(const std::string& _key)
 		return;
 	}
 
-	// デフォルトが消える場合は nullptr に戻す（必要なら別キーに差し替えても良い）
-	if (this->defaultClip == it->second.get())
+	Graphics::Import::AnimationClip* clipRaw = it->second.get();
+	this->clipMap.erase(it);
+
+	// デフォルトが消える場合は nullptr に戻す（別のキーが同じクリップを共有していれば残す）
+	if (this->defaultClip == clipRaw)
 	{
-		this->defaultClip = nullptr;
+		const bool stillShared = std::any_of(this->clipMap.begin(), this->clipMap.end(),
+			[clipRaw](const auto& _entry) { return _entry.second.get() == clipRaw; });
+		if (!stillShared)
+		{
+			this->defaultClip = nullptr;
+		}
 	}
-
-	this->clipMap.erase(it);
 }
 
 /** @brief キーに対応するリソースを取得する
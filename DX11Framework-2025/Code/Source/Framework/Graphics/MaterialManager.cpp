@@ -93,6 +93,21 @@ Material* MaterialManager::Get(const std::string& _key)
     return this->Default();
 }
 
+/** @brief マテリアルの登録名を探す
+ *  @param _material マテリアル
+ *  @return 登録名、無ければnullptr
+ */
+const std::string* MaterialManager::FindKey(const Material* _material) const
+{
+    if (!_material) { return nullptr; }
+
+    for (const auto& [key, material] : this->materialMap)
+    {
+        if (material.get() == _material) { return &key; }
+    }
+    return nullptr;
+}
+
 /** @brief デフォルトマテリアルを取得
  *  @return Material* デフォルトマテリアル
  */
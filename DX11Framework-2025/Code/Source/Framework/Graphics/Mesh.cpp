@@ -7,6 +7,8 @@
  //-----------------------------------------------------------------------------
 #include "Include/Framework/Graphics/Mesh.h"
 
+#include <algorithm>
+
 //-----------------------------------------------------------------------------
 // Mesh Class
 //-----------------------------------------------------------------------------
@@ -26,5 +28,77 @@ namespace Graphics
         {
             this->indexBuffer->Bind(&_context);
         }
+
+        // 圧縮頂点は VS で位置を復元するため、復元パラメータも一緒に設定する
+        if (this->dequantBuffer)
+        {
+            this->dequantBuffer->BindVS(&_context, 8);
+        }
+    }
+
+    /**@brief 指定 LOD の描画範囲を取得
+     * @param _lod LOD 番号（範囲外は最も粗い LOD）
+     * @return 描画範囲
+     */
+    const std::vector<MeshSubset>& Mesh::GetSubsets(size_t _lod) const
+    {
+        if (_lod == 0 || this->lods.empty())
+        {
+            return this->subsets;
+        }
+
+        const size_t lodIndex = std::min(_lod, this->lods.size()) - 1;
+        return this->lods[lodIndex].subsets;
+    }
+
+    /**@brief 画面上の誤差が許容値に収まる最も粗い LOD を選ぶ
+     * @param _distance カメラからの距離（ビュー空間の奥行き）
+     * @param _projectionScale 距離 1 での 1 単位あたりのピクセル数
+     * @param _worldScale オブジェクトのワールドスケール（最大軸）
+     * @param _maxScreenError 許容する画面上の誤差（ピクセル）
+     * @return LOD 番号
+     */
+    size_t Mesh::SelectLod(float _distance, float _projectionScale, float _worldScale, float _maxScreenError) const
+    {
+        // カメラの後ろや至近距離では常に最高精度
+        if (this->lods.empty() || _distance <= 0.0f)
+        {
+            return 0;
+        }
+
+        // 誤差は粗くなる順に単調増加する前提で、許容値を超える手前の LOD を採用する
+        const float pixelsPerUnit = _projectionScale * _worldScale / _distance;
+
+        size_t selected = 0;
+        for (size_t i = 0; i < this->lods.size(); i++)
+        {
+            if (this->lods[i].error * pixelsPerUnit > _maxScreenError)
+            {
+                break;
+            }
+            selected = i + 1;
+        }
+        return selected;
+    }
+
+    /**@brief ワールド/ビュー行列から距離とスケールを求めて LOD を選ぶ
+     * @param _world ワールド行列
+     * @param _view ビュー行列
+     * @param _projectionScale 距離 1 での 1 単位あたりのピクセル数
+     * @param _maxScreenError 許容する画面上の誤差（ピクセル）
+     * @return LOD 番号
+     */
+    size_t Mesh::SelectLod(const DX::Matrix4x4& _world, const DX::Matrix4x4& _view, float _projectionScale, float _maxScreenError) const
+    {
+        if (this->lods.empty())
+        {
+            return 0;
+        }
+
+        // 原点のビュー空間奥行きを距離とし、軸スケールの最大値で誤差を拡大する
+        const DX::Vector3 viewPosition = DX::Vector3::Transform(_world.Translation(), _view);
+        const float worldScale = std::max({ _world.Right().Length(), _world.Up().Length(), _world.Backward().Length() });
+
+        return this->SelectLod(viewPosition.z, _projectionScale, worldScale, _maxScreenError);
     }
 }// namespace Graphics
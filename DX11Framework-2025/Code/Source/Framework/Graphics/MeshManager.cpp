@@ -7,12 +7,80 @@
  //-----------------------------------------------------------------------------
 #include "Include/Framework/Graphics/MeshManager.h"
 #include "Include/Framework/Graphics/PrimitiveMeshData.h"
+#include "Include/Framework/Graphics/MeshOptimizer.h"
+#include "Include/Framework/Graphics/VertexQuantizer.h"
 
 #include "Include/Framework/Core/SystemLocator.h"
 #include "Include/Framework/Core/ResourceHub.h"
+#include "Include/Framework/Core/ContentRegistry.h"
 
+#include <algorithm>
 #include <iostream>
 
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+    /** @brief GPU メッシュの内容を決める値だけを集めて内容キーを作る
+     *  @param _modelData 読み込んだモデルデータ
+     *  @return 内容キー（名前・マテリアル名などの文字列は含めない）
+     */
+    static ContentKey MakeGeometryKey(const Graphics::Import::ModelData& _modelData)
+    {
+        ContentHasher hasher;
+        hasher.AppendValue(static_cast<uint32_t>(_modelData.vertexFormat));
+        hasher.AppendValue(static_cast<uint32_t>(_modelData.boneDictionary.empty() ? 0 : 1));
+
+        hasher.AppendValue(static_cast<uint64_t>(_modelData.vertices.size()));
+        for (const auto& verts : _modelData.vertices)
+        {
+            hasher.AppendValue(static_cast<uint64_t>(verts.size()));
+            for (const auto& v : verts)
+            {
+                const float attributes[8] = {
+                    v.pos.x, v.pos.y, v.pos.z,
+                    v.normal.x, v.normal.y, v.normal.z,
+                    v.texCoord.x, v.texCoord.y,
+                };
+                hasher.Append(attributes, sizeof(attributes));
+                hasher.Append(v.boneIndex, sizeof(v.boneIndex));
+                hasher.Append(v.boneWeight, sizeof(v.boneWeight));
+            }
+        }
+
+        hasher.AppendValue(static_cast<uint64_t>(_modelData.indices.size()));
+        for (const auto& idx : _modelData.indices)
+        {
+            hasher.AppendVector(idx);
+        }
+
+        hasher.AppendValue(static_cast<uint64_t>(_modelData.subsets.size()));
+        for (const auto& subset : _modelData.subsets)
+        {
+            const uint32_t range[6] = {
+                subset.vertexBase, subset.vertexNum,
+                subset.indexBase, subset.indexNum,
+                static_cast<uint32_t>(subset.materialIndex), subset.meshIndex,
+            };
+            hasher.Append(range, sizeof(range));
+        }
+
+        hasher.AppendValue(static_cast<uint64_t>(_modelData.lods.size()));
+        for (const auto& meshLods : _modelData.lods)
+        {
+            hasher.AppendValue(static_cast<uint64_t>(meshLods.size()));
+            for (const auto& level : meshLods)
+            {
+                hasher.AppendVector(level.indices);
+                hasher.AppendValue(level.error);
+            }
+        }
+
+        return hasher.GetKey();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // MeshManager class
 //-----------------------------------------------------------------------------
@@ -50,7 +118,24 @@ void MeshManager:: Register(const std::string& _key, Graphics::Mesh* _mesh)
     if (!_mesh) { return; }
 
     // 所有を移す or 参照保持に切替
-    this->meshTable[_key] = std::unique_ptr<Graphics::Mesh>(_mesh);
+    this->meshTable[_key] = std::shared_ptr<Graphics::Mesh>(_mesh);
+}
+
+Graphics::Mesh* MeshManager::RegisterFromModelData(const std::string& _key, const Graphics::Import::ModelData& _modelData)
+{
+    // 頂点・インデックスが同じなら、別のキー・別のモデルで作ったメッシュをそのまま使う
+    auto mesh = ContentRegistry::Acquire<Graphics::Mesh>(::MakeGeometryKey(_modelData), [&]()
+        {
+            return this->CreateFromModelData(_modelData);
+        });
+    if (!mesh) { return nullptr; }
+
+    std::cout << "[MeshManager] Registered mesh: " << _key
+        << (mesh.use_count() > 1 ? " (shared)" : "") << std::endl;
+
+    Graphics::Mesh* raw = mesh.get();
+    this->meshTable[_key] = std::move(mesh);
+    return raw;
 }
 
 void MeshManager::Unregister(const std::string& _key)
@@ -71,6 +156,17 @@ Graphics::Mesh* MeshManager::Get(const std::string& _key)
     return nullptr;
 }
 
+const std::string* MeshManager::FindKey(const Graphics::Mesh* _mesh) const
+{
+    if (!_mesh) { return nullptr; }
+
+    for (const auto& [key, mesh] : this->meshTable)
+    {
+        if (mesh.get() == _mesh) { return &key; }
+    }
+    return nullptr;
+}
+
 Graphics::Mesh* MeshManager::Default() const
 {
     return this->defaultMesh.get();
@@ -177,17 +273,29 @@ std::unique_ptr<Graphics::Mesh> MeshManager::CreateFromModelData(
     std::vector<Graphics::MeshSubset> subsets;
     subsets.reserve(_modelData.subsets.size());
 
+    // 統合 IB 内での各メッシュの開始位置（LOD も同じ IB の後ろに詰めるため、ここで確定させる）
+    // ModelData の indexBase は分離バッファ前提で 0 なので、統合 IB ではメッシュの並び順から求め直す。
+    // vertices / indices / lods はメッシュ番号で並ぶが、サブセットは null メッシュを飛ばすため subset.meshIndex で引く
+    std::vector<uint32_t> meshIndexStart(_modelData.indices.size(), 0);
+    {
+        uint32_t indexCursor = 0;
+        for (size_t i = 0; i < _modelData.indices.size(); ++i)
+        {
+            meshIndexStart[i] = indexCursor;
+            indexCursor += static_cast<uint32_t>(_modelData.indices[i].size());
+        }
+    }
+
     for (const auto& subset : _modelData.subsets)
     {
         Graphics::MeshSubset s{};
-        s.indexStart = subset.indexBase;
+        s.indexStart = (subset.meshIndex < meshIndexStart.size()) ? meshIndexStart[subset.meshIndex] : subset.indexBase;
         s.indexCount = subset.indexNum;
         s.vertexBase = subset.vertexBase;
         s.vertexCount = subset.vertexNum;
         s.materialIndex = subset.materialIndex;
         subsets.push_back(s);
     }
-    mesh->SetSubsets(std::move(subsets));
 
     //-----------------------------------------------------------
     // 頂点／インデックス統合
@@ -206,9 +314,12 @@ std::unique_ptr<Graphics::Mesh> MeshManager::CreateFromModelData(
     indexData.reserve(totalIdx);
 
 	// 各メッシュの頂点・インデックスを統合する
+    std::vector<uint32_t> meshVertexOffset(_modelData.vertices.size(), 0);
     uint32_t vertexOffset = 0;
     for (size_t meshIndex = 0; meshIndex < _modelData.vertices.size(); ++meshIndex)
     {
+        meshVertexOffset[meshIndex] = vertexOffset;
+
         const auto& verts = _modelData.vertices[meshIndex];
         const auto& idx = _modelData.indices[meshIndex];
 
@@ -240,24 +351,121 @@ std::unique_ptr<Graphics::Mesh> MeshManager::CreateFromModelData(
         vertexOffset += static_cast<uint32_t>(verts.size());
     }
 
+	//-----------------------------------------------------------
+    // LOD 構築（頂点は共有し、インデックスだけ基本メッシュの後ろに追加する）
+	//-----------------------------------------------------------
+    size_t lodCount = 0;
+    for (const auto& meshLods : _modelData.lods)
+    {
+        lodCount = std::max(lodCount, meshLods.size());
+    }
+
+    // LOD が足りないメッシュは、ひとつ前のレベル（無ければ基本メッシュ）の範囲をそのまま指す（IB には複製しない）
+    std::vector<Graphics::MeshSubset> prevSubsets = subsets;
+    for (size_t lod = 1; lod <= lodCount; ++lod)
+    {
+        std::vector<Graphics::MeshSubset> lodSubsets;
+        lodSubsets.reserve(subsets.size());
+        float lodError = 0.0f;
+
+        for (size_t subsetIndex = 0; subsetIndex < subsets.size(); ++subsetIndex)
+        {
+            const unsigned int meshIndex = _modelData.subsets[subsetIndex].meshIndex;
+            const size_t meshLodCount = (meshIndex < _modelData.lods.size()) ? _modelData.lods[meshIndex].size() : 0;
+            if (lod > meshLodCount)
+            {
+                // 誤差も最後に持っていたレベルのものを引き継ぐ
+                if (meshLodCount > 0)
+                {
+                    lodError = std::max(lodError, _modelData.lods[meshIndex][meshLodCount - 1].error);
+                }
+                lodSubsets.push_back(prevSubsets[subsetIndex]);
+                continue;
+            }
+
+            const auto& level = _modelData.lods[meshIndex][lod - 1];
+            lodError = std::max(lodError, level.error);
+
+            Graphics::MeshSubset s = subsets[subsetIndex];
+            s.indexStart = static_cast<UINT>(indexData.size());
+            s.indexCount = static_cast<UINT>(level.indices.size());
+
+            for (const auto& i : level.indices)
+            {
+                indexData.push_back(i + meshVertexOffset[meshIndex]);
+            }
+            lodSubsets.push_back(s);
+        }
+
+        prevSubsets = lodSubsets;
+        mesh->AddLod(std::move(lodSubsets), lodError);
+    }
+    mesh->SetSubsets(std::move(subsets));
+
 	//-----------------------------------------------------------
     //  GPUバッファを生成する
 	//-----------------------------------------------------------
     auto device = this->d3d11System.GetDevice();
 
+    // 頂点形式に合わせて圧縮する（8bit に収まらないボーン番号がある場合は Full に戻す）
+    const bool skinned = !_modelData.boneDictionary.empty();
+    Graphics::VertexFormat format = _modelData.vertexFormat;
+    Graphics::VertexDequantBuffer dequant{};
+    if (format == Graphics::VertexFormat::CompactQuantized)
+    {
+        dequant = Graphics::VertexQuantizer::ComputePositionDequant(vertexData);
+    }
+
+    std::vector<uint8_t> encodedVertices;
+    if (!Graphics::VertexQuantizer::Encode(vertexData, format, skinned, dequant, encodedVertices))
+    {
+        std::cerr << "[MeshManager] Bone index exceeds " << Graphics::VertexQuantizer::MaxCompactBoneIndex
+            << ", falling back to full vertex format.\n";
+        format = Graphics::VertexFormat::Full;
+        dequant = {};
+        Graphics::VertexQuantizer::Encode(vertexData, format, skinned, dequant, encodedVertices);
+    }
+    const UINT vertexStride = Graphics::VertexQuantizer::GetVertexStride(format, skinned);
+
     auto vb = std::make_unique<VertexBuffer>();
-    vb->Create(device, vertexData.data(),
-        sizeof(Graphics::ModelVertexGPU),
+    vb->Create(device, encodedVertices.data(),
+        vertexStride,
         static_cast<UINT>(vertexData.size()),
         false
     );
     mesh->SetVertexBuffer(std::move(vb));
 
+    // 圧縮形式は位置の復元パラメータを定数バッファで渡す（Compact は offset 0 / scale 1）
+    std::unique_ptr<ConstantBuffer<Graphics::VertexDequantBuffer>> dequantBuffer;
+    if (format != Graphics::VertexFormat::Full)
+    {
+        dequantBuffer = std::make_unique<ConstantBuffer<Graphics::VertexDequantBuffer>>();
+        dequantBuffer->Create(device);
+        dequantBuffer->Update(this->d3d11System.GetContext(), dequant);
+    }
+    mesh->SetVertexFormat(format, std::move(dequantBuffer));
+
+    std::cout << "[MeshManager] Vertex format: stride " << sizeof(Graphics::ModelVertexGPU) << " -> " << vertexStride
+        << " bytes, VB " << vertexData.size() * sizeof(Graphics::ModelVertexGPU) << " -> " << encodedVertices.size() << " bytes"
+        << (skinned ? " (skinned)" : "") << std::endl;
+
+    // 頂点数が 16bit に収まる場合は R16_UINT で作り、IB のサイズと帯域を半分にする
     auto ib = std::make_unique<IndexBuffer>();
-    ib->Create(device, indexData.data(),
-        sizeof(uint32_t),
-        static_cast<UINT>(indexData.size())
-    );
+    if (vertexData.size() <= Graphics::Import::MeshOptimizer::MaxIndex16VertexCount)
+    {
+        std::vector<uint16_t> indexData16(indexData.begin(), indexData.end());
+        ib->Create(device, indexData16.data(),
+            sizeof(uint16_t),
+            static_cast<UINT>(indexData16.size())
+        );
+    }
+    else
+    {
+        ib->Create(device, indexData.data(),
+            sizeof(uint32_t),
+            static_cast<UINT>(indexData.size())
+        );
+    }
     mesh->SetIndexBuffer(std::move(ib));
 
     return mesh;
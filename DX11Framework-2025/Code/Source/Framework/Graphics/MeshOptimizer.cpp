@@ -0,0 +1,605 @@
+﻿/** @file   MeshOptimizer.cpp
+ *  @brief  インポート時のメッシュ最適化（頂点溶接・頂点キャッシュ/フェッチ最適化）
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Graphics/MeshOptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cfloat>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	//-----------------------------------------------------------------------------
+	// Weld helpers
+	//-----------------------------------------------------------------------------
+	/** @struct WeldKey
+	 *  @brief 溶接判定に使う頂点属性（文字列などのデバッグ情報は含めない）
+	 */
+	struct WeldKey
+	{
+		float values[16] = {};		///< pos(3) + normal(3) + color(4) + uv(2) + weight(4)
+		UINT boneIndex[4] = {};		///< ボーンインデックス
+
+		bool operator==(const WeldKey& _other) const
+		{
+			return std::memcmp(this, &_other, sizeof(WeldKey)) == 0;
+		}
+	};
+
+	/** @brief WeldKey 用ハッシュ（FNV-1a）
+	 */
+	struct WeldKeyHash
+	{
+		size_t operator()(const WeldKey& _key) const
+		{
+			const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&_key);
+
+			uint64_t hash = 14695981039346656037ull;
+			for (size_t i = 0; i < sizeof(WeldKey); i++)
+			{
+				hash ^= bytes[i];
+				hash *= 1099511628211ull;
+			}
+			return static_cast<size_t>(hash);
+		}
+	};
+
+	/** @brief -0.0f を 0.0f に揃える（ビット比較で別頂点扱いにしないため）
+	 *  @param _value 入力値
+	 *  @return 正規化後の値
+	 */
+	static float CanonicalFloat(float _value)
+	{
+		return (_value == 0.0f) ? 0.0f : _value;
+	}
+
+	/** @brief 頂点から溶接キーを作る
+	 *  @param _vertex 頂点
+	 *  @return 溶接キー
+	 */
+	static WeldKey MakeWeldKey(const Graphics::Import::Vertex& _vertex)
+	{
+		WeldKey key{};
+
+		const float values[16] =
+		{
+			_vertex.pos.x, _vertex.pos.y, _vertex.pos.z,
+			_vertex.normal.x, _vertex.normal.y, _vertex.normal.z,
+			_vertex.color.r, _vertex.color.g, _vertex.color.b, _vertex.color.a,
+			_vertex.texCoord.x, _vertex.texCoord.y,
+			_vertex.boneWeight[0], _vertex.boneWeight[1], _vertex.boneWeight[2], _vertex.boneWeight[3],
+		};
+
+		for (int i = 0; i < 16; i++)
+		{
+			key.values[i] = ::CanonicalFloat(values[i]);
+		}
+		for (int i = 0; i < 4; i++)
+		{
+			key.boneIndex[i] = _vertex.boneIndex[i];
+		}
+
+		return key;
+	}
+
+	//-----------------------------------------------------------------------------
+	// Forsyth helpers
+	//-----------------------------------------------------------------------------
+	static constexpr float CacheDecayPower = 1.5f;		///< キャッシュ位置による減衰
+	static constexpr float LastTriScore = 0.75f;		///< 直前の三角形の頂点に与えるスコア
+	static constexpr float ValenceBoostScale = 2.0f;	///< 残り三角形数が少ない頂点を優先する係数
+	static constexpr float ValenceBoostPower = 0.5f;	///< 同上の指数
+
+	/** @brief Forsyth 法の頂点スコアを求める
+	 *  @param _cachePosition キャッシュ内の位置（キャッシュ外は -1）
+	 *  @param _remainingValence まだ出力していない隣接三角形数
+	 *  @return 頂点スコア
+	 */
+	static float ComputeVertexScore(int _cachePosition, unsigned int _remainingValence)
+	{
+		// もう使われない頂点は選ばない
+		if (_remainingValence == 0)
+		{
+			return -1.0f;
+		}
+
+		float score = 0.0f;
+		if (_cachePosition >= 0)
+		{
+			if (_cachePosition < 3)
+			{
+				// 直前の三角形の頂点は一律のスコアにして、同じ辺ばかり辿らないようにする
+				score = LastTriScore;
+			}
+			else
+			{
+				const float scaler = 1.0f / static_cast<float>(Graphics::Import::MeshOptimizer::ForsythCacheSize - 3);
+				score = 1.0f - static_cast<float>(_cachePosition - 3) * scaler;
+				score = std::pow(score, CacheDecayPower);
+			}
+		}
+
+		score += ValenceBoostScale * std::pow(static_cast<float>(_remainingValence), -ValenceBoostPower);
+		return score;
+	}
+
+	//-----------------------------------------------------------------------------
+	// SelfTest helpers
+	//-----------------------------------------------------------------------------
+	using TrianglePositions = std::array<float, 9>;	///< 三角形 1 枚分の頂点位置
+
+	/** @brief 三角形ごとに頂点を持つ（溶接前の）格子を作り、三角形の順番をシャッフルする
+	 *  @param _quads 一辺の四角形数
+	 *  @param _outVertices 出力頂点
+	 *  @param _outIndices 出力インデックス
+	 */
+	static void BuildShuffledGrid(uint32_t _quads, std::vector<Graphics::Import::Vertex>& _outVertices, std::vector<unsigned int>& _outIndices)
+	{
+		_outVertices.clear();
+		_outIndices.clear();
+
+		auto addVertex = [&](uint32_t _x, uint32_t _y)
+			{
+				Graphics::Import::Vertex vertex{};
+				vertex.pos = { static_cast<float>(_x), 0.0f, static_cast<float>(_y) };
+				vertex.normal = { 0.0f, 1.0f, 0.0f };
+				vertex.texCoord = { static_cast<float>(_x) / static_cast<float>(_quads), static_cast<float>(_y) / static_cast<float>(_quads), 0.0f };
+				_outIndices.push_back(static_cast<unsigned int>(_outVertices.size()));
+				_outVertices.push_back(vertex);
+			};
+
+		for (uint32_t y = 0; y < _quads; y++)
+		{
+			for (uint32_t x = 0; x < _quads; x++)
+			{
+				addVertex(x, y); addVertex(x + 1, y); addVertex(x, y + 1);
+				addVertex(x + 1, y); addVertex(x + 1, y + 1); addVertex(x, y + 1);
+			}
+		}
+
+		// 入力順のままだと最初から局所性が高いので、三角形単位で並びを崩す
+		std::mt19937 random(12345);
+		const size_t triangleCount = _outIndices.size() / 3;
+		for (size_t i = triangleCount - 1; i > 0; i--)
+		{
+			const size_t j = random() % (i + 1);
+			std::swap_ranges(_outIndices.begin() + i * 3, _outIndices.begin() + i * 3 + 3, _outIndices.begin() + j * 3);
+		}
+	}
+
+	/** @brief 三角形を頂点位置の並びに直して整列する（頂点番号・三角形順・巻き始めの違いを無視して比較するため）
+	 *  @param _vertices 頂点
+	 *  @param _indices インデックス
+	 *  @return 整列済みの三角形一覧
+	 */
+	static std::vector<TrianglePositions> CollectTriangles(const std::vector<Graphics::Import::Vertex>& _vertices, const std::vector<unsigned int>& _indices)
+	{
+		std::vector<TrianglePositions> triangles;
+		triangles.reserve(_indices.size() / 3);
+		for (size_t i = 0; i + 2 < _indices.size(); i += 3)
+		{
+			// 巻き順は保ったまま、最小の頂点から始まるように回す
+			std::array<std::array<float, 3>, 3> corners{};
+			for (size_t k = 0; k < 3; k++)
+			{
+				const auto& p = _vertices[_indices[i + k]].pos;
+				corners[k] = { p.x, p.y, p.z };
+			}
+			const size_t first = static_cast<size_t>(std::min_element(corners.begin(), corners.end()) - corners.begin());
+
+			TrianglePositions triangle{};
+			for (size_t k = 0; k < 3; k++)
+			{
+				const auto& corner = corners[(first + k) % 3];
+				std::copy(corner.begin(), corner.end(), triangle.begin() + k * 3);
+			}
+			triangles.push_back(triangle);
+		}
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Namespace : Graphics::Import::MeshOptimizer
+//-----------------------------------------------------------------------------
+namespace Graphics::Import::MeshOptimizer
+{
+	//-----------------------------------------------------------------------------
+	// WeldVertices
+	//-----------------------------------------------------------------------------
+	/** @brief 属性（位置・法線・色・UV・ボーン）が完全一致する頂点を溶接する
+	 *  @param _vertices 入出力頂点配列（重複が取り除かれる）
+	 *  @param _indices 入出力インデックス配列（溶接後の番号に置き換えられる）
+	 *  @return 旧頂点番号 -> 新頂点番号 の対応表
+	 */
+	std::vector<unsigned int> WeldVertices(std::vector<Vertex>& _vertices, std::vector<unsigned int>& _indices)
+	{
+		std::vector<unsigned int> remap(_vertices.size(), 0);
+
+		std::unordered_map<WeldKey, unsigned int, WeldKeyHash> uniqueTable;
+		uniqueTable.reserve(_vertices.size());
+
+		std::vector<Vertex> weldedVertices;
+		weldedVertices.reserve(_vertices.size());
+
+		for (size_t vertexIndex = 0; vertexIndex < _vertices.size(); vertexIndex++)
+		{
+			const WeldKey key = ::MakeWeldKey(_vertices[vertexIndex]);
+			const unsigned int newIndex = static_cast<unsigned int>(weldedVertices.size());
+
+			auto [it, inserted] = uniqueTable.emplace(key, newIndex);
+			if (inserted)
+			{
+				weldedVertices.push_back(std::move(_vertices[vertexIndex]));
+			}
+			remap[vertexIndex] = it->second;
+		}
+
+		for (auto& index : _indices)
+		{
+			assert(index < remap.size());
+			index = remap[index];
+		}
+
+		_vertices = std::move(weldedVertices);
+		return remap;
+	}
+
+	//-----------------------------------------------------------------------------
+	// OptimizeVertexCache
+	//-----------------------------------------------------------------------------
+	/** @brief Forsyth 法で三角形の並びを頂点キャッシュのヒット率が高くなる順に並べ替える
+	 *  @param _indices 入出力インデックス配列（三角形リスト）
+	 *  @param _vertexCount 頂点数
+	 */
+	void OptimizeVertexCache(std::vector<unsigned int>& _indices, size_t _vertexCount)
+	{
+		const size_t triangleCount = _indices.size() / 3;
+		if (triangleCount == 0 || _vertexCount == 0)
+		{
+			return;
+		}
+
+		// 頂点ごとの隣接三角形リスト（CSR 形式）を作る
+		std::vector<unsigned int> valence(_vertexCount, 0);
+		for (size_t i = 0; i < triangleCount * 3; i++)
+		{
+			assert(_indices[i] < _vertexCount);
+			valence[_indices[i]]++;
+		}
+
+		std::vector<unsigned int> adjacencyOffset(_vertexCount + 1, 0);
+		for (size_t v = 0; v < _vertexCount; v++)
+		{
+			adjacencyOffset[v + 1] = adjacencyOffset[v] + valence[v];
+		}
+
+		std::vector<unsigned int> adjacency(triangleCount * 3);
+		{
+			std::vector<unsigned int> cursor(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+			for (size_t tri = 0; tri < triangleCount; tri++)
+			{
+				for (size_t k = 0; k < 3; k++)
+				{
+					const unsigned int v = _indices[tri * 3 + k];
+					adjacency[cursor[v]++] = static_cast<unsigned int>(tri);
+				}
+			}
+		}
+
+		// 初期スコア
+		std::vector<unsigned int> remainingValence = valence;
+		std::vector<int> cachePosition(_vertexCount, -1);
+		std::vector<float> vertexScore(_vertexCount, 0.0f);
+		for (size_t v = 0; v < _vertexCount; v++)
+		{
+			vertexScore[v] = ::ComputeVertexScore(-1, remainingValence[v]);
+		}
+
+		std::vector<bool> triangleEmitted(triangleCount, false);
+
+		std::vector<unsigned int> outIndices;
+		outIndices.reserve(triangleCount * 3);
+
+		std::vector<unsigned int> cache;
+		std::vector<unsigned int> nextCache;
+		cache.reserve(ForsythCacheSize + 3);
+		nextCache.reserve(ForsythCacheSize + 3);
+
+		size_t scanCursor = 0;	///< キャッシュから候補が出ない時に次に見る三角形（前にしか進まない）
+		int bestTriangle = -1;
+
+		for (size_t emitted = 0; emitted < triangleCount; emitted++)
+		{
+			// キャッシュ由来の候補が無い場合は、入力順で次の未出力三角形から再開する
+			// （毎回全三角形のスコアを比べると O(T^2) になるため。カーソルは戻らないので全体で O(T)）
+			if (bestTriangle < 0)
+			{
+				while (scanCursor < triangleCount && triangleEmitted[scanCursor])
+				{
+					scanCursor++;
+				}
+				assert(scanCursor < triangleCount);
+				bestTriangle = static_cast<int>(scanCursor);
+			}
+
+			const size_t tri = static_cast<size_t>(bestTriangle);
+			triangleEmitted[tri] = true;
+
+			// 出力し、各頂点の隣接リストからこの三角形を外す
+			for (size_t k = 0; k < 3; k++)
+			{
+				const unsigned int v = _indices[tri * 3 + k];
+				outIndices.push_back(v);
+
+				unsigned int* begin = adjacency.data() + adjacencyOffset[v];
+				unsigned int* end = begin + remainingValence[v];
+				unsigned int* found = std::find(begin, end, static_cast<unsigned int>(tri));
+				assert(found != end);
+				std::swap(*found, *(end - 1));
+				remainingValence[v]--;
+			}
+
+			// LRU キャッシュを更新（出力した三角形の頂点を先頭に）
+			nextCache.clear();
+			for (size_t k = 0; k < 3; k++)
+			{
+				// 縮退三角形で同じ頂点が重複しないようにする
+				const unsigned int v = _indices[tri * 3 + k];
+				if (std::find(nextCache.begin(), nextCache.end(), v) == nextCache.end())
+				{
+					nextCache.push_back(v);
+				}
+			}
+			const size_t headCount = nextCache.size();
+			for (unsigned int v : cache)
+			{
+				if (std::find(nextCache.begin(), nextCache.begin() + headCount, v) == nextCache.begin() + headCount)
+				{
+					nextCache.push_back(v);
+				}
+			}
+
+			// 溢れた頂点はキャッシュ外に戻す
+			for (size_t i = ForsythCacheSize; i < nextCache.size(); i++)
+			{
+				cachePosition[nextCache[i]] = -1;
+				vertexScore[nextCache[i]] = ::ComputeVertexScore(-1, remainingValence[nextCache[i]]);
+			}
+			if (nextCache.size() > ForsythCacheSize)
+			{
+				nextCache.resize(ForsythCacheSize);
+			}
+			cache.swap(nextCache);
+
+			// キャッシュ内頂点のスコアを更新し、その隣接三角形から次の候補を選ぶ
+			for (size_t i = 0; i < cache.size(); i++)
+			{
+				const unsigned int v = cache[i];
+				cachePosition[v] = static_cast<int>(i);
+				vertexScore[v] = ::ComputeVertexScore(cachePosition[v], remainingValence[v]);
+			}
+
+			bestTriangle = -1;
+			float bestScore = -FLT_MAX;
+			for (unsigned int v : cache)
+			{
+				for (unsigned int a = 0; a < remainingValence[v]; a++)
+				{
+					const unsigned int adjTri = adjacency[adjacencyOffset[v] + a];
+					const float score =
+						vertexScore[_indices[adjTri * 3 + 0]] +
+						vertexScore[_indices[adjTri * 3 + 1]] +
+						vertexScore[_indices[adjTri * 3 + 2]];
+
+					if (score > bestScore)
+					{
+						bestScore = score;
+						bestTriangle = static_cast<int>(adjTri);
+					}
+				}
+			}
+		}
+
+		// 端数（3 の倍数に満たない分）はそのまま残す
+		for (size_t i = triangleCount * 3; i < _indices.size(); i++)
+		{
+			outIndices.push_back(_indices[i]);
+		}
+
+		_indices = std::move(outIndices);
+	}
+
+	//-----------------------------------------------------------------------------
+	// OptimizeVertexFetch
+	//-----------------------------------------------------------------------------
+	/** @brief インデックスから参照される順に頂点を並べ替える（参照されない頂点は取り除く）
+	 *  @param _vertices 入出力頂点配列
+	 *  @param _indices 入出力インデックス配列
+	 *  @return 旧頂点番号 -> 新頂点番号 の対応表（取り除いた頂点は UINT_MAX）
+	 */
+	std::vector<unsigned int> OptimizeVertexFetch(std::vector<Vertex>& _vertices, std::vector<unsigned int>& _indices)
+	{
+		std::vector<unsigned int> remap(_vertices.size(), UINT_MAX);
+
+		std::vector<Vertex> orderedVertices;
+		orderedVertices.reserve(_vertices.size());
+
+		for (auto& index : _indices)
+		{
+			assert(index < remap.size());
+
+			if (remap[index] == UINT_MAX)
+			{
+				remap[index] = static_cast<unsigned int>(orderedVertices.size());
+				orderedVertices.push_back(std::move(_vertices[index]));
+			}
+			index = remap[index];
+		}
+
+		_vertices = std::move(orderedVertices);
+		return remap;
+	}
+
+	//-----------------------------------------------------------------------------
+	// ComputeACMR
+	//-----------------------------------------------------------------------------
+	/** @brief FIFO キャッシュを模擬して ACMR（三角形あたりのキャッシュミス数）を求める
+	 *  @param _indices インデックス配列（三角形リスト）
+	 *  @param _vertexCount 頂点数
+	 *  @param _cacheSize キャッシュ長
+	 *  @return ACMR（三角形が無い場合は 0）
+	 */
+	float ComputeACMR(const std::vector<unsigned int>& _indices, size_t _vertexCount, unsigned int _cacheSize)
+	{
+		const size_t triangleCount = _indices.size() / 3;
+		if (triangleCount == 0 || _cacheSize == 0)
+		{
+			return 0.0f;
+		}
+
+		// 頂点ごとに「キャッシュに入った時刻」を持ち、FIFO の出入りを時刻差で判定する
+		std::vector<size_t> insertedAt(_vertexCount, 0);
+		size_t timestamp = _cacheSize + 1;
+		size_t missCount = 0;
+
+		for (size_t i = 0; i < triangleCount * 3; i++)
+		{
+			const unsigned int v = _indices[i];
+			assert(v < _vertexCount);
+
+			if (timestamp - insertedAt[v] > _cacheSize)
+			{
+				insertedAt[v] = timestamp;
+				timestamp++;
+				missCount++;
+			}
+		}
+
+		return static_cast<float>(missCount) / static_cast<float>(triangleCount);
+	}
+
+	//-----------------------------------------------------------------------------
+	// Optimize
+	//-----------------------------------------------------------------------------
+	/** @brief 溶接・キャッシュ最適化・フェッチ最適化をまとめて適用する
+	 *  @param _vertices 入出力頂点配列
+	 *  @param _indices 入出力インデックス配列
+	 *  @param _outStats 計測値の出力先（nullptr 可）
+	 *  @return 旧頂点番号 -> 新頂点番号 の対応表（取り除いた頂点は UINT_MAX）
+	 */
+	std::vector<unsigned int> Optimize(std::vector<Vertex>& _vertices, std::vector<unsigned int>& _indices, Stats* _outStats)
+	{
+		const size_t sourceVertexCount = _vertices.size();
+		const float acmrBefore = ComputeACMR(_indices, sourceVertexCount);
+
+		// 溶接 -> 三角形順 -> 頂点順 の順に適用する（頂点順は三角形順に依存するため最後）
+		std::vector<unsigned int> weldRemap = WeldVertices(_vertices, _indices);
+		OptimizeVertexCache(_indices, _vertices.size());
+		std::vector<unsigned int> fetchRemap = OptimizeVertexFetch(_vertices, _indices);
+
+		// 2 段の対応表を合成する
+		std::vector<unsigned int> remap(sourceVertexCount, UINT_MAX);
+		for (size_t v = 0; v < sourceVertexCount; v++)
+		{
+			remap[v] = fetchRemap[weldRemap[v]];
+		}
+
+		if (_outStats)
+		{
+			_outStats->sourceVertexCount = sourceVertexCount;
+			_outStats->vertexCount = _vertices.size();
+			_outStats->indexCount = _indices.size();
+			_outStats->acmrBefore = acmrBefore;
+			_outStats->acmrAfter = ComputeACMR(_indices, _vertices.size());
+		}
+
+		return remap;
+	}
+
+	//-----------------------------------------------------------------------------
+	// SelfTest
+	//-----------------------------------------------------------------------------
+	/** @brief 三角形順をシャッフルした溶接前の格子で、溶接・ACMR・バッファサイズ・形状の保存を検証する
+	 *  @return 全ての確認を満たせば true
+	 */
+	bool RunSelfTest()
+	{
+		// 格子の FIFO 16 での ACMR は理想的な並びで 0.6 前後。シャッフル直後は 3.0（全頂点がミス）
+		constexpr float MaxAcmrAfter = 0.8f;
+
+		bool passed = true;
+		for (uint32_t quads : { 16u, 64u, 128u, 256u })
+		{
+			std::vector<Vertex> vertices;
+			std::vector<unsigned int> indices;
+			::BuildShuffledGrid(quads, vertices, indices);
+			const auto sourceTriangles = ::CollectTriangles(vertices, indices);
+
+			const auto begin = std::chrono::steady_clock::now();
+			Stats stats{};
+			const std::vector<unsigned int> remap = Optimize(vertices, indices, &stats);
+			const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+			// 格子の頂点は (quads + 1)^2 個に溶接され、三角形は位置・巻き順とも変わらない
+			const size_t expectedVertices = static_cast<size_t>(quads + 1) * (quads + 1);
+			bool ok = stats.vertexCount == expectedVertices && vertices.size() == expectedVertices;
+			ok = ok && remap.size() == stats.sourceVertexCount;
+			ok = ok && std::all_of(indices.begin(), indices.end(), [&](unsigned int _index) { return _index < vertices.size(); });
+			ok = ok && ::CollectTriangles(vertices, indices) == sourceTriangles;
+			ok = ok && stats.acmrAfter <= MaxAcmrAfter && stats.acmrAfter < stats.acmrBefore;
+
+			// バッファサイズは MeshManager::CreateFromModelData が作る GPU 頂点/インデックス基準
+			const size_t indexStride = (stats.vertexCount <= MaxIndex16VertexCount) ? sizeof(uint16_t) : sizeof(uint32_t);
+			const size_t vbBefore = stats.sourceVertexCount * sizeof(ModelVertexGPU);
+			const size_t vbAfter = stats.vertexCount * sizeof(ModelVertexGPU);
+			const size_t ibBefore = stats.indexCount * sizeof(uint32_t);
+			const size_t ibAfter = stats.indexCount * indexStride;
+			ok = ok && vbAfter < vbBefore && ibAfter <= ibBefore;
+
+			std::cout << "[MeshOptimizer] SelfTest grid " << quads << "x" << quads
+				<< ": vertices " << stats.sourceVertexCount << " -> " << stats.vertexCount
+				<< ", VB " << vbBefore << " -> " << vbAfter << " bytes"
+				<< ", IB " << ibBefore << " -> " << ibAfter << " bytes"
+				<< ", ACMR " << stats.acmrBefore << " -> " << stats.acmrAfter
+				<< ", " << milliseconds << " ms" << (ok ? " OK" : " FAILED") << std::endl;
+			passed = passed && ok;
+		}
+
+		std::cout << "[MeshOptimizer] SelfTest " << (passed ? "passed" : "FAILED") << std::endl;
+		return passed;
+	}
+
+	/** @brief コマンドライン引数を解釈してセルフテストを実行する
+	 *  @param _argc 引数の数
+	 *  @param _argv 引数
+	 *  @param _outExitCode 終了コード
+	 *  @return セルフテスト用の引数だった場合 true（アプリケーションは起動しない）
+	 */
+	bool RunCommandLine(int _argc, char** _argv, int& _outExitCode)
+	{
+		if (_argc < 2 || std::string(_argv[1]) != "--mesh-optimizer-selftest") { return false; }
+
+		_outExitCode = RunSelfTest() ? 0 : 1;
+		return true;
+	}
+} // namespace Graphics::Import::MeshOptimizer
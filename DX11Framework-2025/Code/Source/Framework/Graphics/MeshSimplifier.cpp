@@ -0,0 +1,463 @@
+﻿/** @file   MeshSimplifier.cpp
+ *  @brief  インポート時の LOD 生成（Quadric Error Metrics による簡略化）
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Graphics/MeshSimplifier.h"
+#include "Include/Framework/Graphics/MeshOptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <queue>
+#include <unordered_map>
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	/** @struct Quadric
+	 *  @brief 平面群への二乗距離和を表す対称 4x4 行列（上三角 10 要素）
+	 */
+	struct Quadric
+	{
+		double a2 = 0, ab = 0, ac = 0, ad = 0;
+		double b2 = 0, bc = 0, bd = 0;
+		double c2 = 0, cd = 0;
+		double d2 = 0;
+
+		/** @brief 平面 ax + by + cz + d = 0 から作る
+		 */
+		static Quadric FromPlane(double _a, double _b, double _c, double _d)
+		{
+			Quadric q{};
+			q.a2 = _a * _a; q.ab = _a * _b; q.ac = _a * _c; q.ad = _a * _d;
+			q.b2 = _b * _b; q.bc = _b * _c; q.bd = _b * _d;
+			q.c2 = _c * _c; q.cd = _c * _d;
+			q.d2 = _d * _d;
+			return q;
+		}
+
+		Quadric& operator+=(const Quadric& _other)
+		{
+			a2 += _other.a2; ab += _other.ab; ac += _other.ac; ad += _other.ad;
+			b2 += _other.b2; bc += _other.bc; bd += _other.bd;
+			c2 += _other.c2; cd += _other.cd;
+			d2 += _other.d2;
+			return *this;
+		}
+
+		/** @brief 点 p における誤差（二乗距離和）
+		 */
+		double Evaluate(const std::array<double, 3>& _p) const
+		{
+			const double x = _p[0], y = _p[1], z = _p[2];
+			const double value =
+				a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x +
+				b2 * y * y + 2 * bc * y * z + 2 * bd * y +
+				c2 * z * z + 2 * cd * z +
+				d2;
+			return std::max(value, 0.0);
+		}
+	};
+
+	/** @struct Collapse
+	 *  @brief 畳み込み候補（from を to へ寄せる）
+	 */
+	struct Collapse
+	{
+		double cost = 0.0;
+		unsigned int from = 0;
+		unsigned int to = 0;
+		unsigned int fromVersion = 0;
+		unsigned int toVersion = 0;
+
+		bool operator>(const Collapse& _other) const { return cost > _other.cost; }
+	};
+
+	static constexpr double MaxNormalDeviation = 0.5;	///< 畳み込み前後の面法線の cos がこれ未満なら裏返り扱い（約 60 度）
+
+	using Vec3d = std::array<double, 3>;
+
+	static Vec3d Sub(const Vec3d& _a, const Vec3d& _b) { return { _a[0] - _b[0], _a[1] - _b[1], _a[2] - _b[2] }; }
+
+	static Vec3d Cross(const Vec3d& _a, const Vec3d& _b)
+	{
+		return { _a[1] * _b[2] - _a[2] * _b[1], _a[2] * _b[0] - _a[0] * _b[2], _a[0] * _b[1] - _a[1] * _b[0] };
+	}
+
+	static double Dot(const Vec3d& _a, const Vec3d& _b) { return _a[0] * _b[0] + _a[1] * _b[1] + _a[2] * _b[2]; }
+
+	/** @brief 頂点の支配ボーン（最大ウェイトのボーン）を返す
+	 *  @return ウェイトが無い場合は -1
+	 */
+	static int DominantBone(const Graphics::Import::Vertex& _vertex)
+	{
+		int bone = -1;
+		float weight = 0.0f;
+		for (int slot = 0; slot < 4; slot++)
+		{
+			if (_vertex.boneWeight[slot] > weight)
+			{
+				weight = _vertex.boneWeight[slot];
+				bone = static_cast<int>(_vertex.boneIndex[slot]);
+			}
+		}
+		return bone;
+	}
+
+	/** @brief 位置が同じ頂点をまとめるためのキー
+	 */
+	static uint64_t PositionHash(const Graphics::Import::Vertex& _vertex)
+	{
+		float p[3] = { _vertex.pos.x, _vertex.pos.y, _vertex.pos.z };
+		uint64_t hash = 14695981039346656037ull;
+		for (float f : p)
+		{
+			f = (f == 0.0f) ? 0.0f : f;
+			uint32_t bits = 0;
+			std::memcpy(&bits, &f, sizeof(bits));
+			hash ^= bits;
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Namespace : Graphics::Import::MeshSimplifier
+//-----------------------------------------------------------------------------
+namespace Graphics::Import::MeshSimplifier
+{
+	//-----------------------------------------------------------------------------
+	// Simplify
+	//-----------------------------------------------------------------------------
+	/** @brief インデックスを目標数まで簡略化する
+	 *  @param _vertices 頂点配列（変更しない）
+	 *  @param _indices 元のインデックス配列（三角形リスト）
+	 *  @param _targetIndexCount 目標インデックス数
+	 *  @param _outError 発生した最大誤差（オブジェクト空間の距離、nullptr 可）
+	 *  @return 簡略化後のインデックス配列（_vertices を参照する）
+	 */
+	std::vector<unsigned int> Simplify(
+		const std::vector<Vertex>& _vertices,
+		const std::vector<unsigned int>& _indices,
+		size_t _targetIndexCount,
+		float* _outError)
+	{
+		const size_t vertexCount = _vertices.size();
+		const size_t triangleCount = _indices.size() / 3;
+		const size_t targetTriangleCount = _targetIndexCount / 3;
+
+		if (_outError) { *_outError = 0.0f; }
+		if (triangleCount <= targetTriangleCount || vertexCount == 0)
+		{
+			return _indices;
+		}
+
+		//-----------------------------------------------------------------------------
+		// 位置ごとのグループ化（UV シーム検出・位置ベースの境界検出用）
+		//-----------------------------------------------------------------------------
+		std::vector<unsigned int> positionId(vertexCount, 0);
+		std::vector<unsigned int> positionGroupSize;
+		{
+			std::unordered_map<uint64_t, unsigned int> positionTable;
+			positionTable.reserve(vertexCount);
+			for (size_t v = 0; v < vertexCount; v++)
+			{
+				auto [it, inserted] = positionTable.emplace(::PositionHash(_vertices[v]), static_cast<unsigned int>(positionGroupSize.size()));
+				if (inserted)
+				{
+					positionGroupSize.push_back(0);
+				}
+				positionId[v] = it->second;
+				positionGroupSize[it->second]++;
+			}
+		}
+
+		std::vector<bool> locked(vertexCount, false);
+		for (size_t v = 0; v < vertexCount; v++)
+		{
+			// 同じ位置に別属性の頂点がある＝UV シームなどの割れ目。動かすと穴が開くので固定する
+			locked[v] = positionGroupSize[positionId[v]] > 1;
+		}
+
+		// 位置ベースで 1 枚の三角形にしか使われない辺＝境界。輪郭が縮まないよう固定する
+		{
+			std::unordered_map<uint64_t, int> edgeUse;
+			edgeUse.reserve(triangleCount * 3);
+			auto edgeKey = [&](unsigned int _a, unsigned int _b)
+			{
+				uint64_t pa = positionId[_a], pb = positionId[_b];
+				if (pa > pb) { std::swap(pa, pb); }
+				return (pa << 32) | pb;
+			};
+
+			for (size_t tri = 0; tri < triangleCount; tri++)
+			{
+				for (int k = 0; k < 3; k++)
+				{
+					edgeUse[edgeKey(_indices[tri * 3 + k], _indices[tri * 3 + (k + 1) % 3])]++;
+				}
+			}
+			for (size_t tri = 0; tri < triangleCount; tri++)
+			{
+				for (int k = 0; k < 3; k++)
+				{
+					const unsigned int a = _indices[tri * 3 + k];
+					const unsigned int b = _indices[tri * 3 + (k + 1) % 3];
+					if (edgeUse[edgeKey(a, b)] == 1)
+					{
+						locked[a] = true;
+						locked[b] = true;
+					}
+				}
+			}
+		}
+
+		//-----------------------------------------------------------------------------
+		// 三角形・隣接・Quadric の初期化
+		//-----------------------------------------------------------------------------
+		std::vector<Vec3d> positions(vertexCount);
+		std::vector<int> dominantBone(vertexCount, -1);
+		for (size_t v = 0; v < vertexCount; v++)
+		{
+			positions[v] = { _vertices[v].pos.x, _vertices[v].pos.y, _vertices[v].pos.z };
+			dominantBone[v] = ::DominantBone(_vertices[v]);
+		}
+
+		std::vector<std::array<unsigned int, 3>> triangles(triangleCount);
+		std::vector<bool> triangleAlive(triangleCount, true);
+		std::vector<std::vector<unsigned int>> vertexTriangles(vertexCount);
+		std::vector<::Quadric> quadrics(vertexCount);
+
+		size_t aliveTriangleCount = 0;
+		for (size_t tri = 0; tri < triangleCount; tri++)
+		{
+			auto& t = triangles[tri];
+			t = { _indices[tri * 3 + 0], _indices[tri * 3 + 1], _indices[tri * 3 + 2] };
+			assert(t[0] < vertexCount && t[1] < vertexCount && t[2] < vertexCount);
+
+			if (t[0] == t[1] || t[1] == t[2] || t[0] == t[2])
+			{
+				triangleAlive[tri] = false;
+				continue;
+			}
+			aliveTriangleCount++;
+
+			Vec3d normal = ::Cross(::Sub(positions[t[1]], positions[t[0]]), ::Sub(positions[t[2]], positions[t[0]]));
+			const double length = std::sqrt(::Dot(normal, normal));
+			if (length > 0.0)
+			{
+				normal = { normal[0] / length, normal[1] / length, normal[2] / length };
+				const double d = -::Dot(normal, positions[t[0]]);
+				const ::Quadric plane = ::Quadric::FromPlane(normal[0], normal[1], normal[2], d);
+				for (unsigned int v : t)
+				{
+					quadrics[v] += plane;
+				}
+			}
+
+			for (unsigned int v : t)
+			{
+				vertexTriangles[v].push_back(static_cast<unsigned int>(tri));
+			}
+		}
+
+		std::vector<bool> vertexAlive(vertexCount, true);
+		std::vector<unsigned int> version(vertexCount, 0);
+
+		std::priority_queue<::Collapse, std::vector<::Collapse>, std::greater<::Collapse>> heap;
+
+		// from -> to の候補を積む（from が固定頂点・ボーン不一致なら積まない）
+		auto pushCandidate = [&](unsigned int _from, unsigned int _to)
+		{
+			if (locked[_from] || _from == _to)
+			{
+				return;
+			}
+			if (dominantBone[_from] != dominantBone[_to])
+			{
+				return;
+			}
+
+			::Quadric merged = quadrics[_from];
+			merged += quadrics[_to];
+
+			::Collapse collapse{};
+			collapse.cost = merged.Evaluate(positions[_to]);
+			collapse.from = _from;
+			collapse.to = _to;
+			collapse.fromVersion = version[_from];
+			collapse.toVersion = version[_to];
+			heap.push(collapse);
+		};
+
+		for (size_t tri = 0; tri < triangleCount; tri++)
+		{
+			if (!triangleAlive[tri]) { continue; }
+			const auto& t = triangles[tri];
+			for (int k = 0; k < 3; k++)
+			{
+				pushCandidate(t[k], t[(k + 1) % 3]);
+				pushCandidate(t[(k + 1) % 3], t[k]);
+			}
+		}
+
+		//-----------------------------------------------------------------------------
+		// コストの小さい順に畳み込む
+		//-----------------------------------------------------------------------------
+		double maxCost = 0.0;
+
+		while (aliveTriangleCount > targetTriangleCount && !heap.empty())
+		{
+			const ::Collapse collapse = heap.top();
+			heap.pop();
+
+			const unsigned int from = collapse.from;
+			const unsigned int to = collapse.to;
+
+			// 古くなった候補は捨てる
+			if (!vertexAlive[from] || !vertexAlive[to]) { continue; }
+			if (version[from] != collapse.fromVersion || version[to] != collapse.toVersion) { continue; }
+
+			// まだ辺でつながっているか、畳み込みで裏返る三角形が無いかを確認
+			bool connected = false;
+			bool flipped = false;
+			for (unsigned int tri : vertexTriangles[from])
+			{
+				if (!triangleAlive[tri]) { continue; }
+				const auto& t = triangles[tri];
+				if (t[0] == to || t[1] == to || t[2] == to)
+				{
+					connected = true;
+					continue;
+				}
+
+				Vec3d before[3] = { positions[t[0]], positions[t[1]], positions[t[2]] };
+				Vec3d after[3] = { before[0], before[1], before[2] };
+				for (int k = 0; k < 3; k++)
+				{
+					if (t[k] == from) { after[k] = positions[to]; }
+				}
+
+				const Vec3d normalBefore = ::Cross(::Sub(before[1], before[0]), ::Sub(before[2], before[0]));
+				const Vec3d normalAfter = ::Cross(::Sub(after[1], after[0]), ::Sub(after[2], after[0]));
+				const double lengthProduct = std::sqrt(::Dot(normalBefore, normalBefore) * ::Dot(normalAfter, normalAfter));
+				if (lengthProduct <= 0.0 || ::Dot(normalBefore, normalAfter) < MaxNormalDeviation * lengthProduct)
+				{
+					flipped = true;
+					break;
+				}
+			}
+			if (!connected || flipped) { continue; }
+
+			// 畳み込み本体
+			for (unsigned int tri : vertexTriangles[from])
+			{
+				if (!triangleAlive[tri]) { continue; }
+				auto& t = triangles[tri];
+				if (t[0] == to || t[1] == to || t[2] == to)
+				{
+					triangleAlive[tri] = false;
+					aliveTriangleCount--;
+					continue;
+				}
+
+				for (auto& v : t)
+				{
+					if (v == from) { v = to; }
+				}
+				vertexTriangles[to].push_back(tri);
+			}
+
+			vertexTriangles[from].clear();
+			vertexAlive[from] = false;
+			quadrics[to] += quadrics[from];
+			version[to]++;
+			maxCost = std::max(maxCost, collapse.cost);
+
+			// 死んだ三角形を掃除しつつ、周辺の候補を積み直す
+			auto& toTriangles = vertexTriangles[to];
+			toTriangles.erase(
+				std::remove_if(toTriangles.begin(), toTriangles.end(), [&](unsigned int _tri) { return !triangleAlive[_tri]; }),
+				toTriangles.end());
+
+			for (unsigned int tri : toTriangles)
+			{
+				for (unsigned int neighbor : triangles[tri])
+				{
+					if (neighbor == to) { continue; }
+					pushCandidate(to, neighbor);
+					pushCandidate(neighbor, to);
+				}
+			}
+		}
+
+		//-----------------------------------------------------------------------------
+		// 出力
+		//-----------------------------------------------------------------------------
+		std::vector<unsigned int> outIndices;
+		outIndices.reserve(aliveTriangleCount * 3);
+		for (size_t tri = 0; tri < triangleCount; tri++)
+		{
+			if (!triangleAlive[tri]) { continue; }
+			for (unsigned int v : triangles[tri])
+			{
+				outIndices.push_back(v);
+			}
+		}
+
+		if (_outError) { *_outError = static_cast<float>(std::sqrt(maxCost)); }
+		return outIndices;
+	}
+
+	//-----------------------------------------------------------------------------
+	// BuildLodChain
+	//-----------------------------------------------------------------------------
+	/** @brief LodTriangleRatios に従って LOD 列を作る
+	 *  @param _vertices 頂点配列
+	 *  @param _indices 基本メッシュのインデックス配列
+	 *  @return LOD 列（粗くなる順。作れない場合は空）
+	 */
+	std::vector<LodLevel> BuildLodChain(const std::vector<Vertex>& _vertices, const std::vector<unsigned int>& _indices)
+	{
+		std::vector<LodLevel> lods;
+
+		const size_t baseTriangleCount = _indices.size() / 3;
+		if (baseTriangleCount < MinLodTriangleCount)
+		{
+			return lods;
+		}
+
+		size_t previousIndexCount = _indices.size();
+		for (size_t level = 0; level < MaxLodLevels; level++)
+		{
+			const size_t targetIndexCount = static_cast<size_t>(static_cast<float>(baseTriangleCount) * LodTriangleRatios[level]) * 3;
+
+			// 誤差を正しく測るため、毎回基本メッシュから簡略化する
+			LodLevel lod{};
+			lod.indices = Simplify(_vertices, _indices, targetIndexCount, &lod.error);
+
+			// シームや境界の固定でほとんど減らなくなったら以降は作らない
+			if (static_cast<float>(lod.indices.size()) > static_cast<float>(previousIndexCount) * MinLodReduction)
+			{
+				break;
+			}
+
+			MeshOptimizer::OptimizeVertexCache(lod.indices, _vertices.size());
+
+			previousIndexCount = lod.indices.size();
+			lods.push_back(std::move(lod));
+		}
+
+		return lods;
+	}
+} // namespace Graphics::Import::MeshSimplifier
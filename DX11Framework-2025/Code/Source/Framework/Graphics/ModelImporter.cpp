@@ -7,6 +7,8 @@
  *  主な責務:
  *   - マテリアルとテクスチャの読み込み
  *   - 頂点バッファおよびインデックスバッファの構築
+ *   - 頂点の溶接と頂点キャッシュ/フェッチ向けの並べ替え
+ *   - 簡略化した LOD 列の生成
  *   - サブセット情報の作成
  *   - ボーン辞書と頂点ウェイトの収集と正規化
  *   - ノード階層からのツリーノード構築
@@ -17,12 +19,16 @@
 // Includes
 //-----------------------------------------------------------------------------
 #include "Include/Framework/Graphics/ModelImporter.h"
+#include "Include/Framework/Graphics/MeshOptimizer.h"
+#include "Include/Framework/Graphics/MeshSimplifier.h"
+#include "Include/Framework/Graphics/VertexTypes.h"
 #include "Include/Framework/Utils/TreeNode.h"
 
 #include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cfloat>
+#include <climits>
 #include <cstring>
 #include <iostream>
 #include <optional>
@@ -512,12 +518,12 @@ namespace Graphics::Import
 			::TryGetColor(material, AI_MATKEY_COLOR_EMISSIVE, outMaterial.emission);
 			::TryGetShininess(material, outMaterial.shiness);
 
-			// テクスチャのパスを取得して TextureLoader で読み込む（存在しない場合は nullptr）
+			// テクスチャのパスを取得して TextureLoader で読み込む（存在しない場合は nullptr、同じ画像は共有される）
 			outMaterial.diffuseTextureName = ::GetDiffuseTexturePath(material);
 			if (!outMaterial.diffuseTextureName.empty())
 			{
 				const std::string textureFullPath = ::MakeTextureFullPath(_textureDir, outMaterial.diffuseTextureName);
-				_modelData.diffuseTextures[materialIndex] = textureLoader->FromFile(textureFullPath);
+				_modelData.diffuseTextures[materialIndex] = textureLoader->AcquireShared(textureFullPath);
 			}
 			else
 			{
@@ -677,6 +683,7 @@ namespace Graphics::Import
 			Subset subset{};
 		subset.meshName = mesh->mName.C_Str();
 		subset.materialIndex = static_cast<int>(mesh->mMaterialIndex);
+			subset.meshIndex = meshIndex;
 
 			if (subset.materialIndex >= 0 && static_cast<size_t>(subset.materialIndex) < _modelData.materials.size())
 			{
@@ -902,6 +909,109 @@ namespace Graphics::Import
 		}
 	}
 
+	//-----------------------------------------------------------------------------
+	// OptimizeMeshBuffers
+	//-----------------------------------------------------------------------------
+	/** @brief メッシュごとに頂点の溶接・三角形順/頂点順の最適化を行う
+	 *  @details
+	 *      - ボーンウェイトも溶接判定に含めるため BuildBonesAndSkinWeights の後に呼ぶ
+	 *      - Bone::weights が持つ頂点番号は新しい番号に付け替える
+	 *  @param _modelData 入出力モデルデータ
+	 */
+	void ModelImporter::OptimizeMeshBuffers(ModelData& _modelData) const
+	{
+		const size_t meshCount = std::min(_modelData.vertices.size(), _modelData.indices.size());
+
+		std::vector<std::vector<unsigned int>> remapPerMesh(meshCount);
+
+		for (size_t meshIndex = 0; meshIndex < meshCount; meshIndex++)
+		{
+			auto& vertices = _modelData.vertices[meshIndex];
+			auto& indices = _modelData.indices[meshIndex];
+			if (vertices.empty() || indices.empty())
+			{
+				continue;
+			}
+
+			remapPerMesh[meshIndex] = MeshOptimizer::Optimize(vertices, indices);
+		}
+
+		// Bone::weights の頂点番号を付け替える（溶接で消えた頂点は取り除く）
+		for (auto& [boneName, bone] : _modelData.boneDictionary)
+		{
+			auto& weights = bone.weights;
+			for (auto& weight : weights)
+			{
+				if (weight.meshIndex < 0 || static_cast<size_t>(weight.meshIndex) >= meshCount)
+				{
+					continue;
+				}
+
+				const auto& remap = remapPerMesh[static_cast<size_t>(weight.meshIndex)];
+				if (remap.empty() || weight.vertexIndex < 0 || static_cast<size_t>(weight.vertexIndex) >= remap.size())
+				{
+					continue;
+				}
+
+				const unsigned int newIndex = remap[static_cast<size_t>(weight.vertexIndex)];
+				weight.vertexIndex = (newIndex == UINT_MAX) ? -1 : static_cast<int>(newIndex);
+			}
+
+			weights.erase(
+				std::remove_if(weights.begin(), weights.end(), [](const Weight& _weight) { return _weight.vertexIndex < 0; }),
+				weights.end());
+			std::sort(
+				weights.begin(),
+				weights.end(),
+				[](const Weight& a, const Weight& b)
+				{
+					return (a.meshIndex != b.meshIndex) ? (a.meshIndex < b.meshIndex) : (a.vertexIndex < b.vertexIndex);
+				});
+			weights.erase(
+				std::unique(
+					weights.begin(),
+					weights.end(),
+					[](const Weight& a, const Weight& b)
+					{
+						return a.meshIndex == b.meshIndex && a.vertexIndex == b.vertexIndex;
+					}),
+				weights.end());
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// BuildLods
+	//-----------------------------------------------------------------------------
+	/** @brief メッシュごとに簡略化した LOD 列を構築する
+	 *  @details 頂点配列は共有し、インデックスのみを LOD ごとに持つ
+	 *  @param _modelData 入出力モデルデータ（lods を更新）
+	 */
+	void ModelImporter::BuildLods(ModelData& _modelData) const
+	{
+		const size_t meshCount = std::min(_modelData.vertices.size(), _modelData.indices.size());
+
+		_modelData.lods.clear();
+		_modelData.lods.resize(meshCount);
+
+		for (size_t meshIndex = 0; meshIndex < meshCount; meshIndex++)
+		{
+			_modelData.lods[meshIndex] = MeshSimplifier::BuildLodChain(_modelData.vertices[meshIndex], _modelData.indices[meshIndex]);
+
+			const auto& lods = _modelData.lods[meshIndex];
+			if (lods.empty())
+			{
+				continue;
+			}
+
+			std::cout << "[ModelImporter] LOD: mesh " << meshIndex << " triangles " << _modelData.indices[meshIndex].size() / 3;
+			for (const auto& lod : lods)
+			{
+				std::cout << " -> " << lod.indices.size() / 3 << " (err " << lod.error << ")";
+			}
+			std::cout << std::endl;
+		}
+	}
+
 	//-----------------------------------------------------------------------------
 	// Debug: Stick_Body(meshRoot) と mixamorig:Hips の関係を出力
 	// BuildSkeletonCache の nodeNameToIndex を作った後、nodeCount を確認した後に呼ぶ
@@ -1545,12 +1655,24 @@ namespace Graphics::Import
 		_outModel.materials.clear();
 		_outModel.diffuseTextures.clear();
 		_outModel.subsets.clear();
+		_outModel.lods.clear();
 		_outModel.boneDictionary.clear();
+		_outModel.vertexFormat = this->vertexFormat;
 
 		BuildMaterials(scene, _outModel, _textureDir);
 		BuildMeshBuffers(scene, _outModel);
-		BuildSubsets(scene, _outModel, false); // 分離バッファ版
 		BuildBonesAndSkinWeights(scene, _outModel);
+
+		// 溶接で頂点数が変わるため、サブセットは最適化の後に作る
+		if (this->enableMeshOptimize)
+		{
+			OptimizeMeshBuffers(_outModel);
+		}
+		if (this->enableLodGeneration)
+		{
+			BuildLods(_outModel);
+		}
+		BuildSubsets(scene, _outModel, false); // 分離バッファ版
 		BuildNodeTree(scene, _outModel);
 
 		// 読み込んだデータからスケルトンキャッシュを構築
@@ -62,44 +62,80 @@ Graphics::ModelEntry* ModelManager::Register(const std::string& _key)
 		}
 	}
 
+	PreloadedModel model;
+	if (!this->Import(_key, this->modelImporter, model)) { return nullptr; }
+
+	return this->Commit(std::move(model));
+}
+
+ModelManager::PreloadedModel ModelManager::Preload(const std::string& _key) const
+{
+	// インポーターはスレッドをまたいで使えないので、設定だけ写した新しいものを使う
+	Graphics::Import::ModelImporter importer;
+	importer.SetMeshOptimizeEnabled(this->modelImporter.IsMeshOptimizeEnabled());
+	importer.SetLodGenerationEnabled(this->modelImporter.IsLodGenerationEnabled());
+	importer.SetVertexFormat(this->modelImporter.GetVertexFormat());
+
+	PreloadedModel model;
+	this->Import(_key, importer, model);
+	return model;
+}
+
+bool ModelManager::Import(const std::string& _key, Graphics::Import::ModelImporter& _importer, PreloadedModel& _outModel) const
+{
+	_outModel.key = _key;
+
 	// 読み込み情報が無いなら登録できない
 	auto infoIt = this->modelInfoTable.find(_key);
 	if (infoIt == this->modelInfoTable.end())
 	{
 		std::cerr << "[Error] ModelManager::Register: ModelInfo not found: " << _key << std::endl;
-		return nullptr;
+		return false;
 	}
 
 	const Graphics::ModelInfo& info = infoIt->second;
 
-	// Import して ModelData を作る
+	// Import して ModelData を作る（テクスチャはデバイスだけで作るので、ここまではワーカーで行える）
 	auto modelData = std::make_unique<Graphics::Import::ModelData>();
 	auto skeletonCache = std::make_unique<Graphics::Import::SkeletonCache>();
-	if (!this->modelImporter.Load(info.filename, info.textureDir, *modelData, *skeletonCache))
+	if (!_importer.Load(info.filename, info.textureDir, *modelData, *skeletonCache))
 	{
 		std::cerr << "[Error] ModelManager::Register: Import failed: " << _key << std::endl;
-		return nullptr;
+		return false;
 	}
 
-	// Mesh を生成して MeshManager に登録
+	_outModel.modelData = std::move(modelData);
+	_outModel.skeletonCache = std::move(skeletonCache);
+	return true;
+}
+
+Graphics::ModelEntry* ModelManager::Commit(PreloadedModel _model)
+{
+	const std::string& key = _model.key;
+
+	// 読み込みの間に登録されていたらそちらを使う
+	if (auto* existing = this->Get(key)) { return existing; }
+	if (!_model.modelData) { return nullptr; }
+
+	auto& modelData = _model.modelData;
+
+	// Mesh を生成して MeshManager に登録（内容が同じメッシュは共有される。コンテキストを使うのでメインスレッドで行う）
 	auto& meshManager = ResourceHub::Get<MeshManager>();
 
-	auto meshUnique = meshManager.CreateFromModelData(*modelData);
-	if (!meshUnique)
+	Graphics::Mesh* meshRaw = meshManager.RegisterFromModelData(key, *modelData);
+	if (!meshRaw)
 	{
-		std::cerr << "[Error] ModelManager::Register: CreateFromModelData failed: " << _key << std::endl;
+		std::cerr << "[Error] ModelManager::Register: CreateFromModelData failed: " << key << std::endl;
 		return nullptr;
 	}
-	Graphics::Mesh* meshRaw = meshUnique.get();
-	meshManager.Register(_key, meshUnique.release());
 
 	// Material を生成して MaterialManager に登録（当面 0 番のみ）
 	auto& materialManager = ResourceHub::Get<MaterialManager>();
-	const std::string matKey = MakeMaterialKey(_key, 0);
+	const std::string matKey = MakeMaterialKey(key, 0);
 	Material* matRaw = materialManager.Register(matKey);
 
-	// モデル描画用のマテリアル設定を行う(標準)
-	matRaw->shaders = ResourceHub::Get<ShaderManager>().GetShaderProgram("ModelBasic");
+	// モデル描画用のマテリアル設定を行う(メッシュの頂点形式に合わせる)
+	matRaw->shaders = ResourceHub::Get<ShaderManager>().GetModelShaderProgram(meshRaw->GetVertexFormat(), false);
 
 	// ModelData 側にテクスチャがあるなら差し替える（当面 0 番のみ）
 	if (matRaw && !modelData->diffuseTextures.empty())
@@ -115,10 +151,10 @@ Graphics::ModelEntry* ModelManager::Register(const std::string& _key)
 	entry->mesh = meshRaw;
 	entry->material = matRaw;
 	entry->SetModelData(std::move(modelData));
-	entry->SetSkeletonCache(std::move(skeletonCache));
+	entry->SetSkeletonCache(std::move(_model.skeletonCache));
 
 	Graphics::ModelEntry* entryRaw = entry.get();
-	this->modelTable.emplace(_key, std::move(entry));
+	this->modelTable.emplace(key, std::move(entry));
 
 	return entryRaw;
 }
@@ -138,25 +174,28 @@ void ModelManager::Register(const std::string& _key, std::unique_ptr<Graphics::I
 		return;
 	}
 
-	// Mesh を生成して MeshManager に登録
+	// Mesh を生成して MeshManager に登録（内容が同じメッシュは共有される）
 	auto& meshManager = ResourceHub::Get<MeshManager>();
 
-	auto meshUnique = meshManager.CreateFromModelData(*_model);
-	if (!meshUnique)
+	Graphics::Mesh* meshRaw = meshManager.RegisterFromModelData(_key, *_model);
+	if (!meshRaw)
 	{
 		std::cerr << "[Error] ModelManager::Register: CreateFromModelData failed: " << _key << std::endl;
 		return;
 	}
 
-	Graphics::Mesh* meshRaw = meshUnique.get();
-	meshManager.Register(_key, meshUnique.release());
-
 	// Material を生成して MaterialManager に登録（当面 0 番のみ）
 	auto& materialManager = ResourceHub::Get<MaterialManager>();
 
 	const std::string matKey = MakeMaterialKey(_key, 0);
 	Material* matRaw = materialManager.Register(matKey);
 
+	// モデル描画用のマテリアル設定を行う(メッシュの頂点形式に合わせる)
+	if (matRaw)
+	{
+		matRaw->shaders = ResourceHub::Get<ShaderManager>().GetModelShaderProgram(meshRaw->GetVertexFormat(), false);
+	}
+
 	if (matRaw && !_model->diffuseTextures.empty() && _model->diffuseTextures[0])
 	{
 		matRaw->albedoMap = _model->diffuseTextures[0].get();
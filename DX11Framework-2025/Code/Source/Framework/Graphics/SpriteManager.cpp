@@ -61,8 +61,8 @@ TextureResource* SpriteManager::Register(const std::string& _key)
 	auto it = this->spritePathMap.find(_key);
 	if (it == this->spritePathMap.end()) { return nullptr; }
 
-	// 画像読み込み処理
-	auto tex = this->textureLorder->FromFile(it->second);
+	// 画像読み込み処理（内容が同じ画像が読み込み済みならそれを共有する）
+	auto tex = this->textureLorder->AcquireShared(it->second);
 	if (!tex) { return nullptr; }
 
 	// 登録
@@ -82,7 +82,7 @@ void SpriteManager::Unregister(const std::string& _key)
 	auto it = this->spriteMap.find(_key);
 	if (it != this->spriteMap.end())
 	{
-		it->second.reset();			// リソースの中身（unique_ptr）を解放        
+		it->second.reset();			// リソースの参照（shared_ptr）を解放        
 		this->spriteMap.erase(it);	// キーと空のポインタをマップから削除
 	}
 }
@@ -114,4 +114,19 @@ TextureResource* SpriteManager::Get(const std::string& _key)
 	}
 
 	return this->spriteMap.at(_key).get();
+}
+
+/**	@brief	画像の登録名を探す
+ *	@param	const TextureResource* _texture	画像
+ *	@return	const std::string*	登録名、無ければ nullptr
+ */
+const std::string* SpriteManager::FindKey(const TextureResource* _texture) const
+{
+	if (!_texture) { return nullptr; }
+
+	for (const auto& [key, sprite] : this->spriteMap)
+	{
+		if (sprite.get() == _texture) { return &key; }
+	}
+	return nullptr;
 }
\ No newline at end of file
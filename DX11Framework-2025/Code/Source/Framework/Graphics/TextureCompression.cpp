@@ -0,0 +1,780 @@
+﻿/** @file   TextureCompression.cpp
+ *  @brief  CPU でのブロック圧縮（BC1 / BC3 / BC5 / BC7）エンコーダ・デコーダ
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Graphics/TextureCompression.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	inline constexpr int TexelCount = 16;				///< 1 ブロックのテクセル数
+	inline constexpr int PowerIterationCount = 8;		///< 主成分軸を求める反復回数
+	inline constexpr int Bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };	///< BC7 4bit インデックスの補間ウェイト
+	inline constexpr float Bc1Weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };	///< BC1 インデックスごとの c0 の重み
+
+	//-----------------------------------------------------------------------------
+	// Bit I/O
+	//-----------------------------------------------------------------------------
+	/** @class BitWriter
+	 *  @brief 16 バイトのブロックへ LSB から順にビットを詰める
+	 */
+	class BitWriter
+	{
+	public:
+		explicit BitWriter(uint8_t* _dst) : dst(_dst), position(0) { std::memset(_dst, 0, 16); }
+
+		void Write(uint32_t _value, uint32_t _bits)
+		{
+			for (uint32_t i = 0; i < _bits; i++, this->position++)
+			{
+				if ((_value >> i) & 1u)
+				{
+					this->dst[this->position >> 3] |= static_cast<uint8_t>(1u << (this->position & 7));
+				}
+			}
+		}
+
+	private:
+		uint8_t* dst;
+		uint32_t position;
+	};
+
+	/** @class BitReader
+	 *  @brief 16 バイトのブロックから LSB から順にビットを読む
+	 */
+	class BitReader
+	{
+	public:
+		explicit BitReader(const uint8_t* _src) : src(_src), position(0) {}
+
+		uint32_t Read(uint32_t _bits)
+		{
+			uint32_t value = 0;
+			for (uint32_t i = 0; i < _bits; i++, this->position++)
+			{
+				value |= static_cast<uint32_t>((this->src[this->position >> 3] >> (this->position & 7)) & 1u) << i;
+			}
+			return value;
+		}
+
+	private:
+		const uint8_t* src;
+		uint32_t position;
+	};
+
+	//-----------------------------------------------------------------------------
+	// Endpoint fitting
+	//-----------------------------------------------------------------------------
+	/** @brief ブロックの主成分軸を求める（共分散行列のべき乗法）
+	 *  @param _pixels テクセル（0..255）
+	 *  @param _channels 使うチャンネル数（3 または 4）
+	 *  @param _outMean 平均
+	 *  @param _outAxis 主成分軸（正規化済み）
+	 */
+	static void ComputePrincipalAxis(const float _pixels[TexelCount][4], int _channels, float _outMean[4], float _outAxis[4])
+	{
+		float minValue[4] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX };
+		float maxValue[4] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		for (int c = 0; c < 4; c++) { _outMean[c] = 0.0f; _outAxis[c] = 0.0f; }
+
+		for (int i = 0; i < TexelCount; i++)
+		{
+			for (int c = 0; c < _channels; c++)
+			{
+				_outMean[c] += _pixels[i][c];
+				minValue[c] = std::min(minValue[c], _pixels[i][c]);
+				maxValue[c] = std::max(maxValue[c], _pixels[i][c]);
+			}
+		}
+		for (int c = 0; c < _channels; c++) { _outMean[c] /= TexelCount; }
+
+		float covariance[4][4] = {};
+		for (int i = 0; i < TexelCount; i++)
+		{
+			for (int a = 0; a < _channels; a++)
+			{
+				const float da = _pixels[i][a] - _outMean[a];
+				for (int b = a; b < _channels; b++)
+				{
+					covariance[a][b] += da * (_pixels[i][b] - _outMean[b]);
+				}
+			}
+		}
+		for (int a = 0; a < _channels; a++)
+		{
+			for (int b = 0; b < a; b++) { covariance[a][b] = covariance[b][a]; }
+		}
+
+		// 初期値は範囲の対角（一様なブロックでも 0 にならないよう輝度方向を足す）
+		for (int c = 0; c < _channels; c++) { _outAxis[c] = (maxValue[c] - minValue[c]) + 1e-3f; }
+
+		for (int iteration = 0; iteration < PowerIterationCount; iteration++)
+		{
+			float next[4] = {};
+			float length = 0.0f;
+			for (int a = 0; a < _channels; a++)
+			{
+				for (int b = 0; b < _channels; b++) { next[a] += covariance[a][b] * _outAxis[b]; }
+				length += next[a] * next[a];
+			}
+			if (length <= FLT_EPSILON) { break; }
+
+			length = std::sqrt(length);
+			for (int c = 0; c < _channels; c++) { _outAxis[c] = next[c] / length; }
+		}
+
+		float length = 0.0f;
+		for (int c = 0; c < _channels; c++) { length += _outAxis[c] * _outAxis[c]; }
+		length = std::sqrt(length);
+		for (int c = 0; c < _channels; c++) { _outAxis[c] = (length > FLT_EPSILON) ? _outAxis[c] / length : 0.0f; }
+	}
+
+	/** @brief 主成分軸上の両端を端点にする
+	 *  @param _pixels テクセル
+	 *  @param _channels 使うチャンネル数
+	 *  @param _outLow 軸の負側の端点
+	 *  @param _outHigh 軸の正側の端点
+	 */
+	static void FitEndpoints(const float _pixels[TexelCount][4], int _channels, float _outLow[4], float _outHigh[4])
+	{
+		float mean[4];
+		float axis[4];
+		::ComputePrincipalAxis(_pixels, _channels, mean, axis);
+
+		float tMin = FLT_MAX;
+		float tMax = -FLT_MAX;
+		for (int i = 0; i < TexelCount; i++)
+		{
+			float t = 0.0f;
+			for (int c = 0; c < _channels; c++) { t += (_pixels[i][c] - mean[c]) * axis[c]; }
+			tMin = std::min(tMin, t);
+			tMax = std::max(tMax, t);
+		}
+
+		for (int c = 0; c < 4; c++)
+		{
+			_outLow[c] = (c < _channels) ? std::clamp(mean[c] + axis[c] * tMin, 0.0f, 255.0f) : 255.0f;
+			_outHigh[c] = (c < _channels) ? std::clamp(mean[c] + axis[c] * tMax, 0.0f, 255.0f) : 255.0f;
+		}
+	}
+
+	/** @brief インデックスを固定して端点を最小二乗で求め直す
+	 *  @param _pixels テクセル
+	 *  @param _channels 使うチャンネル数
+	 *  @param _weights テクセルごとの端点 0 の重み
+	 *  @param _outE0 端点 0
+	 *  @param _outE1 端点 1
+	 *  @return 解けた場合 true
+	 */
+	static bool SolveEndpoints(const float _pixels[TexelCount][4], int _channels, const float _weights[TexelCount], float _outE0[4], float _outE1[4])
+	{
+		float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+		float ax[4] = {}, bx[4] = {};
+		for (int i = 0; i < TexelCount; i++)
+		{
+			const float a = _weights[i];
+			const float b = 1.0f - a;
+			aa += a * a;
+			ab += a * b;
+			bb += b * b;
+			for (int c = 0; c < _channels; c++)
+			{
+				ax[c] += a * _pixels[i][c];
+				bx[c] += b * _pixels[i][c];
+			}
+		}
+
+		const float det = aa * bb - ab * ab;
+		if (std::fabs(det) <= 1e-6f) { return false; }
+
+		for (int c = 0; c < _channels; c++)
+		{
+			_outE0[c] = std::clamp((bb * ax[c] - ab * bx[c]) / det, 0.0f, 255.0f);
+			_outE1[c] = std::clamp((aa * bx[c] - ab * ax[c]) / det, 0.0f, 255.0f);
+		}
+		return true;
+	}
+
+	/** @brief RGBA8 の 4x4 ブロックを float に展開する
+	 *  @param _rgba 入力
+	 *  @param _outPixels 出力
+	 */
+	static void LoadPixels(const uint8_t _rgba[64], float _outPixels[TexelCount][4])
+	{
+		for (int i = 0; i < TexelCount; i++)
+		{
+			for (int c = 0; c < 4; c++) { _outPixels[i][c] = static_cast<float>(_rgba[i * 4 + c]); }
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// BC1
+	//-----------------------------------------------------------------------------
+	static uint16_t PackRgb565(const float _color[4])
+	{
+		const int r = std::clamp(static_cast<int>(std::lround(_color[0] * 31.0f / 255.0f)), 0, 31);
+		const int g = std::clamp(static_cast<int>(std::lround(_color[1] * 63.0f / 255.0f)), 0, 63);
+		const int b = std::clamp(static_cast<int>(std::lround(_color[2] * 31.0f / 255.0f)), 0, 31);
+		return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+	}
+
+	static void UnpackRgb565(uint16_t _packed, float _outColor[3])
+	{
+		const int r = (_packed >> 11) & 31;
+		const int g = (_packed >> 5) & 63;
+		const int b = _packed & 31;
+		_outColor[0] = static_cast<float>((r << 3) | (r >> 2));
+		_outColor[1] = static_cast<float>((g << 2) | (g >> 4));
+		_outColor[2] = static_cast<float>((b << 3) | (b >> 2));
+	}
+
+	/** @brief BC1（4 色モード）の各テクセルに最も近いインデックスを割り当てる
+	 *  @return 二乗誤差の合計
+	 */
+	static float AssignBc1Indices(const float _pixels[TexelCount][4], uint16_t _c0, uint16_t _c1, uint8_t _outIndices[TexelCount])
+	{
+		float palette[4][3];
+		::UnpackRgb565(_c0, palette[0]);
+		::UnpackRgb565(_c1, palette[1]);
+		for (int c = 0; c < 3; c++)
+		{
+			palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+			palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+		}
+
+		float total = 0.0f;
+		for (int i = 0; i < TexelCount; i++)
+		{
+			float best = FLT_MAX;
+			for (uint8_t p = 0; p < 4; p++)
+			{
+				float error = 0.0f;
+				for (int c = 0; c < 3; c++)
+				{
+					const float d = _pixels[i][c] - palette[p][c];
+					error += d * d;
+				}
+				if (error < best)
+				{
+					best = error;
+					_outIndices[i] = p;
+				}
+			}
+			total += best;
+		}
+		return total;
+	}
+
+	/** @brief BC1 のカラーブロック（8 バイト）を作る
+	 *  @param _pixels テクセル
+	 *  @param _outBlock 出力先
+	 */
+	static void EncodeBc1Color(const float _pixels[TexelCount][4], uint8_t _outBlock[8])
+	{
+		float low[4], high[4];
+		::FitEndpoints(_pixels, 3, low, high);
+
+		// 565 の量子化で端が外へ出やすいため、範囲の 1/16 だけ内側に寄せる
+		for (int c = 0; c < 3; c++)
+		{
+			const float inset = (high[c] - low[c]) / 16.0f;
+			high[c] -= inset;
+			low[c] += inset;
+		}
+
+		uint16_t c0 = ::PackRgb565(high);
+		uint16_t c1 = ::PackRgb565(low);
+		uint8_t indices[TexelCount] = {};
+		float error = ::AssignBc1Indices(_pixels, c0, c1, indices);
+
+		// 割り当てたインデックスで端点を最小二乗で求め直し、良くなった場合だけ採用する
+		float weights[TexelCount];
+		for (int i = 0; i < TexelCount; i++) { weights[i] = Bc1Weights[indices[i]]; }
+
+		float e0[4], e1[4];
+		if (::SolveEndpoints(_pixels, 3, weights, e0, e1))
+		{
+			const uint16_t refined0 = ::PackRgb565(e0);
+			const uint16_t refined1 = ::PackRgb565(e1);
+			uint8_t refinedIndices[TexelCount] = {};
+			const float refinedError = ::AssignBc1Indices(_pixels, refined0, refined1, refinedIndices);
+			if (refinedError < error)
+			{
+				c0 = refined0;
+				c1 = refined1;
+				std::memcpy(indices, refinedIndices, sizeof(indices));
+			}
+		}
+
+		// c0 > c1 で 4 色モードになるため、逆順なら入れ替えてインデックスも付け替える
+		if (c0 < c1)
+		{
+			std::swap(c0, c1);
+			for (auto& index : indices) { index ^= 1; }
+		}
+		else if (c0 == c1)
+		{
+			std::memset(indices, 0, sizeof(indices));
+		}
+
+		uint32_t packedIndices = 0;
+		for (int i = 0; i < TexelCount; i++) { packedIndices |= static_cast<uint32_t>(indices[i]) << (i * 2); }
+
+		_outBlock[0] = static_cast<uint8_t>(c0 & 0xFF);
+		_outBlock[1] = static_cast<uint8_t>(c0 >> 8);
+		_outBlock[2] = static_cast<uint8_t>(c1 & 0xFF);
+		_outBlock[3] = static_cast<uint8_t>(c1 >> 8);
+		std::memcpy(_outBlock + 4, &packedIndices, sizeof(packedIndices));
+	}
+
+	/** @brief BC1 のカラーブロックを展開する（RGB のみ書き込む）
+	 *  @param _block 入力
+	 *  @param _forceFourColor BC3 のカラーブロックとして扱うか（常に 4 色モード）
+	 *  @param _outRgba 出力
+	 */
+	static void DecodeBc1Color(const uint8_t _block[8], bool _forceFourColor, uint8_t _outRgba[64])
+	{
+		const uint16_t c0 = static_cast<uint16_t>(_block[0] | (_block[1] << 8));
+		const uint16_t c1 = static_cast<uint16_t>(_block[2] | (_block[3] << 8));
+
+		float palette[4][4] = {};
+		::UnpackRgb565(c0, palette[0]);
+		::UnpackRgb565(c1, palette[1]);
+		palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255.0f;
+
+		if (_forceFourColor || c0 > c1)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+				palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+			}
+		}
+		else
+		{
+			for (int c = 0; c < 3; c++) { palette[2][c] = (palette[0][c] + palette[1][c]) * 0.5f; }
+			palette[3][3] = 0.0f;
+		}
+
+		uint32_t packedIndices = 0;
+		std::memcpy(&packedIndices, _block + 4, sizeof(packedIndices));
+		for (int i = 0; i < TexelCount; i++)
+		{
+			const uint32_t index = (packedIndices >> (i * 2)) & 3u;
+			for (int c = 0; c < 4; c++)
+			{
+				_outRgba[i * 4 + c] = static_cast<uint8_t>(std::lround(palette[index][c]));
+			}
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// BC4（BC3 のアルファ / BC5 の各チャンネル）
+	//-----------------------------------------------------------------------------
+	/** @brief BC4 の 8 段階パレットを作る
+	 *  @param _a0 端点 0
+	 *  @param _a1 端点 1
+	 *  @param _outPalette 出力
+	 */
+	static void BuildBc4Palette(uint8_t _a0, uint8_t _a1, float _outPalette[8])
+	{
+		_outPalette[0] = _a0;
+		_outPalette[1] = _a1;
+		if (_a0 > _a1)
+		{
+			for (int i = 1; i < 7; i++) { _outPalette[i + 1] = ((7 - i) * _a0 + i * _a1) / 7.0f; }
+		}
+		else
+		{
+			for (int i = 1; i < 5; i++) { _outPalette[i + 1] = ((5 - i) * _a0 + i * _a1) / 5.0f; }
+			_outPalette[6] = 0.0f;
+			_outPalette[7] = 255.0f;
+		}
+	}
+
+	/** @brief 1 チャンネルを BC4 ブロック（8 バイト）にする
+	 *  @param _values 入力値
+	 *  @param _outBlock 出力先
+	 */
+	static void EncodeBc4(const uint8_t _values[TexelCount], uint8_t _outBlock[8])
+	{
+		const uint8_t maxValue = *std::max_element(_values, _values + TexelCount);
+		const uint8_t minValue = *std::min_element(_values, _values + TexelCount);
+
+		std::memset(_outBlock, 0, 8);
+		_outBlock[0] = maxValue;
+		_outBlock[1] = minValue;
+		if (maxValue == minValue) { return; }
+
+		// a0 > a1 の 8 段階モードで、最も近い段階を選ぶ
+		float palette[8];
+		::BuildBc4Palette(maxValue, minValue, palette);
+
+		uint64_t packedIndices = 0;
+		for (int i = 0; i < TexelCount; i++)
+		{
+			uint64_t bestIndex = 0;
+			float best = FLT_MAX;
+			for (uint64_t p = 0; p < 8; p++)
+			{
+				const float d = std::fabs(_values[i] - palette[p]);
+				if (d < best)
+				{
+					best = d;
+					bestIndex = p;
+				}
+			}
+			packedIndices |= bestIndex << (i * 3);
+		}
+
+		for (int b = 0; b < 6; b++) { _outBlock[2 + b] = static_cast<uint8_t>(packedIndices >> (b * 8)); }
+	}
+
+	/** @brief BC4 ブロックを 1 チャンネルに展開する
+	 *  @param _block 入力
+	 *  @param _outRgba 出力先
+	 *  @param _channel 書き込むチャンネル
+	 */
+	static void DecodeBc4(const uint8_t _block[8], uint8_t _outRgba[64], int _channel)
+	{
+		float palette[8];
+		::BuildBc4Palette(_block[0], _block[1], palette);
+
+		uint64_t packedIndices = 0;
+		for (int b = 0; b < 6; b++) { packedIndices |= static_cast<uint64_t>(_block[2 + b]) << (b * 8); }
+
+		for (int i = 0; i < TexelCount; i++)
+		{
+			const uint64_t index = (packedIndices >> (i * 3)) & 7u;
+			_outRgba[i * 4 + _channel] = static_cast<uint8_t>(std::lround(palette[index]));
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// BC7（モード 6）
+	//-----------------------------------------------------------------------------
+	/** @brief 端点を 7bit + 共有 P ビットに量子化する（誤差が小さい P ビットを選ぶ）
+	 *  @param _endpoint 端点（0..255）
+	 *  @param _outQuantized 7bit 値
+	 *  @param _outPBit P ビット
+	 */
+	static void QuantizeBc7Endpoint(const float _endpoint[4], uint8_t _outQuantized[4], uint8_t& _outPBit)
+	{
+		float bestError = FLT_MAX;
+		for (uint8_t p = 0; p < 2; p++)
+		{
+			uint8_t quantized[4];
+			float error = 0.0f;
+			for (int c = 0; c < 4; c++)
+			{
+				const int q = std::clamp(static_cast<int>(std::lround((_endpoint[c] - p) * 0.5f)), 0, 127);
+				quantized[c] = static_cast<uint8_t>(q);
+				const float d = static_cast<float>((q << 1) | p) - _endpoint[c];
+				error += d * d;
+			}
+			if (error < bestError)
+			{
+				bestError = error;
+				_outPBit = p;
+				std::memcpy(_outQuantized, quantized, 4);
+			}
+		}
+	}
+
+	/** @brief BC7 モード 6 の各テクセルに最も近いインデックスを割り当てる
+	 *  @return 二乗誤差の合計
+	 */
+	static float AssignBc7Indices(const float _pixels[TexelCount][4], const uint8_t _q0[4], uint8_t _p0, const uint8_t _q1[4], uint8_t _p1, uint8_t _outIndices[TexelCount])
+	{
+		int palette[16][4];
+		for (int w = 0; w < 16; w++)
+		{
+			for (int c = 0; c < 4; c++)
+			{
+				const int e0 = (_q0[c] << 1) | _p0;
+				const int e1 = (_q1[c] << 1) | _p1;
+				palette[w][c] = ((64 - Bc7Weights4[w]) * e0 + Bc7Weights4[w] * e1 + 32) >> 6;
+			}
+		}
+
+		float total = 0.0f;
+		for (int i = 0; i < TexelCount; i++)
+		{
+			float best = FLT_MAX;
+			for (uint8_t w = 0; w < 16; w++)
+			{
+				float error = 0.0f;
+				for (int c = 0; c < 4; c++)
+				{
+					const float d = _pixels[i][c] - static_cast<float>(palette[w][c]);
+					error += d * d;
+				}
+				if (error < best)
+				{
+					best = error;
+					_outIndices[i] = w;
+				}
+			}
+			total += best;
+		}
+		return total;
+	}
+
+	/** @brief BC7 モード 6 のブロック（16 バイト）を作る
+	 *  @param _pixels テクセル
+	 *  @param _outBlock 出力先
+	 */
+	static void EncodeBc7Mode6(const float _pixels[TexelCount][4], uint8_t _outBlock[16])
+	{
+		float e0[4], e1[4];
+		::FitEndpoints(_pixels, 4, e0, e1);
+
+		uint8_t q0[4], q1[4], p0 = 0, p1 = 0;
+		::QuantizeBc7Endpoint(e0, q0, p0);
+		::QuantizeBc7Endpoint(e1, q1, p1);
+
+		uint8_t indices[TexelCount] = {};
+		float error = ::AssignBc7Indices(_pixels, q0, p0, q1, p1, indices);
+
+		// 割り当てたインデックスで端点を最小二乗で求め直し、良くなった場合だけ採用する
+		float weights[TexelCount];
+		for (int i = 0; i < TexelCount; i++) { weights[i] = 1.0f - Bc7Weights4[indices[i]] / 64.0f; }
+
+		float r0[4], r1[4];
+		if (::SolveEndpoints(_pixels, 4, weights, r0, r1))
+		{
+			uint8_t rq0[4], rq1[4], rp0 = 0, rp1 = 0;
+			::QuantizeBc7Endpoint(r0, rq0, rp0);
+			::QuantizeBc7Endpoint(r1, rq1, rp1);
+
+			uint8_t refinedIndices[TexelCount] = {};
+			const float refinedError = ::AssignBc7Indices(_pixels, rq0, rp0, rq1, rp1, refinedIndices);
+			if (refinedError < error)
+			{
+				std::memcpy(q0, rq0, 4);
+				std::memcpy(q1, rq1, 4);
+				p0 = rp0;
+				p1 = rp1;
+				std::memcpy(indices, refinedIndices, sizeof(indices));
+			}
+		}
+
+		// 先頭テクセルのインデックスは最上位ビットが 0 でなければならない（アンカー）
+		if (indices[0] & 8)
+		{
+			std::swap(q0, q1);
+			std::swap(p0, p1);
+			for (auto& index : indices) { index = static_cast<uint8_t>(15 - index); }
+		}
+
+		BitWriter writer(_outBlock);
+		writer.Write(1u << 6, 7);	// モード 6
+		for (int c = 0; c < 4; c++)
+		{
+			writer.Write(q0[c], 7);
+			writer.Write(q1[c], 7);
+		}
+		writer.Write(p0, 1);
+		writer.Write(p1, 1);
+		writer.Write(indices[0], 3);
+		for (int i = 1; i < TexelCount; i++) { writer.Write(indices[i], 4); }
+	}
+
+	/** @brief BC7 モード 6 のブロックを展開する（他モードは 0 で埋める）
+	 *  @param _block 入力
+	 *  @param _outRgba 出力
+	 */
+	static void DecodeBc7Mode6(const uint8_t _block[16], uint8_t _outRgba[64])
+	{
+		BitReader reader(_block);
+		if (reader.Read(7) != (1u << 6))
+		{
+			std::memset(_outRgba, 0, 64);
+			return;
+		}
+
+		int q[2][4];
+		for (int c = 0; c < 4; c++)
+		{
+			q[0][c] = static_cast<int>(reader.Read(7));
+			q[1][c] = static_cast<int>(reader.Read(7));
+		}
+		const int p0 = static_cast<int>(reader.Read(1));
+		const int p1 = static_cast<int>(reader.Read(1));
+
+		for (int i = 0; i < TexelCount; i++)
+		{
+			const int w = Bc7Weights4[reader.Read(i == 0 ? 3 : 4)];
+			for (int c = 0; c < 4; c++)
+			{
+				const int e0 = (q[0][c] << 1) | p0;
+				const int e1 = (q[1][c] << 1) | p1;
+				_outRgba[i * 4 + c] = static_cast<uint8_t>(((64 - w) * e0 + w * e1 + 32) >> 6);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Namespace : Graphics::TextureCompression
+//-----------------------------------------------------------------------------
+namespace Graphics::TextureCompression
+{
+	/** @brief 1 ブロックのバイト数を取得
+	 *  @param _format 圧縮形式
+	 *  @return バイト数（8 または 16）
+	 */
+	uint32_t GetBlockBytes(BlockFormat _format)
+	{
+		return (_format == BlockFormat::BC1) ? 8u : 16u;
+	}
+
+	/** @brief 4x4 ブロックを圧縮する
+	 *  @param _format 圧縮形式
+	 *  @param _rgba 入力テクセル（RGBA8 x 16）
+	 *  @param _outBlock 出力先（GetBlockBytes バイト）
+	 */
+	void EncodeBlock(BlockFormat _format, const uint8_t _rgba[64], uint8_t* _outBlock)
+	{
+		float pixels[TexelCount][4];
+		::LoadPixels(_rgba, pixels);
+
+		uint8_t channel[TexelCount];
+		switch (_format)
+		{
+		case BlockFormat::BC1:
+			::EncodeBc1Color(pixels, _outBlock);
+			break;
+
+		case BlockFormat::BC3:
+			for (int i = 0; i < TexelCount; i++) { channel[i] = _rgba[i * 4 + 3]; }
+			::EncodeBc4(channel, _outBlock);
+			::EncodeBc1Color(pixels, _outBlock + 8);
+			break;
+
+		case BlockFormat::BC5:
+			for (int i = 0; i < TexelCount; i++) { channel[i] = _rgba[i * 4 + 0]; }
+			::EncodeBc4(channel, _outBlock);
+			for (int i = 0; i < TexelCount; i++) { channel[i] = _rgba[i * 4 + 1]; }
+			::EncodeBc4(channel, _outBlock + 8);
+			break;
+
+		case BlockFormat::BC7:
+			::EncodeBc7Mode6(pixels, _outBlock);
+			break;
+		}
+	}
+
+	/** @brief 4x4 ブロックを展開する（検証用、BC7 はモード 6 のみ対応）
+	 *  @param _format 圧縮形式
+	 *  @param _block 入力ブロック
+	 *  @param _outRgba 出力テクセル（RGBA8 x 16）
+	 */
+	void DecodeBlock(BlockFormat _format, const uint8_t* _block, uint8_t _outRgba[64])
+	{
+		switch (_format)
+		{
+		case BlockFormat::BC1:
+			::DecodeBc1Color(_block, false, _outRgba);
+			break;
+
+		case BlockFormat::BC3:
+			::DecodeBc1Color(_block + 8, true, _outRgba);
+			::DecodeBc4(_block, _outRgba, 3);
+			break;
+
+		case BlockFormat::BC5:
+			for (int i = 0; i < TexelCount; i++)
+			{
+				_outRgba[i * 4 + 2] = 0;
+				_outRgba[i * 4 + 3] = 255;
+			}
+			::DecodeBc4(_block, _outRgba, 0);
+			::DecodeBc4(_block + 8, _outRgba, 1);
+			break;
+
+		case BlockFormat::BC7:
+			::DecodeBc7Mode6(_block, _outRgba);
+			break;
+		}
+	}
+
+	/** @brief 画像全体を圧縮する（端のブロックは境界のテクセルを複製して埋める）
+	 *  @param _format 圧縮形式
+	 *  @param _rgba 入力画像（RGBA8、行ピッチは _width * 4）
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @param _outBlocks 出力ブロック列（行ピッチは ceil(_width / 4) * GetBlockBytes）
+	 */
+	void CompressImage(BlockFormat _format, const uint8_t* _rgba, uint32_t _width, uint32_t _height, std::vector<uint8_t>& _outBlocks)
+	{
+		const uint32_t blocksX = (_width + BlockDimension - 1) / BlockDimension;
+		const uint32_t blocksY = (_height + BlockDimension - 1) / BlockDimension;
+		const uint32_t blockBytes = GetBlockBytes(_format);
+		_outBlocks.assign(static_cast<size_t>(blocksX) * blocksY * blockBytes, 0);
+
+		uint8_t texels[64];
+		for (uint32_t by = 0; by < blocksY; by++)
+		{
+			for (uint32_t bx = 0; bx < blocksX; bx++)
+			{
+				for (uint32_t y = 0; y < BlockDimension; y++)
+				{
+					const uint32_t srcY = std::min(by * BlockDimension + y, _height - 1);
+					for (uint32_t x = 0; x < BlockDimension; x++)
+					{
+						const uint32_t srcX = std::min(bx * BlockDimension + x, _width - 1);
+						std::memcpy(&texels[(y * BlockDimension + x) * 4], &_rgba[(static_cast<size_t>(srcY) * _width + srcX) * 4], 4);
+					}
+				}
+				EncodeBlock(_format, texels, &_outBlocks[(static_cast<size_t>(by) * blocksX + bx) * blockBytes]);
+			}
+		}
+	}
+
+	/** @brief 圧縮済みの画像を RGBA8 に展開する（検証用）
+	 *  @param _format 圧縮形式
+	 *  @param _blocks 入力ブロック列
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @param _outRgba 出力画像（RGBA8、行ピッチは _width * 4）
+	 */
+	void DecompressImage(BlockFormat _format, const uint8_t* _blocks, uint32_t _width, uint32_t _height, std::vector<uint8_t>& _outRgba)
+	{
+		const uint32_t blocksX = (_width + BlockDimension - 1) / BlockDimension;
+		const uint32_t blocksY = (_height + BlockDimension - 1) / BlockDimension;
+		const uint32_t blockBytes = GetBlockBytes(_format);
+		_outRgba.assign(static_cast<size_t>(_width) * _height * 4, 0);
+
+		uint8_t texels[64];
+		for (uint32_t by = 0; by < blocksY; by++)
+		{
+			for (uint32_t bx = 0; bx < blocksX; bx++)
+			{
+				DecodeBlock(_format, &_blocks[(static_cast<size_t>(by) * blocksX + bx) * blockBytes], texels);
+				for (uint32_t y = 0; y < BlockDimension; y++)
+				{
+					const uint32_t dstY = by * BlockDimension + y;
+					if (dstY >= _height) { break; }
+					for (uint32_t x = 0; x < BlockDimension; x++)
+					{
+						const uint32_t dstX = bx * BlockDimension + x;
+						if (dstX >= _width) { break; }
+						std::memcpy(&_outRgba[(static_cast<size_t>(dstY) * _width + dstX) * 4], &texels[(y * BlockDimension + x) * 4], 4);
+					}
+				}
+			}
+		}
+	}
+} // namespace Graphics::TextureCompression
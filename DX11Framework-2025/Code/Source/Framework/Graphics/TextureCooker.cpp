@@ -0,0 +1,879 @@
+﻿/** @file   TextureCooker.cpp
+ *  @brief  テクスチャのオフライン変換（ミップ生成・ブロック圧縮・.ctex 形式の読み書き）
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Graphics/TextureCooker.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numbers>
+
+#include "../External/stb/include/stb_image.h"	// 実装は TextureLoader.cpp 側
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	using namespace Graphics::TextureCooker;
+	namespace Compression = Graphics::TextureCompression;
+
+	//-----------------------------------------------------------------------------
+	// Color space
+	//-----------------------------------------------------------------------------
+	/** @brief sRGB の 8bit 値を線形値に変換する（テーブル参照）
+	 *  @param _value sRGB 値
+	 *  @return 線形値（0..1）
+	 */
+	static float SrgbToLinear(uint8_t _value)
+	{
+		static const std::array<float, 256> table = []()
+			{
+				std::array<float, 256> t{};
+				for (int i = 0; i < 256; i++)
+				{
+					const float c = i / 255.0f;
+					t[i] = (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+				}
+				return t;
+			}();
+		return table[_value];
+	}
+
+	/** @brief 線形値を sRGB の 8bit 値に変換する
+	 *  @param _value 線形値（0..1）
+	 *  @return sRGB 値
+	 */
+	static uint8_t LinearToSrgb(float _value)
+	{
+		const float c = std::clamp(_value, 0.0f, 1.0f);
+		const float s = (c <= 0.0031308f) ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+		return static_cast<uint8_t>(std::lround(s * 255.0f));
+	}
+
+	/** @brief 0..1 の値を 8bit にする
+	 *  @param _value 値
+	 *  @return 8bit 値
+	 */
+	static uint8_t ToUnorm8(float _value)
+	{
+		return static_cast<uint8_t>(std::lround(std::clamp(_value, 0.0f, 1.0f) * 255.0f));
+	}
+
+	//-----------------------------------------------------------------------------
+	// Mip filters
+	//-----------------------------------------------------------------------------
+	/** @brief 第 1 種変形ベッセル関数 I0（級数展開）
+	 *  @param _x 引数
+	 *  @return I0(_x)
+	 */
+	static float BesselI0(float _x)
+	{
+		float sum = 1.0f;
+		float term = 1.0f;
+		const float halfX = _x * 0.5f;
+		for (int k = 1; k < 32; k++)
+		{
+			term *= (halfX / k) * (halfX / k);
+			sum += term;
+			if (term < sum * 1e-8f) { break; }
+		}
+		return sum;
+	}
+
+	/** @brief Kaiser 窓付き sinc
+	 *  @param _t 縮小後のテクセル単位での距離
+	 *  @return 重み
+	 */
+	static float KaiserSinc(float _t)
+	{
+		const float x = _t / KaiserRadius;
+		if (std::fabs(x) >= 1.0f) { return 0.0f; }
+
+		const float pt = std::numbers::pi_v<float> * _t;
+		const float sinc = (std::fabs(pt) < 1e-5f) ? 1.0f : std::sin(pt) / pt;
+		const float window = ::BesselI0(KaiserAlpha * std::sqrt(1.0f - x * x)) / ::BesselI0(KaiserAlpha);
+		return sinc * window;
+	}
+
+	/** @brief 2x2 平均で半分に縮小する（奇数サイズの端は境界を複製）
+	 *  @param _src 入力（RGBA float）
+	 *  @param _srcWidth 入力幅
+	 *  @param _srcHeight 入力高さ
+	 *  @param _dstWidth 出力幅
+	 *  @param _dstHeight 出力高さ
+	 *  @return 出力（RGBA float）
+	 */
+	static std::vector<float> DownsampleBox(const std::vector<float>& _src, uint32_t _srcWidth, uint32_t _srcHeight, uint32_t _dstWidth, uint32_t _dstHeight)
+	{
+		std::vector<float> dst(static_cast<size_t>(_dstWidth) * _dstHeight * 4);
+		for (uint32_t y = 0; y < _dstHeight; y++)
+		{
+			const uint32_t y0 = std::min(y * 2, _srcHeight - 1);
+			const uint32_t y1 = std::min(y * 2 + 1, _srcHeight - 1);
+			for (uint32_t x = 0; x < _dstWidth; x++)
+			{
+				const uint32_t x0 = std::min(x * 2, _srcWidth - 1);
+				const uint32_t x1 = std::min(x * 2 + 1, _srcWidth - 1);
+				for (int c = 0; c < 4; c++)
+				{
+					const float sum =
+						_src[(static_cast<size_t>(y0) * _srcWidth + x0) * 4 + c] + _src[(static_cast<size_t>(y0) * _srcWidth + x1) * 4 + c] +
+						_src[(static_cast<size_t>(y1) * _srcWidth + x0) * 4 + c] + _src[(static_cast<size_t>(y1) * _srcWidth + x1) * 4 + c];
+					dst[(static_cast<size_t>(y) * _dstWidth + x) * 4 + c] = sum * 0.25f;
+				}
+			}
+		}
+		return dst;
+	}
+
+	/** @brief 1 軸だけ Kaiser フィルタで縮小する
+	 *  @param _src 入力（RGBA float）
+	 *  @param _srcWidth 入力幅
+	 *  @param _srcHeight 入力高さ
+	 *  @param _dstLength 縮小後の長さ
+	 *  @param _horizontal 横方向に縮小するか
+	 *  @return 出力（RGBA float）
+	 */
+	static std::vector<float> ResampleKaiserAxis(const std::vector<float>& _src, uint32_t _srcWidth, uint32_t _srcHeight, uint32_t _dstLength, bool _horizontal)
+	{
+		const uint32_t srcLength = _horizontal ? _srcWidth : _srcHeight;
+		if (srcLength == _dstLength) { return _src; }
+
+		// 出力位置ごとのタップと重みを先に求める（行/列で共通）
+		const float scale = static_cast<float>(srcLength) / static_cast<float>(_dstLength);
+		std::vector<std::vector<std::pair<uint32_t, float>>> taps(_dstLength);
+		for (uint32_t i = 0; i < _dstLength; i++)
+		{
+			const float center = (i + 0.5f) * scale - 0.5f;
+			const int first = static_cast<int>(std::ceil(center - KaiserRadius * scale));
+			const int last = static_cast<int>(std::floor(center + KaiserRadius * scale));
+
+			float total = 0.0f;
+			for (int s = first; s <= last; s++)
+			{
+				const float weight = ::KaiserSinc((s - center) / scale);
+				if (weight == 0.0f) { continue; }
+
+				const uint32_t clamped = static_cast<uint32_t>(std::clamp(s, 0, static_cast<int>(srcLength) - 1));
+				taps[i].emplace_back(clamped, weight);
+				total += weight;
+			}
+			for (auto& tap : taps[i]) { tap.second /= total; }
+		}
+
+		const uint32_t dstWidth = _horizontal ? _dstLength : _srcWidth;
+		const uint32_t dstHeight = _horizontal ? _srcHeight : _dstLength;
+		std::vector<float> dst(static_cast<size_t>(dstWidth) * dstHeight * 4, 0.0f);
+		for (uint32_t y = 0; y < dstHeight; y++)
+		{
+			for (uint32_t x = 0; x < dstWidth; x++)
+			{
+				float* out = &dst[(static_cast<size_t>(y) * dstWidth + x) * 4];
+				for (const auto& [srcIndex, weight] : taps[_horizontal ? x : y])
+				{
+					const uint32_t sx = _horizontal ? srcIndex : x;
+					const uint32_t sy = _horizontal ? y : srcIndex;
+					const float* in = &_src[(static_cast<size_t>(sy) * _srcWidth + sx) * 4];
+					for (int c = 0; c < 4; c++) { out[c] += in[c] * weight; }
+				}
+			}
+		}
+		return dst;
+	}
+
+	//-----------------------------------------------------------------------------
+	// Format helpers
+	//-----------------------------------------------------------------------------
+	/** @brief ブロック圧縮形式か
+	 *  @param _format 形式
+	 *  @return BC 形式なら true
+	 */
+	static bool IsBlockCompressed(CookedFormat _format)
+	{
+		return _format != CookedFormat::RGBA8;
+	}
+
+	/** @brief CookedFormat をブロック圧縮形式に変換する
+	 *  @param _format 形式（RGBA8 以外）
+	 *  @return ブロック圧縮形式
+	 */
+	static Compression::BlockFormat ToBlockFormat(CookedFormat _format)
+	{
+		switch (_format)
+		{
+		case CookedFormat::BC1: return Compression::BlockFormat::BC1;
+		case CookedFormat::BC3: return Compression::BlockFormat::BC3;
+		case CookedFormat::BC5: return Compression::BlockFormat::BC5;
+		case CookedFormat::BC7:
+		default: return Compression::BlockFormat::BC7;
+		}
+	}
+
+	/** @brief 形式名（ログ用）
+	 *  @param _format 形式
+	 *  @return 名前
+	 */
+	static const char* GetFormatName(CookedFormat _format)
+	{
+		switch (_format)
+		{
+		case CookedFormat::RGBA8: return "RGBA8";
+		case CookedFormat::BC1: return "BC1";
+		case CookedFormat::BC3: return "BC3";
+		case CookedFormat::BC5: return "BC5";
+		case CookedFormat::BC7: return "BC7";
+		default: return "Unknown";
+		}
+	}
+
+	/** @brief ミップ 1 枚のデータサイズと行ピッチを求める
+	 *  @param _format 形式
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @param _outRowPitch 行ピッチ
+	 *  @return バイト数
+	 */
+	static size_t ComputeMipSize(CookedFormat _format, uint32_t _width, uint32_t _height, uint32_t& _outRowPitch)
+	{
+		if (!::IsBlockCompressed(_format))
+		{
+			_outRowPitch = _width * 4;
+			return static_cast<size_t>(_outRowPitch) * _height;
+		}
+
+		const uint32_t blocksX = (_width + Compression::BlockDimension - 1) / Compression::BlockDimension;
+		const uint32_t blocksY = (_height + Compression::BlockDimension - 1) / Compression::BlockDimension;
+		_outRowPitch = blocksX * Compression::GetBlockBytes(::ToBlockFormat(_format));
+		return static_cast<size_t>(_outRowPitch) * blocksY;
+	}
+
+	/** @brief ミップ 0 を展開して元画像との PSNR を求める
+	 *  @param _texture 変換済みテクスチャ
+	 *  @param _source 元画像（RGBA8）
+	 *  @param _channels 比較するチャンネル数（先頭から）
+	 *  @return PSNR（dB、完全一致は 99）
+	 */
+	static double ComputePsnr(const CookedTexture& _texture, const uint8_t* _source, int _channels)
+	{
+		if (_texture.mips.empty()) { return 0.0; }
+
+		const CookedMip& mip = _texture.mips[0];
+		std::vector<uint8_t> decoded;
+		if (::IsBlockCompressed(_texture.format))
+		{
+			Compression::DecompressImage(::ToBlockFormat(_texture.format), mip.data.data(), mip.width, mip.height, decoded);
+		}
+		else
+		{
+			decoded = mip.data;
+		}
+
+		double squaredError = 0.0;
+		const size_t pixelCount = static_cast<size_t>(mip.width) * mip.height;
+		for (size_t i = 0; i < pixelCount; i++)
+		{
+			for (int c = 0; c < _channels; c++)
+			{
+				const double d = static_cast<double>(decoded[i * 4 + c]) - static_cast<double>(_source[i * 4 + c]);
+				squaredError += d * d;
+			}
+		}
+
+		const double mse = squaredError / static_cast<double>(pixelCount * _channels);
+		return (mse <= 0.0) ? 99.0 : 10.0 * std::log10(255.0 * 255.0 / mse);
+	}
+
+	/** @brief 変換済みテクスチャと同じミップ構成の RGBA8 のサイズ（圧縮率の表示用）
+	 *  @param _texture 変換済みテクスチャ
+	 *  @return バイト数
+	 */
+	static size_t ComputeUncompressedSize(const CookedTexture& _texture)
+	{
+		size_t total = 0;
+		for (const auto& mip : _texture.mips) { total += static_cast<size_t>(mip.width) * mip.height * 4; }
+		return total;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Namespace : Graphics::TextureCooker
+//-----------------------------------------------------------------------------
+namespace Graphics::TextureCooker
+{
+	/** @brief 全ミップのデータサイズ
+	 *  @return バイト数
+	 */
+	size_t CookedTexture::GetByteSize() const
+	{
+		size_t total = 0;
+		for (const auto& mip : this->mips) { total += mip.data.size(); }
+		return total;
+	}
+
+	/** @brief ミップ列を生成する（先頭は入力のコピー）
+	 *  @param _rgba 入力画像（RGBA8）
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @param _filter 縮小フィルタ
+	 *  @param _srgb RGB を sRGB とみなして線形空間で縮小するか
+	 *  @return 1x1 までのミップ列
+	 */
+	std::vector<Image> GenerateMipChain(const uint8_t* _rgba, uint32_t _width, uint32_t _height, MipFilter _filter, bool _srgb)
+	{
+		std::vector<Image> chain;
+		chain.push_back({ _width, _height, std::vector<uint8_t>(_rgba, _rgba + static_cast<size_t>(_width) * _height * 4) });
+
+		// 縮小は float（sRGB の場合は線形空間）で行い、段ごとに 8bit へ丸めた誤差を次の段へ持ち越さない
+		std::vector<float> current(static_cast<size_t>(_width) * _height * 4);
+		for (size_t i = 0; i < current.size(); i++)
+		{
+			const bool isColor = (i % 4) != 3;
+			current[i] = (_srgb && isColor) ? ::SrgbToLinear(_rgba[i]) : _rgba[i] / 255.0f;
+		}
+
+		uint32_t width = _width;
+		uint32_t height = _height;
+		while (width > 1 || height > 1)
+		{
+			const uint32_t nextWidth = std::max(1u, width / 2);
+			const uint32_t nextHeight = std::max(1u, height / 2);
+
+			if (_filter == MipFilter::Box)
+			{
+				current = ::DownsampleBox(current, width, height, nextWidth, nextHeight);
+			}
+			else
+			{
+				current = ::ResampleKaiserAxis(current, width, height, nextWidth, true);
+				current = ::ResampleKaiserAxis(current, nextWidth, height, nextHeight, false);
+			}
+			width = nextWidth;
+			height = nextHeight;
+
+			Image image{ width, height, std::vector<uint8_t>(current.size()) };
+			for (size_t i = 0; i < current.size(); i++)
+			{
+				const bool isColor = (i % 4) != 3;
+				image.rgba[i] = (_srgb && isColor) ? ::LinearToSrgb(current[i]) : ::ToUnorm8(current[i]);
+			}
+			chain.push_back(std::move(image));
+		}
+		return chain;
+	}
+
+	/** @brief RGBA8 画像を変換する
+	 *  @param _rgba 入力画像（RGBA8）
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @param _options 変換設定
+	 *  @param _outTexture 出力先
+	 *  @return 成功時 true
+	 */
+	bool Cook(const uint8_t* _rgba, uint32_t _width, uint32_t _height, const CookOptions& _options, CookedTexture& _outTexture)
+	{
+		if (!_rgba || _width == 0 || _height == 0) { return false; }
+
+		// 完全に不透明なら 8bpp の BC3 / BC7 ではなく 4bpp の BC1 で足りる
+		CookedFormat format = _options.format;
+		if (_options.selectFormatByAlpha && (format == CookedFormat::BC3 || format == CookedFormat::BC7))
+		{
+			bool opaque = true;
+			for (size_t i = 3; i < static_cast<size_t>(_width) * _height * 4; i += 4)
+			{
+				if (_rgba[i] != 255) { opaque = false; break; }
+			}
+			if (opaque) { format = CookedFormat::BC1; }
+		}
+
+		// D3D11 ではミップ 0 が 4 の倍数でない BC テクスチャを作れない
+		if (::IsBlockCompressed(format) && ((_width % Compression::BlockDimension) != 0 || (_height % Compression::BlockDimension) != 0))
+		{
+			std::cerr << "[TextureCooker] " << _width << "x" << _height << " is not a multiple of 4, falling back to RGBA8.\n";
+			format = CookedFormat::RGBA8;
+		}
+
+		// 法線マップは線形データなので sRGB 扱いしない
+		const bool srgb = _options.srgb && format != CookedFormat::BC5;
+
+		std::vector<Image> chain;
+		if (_options.generateMips)
+		{
+			chain = GenerateMipChain(_rgba, _width, _height, _options.mipFilter, srgb);
+		}
+		else
+		{
+			chain.push_back({ _width, _height, std::vector<uint8_t>(_rgba, _rgba + static_cast<size_t>(_width) * _height * 4) });
+		}
+
+		_outTexture = {};
+		_outTexture.format = format;
+		_outTexture.width = _width;
+		_outTexture.height = _height;
+		_outTexture.flags = (srgb ? CookedFlagSrgb : 0u) | ((format == CookedFormat::BC5) ? CookedFlagNormalMap : 0u);
+		_outTexture.mips.reserve(chain.size());
+
+		for (auto& image : chain)
+		{
+			CookedMip mip{};
+			mip.width = image.width;
+			mip.height = image.height;
+			::ComputeMipSize(format, image.width, image.height, mip.rowPitch);
+
+			if (::IsBlockCompressed(format))
+			{
+				Compression::CompressImage(::ToBlockFormat(format), image.rgba.data(), image.width, image.height, mip.data);
+			}
+			else
+			{
+				mip.data = std::move(image.rgba);
+			}
+			_outTexture.mips.push_back(std::move(mip));
+		}
+		return true;
+	}
+
+	/** @brief 変換済みテクスチャをバイト列にする
+	 *  @param _texture 変換済みテクスチャ
+	 *  @param _outBytes 出力先
+	 */
+	void Serialize(const CookedTexture& _texture, std::vector<uint8_t>& _outBytes)
+	{
+		CookedHeader header{};
+		header.format = static_cast<uint32_t>(_texture.format);
+		header.flags = _texture.flags;
+		header.width = _texture.width;
+		header.height = _texture.height;
+		header.mipCount = static_cast<uint32_t>(_texture.mips.size());
+
+		_outBytes.clear();
+		_outBytes.reserve(sizeof(CookedHeader) + sizeof(CookedMipEntry) * _texture.mips.size() + _texture.GetByteSize());
+
+		auto append = [&_outBytes](const void* _data, size_t _size)
+			{
+				const uint8_t* bytes = static_cast<const uint8_t*>(_data);
+				_outBytes.insert(_outBytes.end(), bytes, bytes + _size);
+			};
+
+		append(&header, sizeof(header));
+		for (const auto& mip : _texture.mips)
+		{
+			const CookedMipEntry entry{ mip.width, mip.height, mip.rowPitch, static_cast<uint32_t>(mip.data.size()) };
+			append(&entry, sizeof(entry));
+		}
+		for (const auto& mip : _texture.mips)
+		{
+			append(mip.data.data(), mip.data.size());
+		}
+	}
+
+	/** @brief バイト列から変換済みテクスチャを復元する
+	 *  @param _data 入力データ
+	 *  @param _size 入力サイズ
+	 *  @param _outTexture 出力先
+	 *  @return 形式が正しければ true
+	 */
+	bool Deserialize(const uint8_t* _data, size_t _size, CookedTexture& _outTexture)
+	{
+		if (!IsCookedData(_data, _size) || _size < sizeof(CookedHeader)) { return false; }
+
+		CookedHeader header{};
+		std::memcpy(&header, _data, sizeof(header));
+		if (header.version != CookedVersion || header.format > static_cast<uint32_t>(CookedFormat::BC7) || header.mipCount == 0)
+		{
+			std::cerr << "[TextureCooker] Unsupported cooked texture (version " << header.version << ", format " << header.format << ").\n";
+			return false;
+		}
+
+		// 寸法とミップ数に上限を設けて、以降のサイズ計算があふれないようにする
+		if (header.width == 0 || header.height == 0 || header.width > MaxCookedDimension || header.height > MaxCookedDimension ||
+			header.mipCount > ComputeFullMipCount(header.width, header.height))
+		{
+			std::cerr << "[TextureCooker] Invalid cooked texture size " << header.width << "x" << header.height << ", " << header.mipCount << " mips.\n";
+			return false;
+		}
+
+		const size_t tableSize = sizeof(CookedMipEntry) * header.mipCount;
+		if (_size < sizeof(CookedHeader) + tableSize) { return false; }
+
+		_outTexture = {};
+		_outTexture.format = static_cast<CookedFormat>(header.format);
+		_outTexture.flags = header.flags;
+		_outTexture.width = header.width;
+		_outTexture.height = header.height;
+		_outTexture.mips.resize(header.mipCount);
+
+		size_t offset = sizeof(CookedHeader) + tableSize;
+		for (uint32_t i = 0; i < header.mipCount; i++)
+		{
+			CookedMipEntry entry{};
+			std::memcpy(&entry, _data + sizeof(CookedHeader) + sizeof(CookedMipEntry) * i, sizeof(entry));
+
+			// サイズの整合性を確認してから読む（壊れたファイルでアップロードが範囲外を読まないように）
+			const uint32_t expectedWidth = std::max(1u, header.width >> i);
+			const uint32_t expectedHeight = std::max(1u, header.height >> i);
+			uint32_t expectedPitch = 0;
+			const size_t expectedSize = ::ComputeMipSize(_outTexture.format, expectedWidth, expectedHeight, expectedPitch);
+			if (entry.width != expectedWidth || entry.height != expectedHeight ||
+				entry.rowPitch != expectedPitch || entry.byteSize != expectedSize || entry.byteSize > _size - offset)
+			{
+				std::cerr << "[TextureCooker] Corrupted mip " << i << " in cooked texture.\n";
+				return false;
+			}
+
+			CookedMip& mip = _outTexture.mips[i];
+			mip.width = entry.width;
+			mip.height = entry.height;
+			mip.rowPitch = entry.rowPitch;
+			mip.data.assign(_data + offset, _data + offset + entry.byteSize);
+			offset += entry.byteSize;
+		}
+		return true;
+	}
+
+	/** @brief 1x1 までのミップ数
+	 *  @param _width 幅
+	 *  @param _height 高さ
+	 *  @return ミップ数
+	 */
+	uint32_t ComputeFullMipCount(uint32_t _width, uint32_t _height)
+	{
+		uint32_t count = 1;
+		for (uint32_t size = std::max(_width, _height); size > 1; size >>= 1)
+		{
+			count++;
+		}
+		return count;
+	}
+
+	/** @brief データが .ctex 形式かどうか（先頭の識別子だけを見る）
+	 *  @param _data 入力データ
+	 *  @param _size 入力サイズ
+	 *  @return .ctex なら true
+	 */
+	bool IsCookedData(const uint8_t* _data, size_t _size)
+	{
+		if (!_data || _size < sizeof(uint32_t)) { return false; }
+
+		uint32_t magic = 0;
+		std::memcpy(&magic, _data, sizeof(magic));
+		return magic == CookedMagic;
+	}
+
+	/** @brief 元画像のパスから .ctex のパスを作る（拡張子を置き換える）
+	 *  @param _sourcePath 元画像のパス
+	 *  @return .ctex のパス
+	 */
+	std::string GetCookedPath(const std::string& _sourcePath)
+	{
+		return std::filesystem::path(_sourcePath).replace_extension(CookedExtension).string();
+	}
+
+	/** @brief .ctex が元画像より新しいか
+	 *  @param _sourcePath 元画像のパス
+	 *  @param _cookedPath .ctex のパス
+	 *  @return .ctex があり、元画像が無いか元画像以降に更新されていれば true
+	 */
+	bool IsCookedUpToDate(const std::string& _sourcePath, const std::string& _cookedPath)
+	{
+		std::error_code ec;
+		const auto cookedTime = std::filesystem::last_write_time(_cookedPath, ec);
+		if (ec) { return false; }
+
+		// 元画像を同梱せず .ctex だけを置く場合もあるので、元画像が無ければ .ctex を使う
+		const auto sourceTime = std::filesystem::last_write_time(_sourcePath, ec);
+		if (ec) { return true; }
+
+		return cookedTime >= sourceTime;
+	}
+
+	/** @brief 画像ファイルを変換して保存する
+	 *  @param _sourcePath 元画像のパス（stb_image が読める形式）
+	 *  @param _cookedPath 保存先
+	 *  @param _options 変換設定
+	 *  @return 成功時 true
+	 */
+	bool CookFile(const std::string& _sourcePath, const std::string& _cookedPath, const CookOptions& _options)
+	{
+		int width = 0, height = 0, channels = 0;
+		unsigned char* pixels = stbi_load(_sourcePath.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+		if (!pixels)
+		{
+			std::cerr << "[TextureCooker] Failed to load: " << _sourcePath << std::endl;
+			return false;
+		}
+
+		CookedTexture cooked;
+		const bool cookedOk = Cook(pixels, static_cast<uint32_t>(width), static_cast<uint32_t>(height), _options, cooked);
+		const double psnr = cookedOk ? ::ComputePsnr(cooked, pixels, (cooked.format == CookedFormat::BC5) ? 2 : 4) : 0.0;
+		stbi_image_free(pixels);
+
+		if (!cookedOk)
+		{
+			std::cerr << "[TextureCooker] Failed to cook: " << _sourcePath << std::endl;
+			return false;
+		}
+
+		std::vector<uint8_t> bytes;
+		Serialize(cooked, bytes);
+
+		std::ofstream ofs(_cookedPath, std::ios::binary | std::ios::trunc);
+		if (!ofs || !ofs.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+		{
+			std::cerr << "[TextureCooker] Failed to write: " << _cookedPath << std::endl;
+			return false;
+		}
+
+		const size_t uncompressed = ::ComputeUncompressedSize(cooked);
+		std::cout << "[TextureCooker] " << _sourcePath << ": " << width << "x" << height
+			<< " " << ::GetFormatName(cooked.format) << ", " << cooked.mips.size() << " mips"
+			<< ", " << uncompressed << " -> " << cooked.GetByteSize() << " bytes"
+			<< " (x" << static_cast<double>(uncompressed) / static_cast<double>(std::max<size_t>(cooked.GetByteSize(), 1)) << ")"
+			<< ", PSNR " << psnr << " dB" << std::endl;
+		return true;
+	}
+
+	/** @brief ディレクトリ以下の画像をまとめて変換する（元画像の隣に .ctex を置く）
+	 *  @param _directory 対象ディレクトリ
+	 *  @param _options 変換設定
+	 *  @return 全て成功した場合 true
+	 */
+	bool CookDirectory(const std::string& _directory, const CookOptions& _options)
+	{
+		std::error_code ec;
+		if (!std::filesystem::is_directory(_directory, ec))
+		{
+			std::cerr << "[TextureCooker] Not a directory: " << _directory << std::endl;
+			return false;
+		}
+
+		size_t cookedCount = 0, skippedCount = 0, failedCount = 0;
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(_directory, ec))
+		{
+			if (!entry.is_regular_file()) { continue; }
+
+			std::string extension = entry.path().extension().string();
+			std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char _c) { return static_cast<char>(std::tolower(_c)); });
+			if (extension != ".png" && extension != ".jpg" && extension != ".jpeg" && extension != ".bmp") { continue; }
+
+			// 元画像より新しい .ctex があれば変換しない
+			const std::string sourcePath = entry.path().string();
+			const std::string cookedPath = GetCookedPath(sourcePath);
+			if (IsCookedUpToDate(sourcePath, cookedPath))
+			{
+				skippedCount++;
+				continue;
+			}
+
+			if (CookFile(sourcePath, cookedPath, _options)) { cookedCount++; }
+			else { failedCount++; }
+		}
+
+		std::cout << "[TextureCooker] Cooked " << cookedCount << ", up to date " << skippedCount << ", failed " << failedCount << std::endl;
+		return failedCount == 0;
+	}
+
+	/** @brief 合成画像で全形式を変換・展開し、PSNR とサイズを検証する
+	 *  @return 全形式が閾値を満たせば true
+	 */
+	bool RunSelfTest()
+	{
+		// 滑らかなグラデーションに細かい縞とアルファの傾斜を重ねた 64x64
+		constexpr uint32_t Size = 64;
+		std::vector<uint8_t> source(Size * Size * 4);
+		for (uint32_t y = 0; y < Size; y++)
+		{
+			for (uint32_t x = 0; x < Size; x++)
+			{
+				uint8_t* p = &source[(y * Size + x) * 4];
+				p[0] = static_cast<uint8_t>(x * 4);
+				p[1] = static_cast<uint8_t>(y * 4);
+				p[2] = static_cast<uint8_t>(((x / 8 + y / 8) % 2) ? 200 : 60);
+				p[3] = static_cast<uint8_t>(255 - (x + y));
+			}
+		}
+
+		struct Case
+		{
+			CookedFormat format;
+			int channels;
+			double minPsnr;
+			double minRatio;
+		};
+		const Case cases[] = {
+			{ CookedFormat::RGBA8, 4, 99.0, 1.0 },
+			{ CookedFormat::BC1, 3, 30.0, 7.0 },
+			{ CookedFormat::BC3, 4, 30.0, 3.5 },
+			{ CookedFormat::BC5, 2, 35.0, 3.5 },
+			{ CookedFormat::BC7, 4, 35.0, 3.5 },
+		};
+
+		bool passed = true;
+		for (const auto& testCase : cases)
+		{
+			for (MipFilter filter : { MipFilter::Box, MipFilter::Kaiser })
+			{
+				CookOptions options{};
+				options.format = testCase.format;
+				options.selectFormatByAlpha = false;
+				options.mipFilter = filter;
+
+				CookedTexture cooked;
+				bool ok = Cook(source.data(), Size, Size, options, cooked) && cooked.mips.size() == 7;
+
+				// 保存形式の往復で内容が変わらないこと
+				std::vector<uint8_t> bytes;
+				Serialize(cooked, bytes);
+				CookedTexture loaded;
+				ok = ok && Deserialize(bytes.data(), bytes.size(), loaded) && loaded.mips.size() == cooked.mips.size();
+				for (size_t i = 0; ok && i < cooked.mips.size(); i++)
+				{
+					ok = loaded.mips[i].data == cooked.mips[i].data;
+				}
+
+				const double psnr = ::ComputePsnr(cooked, source.data(), testCase.channels);
+				const double ratio = static_cast<double>(::ComputeUncompressedSize(cooked)) / static_cast<double>(std::max<size_t>(cooked.GetByteSize(), 1));
+				ok = ok && psnr >= testCase.minPsnr && ratio >= testCase.minRatio;
+
+				std::cout << "[TextureCooker] SelfTest " << ::GetFormatName(testCase.format)
+					<< ((filter == MipFilter::Box) ? " Box" : " Kaiser")
+					<< ": PSNR " << psnr << " dB, x" << ratio << (ok ? " OK" : " FAILED") << std::endl;
+				passed = passed && ok;
+			}
+		}
+
+		// 単色画像はどのフィルタでも全ミップが同じ色のまま（重みの正規化の確認）
+		std::vector<uint8_t> flat(Size * Size * 4, 0);
+		for (size_t i = 0; i < flat.size(); i += 4)
+		{
+			flat[i + 0] = 180;
+			flat[i + 1] = 90;
+			flat[i + 2] = 30;
+			flat[i + 3] = 255;
+		}
+		for (MipFilter filter : { MipFilter::Box, MipFilter::Kaiser })
+		{
+			const auto chain = GenerateMipChain(flat.data(), Size, Size, filter, true);
+			bool ok = true;
+			for (const auto& image : chain)
+			{
+				for (size_t i = 0; ok && i < image.rgba.size(); i++)
+				{
+					ok = std::abs(static_cast<int>(image.rgba[i]) - static_cast<int>(flat[i % 4])) <= 1;
+				}
+			}
+			std::cout << "[TextureCooker] SelfTest flat " << ((filter == MipFilter::Box) ? "Box" : "Kaiser") << (ok ? " OK" : " FAILED") << std::endl;
+			passed = passed && ok;
+		}
+
+		// 壊れた .ctex は読み込まない（ヘッダとミップの寸法の食い違い・データの途切れ・ミップ数の過多）
+		{
+			CookOptions options{};
+			options.format = CookedFormat::BC1;
+			CookedTexture cooked;
+			std::vector<uint8_t> valid;
+			bool ok = Cook(source.data(), Size, Size, options, cooked);
+			Serialize(cooked, valid);
+
+			CookedTexture loaded;
+			std::vector<uint8_t> bytes = valid;
+			const uint32_t wrongHeight = Size / 2;
+			std::memcpy(bytes.data() + offsetof(CookedHeader, height), &wrongHeight, sizeof(wrongHeight));
+			ok = ok && !Deserialize(bytes.data(), bytes.size(), loaded);
+
+			ok = ok && !Deserialize(valid.data(), valid.size() - 1, loaded);
+
+			bytes = valid;
+			const uint32_t tooManyMips = ComputeFullMipCount(Size, Size) + 1;
+			std::memcpy(bytes.data() + offsetof(CookedHeader, mipCount), &tooManyMips, sizeof(tooManyMips));
+			ok = ok && !Deserialize(bytes.data(), bytes.size(), loaded);
+
+			std::cout << "[TextureCooker] SelfTest corrupted" << (ok ? " OK" : " FAILED") << std::endl;
+			passed = passed && ok;
+		}
+
+		// 元画像より古い .ctex は使わない
+		{
+			std::error_code ec;
+			const auto directory = std::filesystem::temp_directory_path(ec) / "ctex_selftest";
+			std::filesystem::create_directories(directory, ec);
+			const std::string sourcePath = (directory / "source.png").string();
+			const std::string cookedPath = GetCookedPath(sourcePath);
+			std::ofstream(sourcePath, std::ios::binary | std::ios::trunc) << 's';
+			std::ofstream(cookedPath, std::ios::binary | std::ios::trunc) << 'c';
+
+			const auto now = std::filesystem::file_time_type::clock::now();
+			std::filesystem::last_write_time(sourcePath, now, ec);
+			std::filesystem::last_write_time(cookedPath, now - std::chrono::hours(1), ec);
+			bool ok = !ec && !IsCookedUpToDate(sourcePath, cookedPath);
+
+			std::filesystem::last_write_time(cookedPath, now + std::chrono::hours(1), ec);
+			ok = ok && !ec && IsCookedUpToDate(sourcePath, cookedPath);
+
+			std::filesystem::remove(sourcePath, ec);
+			ok = ok && IsCookedUpToDate(sourcePath, cookedPath);
+
+			std::filesystem::remove_all(directory, ec);
+			std::cout << "[TextureCooker] SelfTest timestamp" << (ok ? " OK" : " FAILED") << std::endl;
+			passed = passed && ok;
+		}
+
+		std::cout << "[TextureCooker] SelfTest " << (passed ? "passed" : "FAILED") << std::endl;
+		return passed;
+	}
+
+	/** @brief コマンドライン引数を解釈して変換を実行する
+	 *  @param _argc 引数の数
+	 *  @param _argv 引数
+	 *  @param _outExitCode 終了コード
+	 *  @return 変換用の引数だった場合 true（アプリケーションは起動しない）
+	 */
+	bool RunCommandLine(int _argc, char** _argv, int& _outExitCode)
+	{
+		if (_argc < 2) { return false; }
+
+		const std::string command = _argv[1];
+		if (command == "--cook-textures-selftest")
+		{
+			_outExitCode = RunSelfTest() ? 0 : 1;
+			return true;
+		}
+		if (command != "--cook-textures") { return false; }
+
+		if (_argc < 3)
+		{
+			std::cerr << "usage: --cook-textures <dir> [rgba8|bc1|bc3|bc5|bc7] [box|kaiser]\n";
+			_outExitCode = 1;
+			return true;
+		}
+
+		CookOptions options{};
+		for (int i = 3; i < _argc; i++)
+		{
+			const std::string arg = _argv[i];
+			if (arg == "rgba8") { options.format = CookedFormat::RGBA8; options.selectFormatByAlpha = false; }
+			else if (arg == "bc1") { options.format = CookedFormat::BC1; options.selectFormatByAlpha = false; }
+			else if (arg == "bc3") { options.format = CookedFormat::BC3; options.selectFormatByAlpha = false; }
+			else if (arg == "bc5") { options.format = CookedFormat::BC5; options.selectFormatByAlpha = false; options.srgb = false; }
+			else if (arg == "bc7") { options.format = CookedFormat::BC7; options.selectFormatByAlpha = false; }
+			else if (arg == "box") { options.mipFilter = MipFilter::Box; }
+			else if (arg == "kaiser") { options.mipFilter = MipFilter::Kaiser; }
+			else { std::cerr << "[TextureCooker] Unknown option: " << arg << std::endl; }
+		}
+
+		_outExitCode = CookDirectory(_argv[2], options) ? 0 : 1;
+		return true;
+	}
+} // namespace Graphics::TextureCooker
@@ -6,6 +6,7 @@
  // Includes
  //-----------------------------------------------------------------------------
 #include "Include/Framework/Graphics/TextureFactory.h"
+#include "Include/Framework/Core/ContentRegistry.h"
 
 //-----------------------------------------------------------------------------
 // TextureFactory class
@@ -65,3 +66,30 @@ std::unique_ptr<TextureResource> TextureFactory::CreateSolidColorTexture(
 
     return texture;
 }
+
+std::shared_ptr<TextureResource> TextureFactory::AcquireSolidColorTexture(
+    ID3D11Device* _device,
+    const DX::Color& _color,
+    int _width,
+    int _height)
+{
+    if (!_device) { return nullptr; }
+
+    // 生成されるピクセルと同じ値で引く（8bit 化後に同じ色なら同じテクスチャ）
+    ContentHasher hasher;
+    hasher.AppendString("SolidColor");
+    hasher.AppendValue(_width);
+    hasher.AppendValue(_height);
+    const uint8_t rgba[4] = {
+        static_cast<uint8_t>(_color.R() * 255),
+        static_cast<uint8_t>(_color.G() * 255),
+        static_cast<uint8_t>(_color.B() * 255),
+        static_cast<uint8_t>(_color.A() * 255),
+    };
+    hasher.Append(rgba, sizeof(rgba));
+
+    return ContentRegistry::Acquire<TextureResource>(hasher.GetKey(), [&]()
+        {
+            return TextureFactory::CreateSolidColorTexture(_device, _color, _width, _height);
+        });
+}
@@ -6,7 +6,9 @@
 #include "Include/Framework/Graphics/TextureLoader.h"
 #include "Include/Framework/Core/SystemLocator.h"
 #include "Include/Framework/Core/D3D11System.h"
+#include "Include/Framework/Core/ContentRegistry.h"
 
+#include <filesystem>
 #include <fstream>
 #include <vector>
 #include <d3d11.h>
@@ -17,27 +19,104 @@
 #define STBI_NO_GIF			// ← GIF ローダ自体を無効化（関数で確保している自動変数（スタック上のローカル領域）が大きい警告を消す）
 #include "../External/stb/include/stb_image.h"
 
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+    /** @brief ファイルを丸ごと読み込む
+     *  @param _path ファイルパス
+     *  @param _outBytes 出力先
+     *  @return 成功時 true
+     */
+    static bool ReadFileBytes(const std::string& _path, std::vector<unsigned char>& _outBytes)
+    {
+        std::ifstream ifs(_path, std::ios::binary | std::ios::ate);
+        if (!ifs) {
+            OutputDebugStringA(("TextureLoader::FromFile - ファイルを開けませんでした: " + _path + "\n").c_str());
+            return false;
+        }
+
+        std::streamsize size = ifs.tellg();
+        ifs.seekg(0, std::ios::beg);
+
+        _outBytes.resize(static_cast<size_t>(size));
+        if (!ifs.read(reinterpret_cast<char*>(_outBytes.data()), size)) {
+            OutputDebugStringA(("TextureLoader::FromFile - ファイル読み込み失敗: " + _path + "\n").c_str());
+            return false;
+        }
+        return true;
+    }
+
+    /** @brief 使える変換済みの .ctex が隣にあるか
+     *  @param _path 元画像のパス
+     *  @param _outCookedPath .ctex のパス
+     *  @return 存在し、元画像より古くなければ true
+     */
+    static bool FindCookedSibling(const std::string& _path, std::string& _outCookedPath)
+    {
+        _outCookedPath = Graphics::TextureCooker::GetCookedPath(_path);
+        if (_outCookedPath == _path) { return false; }
+
+        std::error_code ec;
+        if (!std::filesystem::exists(_outCookedPath, ec)) { return false; }
+
+        // 元画像を編集した後に変換し直していない .ctex は使わない
+        if (!Graphics::TextureCooker::IsCookedUpToDate(_path, _outCookedPath))
+        {
+            OutputDebugStringA(("TextureLoader - 元画像より古い .ctex のため元画像を使います: " + _outCookedPath + "\n").c_str());
+            return false;
+        }
+        return true;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // ファイルからテクスチャを読み込む
 //-----------------------------------------------------------------------------
 std::unique_ptr<TextureResource> TextureLoader::FromFile(const std::string& _path) const
 {
-    std::ifstream ifs(_path, std::ios::binary | std::ios::ate);
-    if (!ifs) {
-        OutputDebugStringA(("TextureLoader::FromFile - ファイルを開けませんでした: " + _path + "\n").c_str());
-        return nullptr;
+    // 変換済みの .ctex があればそちらを優先する（デコードもミップ生成も不要）
+    std::string cookedPath;
+    if (::FindCookedSibling(_path, cookedPath))
+    {
+        if (auto cooked = this->FromFile(cookedPath))
+        {
+            return cooked;
+        }
+        OutputDebugStringA(("TextureLoader::FromFile - .ctex の読み込みに失敗したため元画像を使います: " + cookedPath + "\n").c_str());
     }
 
-    std::streamsize size = ifs.tellg();
-    ifs.seekg(0, std::ios::beg);
+    std::vector<unsigned char> buffer;
+    if (!::ReadFileBytes(_path, buffer)) { return nullptr; }
 
-    std::vector<unsigned char> buffer(size);
-    if (!ifs.read(reinterpret_cast<char*>(buffer.data()), size)) {
-        OutputDebugStringA(("TextureLoader::FromFile - ファイル読み込み失敗: " + _path + "\n").c_str());
-        return nullptr;
+    return FromMemory(buffer.data(), static_cast<int>(buffer.size()));
+}
+
+//-----------------------------------------------------------------------------
+// ファイルから読み込み、内容が同じテクスチャは共有する
+//-----------------------------------------------------------------------------
+std::shared_ptr<TextureResource> TextureLoader::AcquireShared(const std::string& _path) const
+{
+    std::string cookedPath;
+    if (::FindCookedSibling(_path, cookedPath))
+    {
+        if (auto cooked = this->AcquireShared(cookedPath))
+        {
+            return cooked;
+        }
+        OutputDebugStringA(("TextureLoader::AcquireShared - .ctex の読み込みに失敗したため元画像を使います: " + cookedPath + "\n").c_str());
     }
 
-    return FromMemory(buffer.data(), static_cast<int>(buffer.size()));
+    std::vector<unsigned char> buffer;
+    if (!::ReadFileBytes(_path, buffer)) { return nullptr; }
+
+    // デコード・転送の前に内容で引くので、同じ画像は 2 回目以降ファイル読み込みだけで済む
+    const ContentKey key = ContentHasher::HashBytes(buffer.data(), buffer.size());
+    return ContentRegistry::Acquire<TextureResource>(key, [&]()
+        {
+            return this->FromMemory(buffer.data(), static_cast<int>(buffer.size()));
+        });
 }
 
 //-----------------------------------------------------------------------------
@@ -45,6 +124,18 @@ std::unique_ptr<TextureResource> TextureLoader::FromFile(const std::string& _pat
 //-----------------------------------------------------------------------------
 std::unique_ptr<TextureResource> TextureLoader::FromMemory(const unsigned char* _data, int _len) const
 {
+    // .ctex はブロック圧縮済みのミップをそのまま転送する
+    if (Graphics::TextureCooker::IsCookedData(_data, static_cast<size_t>(_len)))
+    {
+        Graphics::TextureCooker::CookedTexture cooked;
+        if (!Graphics::TextureCooker::Deserialize(_data, static_cast<size_t>(_len), cooked))
+        {
+            OutputDebugStringA("TextureLoader::FromMemory - .ctex の解析に失敗\n");
+            return nullptr;
+        }
+        return this->FromCooked(cooked);
+    }
+
     auto tex = std::make_unique<TextureResource>();
 
     int channels = 0;
@@ -92,6 +183,66 @@ std::unique_ptr<TextureResource> TextureLoader::FromMemory(const unsigned char*
     return std::move(tex);
 }
 
+//-----------------------------------------------------------------------------
+// 変換済みテクスチャをそのまま転送
+//-----------------------------------------------------------------------------
+std::unique_ptr<TextureResource> TextureLoader::FromCooked(const Graphics::TextureCooker::CookedTexture& _cooked) const
+{
+    using Graphics::TextureCooker::CookedFormat;
+
+    if (_cooked.mips.empty()) { return nullptr; }
+
+    // 描画は従来どおり UNORM で行う（sRGB フラグはミップ生成時の色空間を表すだけ）
+    DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    int bpp = 32;
+    switch (_cooked.format)
+    {
+    case CookedFormat::BC1: format = DXGI_FORMAT_BC1_UNORM; bpp = 4; break;
+    case CookedFormat::BC3: format = DXGI_FORMAT_BC3_UNORM; bpp = 8; break;
+    case CookedFormat::BC5: format = DXGI_FORMAT_BC5_UNORM; bpp = 8; break;
+    case CookedFormat::BC7: format = DXGI_FORMAT_BC7_UNORM; bpp = 8; break;
+    case CookedFormat::RGBA8:
+    default: break;
+    }
+
+    D3D11_TEXTURE2D_DESC desc{};
+    desc.Width = _cooked.width;
+    desc.Height = _cooked.height;
+    desc.MipLevels = static_cast<UINT>(_cooked.mips.size());
+    desc.ArraySize = 1;
+    desc.Format = format;
+    desc.SampleDesc.Count = 1;
+    desc.Usage = D3D11_USAGE_IMMUTABLE;
+    desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+    std::vector<D3D11_SUBRESOURCE_DATA> subresources(_cooked.mips.size());
+    for (size_t i = 0; i < _cooked.mips.size(); ++i)
+    {
+        subresources[i].pSysMem = _cooked.mips[i].data.data();
+        subresources[i].SysMemPitch = _cooked.mips[i].rowPitch;
+    }
+
+    auto device = SystemLocator::Get<D3D11System>().GetDevice();
+    DX::ComPtr<ID3D11Texture2D> texture;
+    HRESULT hr = device->CreateTexture2D(&desc, subresources.data(), texture.GetAddressOf());
+    if (FAILED(hr)) {
+        OutputDebugStringA("TextureLoader::FromCooked - CreateTexture2D 失敗\n");
+        return nullptr;
+    }
+
+    auto tex = std::make_unique<TextureResource>();
+    hr = device->CreateShaderResourceView(texture.Get(), nullptr, tex->texture.GetAddressOf());
+    if (FAILED(hr)) {
+        OutputDebugStringA("TextureLoader::FromCooked - CreateSRV 失敗\n");
+        return nullptr;
+    }
+
+    tex->width = static_cast<int>(_cooked.width);
+    tex->height = static_cast<int>(_cooked.height);
+    tex->bpp = bpp;
+    return tex;
+}
+
 std::unique_ptr<TextureResource> TextureLoader::FromRawRGBA(
     const unsigned char* data,
     unsigned int width,
@@ -0,0 +1,303 @@
+﻿/** @file   VertexQuantizer.cpp
+ *  @brief  GPU 頂点の圧縮（八面体法線・half UV・8bit スキニング・16bit 位置）
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Graphics/VertexQuantizer.h"
+
+#include <DirectXPackedVector.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	/** @brief [-1, 1] の値を SNORM16 に変換する
+	 *  @param _value 入力値
+	 *  @return SNORM16
+	 */
+	static int16_t ToSnorm16(float _value)
+	{
+		const float clamped = std::clamp(_value, -1.0f, 1.0f);
+		return static_cast<int16_t>(std::lround(clamped * 32767.0f));
+	}
+
+	/** @brief 符号（0 は +1 として扱う）
+	 *  @param _value 入力値
+	 *  @return ±1
+	 */
+	static float SignNotZero(float _value)
+	{
+		return (_value >= 0.0f) ? 1.0f : -1.0f;
+	}
+
+	/** @brief 圧縮頂点の共通部分（位置以外）を書き込む
+	 *  @tparam VertexT 圧縮頂点型
+	 *  @param _src 入力頂点
+	 *  @param _dst 出力頂点
+	 */
+	template<typename VertexT>
+	static void WriteNormalAndTexcoord(const Graphics::ModelVertexGPU& _src, VertexT& _dst)
+	{
+		Graphics::VertexQuantizer::EncodeOctNormal(_src.normal, _dst.normal);
+		_dst.texcoord[0] = DirectX::PackedVector::XMConvertFloatToHalf(_src.texcoord.x);
+		_dst.texcoord[1] = DirectX::PackedVector::XMConvertFloatToHalf(_src.texcoord.y);
+	}
+
+	/** @brief 圧縮頂点のスキニング情報を書き込む
+	 *  @tparam VertexT 圧縮頂点型
+	 *  @param _src 入力頂点
+	 *  @param _dst 出力頂点
+	 */
+	template<typename VertexT>
+	static void WriteSkinning(const Graphics::ModelVertexGPU& _src, VertexT& _dst)
+	{
+		for (int k = 0; k < 4; k++)
+		{
+			_dst.boneIndex[k] = static_cast<uint8_t>(_src.boneIndex[k]);
+		}
+		Graphics::VertexQuantizer::QuantizeBoneWeights(_src.boneWeight, _dst.boneWeight);
+	}
+
+	/** @brief 頂点を 1 つずつ変換してバイト列に詰める
+	 *  @tparam VertexT 圧縮頂点型
+	 *  @param _vertices 入力頂点配列
+	 *  @param _outBytes 出力バイト列
+	 *  @param _convert 変換関数
+	 */
+	template<typename VertexT, typename ConvertFunc>
+	static void EncodeAll(const std::vector<Graphics::ModelVertexGPU>& _vertices, std::vector<uint8_t>& _outBytes, ConvertFunc _convert)
+	{
+		_outBytes.resize(_vertices.size() * sizeof(VertexT));
+		for (size_t i = 0; i < _vertices.size(); i++)
+		{
+			VertexT dst{};
+			_convert(_vertices[i], dst);
+			std::memcpy(_outBytes.data() + i * sizeof(VertexT), &dst, sizeof(VertexT));
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Namespace : Graphics::VertexQuantizer
+//-----------------------------------------------------------------------------
+namespace Graphics::VertexQuantizer
+{
+	/** @brief 形式ごとの頂点ストライドを取得
+	 *  @param _format 頂点形式
+	 *  @param _skinned スキニング情報を含めるか
+	 *  @return 1 頂点のバイト数
+	 */
+	UINT GetVertexStride(VertexFormat _format, bool _skinned)
+	{
+		switch (_format)
+		{
+		case VertexFormat::Compact:
+			return _skinned ? sizeof(SkinnedVertexCompactGPU) : sizeof(ModelVertexCompactGPU);
+		case VertexFormat::CompactQuantized:
+			return _skinned ? sizeof(SkinnedVertexQuantizedGPU) : sizeof(ModelVertexQuantizedGPU);
+		case VertexFormat::Full:
+		default:
+			return sizeof(ModelVertexGPU);
+		}
+	}
+
+	/** @brief 単位法線を八面体エンコードする
+	 *  @param _normal 法線（正規化済みでなくてもよい）
+	 *  @param _outEncoded 出力（SNORM16 x2）
+	 */
+	void EncodeOctNormal(const DirectX::XMFLOAT3& _normal, int16_t _outEncoded[2])
+	{
+		const float l1 = std::fabs(_normal.x) + std::fabs(_normal.y) + std::fabs(_normal.z);
+		if (l1 <= FLT_EPSILON)
+		{
+			// 長さ 0 の法線は +Z として扱う
+			_outEncoded[0] = 0;
+			_outEncoded[1] = 0;
+			return;
+		}
+
+		// 八面体へ射影し、下半球は対角線で折り返して正方形に収める
+		float x = _normal.x / l1;
+		float y = _normal.y / l1;
+		if (_normal.z < 0.0f)
+		{
+			const float foldedX = (1.0f - std::fabs(y)) * ::SignNotZero(x);
+			const float foldedY = (1.0f - std::fabs(x)) * ::SignNotZero(y);
+			x = foldedX;
+			y = foldedY;
+		}
+
+		_outEncoded[0] = ::ToSnorm16(x);
+		_outEncoded[1] = ::ToSnorm16(y);
+	}
+
+	/** @brief 八面体エンコードされた法線を復元する（検証用、HLSL の DecodeOctNormal と同じ計算）
+	 *  @param _encoded エンコード済み法線
+	 *  @return 正規化済み法線
+	 */
+	DirectX::XMFLOAT3 DecodeOctNormal(const int16_t _encoded[2])
+	{
+		// SNORM の -32768 は -1 に丸められる
+		float x = std::max(static_cast<float>(_encoded[0]) / 32767.0f, -1.0f);
+		float y = std::max(static_cast<float>(_encoded[1]) / 32767.0f, -1.0f);
+		const float z = 1.0f - std::fabs(x) - std::fabs(y);
+
+		const float t = std::clamp(-z, 0.0f, 1.0f);
+		x += (x >= 0.0f) ? -t : t;
+		y += (y >= 0.0f) ? -t : t;
+
+		const float length = std::sqrt(x * x + y * y + z * z);
+		return { x / length, y / length, z / length };
+	}
+
+	/** @brief ボーンウェイトを合計が 255 になるよう 8bit に量子化する
+	 *  @param _weights 入力ウェイト（4 本）
+	 *  @param _outWeights 出力ウェイト（UNORM8 x4）
+	 */
+	void QuantizeBoneWeights(const float _weights[4], uint8_t _outWeights[4])
+	{
+		float sum = 0.0f;
+		for (int k = 0; k < 4; k++)
+		{
+			sum += std::max(_weights[k], 0.0f);
+		}
+		if (sum <= 0.0f)
+		{
+			std::memset(_outWeights, 0, 4);
+			return;
+		}
+
+		// 丸め誤差で合計が 255 からずれると頂点が縮む/膨らむため、最大ウェイトで端数を吸収する
+		int total = 0;
+		int largest = 0;
+		for (int k = 0; k < 4; k++)
+		{
+			const int q = static_cast<int>(std::lround(std::max(_weights[k], 0.0f) / sum * 255.0f));
+			_outWeights[k] = static_cast<uint8_t>(std::clamp(q, 0, 255));
+			total += _outWeights[k];
+			if (_outWeights[k] > _outWeights[largest]) { largest = k; }
+		}
+		_outWeights[largest] = static_cast<uint8_t>(std::clamp(_outWeights[largest] + (255 - total), 0, 255));
+	}
+
+	/** @brief 位置の量子化に使う復元パラメータを求める
+	 *  @param _vertices 頂点配列
+	 *  @return AABB 中心と最大半径
+	 */
+	VertexDequantBuffer ComputePositionDequant(const std::vector<ModelVertexGPU>& _vertices)
+	{
+		VertexDequantBuffer dequant{};
+		if (_vertices.empty()) { return dequant; }
+
+		DX::Vector3 minPos(FLT_MAX, FLT_MAX, FLT_MAX);
+		DX::Vector3 maxPos(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (const auto& v : _vertices)
+		{
+			minPos = DX::Vector3::Min(minPos, DX::Vector3(v.position));
+			maxPos = DX::Vector3::Max(maxPos, DX::Vector3(v.position));
+		}
+
+		// 軸ごとにスケールを変えると法線の変換が必要になるため、最大半径で全軸を揃える
+		const DX::Vector3 halfExtent = (maxPos - minPos) * 0.5f;
+		dequant.positionOffset = (minPos + maxPos) * 0.5f;
+		dequant.positionScale = std::max({ halfExtent.x, halfExtent.y, halfExtent.z, FLT_EPSILON });
+		return dequant;
+	}
+
+	/** @brief 頂点配列を指定形式のバイト列に変換する
+	 *  @param _vertices 入力頂点配列
+	 *  @param _format 頂点形式（Full の場合はそのままコピー）
+	 *  @param _skinned スキニング情報を含めるか
+	 *  @param _dequant 位置の復元パラメータ（CompactQuantized のみ使用）
+	 *  @param _outBytes 出力バイト列（GetVertexStride * 頂点数）
+	 *  @return ボーンインデックスが 8bit に収まらない場合 false
+	 */
+	bool Encode(const std::vector<ModelVertexGPU>& _vertices, VertexFormat _format, bool _skinned,
+		const VertexDequantBuffer& _dequant, std::vector<uint8_t>& _outBytes)
+	{
+		_outBytes.clear();
+
+		if (_format != VertexFormat::Full && _skinned)
+		{
+			for (const auto& v : _vertices)
+			{
+				for (int k = 0; k < 4; k++)
+				{
+					if (v.boneIndex[k] > MaxCompactBoneIndex) { return false; }
+				}
+			}
+		}
+
+		const float invScale = 1.0f / _dequant.positionScale;
+		auto quantizePosition = [&](const ModelVertexGPU& _src, int16_t _dst[4])
+			{
+				const DX::Vector3 local = (DX::Vector3(_src.position) - _dequant.positionOffset) * invScale;
+				_dst[0] = ::ToSnorm16(local.x);
+				_dst[1] = ::ToSnorm16(local.y);
+				_dst[2] = ::ToSnorm16(local.z);
+				_dst[3] = 32767;
+			};
+
+		switch (_format)
+		{
+		case VertexFormat::Compact:
+			if (_skinned)
+			{
+				::EncodeAll<SkinnedVertexCompactGPU>(_vertices, _outBytes, [&](const ModelVertexGPU& _src, SkinnedVertexCompactGPU& _dst)
+					{
+						_dst.position = _src.position;
+						::WriteNormalAndTexcoord(_src, _dst);
+						::WriteSkinning(_src, _dst);
+					});
+			}
+			else
+			{
+				::EncodeAll<ModelVertexCompactGPU>(_vertices, _outBytes, [&](const ModelVertexGPU& _src, ModelVertexCompactGPU& _dst)
+					{
+						_dst.position = _src.position;
+						::WriteNormalAndTexcoord(_src, _dst);
+					});
+			}
+			break;
+
+		case VertexFormat::CompactQuantized:
+			if (_skinned)
+			{
+				::EncodeAll<SkinnedVertexQuantizedGPU>(_vertices, _outBytes, [&](const ModelVertexGPU& _src, SkinnedVertexQuantizedGPU& _dst)
+					{
+						quantizePosition(_src, _dst.position);
+						::WriteNormalAndTexcoord(_src, _dst);
+						::WriteSkinning(_src, _dst);
+					});
+			}
+			else
+			{
+				::EncodeAll<ModelVertexQuantizedGPU>(_vertices, _outBytes, [&](const ModelVertexGPU& _src, ModelVertexQuantizedGPU& _dst)
+					{
+						quantizePosition(_src, _dst.position);
+						::WriteNormalAndTexcoord(_src, _dst);
+					});
+			}
+			break;
+
+		case VertexFormat::Full:
+		default:
+			_outBytes.resize(_vertices.size() * sizeof(ModelVertexGPU));
+			if (!_vertices.empty())
+			{
+				std::memcpy(_outBytes.data(), _vertices.data(), _outBytes.size());
+			}
+			break;
+		}
+		return true;
+	}
+} // namespace Graphics::VertexQuantizer
@@ -0,0 +1,522 @@
+﻿/** @file   ColliderCooker.cpp
+ *  @brief  メッシュ・凸包コライダーの生成と .ccol 形式の読み書き
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/ColliderCooker.h"
+#include "Include/Framework/Graphics/ModelData.h"
+#include "Include/Framework/Graphics/MeshSimplifier.h"
+
+#include <Jolt/RegisterTypes.h>
+#include <Jolt/Core/Factory.h>
+#include <Jolt/Core/StreamWrapper.h>
+#include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/Shape/MeshShape.h>
+#include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
+#include <Jolt/Physics/Collision/Shape/StaticCompoundShape.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace Framework::Physics::ColliderCooker
+{
+	//-----------------------------------------------------------------------------
+	// Local Helpers
+	//-----------------------------------------------------------------------------
+	namespace
+	{
+		/** @brief 使うサブセット（= メッシュ）の番号を列挙する
+		 *  @param _model モデルデータ
+		 *  @param _options 変換設定
+		 *  @return メッシュ番号（範囲外は除く）
+		 */
+		static std::vector<uint32_t> SelectMeshes(const Graphics::Import::ModelData& _model, const CookOptions& _options)
+		{
+			const uint32_t meshCount = static_cast<uint32_t>(std::min(_model.vertices.size(), _model.indices.size()));
+
+			std::vector<uint32_t> meshes;
+			if (_options.subsets.empty())
+			{
+				for (uint32_t i = 0; i < meshCount; ++i) { meshes.push_back(i); }
+				return meshes;
+			}
+
+			for (const uint32_t subset : _options.subsets)
+			{
+				if (subset < meshCount) { meshes.push_back(subset); }
+				else { std::cerr << "[ColliderCooker] サブセット番号が範囲外です : " << subset << " (メッシュ数 " << meshCount << ")" << std::endl; }
+			}
+			return meshes;
+		}
+
+		/** @brief メッシュの頂点位置を集める
+		 *  @param _vertices 頂点配列
+		 *  @param _out 追加先
+		 */
+		static void AppendPoints(const std::vector<Graphics::Import::Vertex>& _vertices, JPH::Array<JPH::Vec3>& _out)
+		{
+			for (const auto& v : _vertices)
+			{
+				_out.push_back(JPH::Vec3(v.pos.x, v.pos.y, v.pos.z));
+			}
+		}
+
+		/** @brief ShapeSettings から形状を作る
+		 *  @param _settings 設定
+		 *  @param _label ログ用の名前
+		 *  @return 形状（失敗時 nullptr）
+		 */
+		static JPH::ShapeRefC CreateShape(const JPH::ShapeSettings& _settings, const char* _label)
+		{
+			JPH::ShapeSettings::ShapeResult result = _settings.Create();
+			if (result.HasError())
+			{
+				std::cerr << "[ColliderCooker] " << _label << " の生成に失敗しました : " << result.GetError().c_str() << std::endl;
+				return nullptr;
+			}
+			return result.Get();
+		}
+
+		/** @brief 三角形メッシュを作る（必要なら簡略化する）
+		 *  @param _model モデルデータ
+		 *  @param _meshes 使うメッシュ番号
+		 *  @param _options 変換設定
+		 *  @return 形状
+		 */
+		static JPH::ShapeRefC CookMesh(const Graphics::Import::ModelData& _model, const std::vector<uint32_t>& _meshes, const CookOptions& _options)
+		{
+			namespace Simplifier = Graphics::Import::MeshSimplifier;
+
+			JPH::VertexList vertices;
+			JPH::IndexedTriangleList triangles;
+
+			for (const uint32_t mesh : _meshes)
+			{
+				const auto& srcVertices = _model.vertices[mesh];
+				const auto& srcIndices = _model.indices[mesh];
+				const uint32_t base = static_cast<uint32_t>(vertices.size());
+
+				// 簡略化は頂点を共有したままインデックスだけを間引く
+				std::vector<unsigned int> simplified;
+				const std::vector<unsigned int>* indices = &srcIndices;
+				const size_t triangleCount = srcIndices.size() / 3;
+				if (_options.simplifyRatio < 1.0f && triangleCount >= Simplifier::MinLodTriangleCount)
+				{
+					const size_t target = std::max<size_t>(1, static_cast<size_t>(std::lround(triangleCount * _options.simplifyRatio))) * 3;
+					simplified = Simplifier::Simplify(srcVertices, srcIndices, target);
+					if (!simplified.empty()) { indices = &simplified; }
+				}
+
+				for (const auto& v : srcVertices)
+				{
+					vertices.push_back(JPH::Float3(v.pos.x, v.pos.y, v.pos.z));
+				}
+				for (size_t i = 0; i + 2 < indices->size(); i += 3)
+				{
+					triangles.push_back(JPH::IndexedTriangle(
+						base + (*indices)[i + 0],
+						base + (*indices)[i + 1],
+						base + (*indices)[i + 2]));
+				}
+			}
+
+			if (triangles.empty())
+			{
+				std::cerr << "[ColliderCooker] 変換する三角形がありません" << std::endl;
+				return nullptr;
+			}
+
+			// 縮退三角形は MeshShapeSettings が取り除く
+			const JPH::MeshShapeSettings settings(std::move(vertices), std::move(triangles));
+			return CreateShape(settings, "メッシュ形状");
+		}
+
+		/** @brief 点群から凸包を作る
+		 *  @param _points 点群
+		 *  @param _options 変換設定
+		 *  @return 形状（点が足りなければ nullptr）
+		 */
+		static JPH::ShapeRefC CookHull(const JPH::Array<JPH::Vec3>& _points, const CookOptions& _options)
+		{
+			if (_points.size() < 4) { return nullptr; }
+
+			JPH::ConvexHullShapeSettings settings(_points, _options.maxConvexRadius);
+			settings.mHullTolerance = _options.hullTolerance;
+			return CreateShape(settings, "凸包");
+		}
+
+		/** @brief サブセットごとの凸包を複合形状にまとめる
+		 *  @param _model モデルデータ
+		 *  @param _meshes 使うメッシュ番号
+		 *  @param _options 変換設定
+		 *  @return 形状
+		 */
+		static JPH::ShapeRefC CookDecomposition(const Graphics::Import::ModelData& _model, const std::vector<uint32_t>& _meshes, const CookOptions& _options)
+		{
+			std::vector<JPH::ShapeRefC> hulls;
+			JPH::Array<JPH::Vec3> points;
+
+			for (const uint32_t mesh : _meshes)
+			{
+				points.clear();
+				AppendPoints(_model.vertices[mesh], points);
+
+				JPH::ShapeRefC hull = CookHull(points, _options);
+				if (hull) { hulls.push_back(hull); }
+			}
+
+			if (hulls.empty())
+			{
+				std::cerr << "[ColliderCooker] 凸包を作れるサブセットがありません" << std::endl;
+				return nullptr;
+			}
+			if (hulls.size() == 1) { return hulls.front(); }
+
+			JPH::StaticCompoundShapeSettings settings;
+			for (const auto& hull : hulls)
+			{
+				settings.AddShape(JPH::Vec3::sZero(), JPH::Quat::sIdentity(), hull.GetPtr());
+			}
+			return CreateShape(settings, "凸包の複合形状");
+		}
+
+		/** @brief セルフテスト用のモデル（原点の UV 球と、x = 3 に置いた直方体の 2 メッシュ）を作る
+		 *  @return モデルデータ
+		 */
+		static Graphics::Import::ModelData BuildSelfTestModel()
+		{
+			Graphics::Import::ModelData model;
+			model.vertices.resize(2);
+			model.indices.resize(2);
+
+			auto addVertex = [](std::vector<Graphics::Import::Vertex>& _vertices, float _x, float _y, float _z)
+				{
+					Graphics::Import::Vertex vertex{};
+					vertex.pos = { _x, _y, _z };
+					_vertices.push_back(vertex);
+				};
+
+			// UV 球（極は 1 頂点にまとめる）
+			constexpr uint32_t Slices = 16;
+			constexpr uint32_t Stacks = 8;
+			auto& sphereVertices = model.vertices[0];
+			auto& sphereIndices = model.indices[0];
+			addVertex(sphereVertices, 0.0f, 1.0f, 0.0f);
+			for (uint32_t stack = 1; stack < Stacks; stack++)
+			{
+				const float phi = 3.14159265f * static_cast<float>(stack) / static_cast<float>(Stacks);
+				for (uint32_t slice = 0; slice < Slices; slice++)
+				{
+					const float theta = 2.0f * 3.14159265f * static_cast<float>(slice) / static_cast<float>(Slices);
+					addVertex(sphereVertices, std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+				}
+			}
+			addVertex(sphereVertices, 0.0f, -1.0f, 0.0f);
+
+			const unsigned int bottom = static_cast<unsigned int>(sphereVertices.size() - 1);
+			auto ring = [](uint32_t _stack, uint32_t _slice) { return 1 + (_stack - 1) * Slices + (_slice % Slices); };
+			for (uint32_t slice = 0; slice < Slices; slice++)
+			{
+				sphereIndices.insert(sphereIndices.end(), { 0u, ring(1, slice + 1), ring(1, slice) });
+				for (uint32_t stack = 1; stack + 1 < Stacks; stack++)
+				{
+					sphereIndices.insert(sphereIndices.end(), { ring(stack, slice), ring(stack, slice + 1), ring(stack + 1, slice) });
+					sphereIndices.insert(sphereIndices.end(), { ring(stack, slice + 1), ring(stack + 1, slice + 1), ring(stack + 1, slice) });
+				}
+				sphereIndices.insert(sphereIndices.end(), { bottom, ring(Stacks - 1, slice), ring(Stacks - 1, slice + 1) });
+			}
+
+			// 直方体（1 x 2 x 1）
+			auto& boxVertices = model.vertices[1];
+			for (uint32_t corner = 0; corner < 8; corner++)
+			{
+				addVertex(boxVertices, 3.0f + ((corner & 1) ? 0.5f : -0.5f), (corner & 2) ? 1.0f : -1.0f, (corner & 4) ? 0.5f : -0.5f);
+			}
+			model.indices[1] = {
+				0, 2, 1, 1, 2, 3,	4, 5, 6, 5, 7, 6,	// -z / +z
+				0, 1, 4, 1, 5, 4,	2, 6, 3, 3, 6, 7,	// -y / +y
+				0, 4, 2, 2, 4, 6,	1, 3, 5, 3, 7, 5,	// -x / +x
+			};
+			return model;
+		}
+
+		/** @brief 2 つの形状が同じ当たり方をするか比べる
+		 *  @param _expected 変換直後の形状
+		 *  @param _actual 復元した形状
+		 *  @return 境界・体積・レイの結果が一致すれば true
+		 */
+		static bool CompareShapes(const JPH::Shape& _expected, const JPH::Shape& _actual)
+		{
+			if (_expected.GetSubType() != _actual.GetSubType()) { return false; }
+
+			const JPH::AABox expectedBounds = _expected.GetLocalBounds();
+			const JPH::AABox actualBounds = _actual.GetLocalBounds();
+			if (!expectedBounds.mMin.IsClose(actualBounds.mMin, 1.0e-10f) || !expectedBounds.mMax.IsClose(actualBounds.mMax, 1.0e-10f)) { return false; }
+			if (std::fabs(_expected.GetVolume() - _actual.GetVolume()) > 1.0e-5f * std::max(1.0f, _expected.GetVolume())) { return false; }
+
+			// 境界の外側の格子点から中心へレイを飛ばし、当たり・距離・部分形状が同じか確認する
+			const JPH::Vec3 center = expectedBounds.GetCenter();
+			const JPH::Vec3 extent = expectedBounds.GetExtent() * 2.0f + JPH::Vec3::sReplicate(1.0f);
+			const JPH::SubShapeIDCreator creator;
+			for (int x = -2; x <= 2; x++)
+			{
+				for (int y = -2; y <= 2; y++)
+				{
+					for (int z = -2; z <= 2; z++)
+					{
+						if (x == 0 && y == 0 && z == 0) { continue; }
+
+						const JPH::Vec3 origin = center + JPH::Vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) * extent * 0.5f;
+						const JPH::RayCast ray{ origin, (center - origin) * 2.0f };
+
+						JPH::RayCastResult expectedHit;
+						JPH::RayCastResult actualHit;
+						const bool expectedResult = _expected.CastRay(ray, creator, expectedHit);
+						const bool actualResult = _actual.CastRay(ray, creator, actualHit);
+						if (expectedResult != actualResult) { return false; }
+						if (expectedResult && (std::fabs(expectedHit.mFraction - actualHit.mFraction) > 1.0e-6f || expectedHit.mSubShapeID2 != actualHit.mSubShapeID2))
+						{
+							return false;
+						}
+					}
+				}
+			}
+			return true;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// Functions
+	//-----------------------------------------------------------------------------
+	ContentKey ComputeSourceKey(const Graphics::Import::ModelData& _model, const CookOptions& _options)
+	{
+		ContentHasher hasher;
+		hasher.AppendValue(CookedVersion);
+		hasher.AppendValue(static_cast<uint32_t>(_options.kind));
+		hasher.AppendValue(_options.simplifyRatio);
+		hasher.AppendValue(_options.maxConvexRadius);
+		hasher.AppendValue(_options.hullTolerance);
+
+		// 当たり判定に関わるのは位置とインデックスだけ（UV・法線が変わっても作り直さない）
+		for (const uint32_t mesh : SelectMeshes(_model, _options))
+		{
+			const auto& vertices = _model.vertices[mesh];
+			hasher.AppendValue(mesh);
+			hasher.AppendValue(static_cast<uint64_t>(vertices.size()));
+			for (const auto& v : vertices)
+			{
+				const float position[3] = { v.pos.x, v.pos.y, v.pos.z };
+				hasher.Append(position, sizeof(position));
+			}
+			hasher.AppendVector(_model.indices[mesh]);
+		}
+		return hasher.GetKey();
+	}
+
+	JPH::ShapeRefC Cook(const Graphics::Import::ModelData& _model, const CookOptions& _options)
+	{
+		const std::vector<uint32_t> meshes = SelectMeshes(_model, _options);
+		if (meshes.empty())
+		{
+			std::cerr << "[ColliderCooker] 使えるサブセットがありません" << std::endl;
+			return nullptr;
+		}
+
+		switch (_options.kind)
+		{
+		case ShapeKind::Mesh:
+			return CookMesh(_model, meshes, _options);
+
+		case ShapeKind::ConvexHull:
+		{
+			JPH::Array<JPH::Vec3> points;
+			for (const uint32_t mesh : meshes) { AppendPoints(_model.vertices[mesh], points); }
+
+			JPH::ShapeRefC hull = CookHull(points, _options);
+			if (!hull) { std::cerr << "[ColliderCooker] 凸包を作るには頂点が足りません" << std::endl; }
+			return hull;
+		}
+
+		case ShapeKind::ConvexDecomposition:
+			return CookDecomposition(_model, meshes, _options);
+		}
+		return nullptr;
+	}
+
+	bool Save(const std::string& _path, const JPH::Shape& _shape, ShapeKind _kind, const ContentKey& _sourceKey)
+	{
+		std::ofstream ofs(_path, std::ios::binary | std::ios::trunc);
+		if (!ofs)
+		{
+			std::cerr << "[ColliderCooker] 出力先を開けません : " << _path << std::endl;
+			return false;
+		}
+
+		CookedHeader header{};
+		header.kind = static_cast<uint32_t>(_kind);
+		header.sourceHash = _sourceKey.hash;
+		header.sourceSize = _sourceKey.size;
+		ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		JPH::StreamOutWrapper stream(ofs);
+		JPH::Shape::ShapeToIDMap shapeMap;
+		JPH::Shape::MaterialToIDMap materialMap;
+		_shape.SaveWithChildren(stream, shapeMap, materialMap);
+
+		if (stream.IsFailed() || !ofs)
+		{
+			std::cerr << "[ColliderCooker] 書き込みに失敗しました : " << _path << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	JPH::ShapeRefC Load(const std::string& _path, const ContentKey& _sourceKey, ShapeKind& _outKind)
+	{
+		std::ifstream ifs(_path, std::ios::binary);
+		if (!ifs) { return nullptr; }
+
+		CookedHeader header{};
+		ifs.read(reinterpret_cast<char*>(&header), sizeof(header));
+		if (!ifs || header.magic != CookedMagic || header.version != CookedVersion) { return nullptr; }
+		if (header.sourceHash != _sourceKey.hash || header.sourceSize != _sourceKey.size) { return nullptr; }
+
+		JPH::StreamInWrapper stream(ifs);
+		JPH::Shape::IDToShapeMap shapeMap;
+		JPH::Shape::IDToMaterialMap materialMap;
+		JPH::Shape::ShapeResult result = JPH::Shape::sRestoreWithChildren(stream, shapeMap, materialMap);
+		if (result.HasError())
+		{
+			std::cerr << "[ColliderCooker] 復元に失敗しました : " << _path << " (" << result.GetError().c_str() << ")" << std::endl;
+			return nullptr;
+		}
+
+		_outKind = static_cast<ShapeKind>(header.kind);
+		return result.Get();
+	}
+
+	std::string GetCachePath(const std::string& _name, const ContentKey& _sourceKey)
+	{
+		char hash[17] = {};
+		std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(_sourceKey.hash));
+
+		const std::filesystem::path path = std::filesystem::path(DefaultCacheDirectory) / (_name + "-" + hash + CookedExtension);
+		return path.string();
+	}
+
+	std::shared_ptr<const CookedCollider> Acquire(const std::string& _name, const Graphics::Import::ModelData& _model, const CookOptions& _options)
+	{
+		const ContentKey key = ComputeSourceKey(_model, _options);
+
+		return ContentRegistry::Acquire<CookedCollider>(key, [&]() -> std::shared_ptr<CookedCollider>
+		{
+			auto cooked = std::make_shared<CookedCollider>();
+			const std::string path = GetCachePath(_name, key);
+
+			// 保存済みのものがあれば変換しない
+			cooked->shape = Load(path, key, cooked->kind);
+			if (cooked->shape) { return cooked; }
+
+			cooked->kind = _options.kind;
+			cooked->shape = Cook(_model, _options);
+			if (!cooked->shape) { return nullptr; }
+
+			std::error_code ec;
+			std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+			if (Save(path, *cooked->shape, cooked->kind, key))
+			{
+				std::cout << "[ColliderCooker] 変換して保存しました : " << _name << " -> " << path << std::endl;
+			}
+			return cooked;
+		});
+	}
+
+	bool RunSelfTest()
+	{
+		// アプリケーションを起動しないので、Jolt の型登録もここで行う（PhysicsSystem::Initialize と同じ手順）
+		const bool ownsFactory = (JPH::Factory::sInstance == nullptr);
+		if (ownsFactory)
+		{
+			JPH::RegisterDefaultAllocator();
+			JPH::Factory::sInstance = new JPH::Factory();
+			JPH::RegisterTypes();
+		}
+
+		std::error_code ec;
+		const std::filesystem::path directory = std::filesystem::temp_directory_path(ec) / "ccol_selftest";
+		std::filesystem::create_directories(directory, ec);
+
+		const Graphics::Import::ModelData model = BuildSelfTestModel();
+
+		struct Case
+		{
+			const char* name;
+			ShapeKind kind;
+			JPH::EShapeSubType subType;
+		};
+		const Case cases[] = {
+			{ "Mesh", ShapeKind::Mesh, JPH::EShapeSubType::Mesh },
+			{ "ConvexHull", ShapeKind::ConvexHull, JPH::EShapeSubType::ConvexHull },
+			{ "ConvexDecomposition", ShapeKind::ConvexDecomposition, JPH::EShapeSubType::StaticCompound },
+		};
+
+		bool passed = true;
+		for (const auto& testCase : cases)
+		{
+			CookOptions options{};
+			options.kind = testCase.kind;
+
+			const ContentKey key = ComputeSourceKey(model, options);
+			const std::string path = (directory / (std::string(testCase.name) + CookedExtension)).string();
+
+			JPH::ShapeRefC cooked = Cook(model, options);
+			bool ok = cooked != nullptr && cooked->GetSubType() == testCase.subType && Save(path, *cooked, testCase.kind, key);
+
+			// 保存したものを復元して、変換直後と同じ当たり方をするか
+			ShapeKind restoredKind = ShapeKind::Mesh;
+			JPH::ShapeRefC restored = ok ? Load(path, key, restoredKind) : nullptr;
+			ok = ok && restored != nullptr && restoredKind == testCase.kind && CompareShapes(*cooked, *restored);
+
+			// 内容キーが違えば読まない（元のモデルや設定が変わった場合）
+			ContentKey staleKey = key;
+			staleKey.hash ^= 1;
+			ok = ok && Load(path, staleKey, restoredKind) == nullptr;
+
+			// 途中で切れたファイルは読まない
+			const auto size = std::filesystem::file_size(path, ec);
+			std::filesystem::resize_file(path, (!ec && size > sizeof(CookedHeader) + 8) ? size / 2 : 0, ec);
+			ok = ok && !ec && Load(path, key, restoredKind) == nullptr;
+
+			std::cout << "[ColliderCooker] SelfTest " << testCase.name << (ok ? " OK" : " FAILED") << std::endl;
+			passed = passed && ok;
+		}
+
+		std::filesystem::remove_all(directory, ec);
+
+		if (ownsFactory)
+		{
+			JPH::UnregisterTypes();
+			delete JPH::Factory::sInstance;
+			JPH::Factory::sInstance = nullptr;
+		}
+
+		std::cout << "[ColliderCooker] SelfTest " << (passed ? "passed" : "FAILED") << std::endl;
+		return passed;
+	}
+
+	bool RunCommandLine(int _argc, char** _argv, int& _outExitCode)
+	{
+		if (_argc < 2 || std::string(_argv[1]) != "--cook-colliders-selftest") { return false; }
+
+		_outExitCode = RunSelfTest() ? 0 : 1;
+		return true;
+	}
+} // namespace Framework::Physics::ColliderCooker
@@ -0,0 +1,370 @@
+﻿/** @file   ContactEventBenchmark.cpp
+ *  @brief  接触イベント処理の計測
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/ContactEventBenchmark.h"
+#include "Include/Framework/Physics/ContactPairTable.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Framework::Physics::ContactEventBenchmark
+{
+	//-----------------------------------------------------------------------------
+	// Local Helpers
+	//-----------------------------------------------------------------------------
+	namespace
+	{
+		using Clock = std::chrono::steady_clock;
+		using BodyPair = std::pair<JPH::uint32, JPH::uint32>;
+
+		/** @struct LegacyKey
+		 *  @brief 旧方式のコライダー識別キー（BodyID と ColliderID）
+		 */
+		struct LegacyKey
+		{
+			JPH::BodyID bodyID;
+			int colliderID;
+
+			bool operator==(const LegacyKey& _other) const noexcept
+			{
+				return bodyID == _other.bodyID && colliderID == _other.colliderID;
+			}
+		};
+
+		/** @struct LegacyKeyHash
+		 *  @brief 旧方式のハッシュ関数
+		 */
+		struct LegacyKeyHash
+		{
+			size_t operator()(const LegacyKey& _key) const noexcept
+			{
+				size_t h1 = std::hash<JPH::uint32>()(_key.bodyID.GetIndex()) ^ (std::hash<JPH::uint32>()(_key.bodyID.GetSequenceNumber()) << 1);
+				size_t h2 = std::hash<int>()(_key.colliderID);
+				return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6) + (h1 >> 2));
+			}
+		};
+
+		using LegacyTable = std::unordered_map<LegacyKey, std::unordered_set<LegacyKey, LegacyKeyHash>, LegacyKeyHash>;
+
+		/** @class Workload
+		 *  @brief 持続接触の集合を保ち、毎ステップ一部を入れ替えて Jolt と同じく順不同で報告する
+		 *  @details 同じ設定なら同じ列を生成するので、両方式に同一の入力を与えられる
+		 */
+		class Workload
+		{
+		public:
+			explicit Workload(const Settings& _settings)
+				: settings(_settings)
+				, random(12345u)
+				, bodyCount(static_cast<JPH::uint32>(std::max<size_t>(16, _settings.contactCount / 4)))
+			{
+				while (this->active.size() < this->settings.contactCount)
+				{
+					this->AddRandomPair();
+				}
+			}
+
+			/** @brief 次のステップで報告される接触を作る
+			 *  @param _out 報告順の接触（向きも順不同）
+			 */
+			void NextStep(std::vector<BodyPair>& _out)
+			{
+				const size_t churn = static_cast<size_t>(static_cast<float>(this->active.size()) * this->settings.churnRate);
+				for (size_t i = 0; i < churn && !this->active.empty(); i++)
+				{
+					std::uniform_int_distribution<size_t> pick(0, this->active.size() - 1);
+					const size_t index = pick(this->random);
+					this->keys.erase(this->active[index]);
+					this->active[index] = this->active.back();
+					this->active.pop_back();
+				}
+				while (this->active.size() < this->settings.contactCount)
+				{
+					this->AddRandomPair();
+				}
+
+				_out.clear();
+				for (const auto key : this->active)
+				{
+					BodyPair pair(static_cast<JPH::uint32>(key >> 32), static_cast<JPH::uint32>(key & 0xFFFFFFFFull));
+					if (this->random() & 1u) { std::swap(pair.first, pair.second); }
+					_out.push_back(pair);
+				}
+				std::shuffle(_out.begin(), _out.end(), this->random);
+			}
+
+			/// @brief 接触し得る Body の数
+			JPH::uint32 GetBodyCount() const { return this->bodyCount; }
+
+		private:
+			void AddRandomPair()
+			{
+				std::uniform_int_distribution<JPH::uint32> pick(0, this->bodyCount - 1);
+				const JPH::uint32 a = pick(this->random);
+				const JPH::uint32 b = pick(this->random);
+				if (a == b) { return; }
+
+				const ContactPairKey key = MakeContactPairKey(JPH::BodyID(a), JPH::BodyID(b));
+				if (this->keys.insert(key).second)
+				{
+					this->active.push_back(key);
+				}
+			}
+
+		private:
+			Settings settings;
+			std::mt19937 random;
+			JPH::uint32 bodyCount;
+			std::vector<ContactPairKey> active;
+			std::unordered_set<ContactPairKey> keys;
+		};
+
+		/** @brief 計測時間を 1 ステップあたりに換算する
+		 *  @param _elapsed 合計時間
+		 *  @param _steps ステップ数
+		 *  @return マイクロ秒
+		 */
+		static double ToMicrosecondsPerStep(Clock::duration _elapsed, int _steps)
+		{
+			const double us = std::chrono::duration<double, std::micro>(_elapsed).count();
+			return _steps > 0 ? us / _steps : 0.0;
+		}
+
+		/** @brief 結果を出力する
+		 *  @param _label 方式名
+		 *  @param _result 計測結果
+		 */
+		static void PrintResult(const char* _label, const Result& _result)
+		{
+			std::cout << "[ContactEventBenchmark] " << _label
+				<< " : " << _result.microsecondsPerStep << " us/step"
+				<< " (enter " << _result.enteredCount
+				<< ", stay " << _result.stayedCount
+				<< ", exit " << _result.exitedCount << ")\n";
+		}
+
+		/** @brief 引数を数値として読む（数値でない・余分な文字が付いている場合は失敗）
+		 *  @param _text 引数
+		 *  @param _out 読んだ値
+		 *  @return 読めたら true
+		 */
+		template<typename T>
+		static bool ParseNumber(const char* _text, T& _out)
+		{
+			const char* end = _text + std::strlen(_text);
+			const auto [last, error] = std::from_chars(_text, end, _out);
+			return error == std::errc() && last == end;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// Functions
+	//-----------------------------------------------------------------------------
+	Result RunHashTable(const Settings& _settings)
+	{
+		Workload workload(_settings);
+		std::vector<BodyPair> reported;
+
+		// 旧方式では BodyInterface::IsAdded（Body ロックを取る）で問い合わせていた。ここは配列参照で代用する
+		std::vector<uint8_t> alive(workload.GetBodyCount(), 1);
+		auto isBodyValid = [&alive](JPH::BodyID _id) { return alive[_id.GetIndex()] != 0; };
+
+		std::mutex contactMutex;
+		LegacyTable currContact;
+		LegacyTable prevContact;
+
+		Result result{};
+		Clock::duration elapsed{};
+
+		for (int step = 0; step < _settings.stepCount; step++)
+		{
+			workload.NextStep(reported);
+			const auto begin = Clock::now();
+
+			// AddContactPair（コールバックごとにロック）
+			for (const auto& [rawA, rawB] : reported)
+			{
+				LegacyKey a{ JPH::BodyID(rawA), static_cast<int>(rawA) };
+				LegacyKey b{ JPH::BodyID(rawB), static_cast<int>(rawB) };
+				if (a.bodyID > b.bodyID) { std::swap(a, b); }
+
+				std::lock_guard<std::mutex> lock(contactMutex);
+				currContact[a].insert(b);
+			}
+
+			// ProcessContactEvents
+			{
+				std::lock_guard<std::mutex> lock(contactMutex);
+
+				auto cleanContactTable = [&](LegacyTable& _table)
+				{
+					for (auto itA = _table.begin(); itA != _table.end(); )
+					{
+						if (!isBodyValid(itA->first.bodyID))
+						{
+							itA = _table.erase(itA);
+							continue;
+						}
+						for (auto itB = itA->second.begin(); itB != itA->second.end(); )
+						{
+							if (!isBodyValid(itB->bodyID)) { itB = itA->second.erase(itB); }
+							else { ++itB; }
+						}
+						++itA;
+					}
+				};
+				cleanContactTable(currContact);
+				cleanContactTable(prevContact);
+
+				for (auto& [bodyA, currentSet] : currContact)
+				{
+					auto& prevSet = prevContact[bodyA];
+					for (const auto& bodyB : currentSet)
+					{
+						if (prevSet.count(bodyB) > 0) { ++result.stayedCount; }
+						else { ++result.enteredCount; }
+					}
+				}
+				for (auto& [bodyA, prevSet] : prevContact)
+				{
+					auto itCurr = currContact.find(bodyA);
+					const auto* currSet = (itCurr != currContact.end()) ? &itCurr->second : nullptr;
+					for (const auto& bodyB : prevSet)
+					{
+						if (!(currSet && currSet->count(bodyB) > 0)) { ++result.exitedCount; }
+					}
+				}
+
+				prevContact = currContact;
+				currContact.clear();
+			}
+
+			elapsed += Clock::now() - begin;
+		}
+
+		result.microsecondsPerStep = ToMicrosecondsPerStep(elapsed, _settings.stepCount);
+		return result;
+	}
+
+	Result RunSortedPairs(const Settings& _settings)
+	{
+		Workload workload(_settings);
+		std::vector<BodyPair> reported;
+
+		const size_t bufferCount = static_cast<size_t>(std::max(1, _settings.threadBuffers));
+		std::vector<std::vector<ContactPairKey>> buffers(bufferCount);
+		ContactPairTable table;
+
+		Result result{};
+		Clock::duration elapsed{};
+
+		for (int step = 0; step < _settings.stepCount; step++)
+		{
+			workload.NextStep(reported);
+			const auto begin = Clock::now();
+
+			// AddContactPair（ワーカーごとのバッファに追記。計測は 1 スレッドで行う）
+			for (size_t i = 0; i < reported.size(); i++)
+			{
+				buffers[i % bufferCount].push_back(MakeContactPairKey(JPH::BodyID(reported[i].first), JPH::BodyID(reported[i].second)));
+			}
+
+			// MergeContactBuffers
+			for (auto& buffer : buffers)
+			{
+				table.Append(buffer);
+				buffer.clear();
+			}
+			table.Finalize();
+
+			// ProcessContactEvents
+			table.Diff([&result](ContactTransition _transition, ContactPairKey)
+			{
+				switch (_transition)
+				{
+				case ContactTransition::Entered: ++result.enteredCount; break;
+				case ContactTransition::Stayed: ++result.stayedCount; break;
+				case ContactTransition::Exited: ++result.exitedCount; break;
+				}
+			});
+
+			elapsed += Clock::now() - begin;
+		}
+
+		result.microsecondsPerStep = ToMicrosecondsPerStep(elapsed, _settings.stepCount);
+		return result;
+	}
+
+	bool Run(const Settings& _settings)
+	{
+		std::cout << "[ContactEventBenchmark] contacts " << _settings.contactCount
+			<< ", steps " << _settings.stepCount
+			<< ", churn " << _settings.churnRate << "\n";
+
+		const Result legacy = RunHashTable(_settings);
+		const Result sorted = RunSortedPairs(_settings);
+
+		PrintResult("hash table  ", legacy);
+		PrintResult("sorted pairs", sorted);
+
+		if (sorted.microsecondsPerStep > 0.0)
+		{
+			std::cout << "[ContactEventBenchmark] speedup x" << (legacy.microsecondsPerStep / sorted.microsecondsPerStep) << "\n";
+		}
+
+		const bool matched =
+			legacy.enteredCount == sorted.enteredCount &&
+			legacy.stayedCount == sorted.stayedCount &&
+			legacy.exitedCount == sorted.exitedCount;
+		if (!matched)
+		{
+			std::cerr << "[ContactEventBenchmark] イベント数が一致しません" << std::endl;
+		}
+		return matched;
+	}
+
+	bool RunCommandLine(int _argc, char** _argv, int& _outExitCode)
+	{
+		if (_argc < 2) { return false; }
+		if (std::string(_argv[1]) != "--bench-contacts") { return false; }
+
+		// 数値でない・範囲外の引数は計測せずに失敗で返す
+		Settings settings{};
+		if (_argc > 2 && !ParseNumber(_argv[2], settings.contactCount))
+		{
+			std::cerr << "[ContactEventBenchmark] 接触数が不正です : " << _argv[2] << std::endl;
+			_outExitCode = 1;
+			return true;
+		}
+		if (_argc > 3 && (!ParseNumber(_argv[3], settings.stepCount) || settings.stepCount < 0))
+		{
+			std::cerr << "[ContactEventBenchmark] ステップ数が不正です（0 以上の整数） : " << _argv[3] << std::endl;
+			_outExitCode = 1;
+			return true;
+		}
+		if (_argc > 4 && (!ParseNumber(_argv[4], settings.churnRate) || !(settings.churnRate >= 0.0f && settings.churnRate <= 1.0f)))
+		{
+			std::cerr << "[ContactEventBenchmark] 入れ替わり率が不正です（0 ～ 1） : " << _argv[4] << std::endl;
+			_outExitCode = 1;
+			return true;
+		}
+
+		_outExitCode = Run(settings) ? 0 : 1;
+		return true;
+	}
+} // namespace Framework::Physics::ContactEventBenchmark
@@ -0,0 +1,62 @@
+﻿/** @file   ContactPairTable.cpp
+ *  @brief  接触ペア表の実装
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/ContactPairTable.h"
+
+#include <algorithm>
+
+namespace Framework::Physics
+{
+	//-----------------------------------------------------------------------------
+	// ContactPairTable class
+	//-----------------------------------------------------------------------------
+	void ContactPairTable::Append(const std::vector<ContactPairKey>& _pairs)
+	{
+		this->currPairs.insert(this->currPairs.end(), _pairs.begin(), _pairs.end());
+	}
+
+	void ContactPairTable::Finalize()
+	{
+		// Added と Persisted、複数サブステップで同じペアが重複するので詰める
+		std::sort(this->currPairs.begin(), this->currPairs.end());
+		this->currPairs.erase(std::unique(this->currPairs.begin(), this->currPairs.end()), this->currPairs.end());
+	}
+
+	void ContactPairTable::RemoveBody(JPH::BodyID _bodyID)
+	{
+		this->removedBodies.push_back(_bodyID.GetIndexAndSequenceNumber());
+	}
+
+	void ContactPairTable::Clear()
+	{
+		this->currPairs.clear();
+		this->prevPairs.clear();
+		this->removedBodies.clear();
+	}
+
+	void ContactPairTable::ApplyRemovals()
+	{
+		if (this->removedBodies.empty()) { return; }
+
+		std::sort(this->removedBodies.begin(), this->removedBodies.end());
+
+		auto isRemoved = [this](ContactPairKey _key)
+		{
+			const auto a = static_cast<JPH::uint32>(_key >> 32);
+			const auto b = static_cast<JPH::uint32>(_key & 0xFFFFFFFFull);
+			return std::binary_search(this->removedBodies.begin(), this->removedBodies.end(), a)
+				|| std::binary_search(this->removedBodies.begin(), this->removedBodies.end(), b);
+		};
+
+		// erase_if は順序を保つので昇順のまま
+		std::erase_if(this->currPairs, isRemoved);
+		std::erase_if(this->prevPairs, isRemoved);
+
+		this->removedBodies.clear();
+	}
+} // namespace Framework::Physics
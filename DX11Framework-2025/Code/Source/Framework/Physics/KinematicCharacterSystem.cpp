@@ -0,0 +1,318 @@
+﻿/** @file   KinematicCharacterSystem.cpp
+ *  @brief  Rigidbody3D の押し戻し・接地判定のバッチ解決
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/KinematicCharacterSystem.h"
+#include "Include/Framework/Core/PhysicsSystem.h"
+#include "Include/Framework/Entities/Rigidbody3D.h"
+#include "Include/Framework/Entities/Collider3DComponent.h"
+#include "Include/Framework/Utils/FrameArena.h"
+
+#include <Jolt/Physics/Collision/NarrowPhaseQuery.h>
+#include <Jolt/Physics/Collision/ShapeCast.h>
+#include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+#include <Jolt/Physics/Collision/CollideShape.h>
+#include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
+
+#include <algorithm>
+
+namespace Framework::Physics
+{
+	using namespace JPH;
+
+	//-----------------------------------------------------------------------------
+	// Local Helpers
+	//-----------------------------------------------------------------------------
+	namespace
+	{
+		static constexpr float skinWidth = 1.0e-3f;			///< 壁から少しだけ離すためのスキン幅
+		static constexpr float groundProbeLength = 0.15f;	///< 足元から下に飛ばす Ray の長さ
+
+		/** @brief ヒットした相手が押し戻し対象か（トリガー・未登録は無視する）
+		 *  @param _physicsSystem 物理システム
+		 *  @param _other 相手の Body
+		 *  @return 押し戻すなら true
+		 */
+		static bool IsSolidBody(PhysicsSystem& _physicsSystem, BodyID _other)
+		{
+			auto* other = _physicsSystem.GetCollider3D(_other);
+			return other && !other->IsTrigger();
+		}
+
+		/** @brief 貫通解決（最も深くめり込んでいる Body 1 つを押し出す）
+		 *  @param _physicsSystem 物理システム
+		 *  @param _query 入出力
+		 *  @param _bodies Body クエリ
+		 */
+		static void SolvePenetration(PhysicsSystem& _physicsSystem, KinematicCharacterQuery& _query, const KinematicBodyQuery* _bodies)
+		{
+			const auto& npq = _physicsSystem.GetNarrowPhaseQueryNoLock();
+			const auto& broad = _physicsSystem.GetBroadPhaseLayerFilter(_query.objectLayer);
+			const auto& obj = _physicsSystem.GetObjectLayerFilter(_query.objectLayer);
+			const Quat rot(_query.rotation.x, _query.rotation.y, _query.rotation.z, _query.rotation.w);
+
+			float bestDepth = 0.0f;
+			DX::Vector3 bestDepen = DX::Vector3::Zero;
+			DX::Vector3 bestNormal = DX::Vector3::Zero;
+
+			for (uint32_t i = 0; i < _query.bodyCount; ++i)
+			{
+				const KinematicBodyQuery& body = _bodies[_query.firstBody + i];
+				const DX::Vector3 comPos = _query.position + body.offset;
+
+				CollideShapeSettings settings;
+				settings.mBackFaceMode = EBackFaceMode::IgnoreBackFaces;
+				settings.mMaxSeparationDistance = 0.0f;
+
+				ClosestHitCollisionCollector<CollideShapeCollector> collector;
+				IgnoreSelfBodyFilter bodyFilter(body.id);
+
+				npq.CollideShape(
+					body.shape,
+					Vec3::sOne(),
+					RMat44::sRotationTranslation(rot, RVec3(comPos.x, comPos.y, comPos.z)),
+					settings,
+					RVec3::sZero(),
+					collector,
+					broad,
+					obj,
+					bodyFilter
+				);
+				if (!collector.HadHit()) { continue; }
+
+				const auto& hit = collector.mHit;
+				if (hit.mPenetrationDepth <= 0.0f) { continue; }
+				if (!IsSolidBody(_physicsSystem, hit.mBodyID2)) { continue; }
+
+				if (hit.mPenetrationDepth > bestDepth)
+				{
+					const Vec3 axis = hit.mPenetrationAxis.Normalized();
+					bestDepth = hit.mPenetrationDepth;
+					bestNormal = DX::Vector3(axis.GetX(), axis.GetY(), axis.GetZ());
+					bestDepen = -bestNormal * hit.mPenetrationDepth;
+				}
+			}
+
+			if (bestDepth <= 0.0f) { return; }
+
+			const float vn = _query.velocity.Dot(bestNormal);
+			if (vn > 0.0f)
+			{
+				_query.velocity -= bestNormal * vn;
+			}
+
+			_query.position += bestDepen;
+		}
+
+		/** @brief CastShape 押し戻し解決（移動方向に対するヒットを使って押し戻す）
+		 *  @param _physicsSystem 物理システム
+		 *  @param _query 入出力
+		 *  @param _bodies Body クエリ
+		 */
+		static void SolveCast(PhysicsSystem& _physicsSystem, KinematicCharacterQuery& _query, const KinematicBodyQuery* _bodies)
+		{
+			_query.isGrounded = false;
+			_query.needsGroundProbe = false;
+
+			const DX::Vector3 move = _query.velocity * _query.castDeltaTime;
+			if (move.LengthSquared() <= 0.0f) { return; }
+
+			const float moveLen = move.Length();
+			const DX::Vector3 moveDir = move / moveLen;
+
+			const auto& npq = _physicsSystem.GetNarrowPhaseQueryNoLock();
+			const auto& broad = _physicsSystem.GetBroadPhaseLayerFilter(_query.objectLayer);
+			const auto& obj = _physicsSystem.GetObjectLayerFilter(_query.objectLayer);
+			const Quat rot(_query.rotation.x, _query.rotation.y, _query.rotation.z, _query.rotation.w);
+
+			float bestCorrection = 0.0f;
+			DX::Vector3 bestCandidate = _query.position;
+			DX::Vector3 bestNormal = DX::Vector3::Zero;
+			bool hasHit = false;
+
+			for (uint32_t i = 0; i < _query.bodyCount; ++i)
+			{
+				const KinematicBodyQuery& body = _bodies[_query.firstBody + i];
+				const DX::Vector3 comStart = _query.prevPosition + body.offset;
+
+				RShapeCast cast(
+					body.shape,
+					Vec3::sOne(),
+					RMat44::sRotationTranslation(rot, RVec3(comStart.x, comStart.y, comStart.z)),
+					Vec3(move.x, move.y, move.z)
+				);
+
+				ShapeCastSettings settings;
+				settings.mReturnDeepestPoint = false;
+				settings.mBackFaceModeTriangles = EBackFaceMode::IgnoreBackFaces;
+				settings.mBackFaceModeConvex = EBackFaceMode::IgnoreBackFaces;
+
+				ClosestShapeCastCollector col;
+
+				npq.CastShape(
+					cast,
+					settings,
+					RVec3::sZero(),
+					col,
+					broad,
+					obj,
+					IgnoreSelfBodyFilter(body.id)
+				);
+				if (!col.hasHit) { continue; }
+				if (!IsSolidBody(_physicsSystem, col.hit.mBodyID2)) { continue; }
+
+				const float f = std::clamp(col.hit.mFraction, 0.0f, 1.0f);
+				const float adv = std::max(0.0f, moveLen * f - skinWidth);
+
+				DX::Vector3 newCom = comStart + moveDir * adv;
+
+				DX::Vector3 normal(
+					col.hit.mPenetrationAxis.GetX(),
+					col.hit.mPenetrationAxis.GetY(),
+					col.hit.mPenetrationAxis.GetZ()
+				);
+				normal.Normalize();
+				if (adv > 0.0f)
+				{
+					newCom += normal * skinWidth;
+				}
+
+				const DX::Vector3 candidate = newCom - body.offset;
+				const float correctionLen = (_query.position - candidate).LengthSquared();
+				if (correctionLen > bestCorrection)
+				{
+					bestCorrection = correctionLen;
+					bestCandidate = candidate;
+					bestNormal = normal;
+					hasHit = true;
+				}
+			}
+
+			if (!hasHit) { return; }
+
+			_query.position = bestCandidate;
+
+			// 法線成分の速度を削減（面に沿わせる）
+			const float vn = _query.velocity.Dot(bestNormal);
+			if (vn > 0.0f)
+			{
+				_query.velocity -= bestNormal * vn;
+			}
+
+			// 接地判定の Ray は全キャラクターの解決後にまとめて飛ばす
+			_query.needsGroundProbe = _query.hasGroundProbe;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// KinematicCharacterSystem class
+	//-----------------------------------------------------------------------------
+	KinematicCharacterSystem::KinematicCharacterSystem(PhysicsSystem& _physicsSystem)
+		: physicsSystem(_physicsSystem)
+		, queries()
+		, bodyQueries()
+	{
+	}
+
+	void KinematicCharacterSystem::Step(const std::vector<Rigidbody3D*>& _rigidbodies, float _deltaTime)
+	{
+		//-----------------------------------------------------------
+		// 収集（自前移動もここで済ませる）
+		//-----------------------------------------------------------
+		this->queries.clear();
+		this->bodyQueries.clear();
+		this->queries.reserve(_rigidbodies.size());
+
+		for (auto* rigidbody : _rigidbodies)
+		{
+			if (!rigidbody) { continue; }
+
+			// TimeScale で間引かれたものはクエリに載せない
+			KinematicCharacterQuery& query = this->queries.emplace_back();
+			if (!rigidbody->BuildKinematicQuery(_deltaTime, query, this->bodyQueries))
+			{
+				this->queries.pop_back();
+			}
+		}
+
+		//-----------------------------------------------------------
+		// 解決（ジョブに分けて並列実行）
+		//-----------------------------------------------------------
+		this->physicsSystem.ParallelFor("KinematicCharacter", this->queries.size(), MinCharactersPerJob,
+			[this](size_t _begin, size_t _end) { this->SolveRange(_begin, _end); });
+
+		KinematicCharacterSystem::ResolveGroundProbes(this->physicsSystem, this->queries.data(), this->queries.size());
+
+		//-----------------------------------------------------------
+		// 反映（結果の書き戻しと Transform への同期を 1 パスで行う）
+		//-----------------------------------------------------------
+		for (const auto& query : this->queries)
+		{
+			query.rigidbody->ApplyKinematicResult(query);
+		}
+	}
+
+	void KinematicCharacterSystem::SolveCharacter(PhysicsSystem& _physicsSystem, KinematicCharacterQuery& _query, const KinematicBodyQuery* _bodies)
+	{
+		// Body を持たなければ移動のみ（接地フラグも前回のまま）
+		if (!_query.resolveContacts) { return; }
+
+		for (int i = 0; i < SolveIterations; ++i)
+		{
+			SolvePenetration(_physicsSystem, _query, _bodies);
+		}
+
+		SolveCast(_physicsSystem, _query, _bodies);
+	}
+
+	void KinematicCharacterSystem::ResolveGroundProbes(PhysicsSystem& _physicsSystem, KinematicCharacterQuery* _queries, size_t _count)
+	{
+		size_t rayCount = 0;
+		for (size_t i = 0; i < _count; ++i)
+		{
+			if (_queries[i].needsGroundProbe) { ++rayCount; }
+		}
+		if (rayCount == 0) { return; }
+
+		// 足元から短い Ray を真下に落とす（レイヤーで絞り込まないのは従来どおり）
+		const std::span<RayQuery> rays = Framework::Memory::AllocateFrameArray<RayQuery>(rayCount);
+		const std::span<RayHit> hits = Framework::Memory::AllocateFrameArray<RayHit>(rayCount);
+
+		size_t rayIndex = 0;
+		for (size_t i = 0; i < _count; ++i)
+		{
+			const KinematicCharacterQuery& query = _queries[i];
+			if (!query.needsGroundProbe) { continue; }
+
+			RayQuery& ray = rays[rayIndex++];
+			ray.origin = DX::Vector3(query.position.x, query.position.y + query.groundProbeOffset, query.position.z);
+			ray.direction = DX::Vector3(0.0f, -groundProbeLength, 0.0f);
+		}
+
+		_physicsSystem.GetQuery().CastRays(std::span<const RayQuery>(rays), hits);
+
+		// Ray は needsGroundProbe のクエリ順に並んでいる
+		size_t hitIndex = 0;
+		for (size_t i = 0; i < _count; ++i)
+		{
+			KinematicCharacterQuery& query = _queries[i];
+			if (!query.needsGroundProbe) { continue; }
+
+			query.isGrounded = hits[hitIndex++].hasHit;
+			query.needsGroundProbe = false;
+		}
+	}
+
+	void KinematicCharacterSystem::SolveRange(size_t _begin, size_t _end)
+	{
+		for (size_t i = _begin; i < _end; ++i)
+		{
+			KinematicCharacterSystem::SolveCharacter(this->physicsSystem, this->queries[i], this->bodyQueries.data());
+		}
+	}
+} // namespace Framework::Physics
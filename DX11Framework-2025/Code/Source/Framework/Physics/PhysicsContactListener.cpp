@@ -19,17 +19,10 @@ namespace Framework::Physics
         ContactSettings& _settings)
     {
         (void)_manifold;
-        (void)_settings;
 
-		// 接触しているコライダーIDを取得する
-        int colliderA = static_cast<int>(_bodyA.GetUserData());
-        int colliderB = static_cast<int>(_bodyB.GetUserData());
-
-        // 接触ペアを物理システムに登録する
-        this->physicsSystem.AddContactPair(
-            { _bodyA.GetID(), colliderA },
-            { _bodyB.GetID(), colliderB }
-        );
+        // 接触ペアを物理システムに登録する（コライダーは BodyID から引けるので BodyID だけ渡す）
+        this->physicsSystem.AddContactPair(_bodyA.GetID(), _bodyB.GetID());
+        this->CountConstraint(_bodyA, _bodyB, _settings);
     }
 
     void PhysicsContactListener::OnContactPersisted(const Body& _bodyA,
@@ -38,16 +31,10 @@ namespace Framework::Physics
         ContactSettings& _settings)
     {
         (void)_manifold;
-        (void)_settings;
 
         // 毎フレーム触れている接触も登録する（Stay 判定用）
-        int colliderA = static_cast<int>(_bodyA.GetUserData());
-        int colliderB = static_cast<int>(_bodyB.GetUserData());
-
-        this->physicsSystem.AddContactPair(
-            { _bodyA.GetID(), colliderA },
-            { _bodyB.GetID(), colliderB }
-        );
+        this->physicsSystem.AddContactPair(_bodyA.GetID(), _bodyB.GetID());
+        this->CountConstraint(_bodyA, _bodyB, _settings);
     }
 
     void PhysicsContactListener::OnContactRemoved(const SubShapeIDPair& _pair)
@@ -56,4 +43,15 @@ namespace Framework::Physics
         // ここでは明示的な処理は不要。
         // 必要なら _pair.mBody1ID / mBody2ID と _pair.mSubShapeID1 / mSubShapeID2 を使った即時通知も可能。
     }
+
+    void PhysicsContactListener::CountConstraint(const Body& _bodyA, const Body& _bodyB, const ContactSettings& _settings)
+    {
+        // センサーや、質量を持つ動的 Body を含まない組み合わせは拘束を作らない
+        if (_settings.mIsSensor) { return; }
+        const bool hasMass = (_bodyA.IsDynamic() && _settings.mInvMassScale1 != 0.0f)
+            || (_bodyB.IsDynamic() && _settings.mInvMassScale2 != 0.0f);
+        if (!hasMass) { return; }
+
+        this->constraintCount.fetch_add(1, std::memory_order_relaxed);
+    }
 }
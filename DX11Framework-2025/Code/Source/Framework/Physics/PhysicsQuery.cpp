@@ -0,0 +1,396 @@
+﻿/** @file   PhysicsQuery.cpp
+ *  @brief  空間クエリの一括実行・遅延実行
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/PhysicsQuery.h"
+#include "Include/Framework/Core/PhysicsSystem.h"
+#include "Include/Framework/Entities/Collider3DComponent.h"
+
+#include <Jolt/Physics/Body/Body.h>
+#include <Jolt/Physics/Body/BodyLock.h>
+#include <Jolt/Physics/Collision/NarrowPhaseQuery.h>
+#include <Jolt/Physics/Collision/ShapeCast.h>
+#include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/CollideShape.h>
+#include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
+
+#include <algorithm>
+
+namespace Framework::Physics
+{
+	using namespace JPH;
+
+	//-----------------------------------------------------------------------------
+	// Local Helpers
+	//-----------------------------------------------------------------------------
+	namespace
+	{
+		/** @struct LayerFilters
+		 *  @brief クエリ 1 回分のレイヤーフィルタ
+		 */
+		struct LayerFilters
+		{
+			const BroadPhaseLayerFilter& broad;
+			const ObjectLayerFilter& object;
+		};
+
+		/** @brief レイヤー指定に対応するフィルタを取得する
+		 *  @param _physicsSystem 物理システム
+		 *  @param _layer 指定レイヤー（QueryAllLayers なら絞り込まない）
+		 *  @return フィルタ
+		 */
+		static LayerFilters GetLayerFilters(const PhysicsSystem& _physicsSystem, ObjectLayer _layer)
+		{
+			static const BroadPhaseLayerFilter allBroadPhase;
+			static const ObjectLayerFilter allObjects;
+
+			if (_layer == QueryAllLayers)
+			{
+				return { allBroadPhase, allObjects };
+			}
+			return { _physicsSystem.GetBroadPhaseLayerFilter(_layer), _physicsSystem.GetObjectLayerFilter(_layer) };
+		}
+
+		/// @brief DX の位置・回転から Jolt の変換行列を作る
+		static RMat44 ToWorldTransform(const DX::Vector3& _position, const DX::Quaternion& _rotation)
+		{
+			return RMat44::sRotationTranslation(
+				Quat(_rotation.x, _rotation.y, _rotation.z, _rotation.w),
+				RVec3(_position.x, _position.y, _position.z));
+		}
+
+		/// @brief Jolt のベクトルを DX に変換する
+		static DX::Vector3 ToVector3(Vec3Arg _v)
+		{
+			return DX::Vector3(_v.GetX(), _v.GetY(), _v.GetZ());
+		}
+
+		/** @brief レイキャストを 1 本実行する
+		 *  @param _physicsSystem 物理システム
+		 *  @param _query 入力
+		 *  @param _outHit 結果
+		 */
+		static void CastRay(PhysicsSystem& _physicsSystem, const RayQuery& _query, RayHit& _outHit)
+		{
+			_outHit = RayHit{};
+
+			const LayerFilters filters = GetLayerFilters(_physicsSystem, _query.layer);
+			const RRayCast ray(
+				RVec3(_query.origin.x, _query.origin.y, _query.origin.z),
+				Vec3(_query.direction.x, _query.direction.y, _query.direction.z));
+
+			RayCastResult hit;
+			if (!_physicsSystem.GetNarrowPhaseQueryNoLock().CastRay(ray, hit, filters.broad, filters.object, IgnoreSelfBodyFilter(_query.ignoreBody)))
+			{
+				return;
+			}
+
+			_outHit.hasHit = true;
+			_outHit.fraction = hit.mFraction;
+			_outHit.point = _query.origin + _query.direction * hit.mFraction;
+			_outHit.bodyID = hit.mBodyID;
+			_outHit.collider = _physicsSystem.GetCollider3D(hit.mBodyID);
+
+			BodyLockRead lock(_physicsSystem.GetBodyLockInterfaceNoLock(), hit.mBodyID);
+			if (lock.Succeeded())
+			{
+				const RVec3 point(_outHit.point.x, _outHit.point.y, _outHit.point.z);
+				_outHit.normal = ToVector3(lock.GetBody().GetWorldSpaceSurfaceNormal(hit.mSubShapeID2, point));
+			}
+		}
+
+		/** @brief オーバーラップを 1 回実行する
+		 *  @details コレクタはスレッドごとに使い回す（ヒット配列の確保を毎回行わない）
+		 *  @param _physicsSystem 物理システム
+		 *  @param _query 入力
+		 *  @param _outHits 書き込み先（_query.maxHits 個分の領域）
+		 *  @return 書き込んだ個数
+		 */
+		static uint32_t CollideShape(PhysicsSystem& _physicsSystem, const OverlapQuery& _query, OverlapHit* _outHits)
+		{
+			if (!_query.shape || _query.maxHits == 0) { return 0; }
+
+			thread_local AllHitCollisionCollector<CollideShapeCollector> collector;
+			collector.Reset();
+
+			CollideShapeSettings settings;
+			settings.mBackFaceMode = EBackFaceMode::IgnoreBackFaces;
+			settings.mMaxSeparationDistance = 0.0f;
+
+			const LayerFilters filters = GetLayerFilters(_physicsSystem, _query.layer);
+			_physicsSystem.GetNarrowPhaseQueryNoLock().CollideShape(
+				_query.shape,
+				Vec3::sOne(),
+				ToWorldTransform(_query.position, _query.rotation),
+				settings,
+				RVec3::sZero(),
+				collector,
+				filters.broad,
+				filters.object,
+				IgnoreSelfBodyFilter(_query.ignoreBody)
+			);
+			if (!collector.HadHit()) { return 0; }
+
+			// 同じ Body の複数ヒット（メッシュの三角形・複合形状）は最も深いものにまとめる
+			auto& hits = collector.mHits;
+			std::sort(hits.begin(), hits.end(), [](const CollideShapeResult& _a, const CollideShapeResult& _b)
+			{
+				if (_a.mBodyID2 != _b.mBodyID2) { return _a.mBodyID2 < _b.mBodyID2; }
+				return _a.mPenetrationDepth > _b.mPenetrationDepth;
+			});
+
+			uint32_t count = 0;
+			for (size_t i = 0; i < hits.size(); ++i)
+			{
+				if (i > 0 && hits[i].mBodyID2 == hits[i - 1].mBodyID2) { continue; }
+
+				const OverlapHit hit{ hits[i].mBodyID2, nullptr, hits[i].mPenetrationDepth };
+				if (count < _query.maxHits)
+				{
+					_outHits[count++] = hit;
+					continue;
+				}
+
+				// 上限を超えたら最も浅いものと入れ替える
+				auto shallowest = std::min_element(_outHits, _outHits + count, [](const OverlapHit& _a, const OverlapHit& _b)
+				{
+					return _a.penetrationDepth < _b.penetrationDepth;
+				});
+				if (shallowest->penetrationDepth < hit.penetrationDepth)
+				{
+					*shallowest = hit;
+				}
+			}
+
+			std::sort(_outHits, _outHits + count, [](const OverlapHit& _a, const OverlapHit& _b)
+			{
+				return _a.penetrationDepth > _b.penetrationDepth;
+			});
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				_outHits[i].collider = _physicsSystem.GetCollider3D(_outHits[i].bodyID);
+			}
+			return count;
+		}
+
+		/** @brief ShapeCast を 1 回実行する
+		 *  @param _physicsSystem 物理システム
+		 *  @param _query 入力
+		 *  @param _outHit 結果
+		 */
+		static void CastShape(PhysicsSystem& _physicsSystem, const ShapeCastQuery& _query, ShapeCastHit& _outHit)
+		{
+			_outHit = ShapeCastHit{};
+			if (!_query.shape) { return; }
+
+			RShapeCast cast(
+				_query.shape,
+				Vec3::sOne(),
+				ToWorldTransform(_query.position, _query.rotation),
+				Vec3(_query.direction.x, _query.direction.y, _query.direction.z)
+			);
+
+			ShapeCastSettings settings;
+			settings.mReturnDeepestPoint = false;
+			settings.mBackFaceModeTriangles = EBackFaceMode::IgnoreBackFaces;
+			settings.mBackFaceModeConvex = EBackFaceMode::IgnoreBackFaces;
+
+			ClosestShapeCastCollector collector;
+
+			const LayerFilters filters = GetLayerFilters(_physicsSystem, _query.layer);
+			_physicsSystem.GetNarrowPhaseQueryNoLock().CastShape(
+				cast,
+				settings,
+				RVec3::sZero(),
+				collector,
+				filters.broad,
+				filters.object,
+				IgnoreSelfBodyFilter(_query.ignoreBody)
+			);
+			if (!collector.hasHit) { return; }
+
+			_outHit.hasHit = true;
+			_outHit.fraction = collector.hit.mFraction;
+			_outHit.point = ToVector3(Vec3(collector.hit.mContactPointOn2));
+			_outHit.bodyID = collector.hit.mBodyID2;
+			_outHit.collider = _physicsSystem.GetCollider3D(collector.hit.mBodyID2);
+
+			const Vec3 axis = collector.hit.mPenetrationAxis;
+			if (axis.LengthSq() > 0.0f)
+			{
+				_outHit.normal = ToVector3(-axis.Normalized());
+			}
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// PhysicsQuery class
+	//-----------------------------------------------------------------------------
+	PhysicsQuery::PhysicsQuery(PhysicsSystem& _physicsSystem)
+		: physicsSystem(_physicsSystem)
+	{
+	}
+
+	void PhysicsQuery::CastRays(const std::vector<RayQuery>& _queries, std::vector<RayHit>& _outHits)
+	{
+		_outHits.resize(_queries.size());
+		this->CastRays(std::span<const RayQuery>(_queries), std::span<RayHit>(_outHits));
+	}
+
+	void PhysicsQuery::CastRays(std::span<const RayQuery> _queries, std::span<RayHit> _outHits)
+	{
+		if (_outHits.size() < _queries.size()) { return; }
+
+		this->physicsSystem.ParallelFor("PhysicsQuery::CastRays", _queries.size(), MinQueriesPerJob,
+			[this, _queries, _outHits](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					CastRay(this->physicsSystem, _queries[i], _outHits[i]);
+				}
+			});
+	}
+
+	void PhysicsQuery::CollideShapes(const std::vector<OverlapQuery>& _queries, std::vector<OverlapRange>& _outRanges, std::vector<OverlapHit>& _outHits)
+	{
+		// クエリごとに maxHits 分の書き込み先を割り当てておき、ジョブ同士が同じ領域に触れないようにする
+		this->overlapOffsets.resize(_queries.size());
+		uint32_t capacity = 0;
+		for (size_t i = 0; i < _queries.size(); ++i)
+		{
+			this->overlapOffsets[i] = capacity;
+			capacity += _queries[i].maxHits;
+		}
+		this->overlapScratch.resize(capacity);
+		_outRanges.resize(_queries.size());
+
+		this->physicsSystem.ParallelFor("PhysicsQuery::CollideShapes", _queries.size(), MinQueriesPerJob,
+			[this, &_queries, &_outRanges](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					OverlapHit* out = this->overlapScratch.data() + this->overlapOffsets[i];
+					_outRanges[i].count = CollideShape(this->physicsSystem, _queries[i], out);
+				}
+			});
+
+		// 空きを詰めて 1 本の配列にする
+		_outHits.clear();
+		for (size_t i = 0; i < _queries.size(); ++i)
+		{
+			OverlapRange& range = _outRanges[i];
+			range.first = static_cast<uint32_t>(_outHits.size());
+
+			const auto first = this->overlapScratch.begin() + this->overlapOffsets[i];
+			_outHits.insert(_outHits.end(), first, first + range.count);
+		}
+	}
+
+	void PhysicsQuery::CastShapes(const std::vector<ShapeCastQuery>& _queries, std::vector<ShapeCastHit>& _outHits)
+	{
+		_outHits.resize(_queries.size());
+
+		this->physicsSystem.ParallelFor("PhysicsQuery::CastShapes", _queries.size(), MinQueriesPerJob,
+			[this, &_queries, &_outHits](size_t _begin, size_t _end)
+			{
+				for (size_t i = _begin; i < _end; ++i)
+				{
+					CastShape(this->physicsSystem, _queries[i], _outHits[i]);
+				}
+			});
+	}
+
+	QueryHandle PhysicsQuery::ScheduleRay(const RayQuery& _query)
+	{
+		this->pendingRays.push_back(_query);
+		return this->MakeHandle(this->pendingRays.size() - 1);
+	}
+
+	QueryHandle PhysicsQuery::ScheduleOverlap(const OverlapQuery& _query)
+	{
+		this->pendingOverlaps.push_back(_query);
+		return this->MakeHandle(this->pendingOverlaps.size() - 1);
+	}
+
+	QueryHandle PhysicsQuery::ScheduleShapeCast(const ShapeCastQuery& _query)
+	{
+		this->pendingCasts.push_back(_query);
+		return this->MakeHandle(this->pendingCasts.size() - 1);
+	}
+
+	void PhysicsQuery::ResolveDeferred()
+	{
+		// 予約が無ければ前回の結果をそのまま残す（1 フレームに複数ステップ進んでも引ける）
+		if (this->pendingRays.empty() && this->pendingOverlaps.empty() && this->pendingCasts.empty())
+		{
+			return;
+		}
+
+		this->CastRays(this->pendingRays, this->rayResults);
+		this->CollideShapes(this->pendingOverlaps, this->overlapRanges, this->overlapResults);
+		this->CastShapes(this->pendingCasts, this->castResults);
+
+		this->pendingRays.clear();
+		this->pendingOverlaps.clear();
+		this->pendingCasts.clear();
+
+		this->resolvedGeneration = this->pendingGeneration;
+		// 0 は無効なハンドルとして使うので飛ばす
+		if (++this->pendingGeneration == 0) { this->pendingGeneration = 1; }
+	}
+
+	const RayHit* PhysicsQuery::GetRayHit(QueryHandle _handle) const
+	{
+		return this->IsResolved(_handle, this->rayResults.size()) ? &this->rayResults[_handle.index] : nullptr;
+	}
+
+	bool PhysicsQuery::GetOverlapHits(QueryHandle _handle, const OverlapHit*& _outHits, uint32_t& _outCount) const
+	{
+		_outHits = nullptr;
+		_outCount = 0;
+		if (!this->IsResolved(_handle, this->overlapRanges.size())) { return false; }
+
+		const OverlapRange& range = this->overlapRanges[_handle.index];
+		_outHits = this->overlapResults.data() + range.first;
+		_outCount = range.count;
+		return true;
+	}
+
+	const ShapeCastHit* PhysicsQuery::GetShapeCastHit(QueryHandle _handle) const
+	{
+		return this->IsResolved(_handle, this->castResults.size()) ? &this->castResults[_handle.index] : nullptr;
+	}
+
+	void PhysicsQuery::Clear()
+	{
+		this->pendingRays.clear();
+		this->pendingOverlaps.clear();
+		this->pendingCasts.clear();
+		this->rayResults.clear();
+		this->overlapRanges.clear();
+		this->overlapResults.clear();
+		this->castResults.clear();
+
+		// 古いハンドルで新しい結果を引かないよう、世代は進めたままにする
+		this->resolvedGeneration = 0;
+		if (++this->pendingGeneration == 0) { this->pendingGeneration = 1; }
+	}
+
+	QueryHandle PhysicsQuery::MakeHandle(size_t _index) const
+	{
+		return QueryHandle{ static_cast<uint32_t>(_index), this->pendingGeneration };
+	}
+
+	bool PhysicsQuery::IsResolved(QueryHandle _handle, size_t _count) const
+	{
+		return _handle.IsValid()
+			&& _handle.generation == this->resolvedGeneration
+			&& _handle.index < _count;
+	}
+} // namespace Framework::Physics
@@ -0,0 +1,185 @@
+﻿/** @file   PhysicsRecorder.cpp
+ *  @brief  物理ログの記録
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/PhysicsRecorder.h"
+
+#include <filesystem>
+#include <iostream>
+
+namespace Framework::Physics
+{
+	//-----------------------------------------------------------------------------
+	// PhysicsRecorder class
+	//-----------------------------------------------------------------------------
+	PhysicsRecorder::PhysicsRecorder()
+		: file()
+		, stream(nullptr)
+		, shapeMap()
+		, materialMap()
+		, groupFilterMap()
+		, stepCount(0)
+	{
+	}
+
+	PhysicsRecorder::~PhysicsRecorder()
+	{
+		this->End();
+	}
+
+	bool PhysicsRecorder::Begin(const std::string& _path, const PhysicsConfig& _config)
+	{
+		this->End();
+
+		const std::filesystem::path path(_path);
+		if (path.has_parent_path())
+		{
+			std::error_code ec;
+			std::filesystem::create_directories(path.parent_path(), ec);
+		}
+
+		this->file.open(path, std::ios::binary | std::ios::trunc);
+		if (!this->file)
+		{
+			std::cerr << "[PhysicsRecorder] 出力先を開けません : " << _path << std::endl;
+			return false;
+		}
+
+		RecordHeader header{};
+		header.maxBodies = _config.maxBodies;
+		header.maxBodyPairs = _config.maxBodyPairs;
+		header.maxContactConstraints = _config.maxContactConstraints;
+		header.tempAllocatorSize = _config.tempAllocatorSize;
+		header.workerThreads = _config.workerThreads;
+
+		this->stream = std::make_unique<JPH::StreamOutWrapper>(this->file);
+		this->stream->Write(header);
+		this->stepCount = 0;
+
+		std::cout << "[PhysicsRecorder] 記録を開始しました : " << _path << std::endl;
+		return true;
+	}
+
+	void PhysicsRecorder::End()
+	{
+		if (!this->stream) { return; }
+
+		this->stream->Write(RecordType::End);
+		const bool failed = this->stream->IsFailed();
+
+		this->stream.reset();
+		this->file.close();
+		this->shapeMap.clear();
+		this->materialMap.clear();
+		this->groupFilterMap.clear();
+
+		if (failed)
+		{
+			std::cerr << "[PhysicsRecorder] 書き込みに失敗しました" << std::endl;
+			return;
+		}
+		std::cout << "[PhysicsRecorder] " << this->stepCount << " ステップを記録しました" << std::endl;
+	}
+
+	void PhysicsRecorder::CreateBody(JPH::BodyID _bodyID, const JPH::BodyCreationSettings& _settings)
+	{
+		if (!this->stream) { return; }
+
+		this->WriteBodyRecord(RecordType::CreateBody, _bodyID);
+		_settings.SaveWithChildren(*this->stream, &this->shapeMap, &this->materialMap, &this->groupFilterMap);
+	}
+
+	void PhysicsRecorder::AddBody(JPH::BodyID _bodyID, JPH::EActivation _activation)
+	{
+		if (!this->stream) { return; }
+
+		this->WriteBodyRecord(RecordType::AddBody, _bodyID);
+		this->stream->Write(_activation);
+	}
+
+	void PhysicsRecorder::AddBodies(const JPH::BodyID* _bodyIDs, int _count, JPH::EActivation _activation)
+	{
+		if (!this->stream || _count <= 0) { return; }
+
+		this->stream->Write(RecordType::AddBodies);
+		this->stream->Write(_activation);
+		this->stream->Write(static_cast<uint32_t>(_count));
+		for (int i = 0; i < _count; ++i)
+		{
+			this->stream->Write(_bodyIDs[i].GetIndexAndSequenceNumber());
+		}
+	}
+
+	void PhysicsRecorder::RemoveBody(JPH::BodyID _bodyID)
+	{
+		if (!this->stream) { return; }
+		this->WriteBodyRecord(RecordType::RemoveBody, _bodyID);
+	}
+
+	void PhysicsRecorder::DestroyBody(JPH::BodyID _bodyID)
+	{
+		if (!this->stream) { return; }
+		this->WriteBodyRecord(RecordType::DestroyBody, _bodyID);
+	}
+
+	void PhysicsRecorder::MoveKinematic(JPH::BodyID _bodyID, JPH::RVec3Arg _position, JPH::QuatArg _rotation, float _deltaTime)
+	{
+		if (!this->stream) { return; }
+
+		this->WriteBodyRecord(RecordType::MoveKinematic, _bodyID);
+		this->stream->Write(JPH::RVec3(_position));
+		this->stream->Write(JPH::Quat(_rotation));
+		this->stream->Write(_deltaTime);
+	}
+
+	void PhysicsRecorder::SetMotionType(JPH::BodyID _bodyID, JPH::EMotionType _motionType, JPH::EActivation _activation)
+	{
+		if (!this->stream) { return; }
+
+		this->WriteBodyRecord(RecordType::SetMotionType, _bodyID);
+		this->stream->Write(_motionType);
+		this->stream->Write(_activation);
+	}
+
+	void PhysicsRecorder::SetMotionQuality(JPH::BodyID _bodyID, JPH::EMotionQuality _motionQuality)
+	{
+		if (!this->stream) { return; }
+
+		this->WriteBodyRecord(RecordType::SetMotionQuality, _bodyID);
+		this->stream->Write(_motionQuality);
+	}
+
+	void PhysicsRecorder::SetObjectLayer(JPH::BodyID _bodyID, JPH::ObjectLayer _layer)
+	{
+		if (!this->stream) { return; }
+
+		this->WriteBodyRecord(RecordType::SetObjectLayer, _bodyID);
+		this->stream->Write(_layer);
+	}
+
+	void PhysicsRecorder::OptimizeBroadPhase()
+	{
+		if (!this->stream) { return; }
+		this->stream->Write(RecordType::OptimizeBroadPhase);
+	}
+
+	void PhysicsRecorder::Step(float _deltaTime, uint64_t _stateHash)
+	{
+		if (!this->stream) { return; }
+
+		this->stream->Write(RecordType::Step);
+		this->stream->Write(_deltaTime);
+		this->stream->Write(_stateHash);
+		++this->stepCount;
+	}
+
+	void PhysicsRecorder::WriteBodyRecord(RecordType _type, JPH::BodyID _bodyID)
+	{
+		this->stream->Write(_type);
+		this->stream->Write(_bodyID.GetIndexAndSequenceNumber());
+	}
+} // namespace Framework::Physics
@@ -0,0 +1,375 @@
+﻿/** @file   PhysicsReplay.cpp
+ *  @brief  物理ログのヘッドレス再生
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/PhysicsReplay.h"
+#include "Include/Framework/Physics/PhysicsRecorder.h"
+#include "Include/Framework/Core/PhysicsSystem.h"
+#include "Include/Framework/Utils/Profiler.h"
+
+#include <Jolt/Core/StreamWrapper.h>
+#include <Jolt/Physics/Collision/GroupFilter.h>
+#include <Jolt/Physics/Collision/PhysicsMaterial.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace Framework::Physics::PhysicsReplay
+{
+	//-----------------------------------------------------------------------------
+	// Local Helpers
+	//-----------------------------------------------------------------------------
+	namespace
+	{
+		using Clock = std::chrono::steady_clock;
+
+		/** @struct StepTiming
+		 *  @brief 1 ステップ分の計測値
+		 */
+		struct StepTiming
+		{
+			double milliseconds = 0.0;		///< Step + ProcessContactEvents の処理時間
+			uint32_t contactPairCount = 0;	///< 接触ペア数
+			bool matched = true;			///< 状態ハッシュが一致したか
+		};
+
+		/** @brief BodyID を読む
+		 *  @param _stream 入力
+		 *  @return 読んだ BodyID
+		 */
+		static JPH::BodyID ReadBodyID(JPH::StreamIn& _stream)
+		{
+			JPH::uint32 value = JPH::BodyID::cInvalidBodyID;
+			_stream.Read(value);
+			return JPH::BodyID(value);
+		}
+
+		/** @brief ステップごとの計測結果を CSV に出力する
+		 *  @param _path 出力先
+		 *  @param _timings 計測結果
+		 */
+		static void WriteTimingCsv(const std::string& _path, const std::vector<StepTiming>& _timings)
+		{
+			std::ofstream ofs(_path, std::ios::trunc);
+			if (!ofs)
+			{
+				std::cerr << "[PhysicsReplay] 計測結果を出力できません : " << _path << std::endl;
+				return;
+			}
+
+			ofs << "step,milliseconds,contactPairs,matched\n";
+			for (size_t i = 0; i < _timings.size(); i++)
+			{
+				ofs << i << ',' << _timings[i].milliseconds << ',' << _timings[i].contactPairCount << ',' << (_timings[i].matched ? 1 : 0) << '\n';
+			}
+		}
+
+		/** @brief 計測値を集計する
+		 *  @param _timings 計測結果
+		 *  @param _result 集計先
+		 */
+		static void Summarize(const std::vector<StepTiming>& _timings, Result& _result)
+		{
+			if (_timings.empty()) { return; }
+
+			std::vector<double> sorted;
+			sorted.reserve(_timings.size());
+
+			double total = 0.0;
+			for (size_t i = 0; i < _timings.size(); i++)
+			{
+				const double ms = _timings[i].milliseconds;
+				total += ms;
+				sorted.push_back(ms);
+				if (ms > _result.maxMilliseconds)
+				{
+					_result.maxMilliseconds = ms;
+					_result.slowestStep = i;
+				}
+			}
+
+			std::sort(sorted.begin(), sorted.end());
+			_result.averageMilliseconds = total / static_cast<double>(_timings.size());
+			_result.p95Milliseconds = sorted[std::min(sorted.size() - 1, sorted.size() * 95 / 100)];
+		}
+
+		/** @brief 引数を数値として読む（数値でない・余分な文字が付いている場合は失敗）
+		 *  @param _text 引数
+		 *  @param _out 読んだ値
+		 *  @return 読めたら true
+		 */
+		template<typename T>
+		static bool ParseNumber(const char* _text, T& _out)
+		{
+			const char* end = _text + std::strlen(_text);
+			const auto [last, error] = std::from_chars(_text, end, _out);
+			return error == std::errc() && last == end;
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// Functions
+	//-----------------------------------------------------------------------------
+	Result Run(const Settings& _settings)
+	{
+		Result result{};
+
+		std::ifstream ifs(_settings.logPath, std::ios::binary);
+		if (!ifs)
+		{
+			std::cerr << "[PhysicsReplay] ログを開けません : " << _settings.logPath << std::endl;
+			return result;
+		}
+		JPH::StreamInWrapper stream(ifs);
+
+		RecordHeader header{};
+		stream.Read(header);
+		if (stream.IsEOF() || stream.IsFailed() || header.magic != RecordMagic || header.version != RecordVersion)
+		{
+			std::cerr << "[PhysicsReplay] 物理ログではないか、バージョンが違います : " << _settings.logPath << std::endl;
+			return result;
+		}
+
+		//-----------------------------------------------------------
+		// 記録時と同じ容量で作る（Jolt はスレッド数に依らず決定的）
+		//-----------------------------------------------------------
+		PhysicsConfig config{};
+		config.maxBodies = header.maxBodies;
+		config.maxBodyPairs = header.maxBodyPairs;
+		config.maxContactConstraints = header.maxContactConstraints;
+		config.tempAllocatorSize = header.tempAllocatorSize;
+		config.workerThreads = (_settings.workerThreads > 0) ? _settings.workerThreads : header.workerThreads;
+
+		PhysicsSystem physicsSystem;
+		if (!physicsSystem.Initialize(config))
+		{
+			return result;
+		}
+		auto& bodyInterface = physicsSystem.GetBodyInterface();
+
+		JPH::BodyCreationSettings::IDToShapeMap shapeMap;
+		JPH::BodyCreationSettings::IDToMaterialMap materialMap;
+		JPH::BodyCreationSettings::IDToGroupFilterMap groupFilterMap;
+
+		std::vector<StepTiming> timings;
+		std::vector<JPH::BodyID> batch;
+
+		//-----------------------------------------------------------
+		// 再生
+		//-----------------------------------------------------------
+		bool reachedEnd = false;
+		while (!reachedEnd)
+		{
+			RecordType type = RecordType::End;
+			stream.Read(type);
+			if (stream.IsEOF() || stream.IsFailed())
+			{
+				std::cerr << "[PhysicsReplay] ログが途中で終わっています（" << timings.size() << " ステップ目）" << std::endl;
+				break;
+			}
+
+			switch (type)
+			{
+			case RecordType::End:
+				reachedEnd = true;
+				break;
+
+			case RecordType::CreateBody:
+			{
+				const JPH::BodyID id = ReadBodyID(stream);
+				auto settings = JPH::BodyCreationSettings::sRestoreWithChildren(stream, shapeMap, materialMap, groupFilterMap);
+				if (settings.HasError())
+				{
+					std::cerr << "[PhysicsReplay] Body の復元に失敗しました : " << settings.GetError() << std::endl;
+					return result;
+				}
+				if (!bodyInterface.CreateBodyWithID(id, settings.Get()))
+				{
+					std::cerr << "[PhysicsReplay] Body を記録時の ID で作れません : " << id.GetIndex() << std::endl;
+					return result;
+				}
+				break;
+			}
+			case RecordType::AddBody:
+			{
+				const JPH::BodyID id = ReadBodyID(stream);
+				JPH::EActivation activation = JPH::EActivation::Activate;
+				stream.Read(activation);
+				bodyInterface.AddBody(id, activation);
+				break;
+			}
+			case RecordType::AddBodies:
+			{
+				JPH::EActivation activation = JPH::EActivation::Activate;
+				uint32_t count = 0;
+				stream.Read(activation);
+				stream.Read(count);
+
+				batch.clear();
+				for (uint32_t i = 0; i < count; i++)
+				{
+					batch.push_back(ReadBodyID(stream));
+				}
+
+				const int number = static_cast<int>(batch.size());
+				JPH::BodyInterface::AddState state = bodyInterface.AddBodiesPrepare(batch.data(), number);
+				bodyInterface.AddBodiesFinalize(batch.data(), number, state, activation);
+				break;
+			}
+			case RecordType::RemoveBody:
+				bodyInterface.RemoveBody(ReadBodyID(stream));
+				break;
+
+			case RecordType::DestroyBody:
+				bodyInterface.DestroyBody(ReadBodyID(stream));
+				break;
+
+			case RecordType::MoveKinematic:
+			{
+				const JPH::BodyID id = ReadBodyID(stream);
+				JPH::RVec3 position;
+				JPH::Quat rotation;
+				float deltaTime = 0.0f;
+				stream.Read(position);
+				stream.Read(rotation);
+				stream.Read(deltaTime);
+				bodyInterface.MoveKinematic(id, position, rotation, deltaTime);
+				break;
+			}
+			case RecordType::SetMotionType:
+			{
+				const JPH::BodyID id = ReadBodyID(stream);
+				JPH::EMotionType motionType = JPH::EMotionType::Static;
+				JPH::EActivation activation = JPH::EActivation::Activate;
+				stream.Read(motionType);
+				stream.Read(activation);
+				bodyInterface.SetMotionType(id, motionType, activation);
+				break;
+			}
+			case RecordType::SetMotionQuality:
+			{
+				const JPH::BodyID id = ReadBodyID(stream);
+				JPH::EMotionQuality motionQuality = JPH::EMotionQuality::Discrete;
+				stream.Read(motionQuality);
+				bodyInterface.SetMotionQuality(id, motionQuality);
+				break;
+			}
+			case RecordType::SetObjectLayer:
+			{
+				const JPH::BodyID id = ReadBodyID(stream);
+				JPH::ObjectLayer layer = 0;
+				stream.Read(layer);
+				bodyInterface.SetObjectLayer(id, layer);
+				break;
+			}
+			case RecordType::OptimizeBroadPhase:
+				physicsSystem.OptimizeBroadPhase();
+				break;
+
+			case RecordType::Step:
+			{
+				float deltaTime = 0.0f;
+				uint64_t expectedHash = 0;
+				stream.Read(deltaTime);
+				stream.Read(expectedHash);
+
+				// GameLoop の固定ステップと同じく Step → ProcessContactEvents の順に進める
+				Framework::Profiler::ScopedZone zone("ReplayStep");
+				const auto begin = Clock::now();
+				physicsSystem.Step(deltaTime);
+				const auto stepEnd = Clock::now();
+				const uint64_t hash = physicsSystem.ComputeStateHash();
+				const auto contactBegin = Clock::now();
+				physicsSystem.ProcessContactEvents();
+				const auto end = Clock::now();
+
+				StepTiming& timing = timings.emplace_back();
+				timing.milliseconds = std::chrono::duration<double, std::milli>((stepEnd - begin) + (end - contactBegin)).count();
+				timing.contactPairCount = physicsSystem.GetStats().contactPairCount;
+				timing.matched = (hash == expectedHash);
+
+				if (!timing.matched)
+				{
+					if (result.mismatchCount == 0)
+					{
+						result.firstMismatchStep = static_cast<int64_t>(timings.size() - 1);
+						std::cerr << "[PhysicsReplay] " << result.firstMismatchStep << " ステップ目で状態ハッシュが食い違いました" << std::endl;
+					}
+					++result.mismatchCount;
+				}
+				break;
+			}
+			default:
+				std::cerr << "[PhysicsReplay] 不明な記録です : " << static_cast<int>(type) << std::endl;
+				return result;
+			}
+		}
+
+		result.loaded = reachedEnd;
+		result.stepCount = timings.size();
+		Summarize(timings, result);
+
+		if (!_settings.timingCsvPath.empty())
+		{
+			WriteTimingCsv(_settings.timingCsvPath, timings);
+		}
+		return result;
+	}
+
+	bool RunCommandLine(int _argc, char** _argv, int& _outExitCode)
+	{
+		if (_argc < 2) { return false; }
+		if (std::string(_argv[1]) != "--replay-physics") { return false; }
+
+		if (_argc < 3)
+		{
+			std::cerr << "[PhysicsReplay] 使い方 : --replay-physics <log> [timingCsv] [maxAverageMs] [workerThreads]" << std::endl;
+			_outExitCode = 1;
+			return true;
+		}
+
+		Settings settings{};
+		settings.logPath = _argv[2];
+		if (_argc > 3 && std::string(_argv[3]) != "-") { settings.timingCsvPath = _argv[3]; }
+		// 数値でない引数は再生せずに失敗で返す（CI で終了コードを見られるように）
+		if (_argc > 4 && (!ParseNumber(_argv[4], settings.maxAverageMilliseconds) || !(settings.maxAverageMilliseconds >= 0.0)))
+		{
+			std::cerr << "[PhysicsReplay] 平均処理時間の上限が不正です（0 以上のミリ秒） : " << _argv[4] << std::endl;
+			_outExitCode = 1;
+			return true;
+		}
+		if (_argc > 5 && !ParseNumber(_argv[5], settings.workerThreads))
+		{
+			std::cerr << "[PhysicsReplay] ワーカースレッド数が不正です : " << _argv[5] << std::endl;
+			_outExitCode = 1;
+			return true;
+		}
+
+		const Result result = Run(settings);
+
+		std::cout << "[PhysicsReplay] steps " << result.stepCount
+			<< ", mismatches " << result.mismatchCount
+			<< ", avg " << result.averageMilliseconds << " ms"
+			<< ", p95 " << result.p95Milliseconds << " ms"
+			<< ", max " << result.maxMilliseconds << " ms (step " << result.slowestStep << ")\n";
+
+		bool passed = result.loaded && result.mismatchCount == 0;
+		if (settings.maxAverageMilliseconds > 0.0 && result.averageMilliseconds > settings.maxAverageMilliseconds)
+		{
+			std::cerr << "[PhysicsReplay] 平均処理時間が上限 " << settings.maxAverageMilliseconds << " ms を超えました" << std::endl;
+			passed = false;
+		}
+
+		_outExitCode = passed ? 0 : 1;
+		return true;
+	}
+} // namespace Framework::Physics::PhysicsReplay
@@ -0,0 +1,75 @@
+﻿/** @file   PhysicsReplayMain.cpp
+ *  @brief  物理ログ再生だけを行うヘッドレス版のエントリポイント
+ *  @date   2026/10/18
+ *  @details
+ *      - FRAMEWORK_PHYSICS_HEADLESS を定義したときだけ有効になる（通常のビルドでは空になる）
+ *      - DirectX / WRL に依存せず、Jolt と Source/Framework の次のファイルだけでビルドできる
+ *          Core/PhysicsSystem.cpp, Physics/PhysicsLayers.cpp, Physics/PhysicsContactListener.cpp,
+ *          Physics/ContactPairTable.cpp, Physics/PhysicsTelemetry.cpp, Physics/PhysicsRecorder.cpp,
+ *          Physics/PhysicsReplay.cpp, Utils/Profiler.cpp, Physics/PhysicsReplayMain.cpp
+ *      - JPH_* の定義は Jolt のライブラリをビルドしたときと揃えること（違うと型の配置がずれ、
+ *        コンパイルに失敗するか起動時に落ちる）。同梱の設定では JPH_PROFILE_ENABLED / JPH_DEBUG_RENDERER / JPH_OBJECT_STREAM
+ *      - 例（Code から。<JoltLibDir> は libJolt.a のあるディレクトリ）:
+ *          g++ -std=c++20 -O2 -DFRAMEWORK_PHYSICS_HEADLESS -DJPH_PROFILE_ENABLED -DJPH_DEBUG_RENDERER -DJPH_OBJECT_STREAM
+ *              -I. -I../External/joltphysics/include
+ *              Source/Framework/Core/PhysicsSystem.cpp Source/Framework/Physics/PhysicsLayers.cpp
+ *              Source/Framework/Physics/PhysicsContactListener.cpp Source/Framework/Physics/ContactPairTable.cpp
+ *              Source/Framework/Physics/PhysicsTelemetry.cpp Source/Framework/Physics/PhysicsRecorder.cpp
+ *              Source/Framework/Physics/PhysicsReplay.cpp Source/Framework/Utils/Profiler.cpp
+ *              Source/Framework/Physics/PhysicsReplayMain.cpp
+ *              -L<JoltLibDir> -lJolt -lpthread -o PhysicsReplay
+ *      - 使い方 : PhysicsReplay --replay-physics <log> [timingCsv] [maxAverageMs] [workerThreads] [--profile <path>]
+ */
+
+#if defined(FRAMEWORK_PHYSICS_HEADLESS)
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/PhysicsReplay.h"
+#include "Include/Framework/Utils/Profiler.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// EntryPoint
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    // --profile <path> は main.cpp と同じく先に取り除く
+    std::string profilePath;
+    std::vector<char*> args;
+    for (int i = 0; i < argc; i++)
+    {
+        if (i + 1 < argc && std::string(argv[i]) == "--profile")
+        {
+            profilePath = argv[++i];
+            continue;
+        }
+        args.push_back(argv[i]);
+    }
+
+    if (!profilePath.empty())
+    {
+        Framework::Profiler::SetThreadName("Main");
+        Framework::Profiler::BeginCapture();
+    }
+
+    int exitCode = 1;
+    if (!Framework::Physics::PhysicsReplay::RunCommandLine(static_cast<int>(args.size()), args.data(), exitCode))
+    {
+        std::cerr << "[PhysicsReplay] 使い方 : --replay-physics <log> [timingCsv] [maxAverageMs] [workerThreads] [--profile <path>]" << std::endl;
+        exitCode = 1;
+    }
+
+    if (!profilePath.empty())
+    {
+        Framework::Profiler::EndCapture();
+        Framework::Profiler::WriteChromeTrace(profilePath);
+    }
+    return exitCode;
+}
+
+#endif // FRAMEWORK_PHYSICS_HEADLESS
@@ -0,0 +1,86 @@
+﻿/** @file   PhysicsTelemetry.cpp
+ *  @brief  物理システムの計測値の記録と警告
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Physics/PhysicsTelemetry.h"
+
+#include <Jolt/Physics/EPhysicsUpdateError.h>
+
+#include <iostream>
+
+namespace Framework::Physics
+{
+	//-----------------------------------------------------------------------------
+	// PhysicsTelemetry class
+	//-----------------------------------------------------------------------------
+	void PhysicsTelemetry::Reset(const PhysicsConfig& _config)
+	{
+		this->stats = PhysicsStats{};
+		this->stats.maxBodies = _config.maxBodies;
+		this->stats.maxBodyPairs = _config.maxBodyPairs;
+		this->stats.maxContactConstraints = _config.maxContactConstraints;
+		this->stats.tempAllocatorSize = _config.tempAllocatorSize;
+
+		this->warningRatio = _config.warningRatio;
+		this->bodyWarned = false;
+		this->bodyPairWarned = false;
+		this->constraintWarned = false;
+		this->tempWarned = false;
+	}
+
+	void PhysicsTelemetry::Record(const PhysicsStats& _stats)
+	{
+		const uint64_t stepCount = this->stats.stepCount + 1;
+		const uint64_t overflowStepCount = this->stats.overflowStepCount + (_stats.updateErrors != 0 ? 1 : 0);
+		const size_t tempPeak = std::max(this->stats.tempAllocatorPeak, _stats.tempAllocatorStepPeak);
+
+		this->stats = _stats;
+		this->stats.stepCount = stepCount;
+		this->stats.overflowStepCount = overflowStepCount;
+		this->stats.tempAllocatorPeak = tempPeak;
+
+		this->CheckUsage("Body", _stats.bodyCount, _stats.maxBodies, this->bodyWarned);
+		this->CheckUsage("Body ペア", _stats.bodyPairCount, _stats.maxBodyPairs, this->bodyPairWarned);
+		this->CheckUsage("接触拘束", _stats.contactConstraintCount, _stats.maxContactConstraints, this->constraintWarned);
+		this->CheckUsage("一時領域", _stats.tempAllocatorStepPeak, _stats.tempAllocatorSize, this->tempWarned);
+
+		// 捨てた接触はそのステップの挙動に直接出るので、続いていても毎ステップ報告する
+		if (_stats.updateErrors == 0) { return; }
+
+		const auto errors = static_cast<JPH::EPhysicsUpdateError>(_stats.updateErrors);
+		auto has = [errors](JPH::EPhysicsUpdateError _flag) { return (errors & _flag) != JPH::EPhysicsUpdateError::None; };
+
+		std::cerr << "[PhysicsSystem] ステップ " << this->stats.stepCount << " で接触が上限を超えたため一部を破棄しました:";
+		if (has(JPH::EPhysicsUpdateError::BodyPairCacheFull))
+		{
+			std::cerr << " maxBodyPairs(" << _stats.bodyPairCount << " / " << _stats.maxBodyPairs << ")";
+		}
+		if (has(JPH::EPhysicsUpdateError::ManifoldCacheFull) || has(JPH::EPhysicsUpdateError::ContactConstraintsFull))
+		{
+			std::cerr << " maxContactConstraints(" << _stats.contactConstraintCount << " / " << _stats.maxContactConstraints << ")";
+		}
+		std::cerr << " を PhysicsConfig で増やしてください" << std::endl;
+	}
+
+	void PhysicsTelemetry::CheckUsage(const char* _label, size_t _used, size_t _capacity, bool& _warned) const
+	{
+		if (_capacity == 0) { return; }
+
+		const double ratio = static_cast<double>(_used) / static_cast<double>(_capacity);
+		if (ratio < this->warningRatio)
+		{
+			_warned = false;
+			return;
+		}
+		if (_warned) { return; }
+
+		_warned = true;
+		std::cerr << "[PhysicsSystem] " << _label << " の使用量が上限に近づいています: "
+			<< _used << " / " << _capacity
+			<< " (" << static_cast<int>(ratio * 100.0) << "%)" << std::endl;
+	}
+} // namespace Framework::Physics
@@ -9,6 +9,7 @@
 
 #include"Include/Framework/Core/SystemLocator.h"
 #include"Include/Framework/Core/InputSystem.h"
+#include"Include/Framework/Core/PhysicsSystem.h"
 #include"Include/Scenes/SceneManager.h"
 
 #include<iostream>
@@ -30,8 +31,14 @@ BaseScene::~BaseScene() {}
  */
 void BaseScene::Initialize()
 {
+    // 読み込み時に生成される Body はまとめて追加する（追加後に BroadPhase も最適化される）
+    auto& physicsSystem = SystemLocator::Get<Framework::Physics::PhysicsSystem>();
+    physicsSystem.BeginBodyBatch();
+
     // 初期化
     this->gameObjectManager.FlushInitialize();
+
+    physicsSystem.EndBodyBatch();
 }
 
 /**	@brief		オブジェクトの更新を行う
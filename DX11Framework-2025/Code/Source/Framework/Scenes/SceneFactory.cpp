@@ -20,10 +20,12 @@ SceneFactory::~SceneFactory() {}
 /**	@brief	指定のSceneTypeに対応する生成関数を登録する
  *	@param	SceneType	_type		生成するシーンの種類
  *	@param	Creator		_creator	生成するシーンの種類
+ *	@param	SceneManifest	_manifest	遷移前に読み込んでおくリソース
  */
-void SceneFactory::Register(SceneType _type, Creator _creator)
+void SceneFactory::Register(SceneType _type, Creator _creator, SceneManifest _manifest)
 {
 	this->registry[_type] = std::move(_creator);
+	this->manifests[_type] = std::move(_manifest);
 }
 
 /**	@brief　指定されたSceneTypeに対応するシーンを生成して返す
@@ -44,3 +46,17 @@ std::unique_ptr<BaseScene> SceneFactory::Create(SceneType _type) const
     return nullptr; 
 }
 
+/**	@brief	指定されたSceneTypeのリソース一覧を返す
+ *	@param	SceneType				_type	シーンの種類
+ *	@return	const SceneManifest*			リソース一覧（未登録なら nullptr）
+ */
+const SceneManifest* SceneFactory::GetManifest(SceneType _type) const
+{
+    auto it = this->manifests.find(_type);
+    if (it != this->manifests.end())
+    {
+        return &it->second;
+    }
+    return nullptr;
+}
+
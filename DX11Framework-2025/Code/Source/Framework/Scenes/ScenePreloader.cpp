@@ -0,0 +1,144 @@
+﻿/**	@file	ScenePreloader.cpp
+*	@date	2026/10/18
+*/
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include"Include/Framework/Scenes/ScenePreloader.h"
+#include"Include/Framework/Core/ResourceHub.h"
+#include"Include/Framework/Utils/Profiler.h"
+
+#include <algorithm>
+#include <thread>
+
+//-----------------------------------------------------------------------------
+// ScenePreloader Class
+//-----------------------------------------------------------------------------
+
+/// @brief	コンストラクタ
+ScenePreloader::ScenePreloader() {}
+/// @brief	デストラクタ
+ScenePreloader::~ScenePreloader() { this->Wait(); }
+
+/**	@brief	読み込みを開始する
+ *	@param	const SceneManifest&	_manifest	読み込むリソースの一覧
+ */
+void ScenePreloader::Start(const SceneManifest& _manifest)
+{
+	// 前回の分が残っていれば終わらせてから捨てる
+	this->Wait();
+	this->modelKeys.clear();
+	this->clipKeys.clear();
+	this->models.clear();
+	this->clips.clear();
+
+	this->modelManager = &ResourceHub::Get<ModelManager>();
+	this->animationClipManager = &ResourceHub::Get<AnimationClipManager>();
+
+	// 登録済みのものは読み込まない（登録表を見るのはメインスレッドのここだけ）
+	for (const auto& key : _manifest.models)
+	{
+		if (!this->modelManager->Get(key)) { this->modelKeys.push_back(key); }
+	}
+	for (const auto& key : _manifest.animationClips)
+	{
+		if (!this->animationClipManager->Get(key)) { this->clipKeys.push_back(key); }
+	}
+
+	// 結果の置き場は先に確保しておき、ワーカーは自分の取り出した番号の場所にだけ書く
+	this->models.resize(this->modelKeys.size());
+	this->clips.resize(this->clipKeys.size());
+
+	this->totalCount = this->modelKeys.size() + this->clipKeys.size();
+	this->nextIndex.store(0, std::memory_order_relaxed);
+	this->completedCount.store(0, std::memory_order_relaxed);
+	if (this->totalCount == 0) { return; }
+
+	const size_t hardwareCount = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+	const size_t workerCount = std::min({ MaxWorkerCount, hardwareCount - 1, this->totalCount });
+	for (size_t i = 0; i < workerCount; i++)
+	{
+		this->workers.push_back(std::async(std::launch::async, [this]() { this->WorkerMain(); }));
+	}
+}
+
+/**	@brief	読み込みの進み具合
+ *	@return	float	0.0 ～ 1.0
+ */
+float ScenePreloader::GetProgress() const
+{
+	if (this->totalCount == 0) { return 1.0f; }
+	return static_cast<float>(this->completedCount.load(std::memory_order_acquire)) / static_cast<float>(this->totalCount);
+}
+
+/**	@brief	全て読み込み終えたか
+ *	@return	bool	終えていれば true
+ */
+bool ScenePreloader::IsReady() const
+{
+	return this->completedCount.load(std::memory_order_acquire) >= this->totalCount;
+}
+
+/// @brief	読み込んだリソースを登録する
+void ScenePreloader::Commit()
+{
+	this->Wait();
+
+	// GPU への転送と登録表の書き換えはメインスレッドでまとめて行う
+	for (auto& model : this->models)
+	{
+		if (!model.modelData) { continue; }
+		this->modelManager->Commit(std::move(model));
+	}
+	for (size_t i = 0; i < this->clips.size(); i++)
+	{
+		if (!this->clips[i]) { continue; }
+		this->animationClipManager->Commit(this->clipKeys[i], std::move(this->clips[i]));
+	}
+
+	this->modelKeys.clear();
+	this->clipKeys.clear();
+	this->models.clear();
+	this->clips.clear();
+	this->totalCount = 0;
+}
+
+/// @brief	ワーカーの処理
+void ScenePreloader::WorkerMain()
+{
+	Framework::Profiler::SetThreadName("ScenePreloader");
+
+	for (;;)
+	{
+		const size_t index = this->nextIndex.fetch_add(1, std::memory_order_relaxed);
+		if (index >= this->totalCount) { return; }
+
+		{
+			Framework::Profiler::ScopedZone zone("ScenePreloader::Load");
+
+			// 失敗しても空のまま数える（Commit で飛ばし、シーン側の Register で改めて報告される）
+			if (index < this->modelKeys.size())
+			{
+				this->models[index] = this->modelManager->Preload(this->modelKeys[index]);
+			}
+			else
+			{
+				const size_t clipIndex = index - this->modelKeys.size();
+				this->clips[clipIndex] = this->animationClipManager->Preload(this->clipKeys[clipIndex]);
+			}
+		}
+
+		this->completedCount.fetch_add(1, std::memory_order_acq_rel);
+	}
+}
+
+/// @brief	ワーカーの終了を待つ
+void ScenePreloader::Wait()
+{
+	for (auto& worker : this->workers)
+	{
+		worker.get();
+	}
+	this->workers.clear();
+}
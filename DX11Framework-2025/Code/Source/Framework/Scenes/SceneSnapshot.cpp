@@ -0,0 +1,888 @@
+﻿/**	@file	SceneSnapshot.cpp
+*	@date	2026/10/18
+*/
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include"Include/Framework/Scenes/SceneSnapshot.h"
+#include"Include/Framework/Core/ResourceHub.h"
+#include"Include/Framework/Core/SystemLocator.h"
+#include"Include/Framework/Core/PhysicsSystem.h"
+#include"Include/Framework/Core/TimeScaleSystem.h"
+#include"Include/Framework/Entities/MeshComponent.h"
+#include"Include/Framework/Entities/MaterialComponent.h"
+#include"Include/Framework/Entities/MeshRenderer.h"
+#include"Include/Framework/Graphics/MeshManager.h"
+#include"Include/Framework/Graphics/MaterialManager.h"
+#include"Include/Framework/Graphics/SpriteManager.h"
+#include"Include/Framework/Graphics/ModelManager.h"
+#include"Include/Framework/Graphics/AnimationClipManager.h"
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	/**	@struct	FileHeader
+	 *	@brief	ファイルのヘッダ
+	 */
+	struct FileHeader
+	{
+		uint32_t magic = SceneSnapshot::Magic;		///< 識別子
+		uint32_t version = SceneSnapshot::Version;	///< バージョン
+		uint32_t stringCount = 0;					///< 文字列表の数
+		uint32_t modelCount = 0;					///< マニフェストのモデル数
+		uint32_t clipCount = 0;						///< マニフェストのクリップ数
+		uint32_t objectCount = 0;					///< オブジェクト数
+		uint32_t componentCount = 0;				///< コンポーネント数
+		uint32_t payloadBytes = 0;					///< コンポーネントのデータの合計
+	};
+
+	/**	@struct	ObjectRecord
+	 *	@brief	オブジェクト 1 つ分
+	 */
+	struct ObjectRecord
+	{
+		uint32_t nameIndex = 0;										///< 名前（文字列番号）
+		uint32_t parentIndex = GameObjectManager::NoParent;			///< 親の添字
+		int32_t tag = 0;											///< GameTags::Tag
+		uint8_t isActive = 1;										///< 有効状態
+		uint8_t reserved[3] = {};									///< 予約
+		uint32_t componentCount = 0;								///< 持っているコンポーネントの数
+	};
+
+	/**	@struct	ComponentRecord
+	 *	@brief	コンポーネント 1 つ分
+	 */
+	struct ComponentRecord
+	{
+		uint32_t typeIndex = 0;			///< 型名（文字列番号）
+		uint32_t payloadOffset = 0;		///< データの位置
+		uint32_t payloadSize = 0;		///< データの大きさ
+		uint8_t isActive = 1;			///< 有効状態
+		uint8_t reserved[3] = {};		///< 予約
+	};
+
+	static_assert(sizeof(FileHeader) == 32);
+	static_assert(sizeof(ObjectRecord) == 20);
+	static_assert(sizeof(ComponentRecord) == 16);
+
+	/**	@struct	CodecRegistry
+	 *	@brief	登録された型の保存・復元方法（メインスレッドからだけ触る）
+	 */
+	struct CodecRegistry
+	{
+		std::unordered_map<std::type_index, SceneSnapshot::ComponentCodec> byType;	///< 保存用（型から引く）
+		std::unordered_map<std::string, const SceneSnapshot::ComponentCodec*> byName;	///< 復元用（型名から引く）
+		bool builtinsRegistered = false;												///< 標準の型を登録済みか
+	};
+
+	/**	@brief	登録表を取得する
+	 *	@return	CodecRegistry&
+	 */
+	static CodecRegistry& GetRegistry()
+	{
+		static CodecRegistry registry;
+		return registry;
+	}
+
+	/**	@struct	ParsedSnapshot
+	 *	@brief	ファイルを読み分けた結果（データは元のバッファを指す）
+	 */
+	struct ParsedSnapshot
+	{
+		FileHeader header{};							///< ヘッダ
+		std::vector<std::string> strings;				///< 文字列表
+		std::vector<uint32_t> manifest;					///< マニフェスト（モデル→クリップの順）
+		std::vector<ObjectRecord> objects;				///< オブジェクト
+		std::vector<ComponentRecord> components;		///< コンポーネント
+		const uint8_t* payload = nullptr;				///< データの先頭
+	};
+
+	/**	@brief	バッファから値を読む
+	 *	@param	const std::vector<uint8_t>&	_buffer		バッファ
+	 *	@param	size_t&						_offset		読み込み位置（読んだ分進める）
+	 *	@param	void*						_outData	読み込み先
+	 *	@param	size_t						_bytes		バイト数
+	 *	@return	bool						読めれば true
+	 */
+	static bool ReadBytes(const std::vector<uint8_t>& _buffer, size_t& _offset, void* _outData, size_t _bytes)
+	{
+		if (_buffer.size() - _offset < _bytes) { return false; }
+		if (_bytes > 0) { std::memcpy(_outData, _buffer.data() + _offset, _bytes); }
+		_offset += _bytes;
+		return true;
+	}
+
+	/**	@brief	残りのバイト数に、指定した数のレコードが収まるか確かめる（壊れた個数のまま確保しないように、確保の前に呼ぶ）
+	 *	@param	const std::vector<uint8_t>&	_buffer			バッファ
+	 *	@param	size_t						_offset			読み込み位置
+	 *	@param	uint64_t					_count			レコード数
+	 *	@param	size_t						_recordBytes	1 レコードの最小バイト数
+	 *	@return	bool						収まれば true
+	 */
+	static bool FitsRemaining(const std::vector<uint8_t>& _buffer, size_t _offset, uint64_t _count, size_t _recordBytes)
+	{
+		return _count <= (_buffer.size() - _offset) / _recordBytes;
+	}
+
+	/**	@brief	ファイルを丸ごと読み込む
+	 *	@param	const std::string&		_path		ファイル
+	 *	@param	std::vector<uint8_t>&	_outBuffer	読み込み先
+	 *	@return	bool					読めれば true
+	 */
+	static bool ReadWholeFile(const std::string& _path, std::vector<uint8_t>& _outBuffer)
+	{
+		std::ifstream ifs(_path, std::ios::binary | std::ios::ate);
+		if (!ifs)
+		{
+			std::cerr << "[SceneSnapshot] ファイルを開けません : " << _path << std::endl;
+			return false;
+		}
+
+		const std::streamsize size = ifs.tellg();
+		ifs.seekg(0, std::ios::beg);
+		_outBuffer.resize(static_cast<size_t>(size));
+		if (size > 0 && !ifs.read(reinterpret_cast<char*>(_outBuffer.data()), size))
+		{
+			std::cerr << "[SceneSnapshot] 読み込みに失敗しました : " << _path << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	/**	@brief	ファイルの中身を読み分ける（番号の範囲もここで確かめる）
+	 *	@param	const std::vector<uint8_t>&	_buffer		ファイルの中身
+	 *	@param	ParsedSnapshot&				_out		読み分けた結果
+	 *	@return	bool						壊れていなければ true
+	 */
+	static bool Parse(const std::vector<uint8_t>& _buffer, ParsedSnapshot& _out)
+	{
+		size_t offset = 0;
+		FileHeader& header = _out.header;
+		if (!ReadBytes(_buffer, offset, &header, sizeof(header))) { return false; }
+		if (header.magic != SceneSnapshot::Magic || header.version != SceneSnapshot::Version) { return false; }
+
+		// 文字列表（1 つにつき最低でも長さの 4 バイトがある）
+		if (!FitsRemaining(_buffer, offset, header.stringCount, sizeof(uint32_t))) { return false; }
+		_out.strings.resize(header.stringCount);
+		for (auto& text : _out.strings)
+		{
+			uint32_t length = 0;
+			if (!ReadBytes(_buffer, offset, &length, sizeof(length))) { return false; }
+			if (_buffer.size() - offset < length) { return false; }
+			text.assign(reinterpret_cast<const char*>(_buffer.data() + offset), length);
+			offset += length;
+		}
+
+		// 固定長の部分はまとめて読む（先に合計の大きさが残りに収まるか確かめる）
+		const uint64_t fixedBytes =
+			(static_cast<uint64_t>(header.modelCount) + header.clipCount) * sizeof(uint32_t) +
+			static_cast<uint64_t>(header.objectCount) * sizeof(ObjectRecord) +
+			static_cast<uint64_t>(header.componentCount) * sizeof(ComponentRecord);
+		if (!FitsRemaining(_buffer, offset, fixedBytes, 1)) { return false; }
+		_out.manifest.resize(static_cast<size_t>(header.modelCount) + header.clipCount);
+		_out.objects.resize(header.objectCount);
+		_out.components.resize(header.componentCount);
+		if (!ReadBytes(_buffer, offset, _out.manifest.data(), _out.manifest.size() * sizeof(uint32_t))) { return false; }
+		if (!ReadBytes(_buffer, offset, _out.objects.data(), _out.objects.size() * sizeof(ObjectRecord))) { return false; }
+		if (!ReadBytes(_buffer, offset, _out.components.data(), _out.components.size() * sizeof(ComponentRecord))) { return false; }
+		if (_buffer.size() - offset < header.payloadBytes) { return false; }
+		_out.payload = _buffer.data() + offset;
+
+		// 番号が範囲内か
+		for (uint32_t index : _out.manifest)
+		{
+			if (index >= header.stringCount) { return false; }
+		}
+
+		uint64_t componentTotal = 0;
+		for (size_t i = 0; i < _out.objects.size(); i++)
+		{
+			const ObjectRecord& object = _out.objects[i];
+			if (object.nameIndex >= header.stringCount) { return false; }
+			if (object.parentIndex != GameObjectManager::NoParent && object.parentIndex >= i) { return false; }
+			componentTotal += object.componentCount;
+		}
+		if (componentTotal != header.componentCount) { return false; }
+
+		for (const auto& component : _out.components)
+		{
+			if (component.typeIndex >= header.stringCount) { return false; }
+			if (static_cast<uint64_t>(component.payloadOffset) + component.payloadSize > header.payloadBytes) { return false; }
+		}
+		return true;
+	}
+
+	/// @brief	標準のコンポーネントを登録する
+	static void RegisterBuiltinComponents()
+	{
+		SceneSnapshot::RegisterComponent<Transform>("Transform",
+			[](const Transform& _transform, SnapshotWriter& _writer)
+			{
+				_writer.Write(_transform.GetLocalPosition());
+				_writer.Write(_transform.GetLocalRotation());
+				_writer.Write(_transform.GetLocalScale());
+			},
+			[](Transform& _transform, SnapshotReader& _reader)
+			{
+				DX::Vector3 position{};
+				DX::Quaternion rotation{};
+				DX::Vector3 scale{};
+				if (!_reader.Read(position) || !_reader.Read(rotation) || !_reader.Read(scale)) { return false; }
+				_transform.SetLocalPosition(position);
+				_transform.SetLocalRotation(rotation);
+				_transform.SetLocalScale(scale);
+				return true;
+			});
+
+		SceneSnapshot::RegisterComponent<TimeScaleComponent>("TimeScaleComponent",
+			[](const TimeScaleComponent& _timeScale, SnapshotWriter& _writer)
+			{
+				_writer.Write(_timeScale.GetTimeScale());
+				_writer.Write(static_cast<uint8_t>(_timeScale.GetTimeScaleLayer()));
+				_writer.WriteString(_timeScale.GetGroupName());
+				_writer.Write(static_cast<uint8_t>(_timeScale.IsIgnoreGroup()));
+				_writer.Write(static_cast<uint8_t>(_timeScale.IsIgnoreLayer()));
+				_writer.Write(static_cast<uint8_t>(_timeScale.IsIgnoreGlobal()));
+			},
+			[](TimeScaleComponent& _timeScale, SnapshotReader& _reader)
+			{
+				float scale = 1.0f;
+				uint8_t layer = 0;
+				std::string groupName;
+				uint8_t ignore[3] = {};
+				if (!_reader.Read(scale) || !_reader.Read(layer) || !_reader.ReadString(groupName) || !_reader.Read(ignore)) { return false; }
+				_timeScale.SetTimeScale(scale);
+				_timeScale.SetTimeScaleLayer(static_cast<TimeScaleLayer>(layer));
+				if (!groupName.empty()) { _timeScale.SetGroupName(groupName); }
+				_timeScale.SetignoreGroup(ignore[0] != 0);
+				_timeScale.SetIgnoreLayer(ignore[1] != 0);
+				_timeScale.SetIgnoreGlobal(ignore[2] != 0);
+				return true;
+			});
+
+		// メッシュはポインタではなく MeshManager の登録名で残す
+		SceneSnapshot::RegisterComponent<MeshComponent>("MeshComponent",
+			[](const MeshComponent& _mesh, SnapshotWriter& _writer)
+			{
+				const std::string* key = _mesh.GetMesh() ? ResourceHub::Get<MeshManager>().FindKey(_mesh.GetMesh()) : nullptr;
+				_writer.WriteString(key ? *key : std::string());
+			},
+			[](MeshComponent& _mesh, SnapshotReader& _reader)
+			{
+				std::string key;
+				if (!_reader.ReadString(key)) { return false; }
+				if (key.empty()) { return true; }
+
+				auto& meshManager = ResourceHub::Get<MeshManager>();
+				Graphics::Mesh* mesh = meshManager.Get(key);
+				if (!mesh) { mesh = meshManager.Register(key); }
+				if (!mesh)
+				{
+					std::cerr << "[SceneSnapshot] メッシュが見つかりません : " << key << std::endl;
+				}
+				_mesh.SetMesh(mesh);
+				return true;
+			});
+
+		// マテリアルと個別テクスチャも登録名で残す（登録名の無いもの・デフォルトは空にして、Initialize で既定値に戻す）
+		SceneSnapshot::RegisterComponent<MaterialComponent>("MaterialComponent",
+			[](const MaterialComponent& _material, SnapshotWriter& _writer)
+			{
+				const std::string* materialKey = _material.GetMaterial() ? ResourceHub::Get<MaterialManager>().FindKey(_material.GetMaterial()) : nullptr;
+				const std::string* textureKey = _material.GetTexture() ? ResourceHub::Get<SpriteManager>().FindKey(_material.GetTexture()) : nullptr;
+				_writer.WriteString(materialKey ? *materialKey : std::string());
+				_writer.WriteString(textureKey ? *textureKey : std::string());
+				_writer.Write(_material.GetParams());
+			},
+			[](MaterialComponent& _material, SnapshotReader& _reader)
+			{
+				std::string materialKey;
+				std::string textureKey;
+				MaterialParams params{};
+				if (!_reader.ReadString(materialKey) || !_reader.ReadString(textureKey) || !_reader.Read(params)) { return false; }
+
+				if (!materialKey.empty()) { _material.SetMaterial(ResourceHub::Get<MaterialManager>().Get(materialKey)); }
+				if (!textureKey.empty())
+				{
+					TextureResource* texture = ResourceHub::Get<SpriteManager>().Get(textureKey);
+					if (!texture)
+					{
+						std::cerr << "[SceneSnapshot] テクスチャが見つかりません : " << textureKey << std::endl;
+					}
+					_material.SetTexture(texture);
+				}
+				_material.SetParams(params);
+				return true;
+			});
+		SceneSnapshot::RegisterComponent<MeshRenderer>("MeshRenderer");
+	}
+
+	/// @brief	標準のコンポーネントを登録していなければ登録する
+	static void EnsureBuiltinComponents()
+	{
+		CodecRegistry& registry = GetRegistry();
+		if (registry.builtinsRegistered) { return; }
+
+		// 先に立てておく（登録中の AddCodec から再び呼ばれるため）
+		registry.builtinsRegistered = true;
+		RegisterBuiltinComponents();
+	}
+
+	/**	@brief	セルフテスト用のオブジェクトを作る（リソースを使わない範囲で全ての標準コンポーネントを含める）
+	 *	@param	GameObjectManager&	_manager	生成先
+	 */
+	static void BuildSelfTestObjects(GameObjectManager& _manager)
+	{
+		GameObject* root = _manager.Instantiate("Root", GameTags::Tag::Player);
+		root->transform->SetLocalPosition(DX::Vector3(1.0f, 2.0f, 3.0f));
+		root->transform->SetLocalRotation(DX::Quaternion::CreateFromYawPitchRoll(0.5f, 0.25f, 0.125f));
+		root->transform->SetLocalScale(DX::Vector3(2.0f, 2.0f, 2.0f));
+		root->TimeScale()->SetTimeScale(0.5f);
+		root->TimeScale()->SetTimeScaleLayer(TimeScaleLayer::Effect);
+		root->TimeScale()->SetGroupName("SnapshotSelfTest");
+		root->TimeScale()->SetIgnoreGlobal(true);
+
+		MaterialParams params{};
+		params.Diffuse = DX::Color(0.25f, 0.5f, 0.75f, 1.0f);
+		params.Emission = DX::Color(0.1f, 0.0f, 0.0f, 1.0f);
+		params.Shiness = 8.0f;
+		root->AddComponent<MaterialComponent>()->SetParams(params);
+		root->AddComponent<MeshRenderer>();	// MeshComponent も付く
+
+		GameObject* child = _manager.Instantiate("Child");
+		child->SetParent(root);
+		child->transform->SetLocalPosition(DX::Vector3(0.0f, -1.0f, 0.5f));
+		child->AddComponent<MeshComponent>()->SetActive(false);
+
+		GameObject* grandChild = _manager.Instantiate("GrandChild", GameTags::Tag::Enemy, false);
+		grandChild->SetParent(child);
+		grandChild->transform->SetLocalRotation(DX::Quaternion::CreateFromAxisAngle(DX::Vector3(0.0f, 1.0f, 0.0f), 1.0f));
+
+		GameObject* other = _manager.Instantiate("Other", GameTags::Tag::Camera);
+		other->transform->SetLocalScale(DX::Vector3(1.0f, 3.0f, 1.0f));
+	}
+
+	/**	@brief	2 つのコンポーネントが同じデータを持つか比べる（型は一致していること）
+	 *	@param	const Component&	_expected	元のコンポーネント
+	 *	@param	const Component&	_actual		復元したコンポーネント
+	 *	@return	bool				一致すれば true
+	 */
+	static bool CompareComponent(const Component& _expected, const Component& _actual)
+	{
+		if (_expected.IsActive() != _actual.IsActive()) { return false; }
+
+		if (auto expected = dynamic_cast<const Transform*>(&_expected))
+		{
+			auto actual = static_cast<const Transform*>(&_actual);
+			return expected->GetLocalPosition() == actual->GetLocalPosition()
+				&& expected->GetLocalRotation() == actual->GetLocalRotation()
+				&& expected->GetLocalScale() == actual->GetLocalScale();
+		}
+		if (auto expected = dynamic_cast<const TimeScaleComponent*>(&_expected))
+		{
+			auto actual = static_cast<const TimeScaleComponent*>(&_actual);
+			return expected->GetTimeScale() == actual->GetTimeScale()
+				&& expected->GetTimeScaleLayer() == actual->GetTimeScaleLayer()
+				&& expected->GetGroupName() == actual->GetGroupName()
+				&& expected->IsIgnoreGroup() == actual->IsIgnoreGroup()
+				&& expected->IsIgnoreLayer() == actual->IsIgnoreLayer()
+				&& expected->IsIgnoreGlobal() == actual->IsIgnoreGlobal();
+		}
+		if (auto expected = dynamic_cast<const MaterialComponent*>(&_expected))
+		{
+			auto actual = static_cast<const MaterialComponent*>(&_actual);
+			return expected->GetMaterial() == actual->GetMaterial()
+				&& expected->GetTexture() == actual->GetTexture()
+				&& std::memcmp(&expected->GetParams(), &actual->GetParams(), sizeof(MaterialParams)) == 0;
+		}
+		if (auto expected = dynamic_cast<const MeshComponent*>(&_expected))
+		{
+			return expected->GetMesh() == static_cast<const MeshComponent*>(&_actual)->GetMesh();
+		}
+		return true;
+	}
+
+	/**	@brief	復元したオブジェクトが元と同じ構成か比べる（名前で対応を取る）
+	 *	@param	const GameObjectManager&	_expected	元のオブジェクト
+	 *	@param	GameObjectManager&			_actual		復元したオブジェクト
+	 *	@return	bool						一致すれば true
+	 */
+	static bool CompareObjects(const GameObjectManager& _expected, GameObjectManager& _actual)
+	{
+		if (_expected.GetGameObjects().size() != _actual.GetGameObjects().size()) { return false; }
+
+		for (const auto& expected : _expected.GetGameObjects())
+		{
+			const GameObject* actual = _actual.GetFindObjectByName(expected->GetName());
+			if (!actual) { return false; }
+			if (expected->GetTag() != actual->GetTag() || expected->IsActive() != actual->IsActive()) { return false; }
+
+			const GameObject* expectedParent = expected->Parent();
+			const GameObject* actualParent = actual->Parent();
+			if ((expectedParent == nullptr) != (actualParent == nullptr)) { return false; }
+			if (expectedParent && expectedParent->GetName() != actualParent->GetName()) { return false; }
+
+			const auto& expectedComponents = expected->GetComponents();
+			const auto& actualComponents = actual->GetComponents();
+			if (expectedComponents.size() != actualComponents.size()) { return false; }
+			for (size_t i = 0; i < expectedComponents.size(); i++)
+			{
+				const Component& expectedComponent = *expectedComponents[i];
+				const Component& actualComponent = *actualComponents[i];
+				if (typeid(expectedComponent) != typeid(actualComponent)) { return false; }
+				if (!CompareComponent(expectedComponent, actualComponent)) { return false; }
+			}
+		}
+		return true;
+	}
+
+	/**	@brief	オブジェクトを親から順に並べる
+	 *	@param	GameObject*					_object		並べるオブジェクト
+	 *	@param	std::vector<GameObject*>&	_outOrder	並べた結果
+	 */
+	static void CollectDepthFirst(GameObject* _object, std::vector<GameObject*>& _outOrder)
+	{
+		if (!_object || _object->IsPendingDestroy()) { return; }
+
+		_outOrder.push_back(_object);
+		if (Transform* transform = _object->GetTransform())
+		{
+			for (Transform* child : transform->GetChildren())
+			{
+				CollectDepthFirst(child->Owner(), _outOrder);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// SnapshotWriter / SnapshotReader Class
+//-----------------------------------------------------------------------------
+
+/**	@brief	文字列を書き出す
+ *	@param	const std::string&	_text	文字列
+ */
+void SnapshotWriter::WriteString(const std::string& _text)
+{
+	auto [it, inserted] = this->stringIndices.try_emplace(_text, static_cast<uint32_t>(this->strings.size()));
+	if (inserted) { this->strings.push_back(_text); }
+	this->Write(it->second);
+}
+
+/**	@brief	文字列を読み込む
+ *	@param	std::string&	_outText	読み込み先
+ *	@return	bool			読めれば true
+ */
+bool SnapshotReader::ReadString(std::string& _outText)
+{
+	uint32_t index = 0;
+	if (!this->Read(index) || index >= this->strings.size()) { return false; }
+	_outText = this->strings[index];
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// SceneSnapshot Class
+//-----------------------------------------------------------------------------
+
+/**	@brief	型の保存・復元方法を登録する
+ *	@param	std::type_index		_type	型
+ *	@param	ComponentCodec		_codec	保存・復元方法
+ */
+void SceneSnapshot::AddCodec(std::type_index _type, ComponentCodec _codec)
+{
+	EnsureBuiltinComponents();
+
+	CodecRegistry& registry = GetRegistry();
+	auto it = registry.byType.find(_type);
+	if (it != registry.byType.end())
+	{
+		registry.byName.erase(it->second.typeName);
+		it->second = std::move(_codec);
+	}
+	else
+	{
+		it = registry.byType.emplace(_type, std::move(_codec)).first;
+	}
+	registry.byName[it->second.typeName] = &it->second;
+}
+
+/**	@brief	管理中のゲームオブジェクトを保存する
+ *	@param	const std::string&		_path		保存先
+ *	@param	const GameObjectManager&	_manager	保存するオブジェクトの管理
+ *	@param	const SceneManifest&	_resources	読み込み時に先に登録しておくリソース
+ *	@return	bool					保存できれば true
+ */
+bool SceneSnapshot::Save(const std::string& _path, const GameObjectManager& _manager, const SceneManifest& _resources)
+{
+	EnsureBuiltinComponents();
+	const CodecRegistry& registry = GetRegistry();
+
+	std::vector<std::string> strings;
+	std::unordered_map<std::string, uint32_t> stringIndices;
+	std::vector<uint8_t> payload;
+	SnapshotWriter writer(payload, stringIndices, strings);
+
+	auto intern = [&](const std::string& _text)
+		{
+			auto [it, inserted] = stringIndices.try_emplace(_text, static_cast<uint32_t>(strings.size()));
+			if (inserted) { strings.push_back(_text); }
+			return it->second;
+		};
+
+	//-----------------------------------------------------------
+	// マニフェスト
+	//-----------------------------------------------------------
+	std::vector<uint32_t> manifest;
+	manifest.reserve(_resources.models.size() + _resources.animationClips.size());
+	for (const auto& key : _resources.models) { manifest.push_back(intern(key)); }
+	for (const auto& key : _resources.animationClips) { manifest.push_back(intern(key)); }
+
+	//-----------------------------------------------------------
+	// オブジェクトを親から順に並べる
+	//-----------------------------------------------------------
+	std::vector<GameObject*> order;
+	order.reserve(_manager.GetGameObjects().size());
+	for (const auto& object : _manager.GetGameObjects())
+	{
+		if (object && !object->Parent()) { CollectDepthFirst(object.get(), order); }
+	}
+
+	std::unordered_map<const GameObject*, uint32_t> objectIndices;
+	objectIndices.reserve(order.size());
+	for (size_t i = 0; i < order.size(); i++) { objectIndices.emplace(order[i], static_cast<uint32_t>(i)); }
+
+	//-----------------------------------------------------------
+	// オブジェクトとコンポーネント
+	//-----------------------------------------------------------
+	std::vector<ObjectRecord> objects;
+	std::vector<ComponentRecord> components;
+	std::set<std::string> skippedTypes;
+	objects.reserve(order.size());
+
+	for (GameObject* object : order)
+	{
+		ObjectRecord record{};
+		record.nameIndex = intern(object->GetName());
+		record.tag = static_cast<int32_t>(object->GetTag());
+		record.isActive = object->IsActive() ? 1 : 0;
+		if (object->Parent())
+		{
+			auto parentIt = objectIndices.find(object->Parent());
+			if (parentIt != objectIndices.end()) { record.parentIndex = parentIt->second; }
+		}
+
+		for (const auto& compUPtr : object->GetComponents())
+		{
+			const Component& component = *compUPtr;
+			auto codecIt = registry.byType.find(std::type_index(typeid(component)));
+			if (codecIt == registry.byType.end())
+			{
+				skippedTypes.insert(typeid(component).name());
+				continue;
+			}
+
+			const ComponentCodec& codec = codecIt->second;
+			ComponentRecord componentRecord{};
+			componentRecord.typeIndex = intern(codec.typeName);
+			componentRecord.payloadOffset = static_cast<uint32_t>(payload.size());
+			componentRecord.isActive = component.IsActive() ? 1 : 0;
+			if (codec.save) { codec.save(component, writer); }
+			componentRecord.payloadSize = static_cast<uint32_t>(payload.size()) - componentRecord.payloadOffset;
+
+			components.push_back(componentRecord);
+			++record.componentCount;
+		}
+		objects.push_back(record);
+	}
+
+	for (const auto& typeName : skippedTypes)
+	{
+		std::cout << "[SceneSnapshot] 登録されていないコンポーネントは保存しません : " << typeName << std::endl;
+	}
+
+	//-----------------------------------------------------------
+	// 書き出し
+	//-----------------------------------------------------------
+	const std::filesystem::path path(_path);
+	if (path.has_parent_path())
+	{
+		std::error_code ec;
+		std::filesystem::create_directories(path.parent_path(), ec);
+	}
+
+	std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+	if (!ofs)
+	{
+		std::cerr << "[SceneSnapshot] 出力先を開けません : " << _path << std::endl;
+		return false;
+	}
+
+	FileHeader header{};
+	header.stringCount = static_cast<uint32_t>(strings.size());
+	header.modelCount = static_cast<uint32_t>(_resources.models.size());
+	header.clipCount = static_cast<uint32_t>(_resources.animationClips.size());
+	header.objectCount = static_cast<uint32_t>(objects.size());
+	header.componentCount = static_cast<uint32_t>(components.size());
+	header.payloadBytes = static_cast<uint32_t>(payload.size());
+
+	ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	for (const auto& text : strings)
+	{
+		const uint32_t length = static_cast<uint32_t>(text.size());
+		ofs.write(reinterpret_cast<const char*>(&length), sizeof(length));
+		ofs.write(text.data(), length);
+	}
+	ofs.write(reinterpret_cast<const char*>(manifest.data()), manifest.size() * sizeof(uint32_t));
+	ofs.write(reinterpret_cast<const char*>(objects.data()), objects.size() * sizeof(ObjectRecord));
+	ofs.write(reinterpret_cast<const char*>(components.data()), components.size() * sizeof(ComponentRecord));
+	ofs.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+	if (!ofs)
+	{
+		std::cerr << "[SceneSnapshot] 書き込みに失敗しました : " << _path << std::endl;
+		return false;
+	}
+
+	std::cout << "[SceneSnapshot] " << objects.size() << " 個のオブジェクトを保存しました : " << _path << std::endl;
+	return true;
+}
+
+/**	@brief	保存したゲームオブジェクトを復元する
+ *	@param	const std::string&	_path		読み込むファイル
+ *	@param	GameObjectManager&	_manager	生成先
+ *	@return	bool				復元できれば true
+ */
+bool SceneSnapshot::Load(const std::string& _path, GameObjectManager& _manager)
+{
+	EnsureBuiltinComponents();
+	const CodecRegistry& registry = GetRegistry();
+
+	std::vector<uint8_t> buffer;
+	if (!ReadWholeFile(_path, buffer)) { return false; }
+
+	ParsedSnapshot snapshot;
+	if (!Parse(buffer, snapshot))
+	{
+		std::cerr << "[SceneSnapshot] シーンファイルではないか、壊れています : " << _path << std::endl;
+		return false;
+	}
+
+	//-----------------------------------------------------------
+	// 型名を先に引いておく（未登録の型があれば何も生成しない）
+	//-----------------------------------------------------------
+	std::vector<const ComponentCodec*> codecs(snapshot.strings.size(), nullptr);
+	for (const auto& component : snapshot.components)
+	{
+		const ComponentCodec*& codec = codecs[component.typeIndex];
+		if (codec) { continue; }
+
+		auto it = registry.byName.find(snapshot.strings[component.typeIndex]);
+		if (it == registry.byName.end())
+		{
+			std::cerr << "[SceneSnapshot] 登録されていないコンポーネントです : " << snapshot.strings[component.typeIndex] << std::endl;
+			return false;
+		}
+		codec = it->second;
+	}
+
+	//-----------------------------------------------------------
+	// 参照するリソースを先に登録する（先読み済みなら登録済みのものが返るだけ）
+	//-----------------------------------------------------------
+	const size_t modelCount = snapshot.header.modelCount;
+	for (size_t i = 0; i < snapshot.manifest.size(); i++)
+	{
+		const std::string& key = snapshot.strings[snapshot.manifest[i]];
+		if (i < modelCount) { ResourceHub::Get<ModelManager>().Register(key); }
+		else { ResourceHub::Get<AnimationClipManager>().Register(key); }
+	}
+
+	//-----------------------------------------------------------
+	// まとめて生成する
+	//-----------------------------------------------------------
+	std::vector<GameObjectManager::BulkObjectDesc> descs(snapshot.objects.size());
+	std::vector<uint32_t> firstComponents(snapshot.objects.size());
+	uint32_t componentCursor = 0;
+	for (size_t i = 0; i < snapshot.objects.size(); i++)
+	{
+		const ObjectRecord& record = snapshot.objects[i];
+		descs[i].name = snapshot.strings[record.nameIndex];
+		descs[i].tag = static_cast<GameTags::Tag>(record.tag);
+		descs[i].isActive = record.isActive != 0;
+		descs[i].parentIndex = record.parentIndex;
+
+		firstComponents[i] = componentCursor;
+		componentCursor += record.componentCount;
+	}
+
+	std::vector<Component*> inactiveComponents;
+	std::vector<GameObject*> created;
+	const bool succeeded = _manager.InstantiateBulk(descs,
+		[&](size_t _index, GameObject& _object)
+		{
+			const uint32_t first = firstComponents[_index];
+			for (uint32_t i = first; i < first + snapshot.objects[_index].componentCount; i++)
+			{
+				const ComponentRecord& record = snapshot.components[i];
+				const ComponentCodec& codec = *codecs[record.typeIndex];
+
+				Component* component = codec.attach(_object);
+				if (!component) { return false; }
+
+				if (codec.load)
+				{
+					const uint8_t* begin = snapshot.payload + record.payloadOffset;
+					SnapshotReader reader(begin, begin + record.payloadSize, snapshot.strings);
+					if (!codec.load(*component, reader))
+					{
+						std::cerr << "[SceneSnapshot] " << codec.typeName << " のデータを読めません : " << _object.GetName() << std::endl;
+						return false;
+					}
+				}
+				if (record.isActive == 0) { inactiveComponents.push_back(component); }
+			}
+			return true;
+		}, created);
+
+	if (!succeeded)
+	{
+		std::cerr << "[SceneSnapshot] 復元に失敗しました : " << _path << std::endl;
+		return false;
+	}
+
+	// 無効なコンポーネントは登録の後で止める（数は少ないので通知で外してよい）
+	for (Component* component : inactiveComponents)
+	{
+		component->SetActive(false);
+	}
+
+	std::cout << "[SceneSnapshot] " << created.size() << " 個のオブジェクトを復元しました : " << _path << std::endl;
+	return true;
+}
+
+/**	@brief	保存したリソース一覧だけを読み込む
+ *	@param	const std::string&	_path			読み込むファイル
+ *	@param	SceneManifest&		_outResources	読み込み先
+ *	@return	bool				読めれば true
+ */
+bool SceneSnapshot::ReadManifest(const std::string& _path, SceneManifest& _outResources)
+{
+	std::vector<uint8_t> buffer;
+	if (!ReadWholeFile(_path, buffer)) { return false; }
+
+	ParsedSnapshot snapshot;
+	if (!Parse(buffer, snapshot))
+	{
+		std::cerr << "[SceneSnapshot] シーンファイルではないか、壊れています : " << _path << std::endl;
+		return false;
+	}
+
+	_outResources.models.clear();
+	_outResources.animationClips.clear();
+	for (size_t i = 0; i < snapshot.manifest.size(); i++)
+	{
+		const std::string& key = snapshot.strings[snapshot.manifest[i]];
+		if (i < snapshot.header.modelCount) { _outResources.models.push_back(key); }
+		else { _outResources.animationClips.push_back(key); }
+	}
+	return true;
+}
+
+/**	@brief	保存→復元の往復をヘッドレスで確認する
+ *	@return	bool	全て一致すれば true
+ */
+bool SceneSnapshot::RunSelfTest()
+{
+	// アプリケーションを起動しないので、GameObjectManager が参照するシステムだけをここで用意する
+	// （PhysicsSystem は初期化しない。Rigidbody3D を使わなければ参照を持つだけ）
+	TimeScaleSystem timeScaleSystem;
+	Framework::Physics::PhysicsSystem physicsSystem;
+	SystemLocator::Register<TimeScaleSystem>(&timeScaleSystem);
+	SystemLocator::Register<Framework::Physics::PhysicsSystem>(&physicsSystem);
+
+	std::error_code ec;
+	const std::filesystem::path directory = std::filesystem::temp_directory_path(ec) / "scene_snapshot_selftest";
+	const std::string scenePath = (directory / (std::string("SelfTest") + Extension)).string();
+	const std::string manifestPath = (directory / (std::string("Manifest") + Extension)).string();
+
+	bool passed = true;
+	{
+		GameObjectManager source(nullptr);
+		BuildSelfTestObjects(source);
+
+		// 往復して、オブジェクト・親子関係・コンポーネントのデータが元と一致するか
+		GameObjectManager restored(nullptr);
+		bool ok = Save(scenePath, source) && Load(scenePath, restored) && CompareObjects(source, restored);
+		std::cout << "[SceneSnapshot] SelfTest round-trip" << (ok ? " OK" : " FAILED") << std::endl;
+		passed = passed && ok;
+
+		// 途中で切れたファイルは読まず、1 つも生成しない
+		const auto size = std::filesystem::file_size(scenePath, ec);
+		std::filesystem::resize_file(scenePath, ec ? 0 : size - 1, ec);
+		GameObjectManager truncated(nullptr);
+		ok = !ec && !Load(scenePath, truncated) && truncated.GetGameObjects().empty();
+		std::cout << "[SceneSnapshot] SelfTest truncated" << (ok ? " OK" : " FAILED") << std::endl;
+		passed = passed && ok;
+
+		// ヘッダの個数が壊れていても、確保に進まずに失敗する
+		const size_t countFields[] = {
+			offsetof(FileHeader, stringCount), offsetof(FileHeader, modelCount),
+			offsetof(FileHeader, objectCount), offsetof(FileHeader, componentCount) };
+		ok = true;
+		for (const size_t field : countFields)
+		{
+			std::vector<uint8_t> bytes;
+			ok = ok && Save(scenePath, source) && ReadWholeFile(scenePath, bytes) && bytes.size() >= sizeof(FileHeader);
+			if (!ok) { break; }
+
+			const uint32_t corrupted = 0xFFFFFFFFu;
+			std::memcpy(bytes.data() + field, &corrupted, sizeof(corrupted));
+			std::ofstream(scenePath, std::ios::binary | std::ios::trunc).write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+			GameObjectManager corruptedScene(nullptr);
+			ok = !Load(scenePath, corruptedScene) && corruptedScene.GetGameObjects().empty();
+		}
+		std::cout << "[SceneSnapshot] SelfTest corrupted counts" << (ok ? " OK" : " FAILED") << std::endl;
+		passed = passed && ok;
+
+		// リソース一覧はモデル→クリップの順で戻る（Load はリソースを登録するので ReadManifest だけで確かめる）
+		SceneManifest manifest;
+		manifest.models = { "SelfTestModel" };
+		manifest.animationClips = { "SelfTestIdle", "SelfTestRun" };
+		SceneManifest readBack;
+		ok = Save(manifestPath, source, manifest) && ReadManifest(manifestPath, readBack)
+			&& readBack.models == manifest.models && readBack.animationClips == manifest.animationClips;
+		std::cout << "[SceneSnapshot] SelfTest manifest" << (ok ? " OK" : " FAILED") << std::endl;
+		passed = passed && ok;
+	}
+
+	std::filesystem::remove_all(directory, ec);
+	SystemLocator::Unregister<Framework::Physics::PhysicsSystem>();
+	SystemLocator::Unregister<TimeScaleSystem>();
+
+	std::cout << "[SceneSnapshot] SelfTest " << (passed ? "passed" : "FAILED") << std::endl;
+	return passed;
+}
+
+/**	@brief	コマンドライン引数を解釈してセルフテストを実行する
+ *	@param	int		_argc			引数の数
+ *	@param	char**	_argv			引数
+ *	@param	int&	_outExitCode	終了コード
+ *	@return	bool	セルフテスト用の引数だった場合 true
+ */
+bool SceneSnapshot::RunCommandLine(int _argc, char** _argv, int& _outExitCode)
+{
+	if (_argc < 2 || std::string(_argv[1]) != "--scene-snapshot-selftest") { return false; }
+
+	_outExitCode = RunSelfTest() ? 0 : 1;
+	return true;
+}
@@ -47,6 +47,12 @@ ShaderManager::ShaderManager() :
 	// スキニング用
 	this->PreRegisterShaderInfo("VS_SkinnedModel", ShaderInfo(ShaderType::VertexShader, L"VertexShader/VS_SkinnedModel", LayoutType::Skinned));
 
+	// 圧縮頂点用（同じ VS を位置 float3 / 16bit 量子化の 2 レイアウトで登録する）
+	this->PreRegisterShaderInfo("VS_ModelCompact", ShaderInfo(ShaderType::VertexShader, L"VertexShader/VS_ModelCompact", LayoutType::ModelCompact));
+	this->PreRegisterShaderInfo("VS_ModelQuantized", ShaderInfo(ShaderType::VertexShader, L"VertexShader/VS_ModelCompact", LayoutType::ModelQuantized));
+	this->PreRegisterShaderInfo("VS_SkinnedModelCompact", ShaderInfo(ShaderType::VertexShader, L"VertexShader/VS_SkinnedModelCompact", LayoutType::SkinnedCompact));
+	this->PreRegisterShaderInfo("VS_SkinnedModelQuantized", ShaderInfo(ShaderType::VertexShader, L"VertexShader/VS_SkinnedModelCompact", LayoutType::SkinnedQuantized));
+
 	// シェーダープログラムの登録
 	this->CreateShaderProgram("Default", { "TestVS","TestPS","","","" });
 	this->CreateShaderProgram("ModelTest", { "VS_TestModel","PS_TestModel","","","" });
@@ -55,6 +61,10 @@ ShaderManager::ShaderManager() :
 	this->CreateShaderProgram("DebugWireframe", { "VS_DebugLine","PS_DebugLine","","","" });
 	this->CreateShaderProgram("Fog", { "VS_Fog","PS_Fog","","","" });
 	this->CreateShaderProgram("SkinnedModel", { "VS_SkinnedModel","PS_Model","","","" });
+	this->CreateShaderProgram("ModelCompact", { "VS_ModelCompact","PS_Model","","","" });
+	this->CreateShaderProgram("ModelQuantized", { "VS_ModelQuantized","PS_Model","","","" });
+	this->CreateShaderProgram("SkinnedModelCompact", { "VS_SkinnedModelCompact","PS_Model","","","" });
+	this->CreateShaderProgram("SkinnedModelQuantized", { "VS_SkinnedModelQuantized","PS_Model","","","" });
 
 	// デフォルト設定のシェーダーリソースを登録
 	this->defaultShadersMap[ShaderType::VertexShader] = this->Get("TestVS");
@@ -182,6 +192,25 @@ ShaderProgram* ShaderManager::GetShaderProgram(const std::string& _programName)
 	return &this->shaderProgramMap.at(_programName);
 }
 
+/**	@brief 頂点形式に合ったモデル描画用シェーダープログラムの取得
+ *	@param Graphics::VertexFormat _format	メッシュの頂点形式
+ *	@param bool _skinned					スキニング描画か
+ *	@return ShaderProgram*	シェーダープログラムの参照
+ */
+ShaderProgram* ShaderManager::GetModelShaderProgram(Graphics::VertexFormat _format, bool _skinned)
+{
+	switch (_format)
+	{
+	case Graphics::VertexFormat::Compact:
+		return this->GetShaderProgram(_skinned ? "SkinnedModelCompact" : "ModelCompact");
+	case Graphics::VertexFormat::CompactQuantized:
+		return this->GetShaderProgram(_skinned ? "SkinnedModelQuantized" : "ModelQuantized");
+	case Graphics::VertexFormat::Full:
+	default:
+		return this->GetShaderProgram(_skinned ? "SkinnedModel" : "ModelBasic");
+	}
+}
+
 /**	@brief シェーダー情報を事前登録する
  *	@param	const std::string& _key	リソースのキー
  *	@param	const ShaderInfo& _info	シェーダー情報
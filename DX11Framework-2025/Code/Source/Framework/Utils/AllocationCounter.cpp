@@ -0,0 +1,202 @@
+﻿/** @file   AllocationCounter.cpp
+ *  @brief  ヒープ確保回数の計測（グローバルな operator new の置き換え）
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Utils/AllocationCounter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+//-----------------------------------------------------------------------------
+// Local Helpers
+//-----------------------------------------------------------------------------
+namespace
+{
+	std::atomic<uint64_t> heapAllocationCount{ 0 };		///< operator new の呼び出し回数
+
+#if !defined(FRAMEWORK_DISABLE_ALLOCATION_COUNTER)
+	/** @brief 数えてから確保する（確保できなければ new_handler に任せる）
+	 *  @param _bytes バイト数
+	 *  @return 確保した領域（確保できなければ nullptr）
+	 */
+	static void* CountedAllocate(size_t _bytes)
+	{
+		heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+		const size_t bytes = std::max<size_t>(_bytes, 1);
+		for (;;)
+		{
+			if (void* memory = std::malloc(bytes)) { return memory; }
+
+			std::new_handler handler = std::get_new_handler();
+			if (!handler) { return nullptr; }
+			handler();
+		}
+	}
+
+	/** @brief アラインメント付きで数えてから確保する
+	 *  @param _bytes バイト数
+	 *  @param _alignment アラインメント
+	 *  @return 確保した領域（確保できなければ nullptr）
+	 */
+	static void* CountedAllocateAligned(size_t _bytes, std::align_val_t _alignment)
+	{
+		heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+		const size_t alignment = static_cast<size_t>(_alignment);
+		const size_t bytes = std::max<size_t>(_bytes, 1);
+		for (;;)
+		{
+#if defined(_MSC_VER)
+			if (void* memory = _aligned_malloc(bytes, alignment)) { return memory; }
+#else
+			if (void* memory = std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment)) { return memory; }
+#endif
+			std::new_handler handler = std::get_new_handler();
+			if (!handler) { return nullptr; }
+			handler();
+		}
+	}
+
+	/** @brief アラインメント付きで確保した領域を解放する
+	 *  @param _memory 領域
+	 */
+	static void FreeAligned(void* _memory)
+	{
+#if defined(_MSC_VER)
+		_aligned_free(_memory);
+#else
+		std::free(_memory);
+#endif
+	}
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Global operator new / delete
+//-----------------------------------------------------------------------------
+#if !defined(FRAMEWORK_DISABLE_ALLOCATION_COUNTER)
+void* operator new(size_t _bytes)
+{
+	if (void* memory = CountedAllocate(_bytes)) { return memory; }
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t _bytes)
+{
+	if (void* memory = CountedAllocate(_bytes)) { return memory; }
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t _bytes, const std::nothrow_t&) noexcept { return CountedAllocate(_bytes); }
+void* operator new[](size_t _bytes, const std::nothrow_t&) noexcept { return CountedAllocate(_bytes); }
+
+void* operator new(size_t _bytes, std::align_val_t _alignment)
+{
+	if (void* memory = CountedAllocateAligned(_bytes, _alignment)) { return memory; }
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t _bytes, std::align_val_t _alignment)
+{
+	if (void* memory = CountedAllocateAligned(_bytes, _alignment)) { return memory; }
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t _bytes, std::align_val_t _alignment, const std::nothrow_t&) noexcept { return CountedAllocateAligned(_bytes, _alignment); }
+void* operator new[](size_t _bytes, std::align_val_t _alignment, const std::nothrow_t&) noexcept { return CountedAllocateAligned(_bytes, _alignment); }
+
+void operator delete(void* _memory) noexcept { std::free(_memory); }
+void operator delete[](void* _memory) noexcept { std::free(_memory); }
+void operator delete(void* _memory, size_t) noexcept { std::free(_memory); }
+void operator delete[](void* _memory, size_t) noexcept { std::free(_memory); }
+void operator delete(void* _memory, const std::nothrow_t&) noexcept { std::free(_memory); }
+void operator delete[](void* _memory, const std::nothrow_t&) noexcept { std::free(_memory); }
+
+void operator delete(void* _memory, std::align_val_t) noexcept { FreeAligned(_memory); }
+void operator delete[](void* _memory, std::align_val_t) noexcept { FreeAligned(_memory); }
+void operator delete(void* _memory, size_t, std::align_val_t) noexcept { FreeAligned(_memory); }
+void operator delete[](void* _memory, size_t, std::align_val_t) noexcept { FreeAligned(_memory); }
+void operator delete(void* _memory, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(_memory); }
+void operator delete[](void* _memory, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(_memory); }
+#endif
+
+namespace Framework::Memory
+{
+	//-----------------------------------------------------------------------------
+	// Functions
+	//-----------------------------------------------------------------------------
+	uint64_t GetHeapAllocationCount()
+	{
+		return heapAllocationCount.load(std::memory_order_relaxed);
+	}
+
+	//-----------------------------------------------------------------------------
+	// FrameAllocationMonitor class
+	//-----------------------------------------------------------------------------
+
+	/// @brief コンストラクタ
+	FrameAllocationMonitor::FrameAllocationMonitor()
+		: lastTotal(GetHeapAllocationCount())
+		, lastFrameCount(0)
+		, warmupRemaining(Config::SteadyStateWarmupFrames)
+		, steadyFrames(0)
+		, steadyFramesWithAllocations(0)
+		, steadyPeakCount(0)
+	{
+	}
+
+	/** @brief フレームを終える
+	 *  @param _isSteady 定常状態として数えてよいか
+	 */
+	void FrameAllocationMonitor::EndFrame(bool _isSteady)
+	{
+		if constexpr (!Config::BuildEnableAllocationCounter) { return; }
+
+		const uint64_t total = GetHeapAllocationCount();
+		this->lastFrameCount = total - this->lastTotal;
+		this->lastTotal = total;
+
+		// 起動直後・シーン遷移の後はしばらく数えない（読み込みや初回の確保が続くため）
+		if (!_isSteady)
+		{
+			this->warmupRemaining = Config::SteadyStateWarmupFrames;
+			return;
+		}
+		if (this->warmupRemaining > 0)
+		{
+			--this->warmupRemaining;
+			return;
+		}
+
+		++this->steadyFrames;
+		if (this->lastFrameCount == 0) { return; }
+
+		++this->steadyFramesWithAllocations;
+		if (this->lastFrameCount > this->steadyPeakCount)
+		{
+			this->steadyPeakCount = this->lastFrameCount;
+			std::cout << "[AllocationCounter] 定常状態のフレームでヒープ確保が " << this->lastFrameCount
+				<< " 回ありました（最大を更新）" << std::endl;
+
+			// ログ出力の分は次のフレームに数えない
+			this->lastTotal = GetHeapAllocationCount();
+		}
+	}
+
+	/// @brief 集計をログに出す
+	void FrameAllocationMonitor::Report() const
+	{
+		if constexpr (!Config::BuildEnableAllocationCounter) { return; }
+
+		std::cout << "[AllocationCounter] 定常状態 " << this->steadyFrames << " フレーム中、確保があったのは "
+			<< this->steadyFramesWithAllocations << " フレーム（1 フレームの最大 " << this->steadyPeakCount << " 回）" << std::endl;
+	}
+} // namespace Framework::Memory
@@ -0,0 +1,153 @@
+﻿/** @file   FrameArena.cpp
+ *  @brief  FrameArena の実装
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Utils/FrameArena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+
+namespace Framework::Memory
+{
+	//-----------------------------------------------------------------------------
+	// Local Helpers
+	//-----------------------------------------------------------------------------
+	namespace
+	{
+		std::atomic<uint64_t> currentFrameEpoch{ 0 };		///< EndFrame のたびに進む
+
+		/** @brief 位置をアラインメントに合わせて切り上げる
+		 *  @param _address 位置
+		 *  @param _alignment アラインメント（2 の冪）
+		 *  @return 切り上げた位置
+		 */
+		static uintptr_t AlignUp(uintptr_t _address, size_t _alignment)
+		{
+			return (_address + (_alignment - 1)) & ~static_cast<uintptr_t>(_alignment - 1);
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// FrameArena class
+	//-----------------------------------------------------------------------------
+
+	/** @brief コンストラクタ
+	 *  @param _initialBytes 初期容量
+	 */
+	FrameArena::FrameArena(size_t _initialBytes)
+		: blocks()
+		, offset(0)
+		, retiredUsedBytes(0)
+		, retiredCapacityBytes(0)
+		, peakBytes(0)
+		, frameEpoch(currentFrameEpoch.load(std::memory_order_relaxed))
+	{
+		this->AddBlock(_initialBytes);
+	}
+
+	/** @brief 領域を確保する
+	 *  @param _bytes バイト数
+	 *  @param _alignment アラインメント（2 の冪）
+	 *  @return 確保した領域
+	 */
+	void* FrameArena::Allocate(size_t _bytes, size_t _alignment)
+	{
+		assert(_alignment > 0 && (_alignment & (_alignment - 1)) == 0 && "アラインメントは 2 の冪にしてください");
+
+		const size_t bytes = std::max<size_t>(_bytes, 1);
+
+		Block* block = &this->blocks.back();
+		uintptr_t base = reinterpret_cast<uintptr_t>(block->memory.get());
+		uintptr_t address = AlignUp(base + this->offset, _alignment);
+
+		// 入らなければ次の塊へ（このフレームだけ溢れる。Reset でまとめ直す）
+		if (address + bytes > base + block->size)
+		{
+			this->AddBlock(bytes + _alignment);
+			block = &this->blocks.back();
+			base = reinterpret_cast<uintptr_t>(block->memory.get());
+			address = AlignUp(base, _alignment);
+		}
+
+		this->offset = static_cast<size_t>(address + bytes - base);
+		this->peakBytes = std::max(this->peakBytes, this->UsedBytes());
+		return reinterpret_cast<void*>(address);
+	}
+
+	/// @brief 全て捨てる
+	void FrameArena::Reset()
+	{
+		// 溢れたフレームがあれば、その合計を入れられる 1 つの塊にまとめ直す
+		if (this->blocks.size() > 1)
+		{
+			const size_t total = this->CapacityBytes();
+			this->blocks.clear();
+			this->retiredUsedBytes = 0;
+			this->retiredCapacityBytes = 0;
+			this->AddBlock(total);
+		}
+
+		this->offset = 0;
+	}
+
+	/// @brief 使用中のバイト数
+	size_t FrameArena::UsedBytes() const
+	{
+		return this->retiredUsedBytes + this->offset;
+	}
+
+	/// @brief 確保済みの容量
+	size_t FrameArena::CapacityBytes() const
+	{
+		return this->retiredCapacityBytes + this->blocks.back().size;
+	}
+
+	/** @brief このスレッドの領域を取得する
+	 *  @return このスレッドの FrameArena
+	 */
+	FrameArena& FrameArena::ForThisThread()
+	{
+		thread_local FrameArena arena;
+
+		// フレームが進んでいたら前のフレームの分を捨てる（他スレッドの領域には触らない）
+		const uint64_t epoch = currentFrameEpoch.load(std::memory_order_acquire);
+		if (arena.frameEpoch != epoch)
+		{
+			arena.frameEpoch = epoch;
+			arena.Reset();
+		}
+		return arena;
+	}
+
+	/// @brief フレームを終える
+	void FrameArena::EndFrame()
+	{
+		currentFrameEpoch.fetch_add(1, std::memory_order_acq_rel);
+	}
+
+	/** @brief 塊を追加する
+	 *  @param _bytes 最低限必要なバイト数
+	 */
+	void FrameArena::AddBlock(size_t _bytes)
+	{
+		// 追加するときは倍々に増やして、溢れる回数を抑える
+		size_t previous = 0;
+		if (!this->blocks.empty())
+		{
+			previous = this->blocks.back().size;
+			this->retiredUsedBytes += this->offset;
+			this->retiredCapacityBytes += previous;
+		}
+		const size_t size = std::max(_bytes, previous * 2);
+
+		Block& block = this->blocks.emplace_back();
+		block.memory = std::make_unique_for_overwrite<std::byte[]>(size);
+		block.size = size;
+		this->offset = 0;
+	}
+} // namespace Framework::Memory
@@ -0,0 +1,304 @@
+﻿/** @file   Profiler.cpp
+ *  @brief  CPU プロファイラの実装
+ *  @date   2026/10/18
+ */
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "Include/Framework/Utils/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+namespace Framework::Profiler
+{
+	//-----------------------------------------------------------------------------
+	// Local Helpers
+	//-----------------------------------------------------------------------------
+	namespace
+	{
+		/** @struct ZoneEvent
+		 *  @brief 記録したゾーン 1 件
+		 */
+		struct ZoneEvent
+		{
+			const char* name = nullptr;		///< ゾーン名
+			Clock::time_point begin{};		///< 開始時刻
+			Clock::time_point end{};		///< 終了時刻
+			uint32_t count = 0;				///< まとめた回数（0 なら通常のゾーン）
+		};
+
+		/** @struct ThreadBuffer
+		 *  @brief スレッドごとのリングバッファ（書き込みは持ち主のスレッドだけ）
+		 */
+		struct ThreadBuffer
+		{
+			uint32_t threadIndex = 0;				///< トレース上のスレッド番号
+			const char* threadName = nullptr;		///< スレッド名（無ければ番号で出す）
+			std::vector<ZoneEvent> events;			///< リング本体
+			std::atomic<uint64_t> writeCount{ 0 };	///< 書き込んだ総数（出力側は acquire で読む）
+			std::atomic<uint64_t> generation{ 0 };	///< 最後に書き込んだ記録の世代（古ければ出力しない）
+		};
+
+		std::atomic<bool> capturing{ false };						///< 記録中か
+		std::atomic<uint64_t> captureGeneration{ 0 };				///< BeginCapture のたびに進む（古い記録を捨てる目印）
+		Clock::time_point captureOrigin{};							///< 記録開始時刻（トレースの 0）
+
+		std::mutex registryMutex;									///< バッファ登録用（登録時だけロックする）
+		std::vector<std::unique_ptr<ThreadBuffer>> registry;		///< 全スレッドのバッファ（スレッド終了後も残す）
+
+		thread_local ThreadBuffer* localBuffer = nullptr;			///< このスレッドのバッファ
+
+		/** @brief このスレッドのバッファを取得する（初回だけ登録する）
+		 *  @return バッファ
+		 */
+		static ThreadBuffer& GetThreadBuffer()
+		{
+			if (!localBuffer)
+			{
+				auto buffer = std::make_unique<ThreadBuffer>();
+				buffer->events.resize(Config::ThreadRingCapacity);
+
+				std::lock_guard<std::mutex> lock(registryMutex);
+				buffer->threadIndex = static_cast<uint32_t>(registry.size());
+				localBuffer = buffer.get();
+				registry.push_back(std::move(buffer));
+			}
+
+			// 新しい記録が始まっていたら自分の分を空にする（他スレッドのバッファには触らない）
+			const uint64_t generation = captureGeneration.load(std::memory_order_acquire);
+			if (localBuffer->generation.load(std::memory_order_relaxed) != generation)
+			{
+				localBuffer->writeCount.store(0, std::memory_order_relaxed);
+				localBuffer->generation.store(generation, std::memory_order_release);
+			}
+			return *localBuffer;
+		}
+
+		/** @brief JSON 文字列として書き出す（MSVC の typeid 名の "class " 等は落とす）
+		 *  @param _ofs 出力先
+		 *  @param _text 文字列
+		 */
+		static void WriteJsonString(std::ofstream& _ofs, std::string_view _text)
+		{
+			for (std::string_view prefix : { "class ", "struct " })
+			{
+				if (_text.substr(0, prefix.size()) == prefix)
+				{
+					_text.remove_prefix(prefix.size());
+					break;
+				}
+			}
+
+			_ofs << '"';
+			for (char c : _text)
+			{
+				switch (c)
+				{
+				case '"':  _ofs << "\\\""; break;
+				case '\\': _ofs << "\\\\"; break;
+				case '\n': _ofs << "\\n";  break;
+				case '\t': _ofs << "\\t";  break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20) { _ofs << ' '; }
+					else { _ofs << c; }
+					break;
+				}
+			}
+			_ofs << '"';
+		}
+
+		/** @brief 記録開始からの経過をマイクロ秒で求める
+		 *  @param _time 時刻
+		 *  @return マイクロ秒
+		 */
+		static double ToTraceMicroseconds(Clock::time_point _time)
+		{
+			return std::chrono::duration<double, std::micro>(_time - captureOrigin).count();
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	// Functions
+	//-----------------------------------------------------------------------------
+	void BeginCapture()
+	{
+		if constexpr (!Config::BuildEnableProfiler) { return; }
+
+		// 世代を進めるだけで、各スレッドは次に書き込むときに自分の分を空にする
+		// （この記録中に書き込まなかったスレッドは世代が古いまま残り、出力されない）
+		captureOrigin = Clock::now();
+		captureGeneration.fetch_add(1, std::memory_order_acq_rel);
+		capturing.store(true, std::memory_order_release);
+	}
+
+	void EndCapture()
+	{
+		capturing.store(false, std::memory_order_release);
+	}
+
+	bool IsCapturing()
+	{
+		if constexpr (!Config::BuildEnableProfiler) { return false; }
+		return capturing.load(std::memory_order_relaxed);
+	}
+
+	void SetThreadName(const char* _name)
+	{
+		if constexpr (!Config::BuildEnableProfiler) { return; }
+		GetThreadBuffer().threadName = _name;
+	}
+
+	void RecordZone(const char* _name, Clock::time_point _begin, Clock::time_point _end, uint32_t _count)
+	{
+		if constexpr (!Config::BuildEnableProfiler) { return; }
+
+		// 記録を止めた後は書かない（出力中のバッファを書き換えないため）
+		if (!IsCapturing()) { return; }
+
+		ThreadBuffer& buffer = GetThreadBuffer();
+		const uint64_t index = buffer.writeCount.load(std::memory_order_relaxed);
+
+		ZoneEvent& event = buffer.events[index % Config::ThreadRingCapacity];
+		event.name = _name;
+		event.begin = _begin;
+		event.end = _end;
+		event.count = _count;
+
+		buffer.writeCount.store(index + 1, std::memory_order_release);
+	}
+
+	bool WriteChromeTrace(const std::string& _path)
+	{
+		if constexpr (!Config::BuildEnableProfiler)
+		{
+			std::cerr << "[Profiler] FRAMEWORK_DISABLE_PROFILER でビルドされているため出力できません" << std::endl;
+			return false;
+		}
+
+		const std::filesystem::path path(_path);
+		if (path.has_parent_path())
+		{
+			std::error_code ec;
+			std::filesystem::create_directories(path.parent_path(), ec);
+		}
+
+		std::ofstream ofs(path, std::ios::trunc);
+		if (!ofs)
+		{
+			std::cerr << "[Profiler] 出力先を開けません : " << _path << std::endl;
+			return false;
+		}
+
+		ofs << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+		bool first = true;
+		uint64_t eventCount = 0;
+		const uint64_t generation = captureGeneration.load(std::memory_order_acquire);
+		std::lock_guard<std::mutex> lock(registryMutex);
+		for (const auto& buffer : registry)
+		{
+			if (buffer->generation.load(std::memory_order_acquire) != generation) { continue; }
+
+			const uint64_t written = buffer->writeCount.load(std::memory_order_acquire);
+			if (written == 0) { continue; }
+
+			// スレッド名
+			if (!first) { ofs << ",\n"; }
+			first = false;
+			ofs << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << buffer->threadIndex << ",\"args\":{\"name\":";
+			if (buffer->threadName) { WriteJsonString(ofs, buffer->threadName); }
+			else { WriteJsonString(ofs, (buffer->threadIndex == 0) ? "Main" : "Worker " + std::to_string(buffer->threadIndex)); }
+			ofs << "}}";
+
+			// 溢れていたら残っている分だけ（古い方から）
+			const uint64_t kept = std::min<uint64_t>(written, Config::ThreadRingCapacity);
+			for (uint64_t i = written - kept; i < written; i++)
+			{
+				const ZoneEvent& event = buffer->events[i % Config::ThreadRingCapacity];
+
+				ofs << ",\n{\"ph\":\"X\",\"cat\":\"cpu\",\"pid\":1,\"tid\":" << buffer->threadIndex << ",\"name\":";
+				WriteJsonString(ofs, event.name ? event.name : "?");
+				ofs << ",\"ts\":" << ToTraceMicroseconds(event.begin)
+					<< ",\"dur\":" << std::chrono::duration<double, std::micro>(event.end - event.begin).count();
+				if (event.count > 0)
+				{
+					ofs << ",\"args\":{\"count\":" << event.count << "}";
+				}
+				ofs << "}";
+			}
+			eventCount += kept;
+		}
+
+		ofs << "\n]}\n";
+		if (!ofs)
+		{
+			std::cerr << "[Profiler] 書き込みに失敗しました : " << _path << std::endl;
+			return false;
+		}
+
+		std::cout << "[Profiler] " << eventCount << " 件のゾーンを出力しました : " << _path << std::endl;
+		return true;
+	}
+
+	//-----------------------------------------------------------------------------
+	// TypeAggregateZone class
+	//-----------------------------------------------------------------------------
+	TypeAggregateZone::TypeAggregateZone(const char* _name)
+	{
+		if constexpr (Config::BuildEnableProfiler)
+		{
+			if (IsCapturing())
+			{
+				this->name = _name;
+				this->begin = Clock::now();
+			}
+		}
+	}
+
+	TypeAggregateZone::~TypeAggregateZone()
+	{
+		if constexpr (Config::BuildEnableProfiler)
+		{
+			if (!this->name) { return; }
+
+			const Clock::time_point end = Clock::now();
+			RecordZone(this->name, this->begin, end);
+
+			// 型ごとの合計をループの開始時刻から順に並べる（時間の長い順）
+			std::sort(this->entries.begin(), this->entries.end(),
+				[](const Entry& _a, const Entry& _b) { return _a.total > _b.total; });
+
+			Clock::time_point cursor = this->begin;
+			for (const auto& entry : this->entries)
+			{
+				RecordZone(entry.typeName, cursor, cursor + entry.total, entry.count);
+				cursor += entry.total;
+			}
+		}
+	}
+
+	void TypeAggregateZone::Add(const std::type_info& _type, Clock::time_point _begin, Clock::time_point _end)
+	{
+		if (!this->name) { return; }
+
+		const std::type_index type(_type);
+		for (auto& entry : this->entries)
+		{
+			if (entry.type == type)
+			{
+				entry.total += _end - _begin;
+				++entry.count;
+				return;
+			}
+		}
+		this->entries.push_back(Entry{ type, _type.name(), _end - _begin, 1 });
+	}
+} // namespace Framework::Profiler
@@ -7,18 +7,125 @@
 // Includes
 //-----------------------------------------------------------------------------
 #include "Include/Framework/Core/Application.h"
+#include "Include/Framework/Graphics/TextureCooker.h"
+#include "Include/Framework/Graphics/MeshOptimizer.h"
+#include "Include/Framework/Physics/ColliderCooker.h"
+#include "Include/Framework/Physics/ContactEventBenchmark.h"
+#include "Include/Framework/Physics/PhysicsReplay.h"
+#include "Include/Framework/Scenes/SceneSnapshot.h"
+#include "Include/Framework/Utils/Profiler.h"
+
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
 
 #pragma comment(lib, "Winmm.lib")
 //-----------------------------------------------------------------------------
 // EntryPoint
 //-----------------------------------------------------------------------------
-int main()
+int main(int argc, char* argv[])
 {
+    // --profile <path> は全ての起動方法で使えるように、先に取り除いてから他の引数を解釈する
+    std::string profilePath;
+    std::vector<char*> args;
+    for (int i = 0; i < argc; i++)
+    {
+        if (i + 1 < argc && std::string(argv[i]) == "--profile")
+        {
+            profilePath = argv[++i];
+            continue;
+        }
+        args.push_back(argv[i]);
+    }
+    argc = static_cast<int>(args.size());
+    argv = args.data();
+
+    // 終了時に記録を止めてトレースを書き出す
+    struct ProfileCapture
+    {
+        const std::string& path;
+        ~ProfileCapture()
+        {
+            if (this->path.empty()) { return; }
+            Framework::Profiler::EndCapture();
+            Framework::Profiler::WriteChromeTrace(this->path);
+        }
+    } profileCapture{ profilePath };
+
+    if (!profilePath.empty())
+    {
+        Framework::Profiler::SetThreadName("Main");
+        Framework::Profiler::BeginCapture();
+    }
+
+    // --cook-textures / --bench-contacts / --replay-physics 等の場合はウィンドウを作らずにその処理だけ行う
+    int exitCode = 0;
+    if (Graphics::TextureCooker::RunCommandLine(argc, argv, exitCode))
+    {
+        return exitCode;
+    }
+    if (Graphics::Import::MeshOptimizer::RunCommandLine(argc, argv, exitCode))
+    {
+        return exitCode;
+    }
+    if (Framework::Physics::ColliderCooker::RunCommandLine(argc, argv, exitCode))
+    {
+        return exitCode;
+    }
+    if (Framework::Physics::ContactEventBenchmark::RunCommandLine(argc, argv, exitCode))
+    {
+        return exitCode;
+    }
+    if (Framework::Physics::PhysicsReplay::RunCommandLine(argc, argv, exitCode))
+    {
+        return exitCode;
+    }
+    if (SceneSnapshot::RunCommandLine(argc, argv, exitCode))
+    {
+        return exitCode;
+    }
+
     Application::AppConfig config = {
         1280,
         720,
     };
 
+    // --record-physics <path> で物理ログを記録しながら起動する
+    // --record-input <path> で入力を記録しながら起動する
+    // --replay-input <path> で記録した入力と経過時間でゲームを進め、最後まで再生したら終了する（--fps 0 と組み合わせるとベンチマークになる）
+    // --fps <n> で目標フレームレートを変える（0 なら待たない）
+    // --profile <path> で終了時に Chrome トレース形式の JSON を書き出す（どの起動方法でも使える）
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string(argv[i]) == "--record-physics")
+        {
+            config.physicsRecordPath = argv[i + 1];
+        }
+        else if (std::string(argv[i]) == "--record-input")
+        {
+            config.inputRecordPath = argv[i + 1];
+        }
+        else if (std::string(argv[i]) == "--replay-input")
+        {
+            config.inputReplayPath = argv[i + 1];
+        }
+        else if (std::string(argv[i]) == "--fps")
+        {
+            // 数値でなければ既定値のまま起動する
+            const char* text = argv[i + 1];
+            uint32_t fps = 0;
+            const auto [end, error] = std::from_chars(text, text + std::strlen(text), fps);
+            if (error != std::errc() || *end != '\0')
+            {
+                std::cerr << "[main] --fps の値が不正です : " << text << "（" << config.targetFps << " で起動します）" << std::endl;
+                continue;
+            }
+            config.targetFps = fps;
+        }
+    }
+
     Application application(config);
     application.Run();
     return 0;
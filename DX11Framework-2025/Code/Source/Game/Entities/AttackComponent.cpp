@@ -89,7 +89,8 @@ void AttackComponent::Update(float _deltaTime)
 		this->animationComponent->GetCurrentClip();
 	if (!currentClip) { return; }
 
-	if (currentClip->keyName != this->currentAttackDef.attackClip)
+	// 同じ内容のクリップはキー間で共有されるので、キー名ではなくポインタで比べる
+	if (currentClip != this->animClipManager->Get(this->currentAttackDef.attackClip))
 	{
 		this->clipEventWatcher.Reset(
 			this->animationComponent->GetNormalizedTime());
@@ -79,13 +79,13 @@ void CharacterController::Initialize()
 	//-----------------------------------------------------------------------------
 	// キーバインドの登録（暫定）
 	//-----------------------------------------------------------------------------
-	this->inputSystem.RegisterKeyBinding("MoveForward", static_cast<int>(DirectInputDevice::KeyboardKey::W));
-	this->inputSystem.RegisterKeyBinding("MoveBackward", static_cast<int>(DirectInputDevice::KeyboardKey::S));
-	this->inputSystem.RegisterKeyBinding("MoveLeft", static_cast<int>(DirectInputDevice::KeyboardKey::A));
-	this->inputSystem.RegisterKeyBinding("MoveRight", static_cast<int>(DirectInputDevice::KeyboardKey::D));
+	this->moveForwardAction = this->inputSystem.RegisterKeyBinding("MoveForward", static_cast<int>(DirectInputDevice::KeyboardKey::W));
+	this->moveBackwardAction = this->inputSystem.RegisterKeyBinding("MoveBackward", static_cast<int>(DirectInputDevice::KeyboardKey::S));
+	this->moveLeftAction = this->inputSystem.RegisterKeyBinding("MoveLeft", static_cast<int>(DirectInputDevice::KeyboardKey::A));
+	this->moveRightAction = this->inputSystem.RegisterKeyBinding("MoveRight", static_cast<int>(DirectInputDevice::KeyboardKey::D));
 
-	this->inputSystem.RegisterKeyBinding("Punch", static_cast<int>(DirectInputDevice::MouseButton::Left));
-	this->inputSystem.RegisterKeyBinding("Dodge", static_cast<int>(DirectInputDevice::MouseButton::Right));
+	this->punchAction = this->inputSystem.RegisterKeyBinding("Punch", static_cast<int>(DirectInputDevice::MouseButton::Left));
+	this->dodgeAction = this->inputSystem.RegisterKeyBinding("Dodge", static_cast<int>(DirectInputDevice::MouseButton::Right));
 
 	//-----------------------------------------------------------------------------
 	// 攻撃定義（テスト用）
@@ -121,10 +121,10 @@ void CharacterController::Update(float _deltaTime)
 	float inputX = 0.0f;
 	float inputZ = 0.0f;
 
-	if (this->inputSystem.IsActionPressed("MoveForward")) { inputZ += 1.0f; }
-	if (this->inputSystem.IsActionPressed("MoveBackward")) { inputZ -= 1.0f; }
-	if (this->inputSystem.IsActionPressed("MoveLeft")) { inputX -= 1.0f; }
-	if (this->inputSystem.IsActionPressed("MoveRight")) { inputX += 1.0f; }
+	if (this->inputSystem.IsActionPressed(this->moveForwardAction)) { inputZ += 1.0f; }
+	if (this->inputSystem.IsActionPressed(this->moveBackwardAction)) { inputZ -= 1.0f; }
+	if (this->inputSystem.IsActionPressed(this->moveLeftAction)) { inputX -= 1.0f; }
+	if (this->inputSystem.IsActionPressed(this->moveRightAction)) { inputX += 1.0f; }
 
 	//-----------------------------------------------------------------------------
 	// 移動指示（毎フレーム適用）
@@ -235,14 +235,14 @@ void CharacterController::StateUpdate(float _deltaTime)
 	switch (this->currentState)
 	{
 	case CharacterController::PlayerState::Normal:
-		if (this->inputSystem.IsActionTriggered("Dodge"))
+		if (this->inputSystem.IsActionTriggered(this->dodgeAction))
 		{
 			std::cout << "DODGE\n";
 			this->currentState = PlayerState::Dodging;
 			break;
 		}
 
-		if (this->inputSystem.IsActionTriggered("Punch"))
+		if (this->inputSystem.IsActionTriggered(this->punchAction))
 		{
 			std::cout << "PUNCH\n";
 			this->currentState = PlayerState::Attacking;
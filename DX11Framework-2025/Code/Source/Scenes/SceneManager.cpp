@@ -33,10 +33,20 @@ void SceneManager::Update(float _deltaTime)
 	// 遷移フラグが立っていればシーン切り替えを行う
 	if (this->isTransitioning)
 	{
-		this->CompleteTransition();
+		this->ReportTransitionProgress();
+
+		// 読み込みが終わるまでは旧シーンを動かし続ける（待つ設定なら CompleteTransition で待つ）
+		if (!this->isBlockingTransition && !this->preloader.IsReady())
+		{
+			if (this->currentScene && this->isSceneInitialized)
+			{
+				this->currentScene->Update(_deltaTime);
+			}
+			return;
+		}
 
-		// 旧シーンのUpdateをスキップ
-		return; 
+		// 読み込みが終わったら、このフレームのうちに新シーンへ切り替えて動かす
+		this->CompleteTransition();
 	}
 
 	if (this->currentScene)
@@ -55,7 +65,8 @@ void SceneManager::Update(float _deltaTime)
 /// @brief	シーンの描画を行う
 void SceneManager::Draw()
 {
-	if (this->isTransitioning || !this->isSceneInitialized) { return; }
+	// 遷移中も読み込みが終わるまでは旧シーンを描画する
+	if (!this->isSceneInitialized) { return; }
 
 	if (this->currentScene)
 	{
@@ -97,6 +108,14 @@ void SceneManager::SetTransitionCallback(std::function<void(SceneType)> _callbac
 	this->onTransitionBegin = std::move(_callback);
 }
 
+/**	@brief	遷移先のリソース読み込みの進み具合を受け取るコールバック設定を行う
+ *	@param	std::function<void(SceneType, float)> _callback	遷移先と進み具合を受け取るコールバック
+ */
+void SceneManager::SetTransitionProgressCallback(std::function<void(SceneType, float)> _callback)
+{
+	this->onTransitionProgress = std::move(_callback);
+}
+
 /**	@brief	遷移開始処理を行うためのラッパー関数
  *	@param	SceneType _nextSceneType	次のシーンタイプ
  */
@@ -117,7 +136,10 @@ void SceneManager::BeginTransition(SceneType _nextSceneType)
 	this->pendingSceneType = _nextSceneType;
 	this->isTransitioning = true;
 
-	this->isSceneInitialized = false;
+	// 遷移先のリソースをバックグラウンドで読み込み始める（旧シーンは切り替えまで動かす）
+	const SceneManifest* manifest = this->sceneFactory ? this->sceneFactory->GetManifest(_nextSceneType) : nullptr;
+	this->preloader.Start(manifest ? *manifest : SceneManifest{});
+	this->reportedProgress = -1.0f;
 }
 
 /// @brief Factoryを使ってシーン生成・切り替えを行う
@@ -134,12 +156,16 @@ void SceneManager::CompleteTransition()
 
 	if (newScene)
 	{
+		// 先読みしたリソースを登録する（新シーンの SetupObjects の Register は登録済みのものを返すだけになる）
+		this->preloader.Commit();
+
 		// シーンの終了処理
 		if (this->currentScene) { this->currentScene->Finalize(); }
 
 		// シーンを切り替える
 		this->currentScene = std::move(newScene);
 		this->currentSceneType = this->pendingSceneType;
+		this->isSceneInitialized = false;
 	}
 	this->isTransitioning = false;
 
@@ -150,6 +176,18 @@ void SceneManager::CompleteTransition()
 	}
 }
 
+/// @brief 読み込みの進み具合を通知する
+void SceneManager::ReportTransitionProgress()
+{
+	if (!this->onTransitionProgress) { return; }
+
+	const float progress = this->preloader.GetProgress();
+	if (progress == this->reportedProgress) { return; }
+
+	this->reportedProgress = progress;
+	this->onTransitionProgress(this->pendingSceneType, progress);
+}
+
 /// @brief 終了処理
 void SceneManager::Dispose()
 {
@@ -161,4 +199,5 @@ void SceneManager::Dispose()
 	this->sceneFactory.reset();
 	this->onTransitionBegin = nullptr;
 	this->onTransitionEnd = nullptr;
+	this->onTransitionProgress = nullptr;
 }
\ No newline at end of file
@@ -243,6 +243,14 @@ void TestScene::SpawnManyBoxes(const int _countX, const int _countZ, const float
 		DX::Color(0,0,1,1)
 	};
 
+	// 色ごとに 1 枚だけ作って全ボックスで共有する（シーンが参照を保持する）
+	std::array<std::shared_ptr<TextureResource>, 3> colorTextures{};
+	for (size_t i = 0; i < colors.size(); ++i)
+	{
+		colorTextures[i] = TextureFactory::AcquireSolidColorTexture(device, colors[i]);
+		this->groupTextures.push_back(colorTextures[i]);
+	}
+
 	//==============================================================
 	// 生成範囲の中心計算
 	//==============================================================
@@ -294,9 +302,7 @@ void TestScene::SpawnManyBoxes(const int _countX, const int _countZ, const float
 			int groupId = index % 3 + 1;
 			std::string groupName = "EnemyGroup_" + std::to_string(groupId);
 
-			auto tex = TextureFactory::CreateSolidColorTexture(device, colors[groupId - 1]);
-			TextureResource* raw = tex.release();
-			matComp->SetTexture(raw);
+			matComp->SetTexture(colorTextures[groupId - 1].get());
 
 			index++;
 		}
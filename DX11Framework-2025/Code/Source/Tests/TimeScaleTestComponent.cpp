@@ -33,10 +33,10 @@ void TimeScaleTestComponent::Initialize()
 	// ------------------------------------------------------
 	// キーバインドの登録
 	// ------------------------------------------------------
-	this->inputSystem.RegisterKeyBinding("Slow_Global", static_cast<int>(DirectInputDevice::KeyboardKey::Space));
-	this->inputSystem.RegisterKeyBinding("Slow_GameObject_1", static_cast<int>(DirectInputDevice::KeyboardKey::J));
-	this->inputSystem.RegisterKeyBinding("Slow_GameObject_2", static_cast<int>(DirectInputDevice::KeyboardKey::K));
-	this->inputSystem.RegisterKeyBinding("Slow_GameObject_3", static_cast<int>(DirectInputDevice::KeyboardKey::L));
+	this->slowGlobalAction = this->inputSystem.RegisterKeyBinding("Slow_Global", static_cast<int>(DirectInputDevice::KeyboardKey::Space));
+	this->slowObjectActions[0] = this->inputSystem.RegisterKeyBinding("Slow_GameObject_1", static_cast<int>(DirectInputDevice::KeyboardKey::J));
+	this->slowObjectActions[1] = this->inputSystem.RegisterKeyBinding("Slow_GameObject_2", static_cast<int>(DirectInputDevice::KeyboardKey::K));
+	this->slowObjectActions[2] = this->inputSystem.RegisterKeyBinding("Slow_GameObject_3", static_cast<int>(DirectInputDevice::KeyboardKey::L));
 }
 
 /// @brief 終了処理
@@ -49,23 +49,20 @@ void TimeScaleTestComponent::Dispose()
 void TimeScaleTestComponent::Update(float _deltaTime)
 {
 	// スペースキーでグローバルタイムスケールを0.1に変更する
-	if (this->inputSystem.IsActionPressed("Slow_Global"))
+	if (this->inputSystem.IsActionPressed(this->slowGlobalAction))
 	{
 		this->timeScaleSystem.SetGlobalScale(0.3f);
 	}
 	else { this->timeScaleSystem.SetGlobalScale(1.0f); }
 
 	// 1～3キーで各ゲームオブジェクトのタイムスケールを0.1に変更する
-	for (int i = 1; i <= 3; i++)
+	for (InputActionId action : this->slowObjectActions)
 	{
-		std::string actionName = "Slow_GameObject_" + std::to_string(i);
-		std::string groupName = "EnemyGroup_" + std::to_string(i);
-
-		if (this->inputSystem.IsActionTriggered(actionName))
+		if (this->inputSystem.IsActionTriggered(action))
 		{
 			this->timeScaleSystem.RequestEvent(TimeScaleEventId::JustDodge);
 		}
-		if (this->inputSystem.isActionReleased(actionName))
+		if (this->inputSystem.isActionReleased(action))
 		{
 			this->timeScaleSystem.RequestEvent(TimeScaleEventId::JustDodge);
 		}